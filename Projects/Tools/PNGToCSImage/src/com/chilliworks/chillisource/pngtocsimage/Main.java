@@ -132,6 +132,12 @@ public class Main
 				options.bDither = true;
 			}
 			
+			//mip maps
+			else if(arguments[i].equalsIgnoreCase("-m") == true || arguments[i].equalsIgnoreCase("--mipmaps") == true)
+			{
+				options.bMipMaps = true;
+			}
+			
 			//help
 			else if(arguments[i].equalsIgnoreCase("-h") == true || arguments[i].equalsIgnoreCase("--help") == true)
 			{
@@ -175,7 +181,7 @@ public class Main
 	private static void PrintHelpText()
 	{
 		Logging.setLoggingLevel(LoggingLevel.VERBOSE);
-		Logging.logVerbose("Usage: java -jar PNGToCSImage.jar --input <filename> --output <filename> [--convert <type>] [--convertalpha <type>] [--convertnoalpha <type>] [--compression <type>] [--disablepremultipliedalpha] [--dither] [" + Logging.PARAM_LOGGING_LEVEL + " <level>] [--help]");
+		Logging.logVerbose("Usage: java -jar PNGToCSImage.jar --input <filename> --output <filename> [--convert <type>] [--convertalpha <type>] [--convertnoalpha <type>] [--compression <type>] [--disablepremultipliedalpha] [--dither] [--mipmaps] [" + Logging.PARAM_LOGGING_LEVEL + " <level>] [--help]");
 		Logging.logVerbose("Parameters:");
 		Logging.logVerbose(" --input(-i): The path to the source image PNG.");
 		Logging.logVerbose(" --output(-o): The path to the output image csimage.");
@@ -185,6 +191,7 @@ public class Main
 		Logging.logVerbose(" --compression(-cn): [Optional] The compression type. The default is zlib compression.");
 		Logging.logVerbose(" --disablepremultipliedalpha(-dpa): [Optional] If set the output image will not have it's alpha premultiplied.");
 		Logging.logVerbose(" --dither(-d): [Optional] Whether or not to dither if converting to a smaller image format.");
+		Logging.logVerbose(" --mipmaps(-m): [Optional] Whether or not to precompute the image's mip levels. The image dimensions must be a power of two.");
 		Logging.logVerbose(" " + Logging.PARAM_LOGGING_LEVEL + "(" + Logging.SHORT_PARAM_LOGGING_LEVEL + "): [Optional] Sets the level of message to log.");
 		Logging.logVerbose(" --help(-h): [Optional] Display this help message.");
 		Logging.logVerbose("Conversion Types:");
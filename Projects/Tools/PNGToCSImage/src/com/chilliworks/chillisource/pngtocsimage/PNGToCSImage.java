@@ -49,6 +49,9 @@ import com.chilliworks.chillisource.coreutils.Logging;
 ///
 /// 2 - First release version, no comporession @auther SDownie
 /// 3 - Added default zlib comporession @author RHenning
+/// 4 - Added optional precomputed mip levels, each compressed separately and
+///     stored smallest first. Images without mip levels are still output as
+///     version 3.
 //============================================================================
 public class PNGToCSImage 
 {
@@ -56,6 +59,7 @@ public class PNGToCSImage
 	/// Constants
 	//------------------------------------------------------------------------
 	private final static int kdwVersion = 3;
+	private final static int kdwMipMappedVersion = 4;
 	
 	private static long mPNGFileSize = 0;
 	
@@ -145,7 +149,14 @@ public class PNGToCSImage
 		Logging.logVerbose("Building Image Data...");
 		PNGToCSImageOptions.OUTPUT_FORMAT imageFormat = GetOutputFormat(inOptions, image);
 		boolean bDithering = inOptions.bDither;
-		byte[] outImageData = ConvertImageToFormat(image, imageFormat, bDithering);
+		
+		if(inOptions.bMipMaps == true)
+		{
+			RunMipMapped(inOptions, image, imageFormat);
+			return;
+		}
+		
+		byte[] outImageData = ConvertImageToFormat(image, imageFormat, bDithering, false);
 		if(outImageData == null)
 		{
 			throw new CSException("Cannot convert image to format: " + inOptions.strInputFilename + ", " + imageFormat);
@@ -189,6 +200,149 @@ public class PNGToCSImage
 		}
 	}
 	//------------------------------------------------------------------------
+	/// Run Mip Mapped
+	///
+	/// Converts the image and a precomputed chain of mip levels down to 1x1
+	/// to the given format and outputs them as a version 4 csimage. Each level
+	/// is compressed separately so the smaller levels can be read without
+	/// inflating the larger ones.
+	//------------------------------------------------------------------------
+	private static void RunMipMapped(PNGToCSImageOptions inOptions, ImageContainer inImage, PNGToCSImageOptions.OUTPUT_FORMAT inFormat) throws CSException
+	{
+		if(IsPowerOfTwo(inImage.dwWidth) == false || IsPowerOfTwo(inImage.dwHeight) == false)
+		{
+			throw new CSException("Cannot generate mip levels for an image with dimensions that are not a power of two: " + inOptions.strInputFilename);
+		}
+		
+		int dwNumMipLevels = 1;
+		while((inImage.dwWidth >> dwNumMipLevels) > 0 || (inImage.dwHeight >> dwNumMipLevels) > 0)
+		{
+			++dwNumMipLevels;
+		}
+		
+		byte[][] aabyMipLevelData = new byte[dwNumMipLevels][];
+		long[] addwChecksums = new long[dwNumMipLevels];
+		int[] adwOriginalDataSizes = new int[dwNumMipLevels];
+		
+		//all levels are generated before conversion, as dithering modifies the source image.
+		ImageContainer[] aMipLevels = new ImageContainer[dwNumMipLevels];
+		aMipLevels[0] = inImage;
+		for(int i = 1; i < dwNumMipLevels; ++i)
+		{
+			aMipLevels[i] = GenerateMipLevel(aMipLevels[i - 1]);
+		}
+		
+		for(int i = 0; i < dwNumMipLevels; ++i)
+		{
+			byte[] abyMipLevelData = ConvertImageToFormat(aMipLevels[i], inFormat, inOptions.bDither, i > 0);
+			if(abyMipLevelData == null)
+			{
+				throw new CSException("Cannot convert image to format: " + inOptions.strInputFilename + ", " + inFormat);
+			}
+			
+			CRC32 checksum = new CRC32();
+			checksum.update(abyMipLevelData);
+			addwChecksums[i] = checksum.getValue();
+			adwOriginalDataSizes[i] = abyMipLevelData.length;
+			
+			if (inOptions.eCompressionType != PNGToCSImageOptions.COMPRESSION_FORMAT.NONE)
+			{
+				try
+				{
+					abyMipLevelData = CompressImage(inOptions, abyMipLevelData);
+				}
+				catch (IOException e)
+				{
+					throw new CSException("Cannot compress mip level " + i + ".", e);
+				}
+			}
+			
+			aabyMipLevelData[i] = abyMipLevelData;
+		}
+		Logging.logVerbose("Building Image Data Complete");
+		
+		try 
+		{
+			Logging.logVerbose("Outputting CSImage...");
+			String strOutputFile = inOptions.strOutputFilename;
+			Logging.logVerbose("Output File: " + strOutputFile);
+			OutputMipMappedMoImage(aabyMipLevelData, addwChecksums, adwOriginalDataSizes, inFormat, inOptions.eCompressionType, inImage.dwWidth, inImage.dwHeight, strOutputFile);
+			Logging.logVerbose("Outputting CSImage Complete");
+		} 
+		catch (IOException e) 
+		{
+			String ioErrorMessage = e.getMessage();
+			if (ioErrorMessage != null)
+			{
+			    throw new CSException("Cannot output csimage file: " + ioErrorMessage, e);
+			}
+			else
+			{
+			    throw new CSException("Cannot output csimage file.", e);
+			}
+		}
+	}
+	//------------------------------------------------------------------------
+	/// Is Power Of Two
+	///
+	/// @return Whether or not the given value is a power of two.
+	//------------------------------------------------------------------------
+	private static boolean IsPowerOfTwo(int indwValue)
+	{
+		return indwValue > 0 && (indwValue & (indwValue - 1)) == 0;
+	}
+	//------------------------------------------------------------------------
+	/// Generate Mip Level
+	///
+	/// Generates the next mip level of the given image using a box filter.
+	/// The image data should already have its alpha premultiplied if
+	/// required, so that colour does not bleed from transparent pixels.
+	//------------------------------------------------------------------------
+	private static ImageContainer GenerateMipLevel(ImageContainer inImage)
+	{
+		ImageContainer mipLevel = new ImageContainer();
+		mipLevel.dwWidth = Math.max(inImage.dwWidth / 2, 1);
+		mipLevel.dwHeight = Math.max(inImage.dwHeight / 2, 1);
+		mipLevel.dwType = inImage.dwType;
+		mipLevel.bHasAlpha = inImage.bHasAlpha;
+		mipLevel.adwImageData = new int[mipLevel.dwWidth * mipLevel.dwHeight];
+		
+		for (int y = 0; y < mipLevel.dwHeight; ++y)
+		{
+			int dwY0 = Math.min(y * 2, inImage.dwHeight - 1);
+			int dwY1 = Math.min(y * 2 + 1, inImage.dwHeight - 1);
+			
+			for (int x = 0; x < mipLevel.dwWidth; ++x)
+			{
+				int dwX0 = Math.min(x * 2, inImage.dwWidth - 1);
+				int dwX1 = Math.min(x * 2 + 1, inImage.dwWidth - 1);
+				
+				int[] adwSamples = 
+				{
+					inImage.adwImageData[dwX0 + dwY0 * inImage.dwWidth],
+					inImage.adwImageData[dwX1 + dwY0 * inImage.dwWidth],
+					inImage.adwImageData[dwX0 + dwY1 * inImage.dwWidth],
+					inImage.adwImageData[dwX1 + dwY1 * inImage.dwWidth]
+				};
+				
+				int dwCombined = 0;
+				for (int dwShift = 0; dwShift < 32; dwShift += 8)
+				{
+					int dwSum = 0;
+					for (int dwSample : adwSamples)
+					{
+						dwSum += (dwSample >>> dwShift) & 0xFF;
+					}
+					dwCombined |= ((dwSum + 2) / 4) << dwShift;
+				}
+				
+				mipLevel.adwImageData[x + y * mipLevel.dwWidth] = dwCombined;
+			}
+		}
+		
+		return mipLevel;
+	}
+	//------------------------------------------------------------------------
 	/// Load PNG
 	///
 	/// Loads the given PNG.
@@ -357,9 +511,10 @@ public class PNGToCSImage
 	//------------------------------------------------------------------------
 	/// Convert Image To Format
 	///
-	/// Converts the image to the  requested output format.
+	/// Converts the image to the  requested output format. Mip levels are
+	/// uploaded tightly packed so may have an odd width in any format.
 	//------------------------------------------------------------------------
-	private static byte[] ConvertImageToFormat(ImageContainer inImage, PNGToCSImageOptions.OUTPUT_FORMAT inFormatFlag, boolean inbDither)
+	private static byte[] ConvertImageToFormat(ImageContainer inImage, PNGToCSImageOptions.OUTPUT_FORMAT inFormatFlag, boolean inbDither, boolean inbIsMipLevel)
 	{
 		switch (inFormatFlag)
 		{
@@ -368,14 +523,14 @@ public class PNGToCSImage
 		case LA88:
 			return ConvertToLA88(inImage);
 		case RGB565:
-			if(inImage.dwWidth % 2 > 0)
+			if(inImage.dwWidth % 2 > 0 && inbIsMipLevel == false)
 			{
 				Logging.logError("Cannot convert an image that is not divisible by 2 to RGB565 Format.");
 				return null;
 			}
 			return ConvertToRGB565(inImage, inbDither);
 		case RGBA4444:
-			if(inImage.dwWidth % 2 > 0)
+			if(inImage.dwWidth % 2 > 0 && inbIsMipLevel == false)
 			{
 				Logging.logError("Cannot convert an image that is not divisible by 2 to RGBA4444 Format.");
 				return null;
@@ -761,6 +916,94 @@ public class PNGToCSImage
 		Logging.logVerbose("CSImage File Size: " + Math.ceil((float)imageFile.length() / (float)1024) + " KB");
 		Logging.logVerbose("");
 	}
+	//------------------------------------------------------------------------
+	/// Output Mip Mapped MoImage
+	///
+	/// Outputs the generated mip levels to a version 4 csimage file.
+	//------------------------------------------------------------------------
+	private static void OutputMipMappedMoImage(byte[][] inaabyMipLevelData,
+											   long[] inaddwChecksums, int[] inadwOriginalSizes,
+											   PNGToCSImageOptions.OUTPUT_FORMAT inFormat,
+											   PNGToCSImageOptions.COMPRESSION_FORMAT inCompression,
+											   int inWidth, int inHeight,
+											   String instrOutputFile) throws IOException
+	{
+		if(instrOutputFile == null)
+		{
+			throw new IOException();
+		}
+
+		///Apply the header
+		// Byte order check - int
+		// Version - int
+		// Width - int
+		// Height - int
+		// Format - int
+		// Compression - int
+		// Number of mip levels - int
+		// For each mip level, largest first:
+		//     Checksum (CRC32) - long
+		//     Uncompressed data size - int
+		//     Final data size - int
+		//     Offset of the data from the start of the file - int
+		// The mip level data, smallest first
+		int byteOrderCheck = 123456;
+		int version = kdwMipMappedVersion;
+		int compression = 0;
+		if(inCompression == PNGToCSImageOptions.COMPRESSION_FORMAT.DEFAULT_ZLIB)
+			compression = 1;
+		
+		int dwNumMipLevels = inaabyMipLevelData.length;
+		int[] adwOffsets = new int[dwNumMipLevels];
+		int dwOffset = 7 * 4 + dwNumMipLevels * (8 + 3 * 4);
+		for(int i = dwNumMipLevels - 1; i >= 0; --i)
+		{
+			adwOffsets[i] = dwOffset;
+			dwOffset += inaabyMipLevelData[i].length;
+		}
+		
+		//Write out the data
+		FileOutputStream fileStream = new FileOutputStream(instrOutputFile);
+		WriteInt(fileStream, byteOrderCheck);
+		WriteInt(fileStream, version);
+		WriteInt(fileStream, inWidth);
+		WriteInt(fileStream, inHeight);
+		WriteInt(fileStream, inFormat.ordinal());
+		WriteInt(fileStream, compression);
+		WriteInt(fileStream, dwNumMipLevels);
+		
+		int dwOriginalSize = 0;
+		for(int i = 0; i < dwNumMipLevels; ++i)
+		{
+			WriteLong(fileStream, inaddwChecksums[i]);
+			WriteInt(fileStream, inadwOriginalSizes[i]);
+			WriteInt(fileStream, inaabyMipLevelData[i].length);
+			WriteInt(fileStream, adwOffsets[i]);
+			dwOriginalSize += inadwOriginalSizes[i];
+		}
+		
+		for(int i = dwNumMipLevels - 1; i >= 0; --i)
+		{
+			fileStream.write(inaabyMipLevelData[i]);
+		}
+		fileStream.close();
+		
+		Logging.logVerbose("Completed writting file with header:\n\tOrderCheck:"+byteOrderCheck
+																+"\n\tVersion:"+version
+																+"\n\tWidth:"+inWidth
+																+"\n\tHeight:"+inHeight
+																+"\n\tFormat:"+inFormat.ordinal()
+																+"\n\tCompression:"+compression
+																+"\n\tMipLevels:"+dwNumMipLevels
+																+"\n\tOriginalSize:"+dwOriginalSize);
+		
+		File imageFile = new File(instrOutputFile);
+		Logging.logVerbose("CSImage: " + instrOutputFile);
+		Logging.logVerbose("PNG File Size: " + Math.ceil((float)mPNGFileSize / (float)1024) + " KB");
+		Logging.logVerbose("CSImage Uncompressed Size: " + Math.ceil((float)dwOriginalSize / (float)1024) + " KB");
+		Logging.logVerbose("CSImage File Size: " + Math.ceil((float)imageFile.length() / (float)1024) + " KB");
+		Logging.logVerbose("");
+	}
 	//-------------------------------------------------------
 	/// Write Integer
 	///
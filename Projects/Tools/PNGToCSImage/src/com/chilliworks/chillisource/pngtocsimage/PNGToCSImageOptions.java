@@ -60,4 +60,5 @@ public class PNGToCSImageOptions
 	public COMPRESSION_FORMAT eCompressionType = COMPRESSION_FORMAT.DEFAULT_ZLIB;
 	public boolean bPremultiply = true;
 	public boolean bDither = false;
+	public boolean bMipMaps = false;
 }
@@ -35,6 +35,8 @@
 #include <CSBackend/Rendering/OpenGL/Target/GLTargetGroup.h>
 #include <CSBackend/Rendering/OpenGL/Texture/GLTexture.h>
 
+#include <ChilliSource/Core/Base/Application.h>
+#include <ChilliSource/Rendering/Base/RenderCapabilities.h>
 #include <ChilliSource/Rendering/Model/IndexFormat.h>
 #include <ChilliSource/Rendering/Model/PolygonType.h>
 #include <ChilliSource/Rendering/Model/RenderDynamicMesh.h>
@@ -58,9 +60,11 @@
 #include <ChilliSource/Rendering/RenderCommand/Commands/LoadTargetGroupRenderCommand.h>
 #include <ChilliSource/Rendering/RenderCommand/Commands/LoadTextureRenderCommand.h>
 #include <ChilliSource/Rendering/RenderCommand/Commands/RenderInstanceRenderCommand.h>
+#include <ChilliSource/Rendering/RenderCommand/Commands/RenderInstancesRenderCommand.h>
 #include <ChilliSource/Rendering/RenderCommand/Commands/RestoreMeshRenderCommand.h>
 #include <ChilliSource/Rendering/RenderCommand/Commands/RestoreRenderTargetGroupCommand.h>
 #include <ChilliSource/Rendering/RenderCommand/Commands/RestoreTextureRenderCommand.h>
+#include <ChilliSource/Rendering/RenderCommand/Commands/StreamTextureRenderCommand.h>
 #include <ChilliSource/Rendering/RenderCommand/Commands/UnloadMaterialGroupRenderCommand.h>
 #include <ChilliSource/Rendering/RenderCommand/Commands/UnloadMeshRenderCommand.h>
 #include <ChilliSource/Rendering/RenderCommand/Commands/UnloadShaderRenderCommand.h>
@@ -136,7 +140,7 @@ namespace CSBackend
             
             for(const auto& renderCommandList : renderCommandBuffer->GetQueue())
             {
-                for (const auto& renderCommand : renderCommandList->GetOrderedList())
+                for (const auto renderCommand : *renderCommandList)
                 {
                     switch (renderCommand->GetType())
                     {
@@ -146,6 +150,9 @@ namespace CSBackend
                         case ChilliSource::RenderCommand::Type::k_loadTexture:
                             LoadTexture(static_cast<const ChilliSource::LoadTextureRenderCommand*>(renderCommand));
                             break;
+                        case ChilliSource::RenderCommand::Type::k_streamTexture:
+                            StreamTexture(static_cast<const ChilliSource::StreamTextureRenderCommand*>(renderCommand));
+                            break;
                         case ChilliSource::RenderCommand::Type::k_loadMaterialGroup:
                             // Do nothing in OpenGL 2.0 / ES 2.0
                             break;
@@ -200,6 +207,9 @@ namespace CSBackend
                         case ChilliSource::RenderCommand::Type::k_renderInstance:
                             RenderInstance(static_cast<const ChilliSource::RenderInstanceRenderCommand*>(renderCommand));
                             break;
+                        case ChilliSource::RenderCommand::Type::k_renderInstances:
+                            RenderInstances(static_cast<const ChilliSource::RenderInstancesRenderCommand*>(renderCommand));
+                            break;
                         case ChilliSource::RenderCommand::Type::k_end:
                             End();
                             break;
@@ -233,6 +243,11 @@ namespace CSBackend
             {
                 m_glDynamicMesh->Invalidate();
             }
+            
+            if(m_glInstanceBuffer)
+            {
+                m_glInstanceBuffer->Invalidate();
+            }
         }
         
         //------------------------------------------------------------------------------
@@ -242,6 +257,12 @@ namespace CSBackend
             
             m_glDynamicMesh.reset();
             m_glDynamicMesh = GLDynamicMeshUPtr(new GLDynamicMesh(ChilliSource::RenderDynamicMesh::k_maxVertexDataSize, ChilliSource::RenderDynamicMesh::k_maxIndexDataSize));
+            
+            if(m_glInstanceBuffer)
+            {
+                m_glInstanceBuffer.reset();
+                m_glInstanceBuffer = GLInstanceBufferUPtr(new GLInstanceBuffer(ChilliSource::RenderInstancesRenderCommand::k_maxInstances));
+            }
         }
         
         //------------------------------------------------------------------------------
@@ -250,6 +271,12 @@ namespace CSBackend
             m_textureUnitManager = GLTextureUnitManagerUPtr(new GLTextureUnitManager());
             m_glDynamicMesh = GLDynamicMeshUPtr(new GLDynamicMesh(ChilliSource::RenderDynamicMesh::k_maxVertexDataSize, ChilliSource::RenderDynamicMesh::k_maxIndexDataSize));
             
+            auto renderCapabilities = ChilliSource::Application::Get()->GetSystem<ChilliSource::RenderCapabilities>();
+            if (renderCapabilities->IsInstancingSupported())
+            {
+                m_glInstanceBuffer = GLInstanceBufferUPtr(new GLInstanceBuffer(ChilliSource::RenderInstancesRenderCommand::k_maxInstances));
+            }
+            
             ResetCache();
         }
         
@@ -274,11 +301,20 @@ namespace CSBackend
             auto renderTexture = renderCommand->GetRenderTexture();
             
             //TODO: Should be pooled.
-            auto glTexture = new GLTexture(renderCommand->GetTextureData(), renderCommand->GetTextureDataSize(), renderTexture);
+            auto glTexture = new GLTexture(renderCommand->GetTextureData(), renderCommand->GetTextureDataSize(), renderCommand->GetFirstMipLevel(), renderTexture);
             
             renderTexture->SetExtraData(glTexture);
         }
         
+        //------------------------------------------------------------------------------
+        void RenderCommandProcessor::StreamTexture(const ChilliSource::StreamTextureRenderCommand* renderCommand) noexcept
+        {
+            ResetCache();
+            
+            GLTexture* glTexture = static_cast<GLTexture*>(renderCommand->GetRenderTexture()->GetExtraData());
+            glTexture->StreamMipLevelRows(renderCommand->GetTextureData(), renderCommand->GetTextureDataSize(), renderCommand->GetFirstMipLevel(), renderCommand->GetMipLevel(), renderCommand->GetFirstRow());
+        }
+        
         //------------------------------------------------------------------------------
         void RenderCommandProcessor::LoadMesh(const ChilliSource::LoadMeshRenderCommand* renderCommand) noexcept
         {
@@ -421,8 +457,8 @@ namespace CSBackend
         {
             m_currentMaterial = nullptr;
             
-            m_currentLight = GLLightUPtr(new GLDirectionalLight(renderCommand->GetColour(), renderCommand->GetDirection(), renderCommand->GetLightViewProjection(),
-                                                                renderCommand->GetShadowTolerance(), renderCommand->GetShadowMapRenderTexture()));
+            m_currentLight = GLLightUPtr(new GLDirectionalLight(renderCommand->GetColour(), renderCommand->GetDirection(), renderCommand->GetLightViewProjections(),
+                                                                renderCommand->GetShadowTolerance(), renderCommand->GetShadowMapRenderTextures(), renderCommand->GetNumShadowMaps()));
         }
 
         //------------------------------------------------------------------------------
@@ -564,10 +600,51 @@ namespace CSBackend
             CS_ASSERT(m_currentMaterial, "A material must be applied before rendering a mesh.");
             CS_ASSERT(m_currentShader, "A shader must be applied before rendering a mesh.");
             
+            DrawInstance(renderCommand->GetWorldMatrix());
+        }
+        
+        //------------------------------------------------------------------------------
+        void RenderCommandProcessor::RenderInstances(const ChilliSource::RenderInstancesRenderCommand* renderCommand) noexcept
+        {
+            CS_ASSERT(m_currentMaterial, "A material must be applied before rendering a mesh.");
+            CS_ASSERT(m_currentShader, "A shader must be applied before rendering a mesh.");
+            
             auto glShader = static_cast<GLShader*>(m_currentShader->GetExtraData());
-            glShader->SetUniform(k_uniformWorldMat, renderCommand->GetWorldMatrix(), GLShader::FailurePolicy::k_silent);
-            glShader->SetUniform(k_uniformWVPMat, renderCommand->GetWorldMatrix() * m_currentCamera.GetViewProjectionMatrix(), GLShader::FailurePolicy::k_silent);
-            glShader->SetUniform(k_uniformNormalMat, ChilliSource::Matrix4::Transpose(ChilliSource::Matrix4::Inverse(renderCommand->GetWorldMatrix())), GLShader::FailurePolicy::k_silent);
+            
+            if (m_glInstanceBuffer && m_currentMesh && GLInstanceBuffer::IsShaderSupported(glShader))
+            {
+                m_glInstanceBuffer->Bind(glShader, renderCommand->GetWorldMatrices(), renderCommand->GetNumInstances());
+                
+                if (m_currentMesh->GetNumIndices() > 0)
+                {
+                    m_glInstanceBuffer->DrawElements(ToGLPolygonType(m_currentMesh->GetPolygonType()), m_currentMesh->GetNumIndices(), ToGLIndexType(m_currentMesh->GetIndexFormat()), renderCommand->GetNumInstances());
+                }
+                else
+                {
+                    m_glInstanceBuffer->DrawArrays(ToGLPolygonType(m_currentMesh->GetPolygonType()), m_currentMesh->GetNumVertices(), renderCommand->GetNumInstances());
+                }
+                
+                m_glInstanceBuffer->Unbind();
+                
+                CS_ASSERT_NOGLERROR("An OpenGL error occurred while rendering instances.");
+            }
+            else
+            {
+                for (u32 i = 0; i < renderCommand->GetNumInstances(); ++i)
+                {
+                    DrawInstance(renderCommand->GetWorldMatrices()[i]);
+                }
+            }
+        }
+        
+        //------------------------------------------------------------------------------
+        void RenderCommandProcessor::DrawInstance(const ChilliSource::Matrix4& worldMatrix) noexcept
+        {
+            auto glShader = static_cast<GLShader*>(m_currentShader->GetExtraData());
+            glShader->SetUniform(k_uniformWorldMat, worldMatrix, GLShader::FailurePolicy::k_silent);
+            glShader->SetUniform(k_uniformWVPMat, worldMatrix * m_currentCamera.GetViewProjectionMatrix(), GLShader::FailurePolicy::k_silent);
+            glShader->SetUniform(k_uniformNormalMat, ChilliSource::Matrix4::Transpose(ChilliSource::Matrix4::Inverse(worldMatrix)), GLShader::FailurePolicy::k_silent);
+            glShader->SetAttribute(GLShader::k_attributeInstanceWorldMat, worldMatrix);
             
             if (m_currentMesh)
             {
@@ -671,6 +748,11 @@ namespace CSBackend
             // However, if this is called the context is about to be lost anyway so it doesn't need to be
             // cleaned up, so we can just invalidate it.
             m_glDynamicMesh->Invalidate();
+            
+            if (m_glInstanceBuffer)
+            {
+                m_glInstanceBuffer->Invalidate();
+            }
         }
     }
 }
\ No newline at end of file
@@ -30,6 +30,7 @@
 #include <CSBackend/Rendering/OpenGL/Camera/GLCamera.h>
 #include <CSBackend/Rendering/OpenGL/Lighting/GLLight.h>
 #include <CSBackend/Rendering/OpenGL/Model/GLDynamicMesh.h>
+#include <CSBackend/Rendering/OpenGL/Model/GLInstanceBuffer.h>
 #include <CSBackend/Rendering/OpenGL/Texture/GLTextureUnitManager.h>
 
 #include <ChilliSource/ChilliSource.h>
@@ -88,6 +89,14 @@ namespace CSBackend
             ///
             void LoadTexture(const ChilliSource::LoadTextureRenderCommand* renderCommand) noexcept;
             
+            /// Streams the rows of a larger mip level described by the given stream command into
+            /// a texture which has already been loaded.
+            ///
+            /// @param renderCommand
+            ///     The render command
+            ///
+            void StreamTexture(const ChilliSource::StreamTextureRenderCommand* renderCommand) noexcept;
+            
             /// Loads the mesh described by the given load command
             ///
             /// @param renderCommand
@@ -219,6 +228,25 @@ namespace CSBackend
             ///
             void RenderInstance(const ChilliSource::RenderInstanceRenderCommand* renderCommand) noexcept;
             
+            /// Renders multiple instances of the mesh described by the current OpenGL context state. A
+            /// camera, material and mesh must all currently be appled to the context. If hardware
+            /// instancing is supported, and the current shader has an instance world matrix attribute,
+            /// this will be performed with a single draw call. Otherwise each instance is drawn
+            /// individually.
+            ///
+            /// @param renderCommand
+            ///     The render command
+            ///
+            void RenderInstances(const ChilliSource::RenderInstancesRenderCommand* renderCommand) noexcept;
+            
+            /// Draws a single instance of the mesh described by the current OpenGL context state with
+            /// the given world matrix.
+            ///
+            /// @param worldMatrix
+            ///     The world matrix of the instance.
+            ///
+            void DrawInstance(const ChilliSource::Matrix4& worldMatrix) noexcept;
+            
             /// Ends rendering to the current render target.
             ///
             void End() noexcept;
@@ -259,6 +287,7 @@ namespace CSBackend
             
             GLTextureUnitManagerUPtr m_textureUnitManager;
             GLDynamicMeshUPtr m_glDynamicMesh;
+            GLInstanceBufferUPtr m_glInstanceBuffer;
             
             GLCamera m_currentCamera;
             GLLightUPtr m_currentLight;
@@ -54,6 +54,7 @@ namespace CSBackend
             bool areMapBuffersSupported = true;
             bool areDepthTexturesSupported = false;
             bool areShadowMapsSupported = false;
+            bool isInstancingSupported = false;
             
             u32 maxTextureSize = 0;
             u32 maxTextureUnits = 0;
@@ -78,12 +79,18 @@ namespace CSBackend
             areDepthTexturesSupported = CheckForOpenGLExtension("GL_OES_depth_texture");
 #endif
             areShadowMapsSupported = (areDepthTexturesSupported && areHighPrecFragmentsSupported);
+            
+#ifdef CS_OPENGLVERSION_STANDARD
+            isInstancingSupported = CheckForOpenGLExtension("GL_ARB_instanced_arrays") && CheckForOpenGLExtension("GL_ARB_draw_instanced");
+#elif defined(CS_OPENGLVERSION_ES)
+            isInstancingSupported = CheckForOpenGLExtension("GL_EXT_instanced_arrays");
+#endif
             glGetIntegerv(GL_MAX_TEXTURE_SIZE, (s32*)&maxTextureSize);
             glGetIntegerv(GL_MAX_COMBINED_TEXTURE_IMAGE_UNITS, (s32*)&maxTextureUnits);
             
             CS_ASSERT_NOGLERROR("An OpenGL error occurred while getting render capabilities.");
             
-            ChilliSource::RenderInfo renderInfo(areShadowMapsSupported, areDepthTexturesSupported, areMapBuffersSupported, areHighPrecFragmentsSupported, maxTextureSize, maxTextureUnits);
+            ChilliSource::RenderInfo renderInfo(areShadowMapsSupported, areDepthTexturesSupported, areMapBuffersSupported, areHighPrecFragmentsSupported, isInstancingSupported, maxTextureSize, maxTextureUnits);
             
             return renderInfo;
         }
@@ -33,6 +33,7 @@ namespace CSBackend
         namespace
         {
             const std::string k_uniformCameraPos = "u_cameraPos";
+            const std::string k_uniformViewProjMat = "u_viewProjMat";
         }
         
         //------------------------------------------------------------------------------
@@ -45,6 +46,7 @@ namespace CSBackend
         void GLCamera::Apply(GLShader* glShader) const noexcept
         {
             glShader->SetUniform(k_uniformCameraPos, m_position, GLShader::FailurePolicy::k_silent);
+            glShader->SetUniform(k_uniformViewProjMat, m_viewProjectionMatrix, GLShader::FailurePolicy::k_silent);
         }
     }
 }
@@ -61,6 +61,7 @@ namespace CSBackend
         //----------------------------------------------------
         CS_FORWARDDECLARE_CLASS(GLMesh);
         CS_FORWARDDECLARE_CLASS(GLDynamicMesh);
+        CS_FORWARDDECLARE_CLASS(GLInstanceBuffer);
         //----------------------------------------------------
         /// Shader
         //----------------------------------------------------
@@ -35,15 +35,18 @@ namespace CSBackend
         {
             const std::string k_uniformLightCol = "u_lightCol";
             const std::string k_uniformLightDir = "u_lightDir";
-            const std::string k_uniformShadowMap = "u_shadowMap";
             const std::string k_uniformShadowTolerance = "u_shadowTolerance";
-            const std::string k_uniformLightMat = "u_lightMat";
+            const std::string k_uniformNumShadowCascades = "u_numShadowCascades";
+            
+            const std::array<std::string, ChilliSource::DirectionalRenderLight::k_maxShadowCascades> k_uniformShadowMaps = {{ "u_shadowMap", "u_shadowMap1", "u_shadowMap2", "u_shadowMap3" }};
+            const std::array<std::string, ChilliSource::DirectionalRenderLight::k_maxShadowCascades> k_uniformLightMats = {{ "u_lightMat", "u_lightMat1", "u_lightMat2", "u_lightMat3" }};
         }
         
         //------------------------------------------------------------------------------
-        GLDirectionalLight::GLDirectionalLight(const ChilliSource::Colour& colour, const ChilliSource::Vector3& direction, const ChilliSource::Matrix4& lightViewProjection, f32 shadowTolerance,
-                                               const ChilliSource::RenderTexture* shadowMapRenderTexture) noexcept
-            : m_colour(colour), m_direction(direction), m_lightViewProjection(lightViewProjection), m_shadowTolerance(shadowTolerance), m_shadowMapRenderTexture(shadowMapRenderTexture)
+        GLDirectionalLight::GLDirectionalLight(const ChilliSource::Colour& colour, const ChilliSource::Vector3& direction, const std::array<ChilliSource::Matrix4, ChilliSource::DirectionalRenderLight::k_maxShadowCascades>& lightViewProjections,
+                                               f32 shadowTolerance, const std::array<const ChilliSource::RenderTexture*, ChilliSource::DirectionalRenderLight::k_maxShadowCascades>& shadowMapRenderTextures, u32 numShadowMaps) noexcept
+            : m_colour(colour), m_direction(direction), m_lightViewProjections(lightViewProjections), m_shadowTolerance(shadowTolerance), m_shadowMapRenderTextures(shadowMapRenderTextures),
+              m_numShadowMaps(numShadowMaps)
         {
         }
             
@@ -53,13 +56,18 @@ namespace CSBackend
             glShader->SetUniform(k_uniformLightCol, m_colour, GLShader::FailurePolicy::k_silent);
             glShader->SetUniform(k_uniformLightDir, m_direction, GLShader::FailurePolicy::k_silent);
             
-            if (m_shadowMapRenderTexture)
+            if (m_numShadowMaps > 0)
             {
-                auto texUnit = glTextureUnitManager->BindAdditional(m_shadowMapRenderTexture);
-                
-                glShader->SetUniform(k_uniformShadowMap, s32(texUnit), GLShader::FailurePolicy::k_silent);
                 glShader->SetUniform(k_uniformShadowTolerance, m_shadowTolerance, GLShader::FailurePolicy::k_silent);
-                glShader->SetUniform(k_uniformLightMat, m_lightViewProjection, GLShader::FailurePolicy::k_silent);
+                glShader->SetUniform(k_uniformNumShadowCascades, f32(m_numShadowMaps), GLShader::FailurePolicy::k_silent);
+                
+                for (u32 i = 0; i < m_numShadowMaps; ++i)
+                {
+                    auto texUnit = glTextureUnitManager->BindAdditional(m_shadowMapRenderTextures[i]);
+                    
+                    glShader->SetUniform(k_uniformShadowMaps[i], s32(texUnit), GLShader::FailurePolicy::k_silent);
+                    glShader->SetUniform(k_uniformLightMats[i], m_lightViewProjections[i], GLShader::FailurePolicy::k_silent);
+                }
             }
         }
     }
@@ -32,6 +32,9 @@
 #include <ChilliSource/Core/Base/Colour.h>
 #include <ChilliSource/Core/Math/Matrix4.h>
 #include <ChilliSource/Core/Math/Vector3.h>
+#include <ChilliSource/Rendering/Lighting/DirectionalRenderLight.h>
+
+#include <array>
 
 namespace CSBackend
 {
@@ -40,6 +43,10 @@ namespace CSBackend
         /// The directional OpenGL light object, which stores the direction light data and provides
         /// the means to apply the data to a shader.
         ///
+        /// The first shadow map is applied to the u_shadowMap and u_lightMat uniforms. Additional
+        /// shadow cascades are applied to u_shadowMap1, u_lightMat1 and so on, and the number of
+        /// cascades is applied to u_numShadowCascades.
+        ///
         /// This is immutable and therefore thread-safe, but apply must be called on the render
         /// thread.
         ///
@@ -52,17 +59,18 @@ namespace CSBackend
             ///     The colour of the light.
             /// @param direction
             ///     The direction of the light.
-            /// @param lightViewProjection
-            ///     The view projection matrix of the light which is used as the camera when rendering
-            ///     the shadow map.
+            /// @param lightViewProjections
+            ///     The view projection matrix of the light for each shadow cascade, which is used as
+            ///     the camera when rendering the shadow map.
             /// @param shadowTolerance
             ///     The tolerence used to judge if an object is in shadow.
-            /// @param shadowMapRenderTexture
-            ///     The render texture which should be used for the shadow map. Can be null if there is no
-            ///     shadow map.
+            /// @param shadowMapRenderTextures
+            ///     The render texture which should be used for the shadow map of each cascade.
+            /// @param numShadowMaps
+            ///     The number of shadow maps. Can be zero if there is no shadow map.
             ///
-            GLDirectionalLight(const ChilliSource::Colour& colour, const ChilliSource::Vector3& direction, const ChilliSource::Matrix4& lightViewProjection, f32 shadowTolerance,
-                               const ChilliSource::RenderTexture* shadowMapRenderTexture) noexcept;
+            GLDirectionalLight(const ChilliSource::Colour& colour, const ChilliSource::Vector3& direction, const std::array<ChilliSource::Matrix4, ChilliSource::DirectionalRenderLight::k_maxShadowCascades>& lightViewProjections,
+                               f32 shadowTolerance, const std::array<const ChilliSource::RenderTexture*, ChilliSource::DirectionalRenderLight::k_maxShadowCascades>& shadowMapRenderTextures, u32 numShadowMaps) noexcept;
             
             /// Applies the light to the given shader.
             ///
@@ -79,9 +87,10 @@ namespace CSBackend
         private:
             ChilliSource::Colour m_colour;
             ChilliSource::Vector3 m_direction;
-            ChilliSource::Matrix4 m_lightViewProjection;
+            std::array<ChilliSource::Matrix4, ChilliSource::DirectionalRenderLight::k_maxShadowCascades> m_lightViewProjections;
             f32 m_shadowTolerance;
-            const ChilliSource::RenderTexture* m_shadowMapRenderTexture;
+            std::array<const ChilliSource::RenderTexture*, ChilliSource::DirectionalRenderLight::k_maxShadowCascades> m_shadowMapRenderTextures;
+            u32 m_numShadowMaps;
         };
     }
 }
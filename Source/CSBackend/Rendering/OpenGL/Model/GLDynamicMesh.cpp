@@ -241,10 +241,15 @@ namespace CSBackend
             glGetIntegerv(GL_MAX_VERTEX_ATTRIBS, &maxVertexAttributes);
             CS_ASSERT(u32(maxVertexAttributes) >= m_vertexFormat.GetNumElements(), "Too many vertex elements.");
             
+            // Attributes are enabled by the shader as they are set, so the locations used
+            // by the shader don't need to match the element order.
+            for (s32 i = 0; i < maxVertexAttributes; ++i)
+            {
+                glDisableVertexAttribArray(i);
+            }
+            
             for (u32 i = 0; i < m_vertexFormat.GetNumElements(); ++i)
             {
-                glEnableVertexAttribArray(i);
-                
                 auto elementType = m_vertexFormat.GetElement(i);
                 auto name = GLMeshUtils::GetAttributeName(elementType);
                 auto numComponents = ChilliSource::VertexFormat::GetNumComponents(elementType);
@@ -254,11 +259,6 @@ namespace CSBackend
                 
                 glShader->SetAttribute(name, numComponents, type, normalised, m_vertexFormat.GetSize(), offset);
             }
-            
-            for (s32 i = m_vertexFormat.GetNumElements(); i < maxVertexAttributes; ++i)
-            {
-                glDisableVertexAttribArray(i);
-            }
         }
         
         //------------------------------------------------------------------------------
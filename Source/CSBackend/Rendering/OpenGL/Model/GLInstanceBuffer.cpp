@@ -0,0 +1,194 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2016 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#include <CSBackend/Rendering/OpenGL/Model/GLInstanceBuffer.h>
+
+#include <CSBackend/Rendering/OpenGL/Base/GLError.h>
+#include <CSBackend/Rendering/OpenGL/Shader/GLShader.h>
+
+#ifdef CS_TARGETPLATFORM_ANDROID
+#include <EGL/egl.h>
+#endif
+
+namespace CSBackend
+{
+    namespace OpenGL
+    {
+        namespace
+        {
+            // A matrix attribute occupies one attribute location per column.
+            constexpr u32 k_numMatrixColumns = 4;
+            
+#ifdef CS_TARGETPLATFORM_ANDROID
+            // The instanced arrays extension entry points are not exported by libGLESv2 on
+            // Android, so they must be looked up at runtime.
+            typedef void (GL_APIENTRYP VertexAttribDivisorFunc)(GLuint index, GLuint divisor);
+            typedef void (GL_APIENTRYP DrawArraysInstancedFunc)(GLenum mode, GLint first, GLsizei count, GLsizei instanceCount);
+            typedef void (GL_APIENTRYP DrawElementsInstancedFunc)(GLenum mode, GLsizei count, GLenum type, const GLvoid* indices, GLsizei instanceCount);
+            
+            VertexAttribDivisorFunc g_vertexAttribDivisor = nullptr;
+            DrawArraysInstancedFunc g_drawArraysInstanced = nullptr;
+            DrawElementsInstancedFunc g_drawElementsInstanced = nullptr;
+#endif
+            
+            /// Looks up the instancing entry points if required on this platform.
+            ///
+            void LoadEntryPoints() noexcept
+            {
+#ifdef CS_TARGETPLATFORM_ANDROID
+                if (!g_vertexAttribDivisor)
+                {
+                    g_vertexAttribDivisor = reinterpret_cast<VertexAttribDivisorFunc>(eglGetProcAddress("glVertexAttribDivisorEXT"));
+                    g_drawArraysInstanced = reinterpret_cast<DrawArraysInstancedFunc>(eglGetProcAddress("glDrawArraysInstancedEXT"));
+                    g_drawElementsInstanced = reinterpret_cast<DrawElementsInstancedFunc>(eglGetProcAddress("glDrawElementsInstancedEXT"));
+                    
+                    CS_ASSERT(g_vertexAttribDivisor && g_drawArraysInstanced && g_drawElementsInstanced, "Could not find OpenGL instancing entry points.");
+                }
+#endif
+            }
+            
+            /// Sets the rate at which the given attribute advances during instanced rendering.
+            ///
+            /// @param index
+            ///     The attribute index.
+            /// @param divisor
+            ///     The number of instances which will pass between updates of the attribute.
+            ///
+            void VertexAttribDivisor(GLuint index, GLuint divisor) noexcept
+            {
+#if defined(CS_TARGETPLATFORM_ANDROID)
+                g_vertexAttribDivisor(index, divisor);
+#elif defined(CS_TARGETPLATFORM_IOS)
+                glVertexAttribDivisorEXT(index, divisor);
+#elif defined(CS_TARGETPLATFORM_WINDOWS)
+                glVertexAttribDivisorARB(index, divisor);
+#endif
+            }
+        }
+        
+        //------------------------------------------------------------------------------
+        GLInstanceBuffer::GLInstanceBuffer(u32 maxInstances) noexcept
+            : m_maxInstances(maxInstances)
+        {
+            LoadEntryPoints();
+            
+            glGenBuffers(1, &m_bufferHandle);
+            CS_ASSERT(m_bufferHandle != 0, "Invalid instance buffer.");
+            
+            glBindBuffer(GL_ARRAY_BUFFER, m_bufferHandle);
+            glBufferData(GL_ARRAY_BUFFER, m_maxInstances * sizeof(ChilliSource::Matrix4), nullptr, GL_STREAM_DRAW);
+            
+            CS_ASSERT_NOGLERROR("An OpenGL error occurred while creating GLInstanceBuffer.");
+        }
+        
+        //------------------------------------------------------------------------------
+        bool GLInstanceBuffer::IsShaderSupported(const GLShader* glShader) noexcept
+        {
+            return glShader->GetAttributeHandle(GLShader::k_attributeInstanceWorldMat) >= 0;
+        }
+        
+        //------------------------------------------------------------------------------
+        void GLInstanceBuffer::Bind(GLShader* glShader, const ChilliSource::Matrix4* worldMatrices, u32 numInstances) noexcept
+        {
+            CS_ASSERT(numInstances <= m_maxInstances, "Too many instances.");
+            CS_ASSERT(m_boundAttributeHandle < 0, "Instance buffer is already bound.");
+            
+            m_boundAttributeHandle = glShader->GetAttributeHandle(GLShader::k_attributeInstanceWorldMat);
+            CS_ASSERT(m_boundAttributeHandle >= 0, "Shader does not support instancing.");
+            
+            glBindBuffer(GL_ARRAY_BUFFER, m_bufferHandle);
+            
+            // Orphan the previous contents so the upload doesn't stall on in-flight draws.
+            glBufferData(GL_ARRAY_BUFFER, m_maxInstances * sizeof(ChilliSource::Matrix4), nullptr, GL_STREAM_DRAW);
+            glBufferSubData(GL_ARRAY_BUFFER, 0, numInstances * sizeof(ChilliSource::Matrix4), worldMatrices);
+            
+            for (u32 i = 0; i < k_numMatrixColumns; ++i)
+            {
+                GLuint index = GLuint(m_boundAttributeHandle) + i;
+                auto offset = reinterpret_cast<const GLvoid*>(u64(i * k_numMatrixColumns * sizeof(f32)));
+                
+                glEnableVertexAttribArray(index);
+                glVertexAttribPointer(index, k_numMatrixColumns, GL_FLOAT, GL_FALSE, sizeof(ChilliSource::Matrix4), offset);
+                VertexAttribDivisor(index, 1);
+            }
+            
+            CS_ASSERT_NOGLERROR("An OpenGL error occurred while binding GLInstanceBuffer.");
+        }
+        
+        //------------------------------------------------------------------------------
+        void GLInstanceBuffer::DrawElements(GLenum mode, u32 numIndices, GLenum indexType, u32 numInstances) noexcept
+        {
+#if defined(CS_TARGETPLATFORM_ANDROID)
+            g_drawElementsInstanced(mode, numIndices, indexType, 0, numInstances);
+#elif defined(CS_TARGETPLATFORM_IOS)
+            glDrawElementsInstancedEXT(mode, numIndices, indexType, 0, numInstances);
+#elif defined(CS_TARGETPLATFORM_WINDOWS)
+            glDrawElementsInstancedARB(mode, numIndices, indexType, 0, numInstances);
+#endif
+        }
+        
+        //------------------------------------------------------------------------------
+        void GLInstanceBuffer::DrawArrays(GLenum mode, u32 numVertices, u32 numInstances) noexcept
+        {
+#if defined(CS_TARGETPLATFORM_ANDROID)
+            g_drawArraysInstanced(mode, 0, numVertices, numInstances);
+#elif defined(CS_TARGETPLATFORM_IOS)
+            glDrawArraysInstancedEXT(mode, 0, numVertices, numInstances);
+#elif defined(CS_TARGETPLATFORM_WINDOWS)
+            glDrawArraysInstancedARB(mode, 0, numVertices, numInstances);
+#endif
+        }
+        
+        //------------------------------------------------------------------------------
+        void GLInstanceBuffer::Unbind() noexcept
+        {
+            if (m_boundAttributeHandle >= 0)
+            {
+                for (u32 i = 0; i < k_numMatrixColumns; ++i)
+                {
+                    GLuint index = GLuint(m_boundAttributeHandle) + i;
+                    
+                    VertexAttribDivisor(index, 0);
+                    glDisableVertexAttribArray(index);
+                }
+                
+                m_boundAttributeHandle = -1;
+                
+                CS_ASSERT_NOGLERROR("An OpenGL error occurred while unbinding GLInstanceBuffer.");
+            }
+        }
+        
+        //------------------------------------------------------------------------------
+        GLInstanceBuffer::~GLInstanceBuffer() noexcept
+        {
+            if(!m_invalidData)
+            {
+                glDeleteBuffers(1, &m_bufferHandle);
+                
+                CS_ASSERT_NOGLERROR("An OpenGL error occurred while deleting GLInstanceBuffer.");
+            }
+        }
+    }
+}
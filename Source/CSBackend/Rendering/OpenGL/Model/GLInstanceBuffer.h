@@ -0,0 +1,130 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2016 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#ifndef _CSBACKEND_RENDERING_OPENGL_MODEL_GLINSTANCEBUFFER_H_
+#define _CSBACKEND_RENDERING_OPENGL_MODEL_GLINSTANCEBUFFER_H_
+
+#include <CSBackend/Rendering/OpenGL/ForwardDeclarations.h>
+#include <CSBackend/Rendering/OpenGL/Base/GLIncludes.h>
+
+#include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Math/Matrix4.h>
+
+namespace CSBackend
+{
+    namespace OpenGL
+    {
+        /// A container for all functionality pertaining to hardware instanced rendering. This
+        /// contains a streaming vertex buffer of per-instance world matrices, which are applied
+        /// to the shader's instance world matrix attribute, and provides the instanced draw calls.
+        ///
+        /// This should only be created if hardware instancing is supported, as described by
+        /// the RenderCapabilities.
+        ///
+        /// This is not thread-safe and should only be accessed from the render thread.
+        ///
+        class GLInstanceBuffer final
+        {
+        public:
+            CS_DECLARE_NOCOPY(GLInstanceBuffer);
+            
+            /// Creates a new instance buffer which can hold the given number of instances.
+            ///
+            /// @param maxInstances
+            ///     The maximum number of instances.
+            ///
+            GLInstanceBuffer(u32 maxInstances) noexcept;
+            
+            /// @param glShader
+            ///     The shader to check.
+            ///
+            /// @return Whether or not the given shader can be used for instanced rendering, i.e.
+            ///     it contains the instance world matrix attribute.
+            ///
+            static bool IsShaderSupported(const GLShader* glShader) noexcept;
+            
+            /// Updates the instance data and binds it to the instance world matrix attribute of
+            /// the given shader. The shader must support instancing. The attribute is reset by
+            /// calling Unbind() after drawing.
+            ///
+            /// @param glShader
+            ///     The shader to apply attributes to.
+            /// @param worldMatrices
+            ///     The world matrix of each instance.
+            /// @param numInstances
+            ///     The number of instances.
+            ///
+            void Bind(GLShader* glShader, const ChilliSource::Matrix4* worldMatrices, u32 numInstances) noexcept;
+            
+            /// Draws the given number of instances of the currently bound indexed mesh.
+            ///
+            /// @param mode
+            ///     The OpenGL polygon type.
+            /// @param numIndices
+            ///     The number of indices in the mesh.
+            /// @param indexType
+            ///     The OpenGL index type.
+            /// @param numInstances
+            ///     The number of instances.
+            ///
+            void DrawElements(GLenum mode, u32 numIndices, GLenum indexType, u32 numInstances) noexcept;
+            
+            /// Draws the given number of instances of the currently bound non-indexed mesh.
+            ///
+            /// @param mode
+            ///     The OpenGL polygon type.
+            /// @param numVertices
+            ///     The number of vertices in the mesh.
+            /// @param numInstances
+            ///     The number of instances.
+            ///
+            void DrawArrays(GLenum mode, u32 numVertices, u32 numInstances) noexcept;
+            
+            /// Resets the instance attributes applied by Bind() so that they do not affect
+            /// subsequent, non-instanced, draw calls.
+            ///
+            void Unbind() noexcept;
+            
+            /// Called when graphics memory is lost, usually through the GLContext being destroyed
+            /// on Android. Function will set a flag to handle safe destructing of this object, preventing
+            /// us from trying to delete invalid memory.
+            ///
+            void Invalidate() noexcept { m_invalidData = true; }
+            
+            /// Destroys the OpenGL instance buffer that this represents.
+            ///
+            ~GLInstanceBuffer() noexcept;
+            
+        private:
+            u32 m_maxInstances;
+            GLuint m_bufferHandle = 0;
+            GLint m_boundAttributeHandle = -1;
+            
+            bool m_invalidData = false;
+        };
+    }
+}
+
+#endif
@@ -78,10 +78,15 @@ namespace CSBackend
             
             CS_ASSERT_NOGLERROR("An OpenGL error occurred while binding GLMesh.");
             
+            // Attributes are enabled by the shader as they are set, so the locations used
+            // by the shader don't need to match the element order.
+            for (s32 i = 0; i < maxVertexAttributes; ++i)
+            {
+                glDisableVertexAttribArray(i);
+            }
+            
             for (u32 i = 0; i < vertexFormat.GetNumElements(); ++i)
             {
-                glEnableVertexAttribArray(i);
-                
                 auto elementType = vertexFormat.GetElement(i);
                 auto name = GLMeshUtils::GetAttributeName(elementType);
                 auto numComponents = ChilliSource::VertexFormat::GetNumComponents(elementType);
@@ -91,11 +96,6 @@ namespace CSBackend
                 
                 glShader->SetAttribute(name, numComponents, type, normalised, vertexFormat.GetSize(), offset);
             }
-            
-            for (s32 i = vertexFormat.GetNumElements(); i < maxVertexAttributes; ++i)
-            {
-                glDisableVertexAttribArray(i);
-            }
         }
         
         //------------------------------------------------------------------------------
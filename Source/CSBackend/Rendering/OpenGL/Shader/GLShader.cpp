@@ -125,6 +125,7 @@ namespace CSBackend
         const std::string GLShader::k_attributeColour = "a_colour";
         const std::string GLShader::k_attributeWeights = "a_weights";
         const std::string GLShader::k_attributeJointIndices = "a_jointIndices";
+        const std::string GLShader::k_attributeInstanceWorldMat = "a_instanceWorldMat";
     
         //------------------------------------------------------------------------------
         GLShader::GLShader(const std::string& vertexShader, const std::string& fragmentShader) noexcept
@@ -248,22 +249,54 @@ namespace CSBackend
                 return;
             }
 
+            glEnableVertexAttribArray(it->second);
             glVertexAttribPointer(it->second, size, type, isNormalised, stride, offset);
 
             CS_ASSERT_NOGLERROR("An OpenGL error occurred while setting attribute.");
         }
         
+        //------------------------------------------------------------------------------
+        void GLShader::SetAttribute(const std::string& name, const ChilliSource::Matrix4& value) noexcept
+        {
+            auto it = m_attributeHandles.find(name);
+            if(it == m_attributeHandles.end())
+            {
+                return;
+            }
+            
+            // Matrix attributes occupy one location per column.
+            for (u32 i = 0; i < 4; ++i)
+            {
+                glVertexAttrib4fv(it->second + i, reinterpret_cast<const GLfloat*>(&value.m[i * 4]));
+            }
+            
+            CS_ASSERT_NOGLERROR("An OpenGL error occurred while setting attribute.");
+        }
+        
+        //------------------------------------------------------------------------------
+        GLint GLShader::GetAttributeHandle(const std::string& name) const noexcept
+        {
+            auto it = m_attributeHandles.find(name);
+            if(it == m_attributeHandles.end())
+            {
+                return -1;
+            }
+            
+            return it->second;
+        }
+        
         //------------------------------------------------------------------------------
         void GLShader::BuildAttributeHandleMap() noexcept
         {
-            static const std::array<std::string, 6> attribNames =
+            static const std::array<std::string, 7> attribNames =
             {{
                 k_attributePosition,
                 k_attributeNormal,
                 k_attributeTexCoord,
                 k_attributeColour,
                 k_attributeWeights,
-                k_attributeJointIndices
+                k_attributeJointIndices,
+                k_attributeInstanceWorldMat
             }};
             
             for(const auto& name : attribNames)
@@ -58,6 +58,7 @@ namespace CSBackend
             static const std::string k_attributeColour;
             static const std::string k_attributeWeights;
             static const std::string k_attributeJointIndices;
+            static const std::string k_attributeInstanceWorldMat;
             
             /// An enum describing the different types of failure policy. This is used when setting
             /// uniforms to judge if an assertion should occur when the uniform doesn't exist.
@@ -179,8 +180,8 @@ namespace CSBackend
             ///
             void SetUniform(const std::string& name, const ChilliSource::Vector4* values, u32 numValues, FailurePolicy failurePolicy = FailurePolicy::k_hard) noexcept;
             
-            /// Sets the attribute with the given name and data information. If the attribute doesn't
-            /// exist then it will be ignored.
+            /// Sets the attribute with the given name and data information, and enables the vertex
+            /// attribute array. If the attribute doesn't exist then it will be ignored.
             ///
             /// @param name
             ///     The name of the attribute.
@@ -197,6 +198,26 @@ namespace CSBackend
             ///
             void SetAttribute(const std::string& name, GLint size, GLenum type, GLboolean isNormalised, GLsizei stride, const GLvoid* offset) noexcept;
             
+            /// Sets the attribute with the given name to a constant value. This is used when the
+            /// attribute isn't sourced from a vertex attribute array, for example when a shader
+            /// which supports instancing is used to render a single instance. If the attribute
+            /// doesn't exist then it will be ignored.
+            ///
+            /// @param name
+            ///     The name of the attribute.
+            /// @param value
+            ///     The value to set the attribute to.
+            ///
+            void SetAttribute(const std::string& name, const ChilliSource::Matrix4& value) noexcept;
+            
+            /// @param name
+            ///     The name of the attribute.
+            ///
+            /// @return The handle of the attribute with the given name, or -1 if it doesn't exist
+            ///     in the shader.
+            ///
+            GLint GetAttributeHandle(const std::string& name) const noexcept;
+            
             /// Called when graphics memory is lost, usually through the GLContext being destroyed
             /// on Android. Function will set a flag to handle safe destructing of this object, preventing
             /// us from trying to delete invalid memory.
@@ -46,49 +46,102 @@ namespace CSBackend
             const bool k_shouldBackupMeshDataFromMemory = false;
 #endif
     
-            /// Uploads the given uncompressed image data to texture memory.
+            /// Gets the OpenGL pixel format and type of the given uncompressed image format.
             ///
             /// @param format
             ///     The format of the image data.
-            /// @param dimensions
-            ///     The image dimensions.
-            /// @param imageData
-            ///     The image data.
+            /// @param [Out] outGLFormat
+            ///     The OpenGL pixel format.
+            /// @param [Out] outGLType
+            ///     The OpenGL pixel type.
             ///
-            void UploadImageDataNoCompression(ChilliSource::ImageFormat format, const ChilliSource::Integer2& dimensions, const u8* imageData)
+            void GetGLFormatAndType(ChilliSource::ImageFormat format, GLenum& outGLFormat, GLenum& outGLType)
             {
                 switch(format)
                 {
                     default:
                     case ChilliSource::ImageFormat::k_RGBA8888:
-                        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, dimensions.x, dimensions.y, 0, GL_RGBA, GL_UNSIGNED_BYTE, imageData);
+                        outGLFormat = GL_RGBA;
+                        outGLType = GL_UNSIGNED_BYTE;
                         break;
                     case ChilliSource::ImageFormat::k_RGB888:
-                        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, dimensions.x, dimensions.y, 0, GL_RGB, GL_UNSIGNED_BYTE, imageData);
+                        outGLFormat = GL_RGB;
+                        outGLType = GL_UNSIGNED_BYTE;
                         break;
                     case ChilliSource::ImageFormat::k_RGBA4444:
-                        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, dimensions.x, dimensions.y, 0, GL_RGBA, GL_UNSIGNED_SHORT_4_4_4_4, imageData);
+                        outGLFormat = GL_RGBA;
+                        outGLType = GL_UNSIGNED_SHORT_4_4_4_4;
                         break;
                     case ChilliSource::ImageFormat::k_RGB565:
-                        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, dimensions.x, dimensions.y, 0, GL_RGB, GL_UNSIGNED_SHORT_5_6_5, imageData);
+                        outGLFormat = GL_RGB;
+                        outGLType = GL_UNSIGNED_SHORT_5_6_5;
                         break;
                     case ChilliSource::ImageFormat::k_LumA88:
-                        glTexImage2D(GL_TEXTURE_2D, 0, GL_LUMINANCE_ALPHA, dimensions.x, dimensions.y, 0, GL_LUMINANCE_ALPHA, GL_UNSIGNED_BYTE, imageData);
+                        outGLFormat = GL_LUMINANCE_ALPHA;
+                        outGLType = GL_UNSIGNED_BYTE;
                         break;
                     case ChilliSource::ImageFormat::k_Lum8:
-                        glTexImage2D(GL_TEXTURE_2D, 0, GL_LUMINANCE, dimensions.x, dimensions.y, 0, GL_LUMINANCE, GL_UNSIGNED_BYTE, imageData);
+                        outGLFormat = GL_LUMINANCE;
+                        outGLType = GL_UNSIGNED_BYTE;
                         break;
                     case ChilliSource::ImageFormat::k_Depth16:
-                        glTexImage2D(GL_TEXTURE_2D, 0, GL_DEPTH_COMPONENT, dimensions.x, dimensions.y, 0, GL_DEPTH_COMPONENT, GL_UNSIGNED_SHORT, imageData);
+                        outGLFormat = GL_DEPTH_COMPONENT;
+                        outGLType = GL_UNSIGNED_SHORT;
                         break;
                     case ChilliSource::ImageFormat::k_Depth32:
-                        glTexImage2D(GL_TEXTURE_2D, 0, GL_DEPTH_COMPONENT, dimensions.x, dimensions.y, 0, GL_DEPTH_COMPONENT, GL_UNSIGNED_INT, imageData);
+                        outGLFormat = GL_DEPTH_COMPONENT;
+                        outGLType = GL_UNSIGNED_INT;
                         break;
                 };
+            }
+            
+            /// Uploads the given uncompressed image data to texture memory.
+            ///
+            /// @param format
+            ///     The format of the image data.
+            /// @param mipLevel
+            ///     The mip level the image data should be uploaded to.
+            /// @param dimensions
+            ///     The image dimensions.
+            /// @param imageData
+            ///     The image data.
+            ///
+            void UploadImageDataNoCompression(ChilliSource::ImageFormat format, GLint mipLevel, const ChilliSource::Integer2& dimensions, const u8* imageData)
+            {
+                GLenum glFormat, glType;
+                GetGLFormatAndType(format, glFormat, glType);
+                
+                glTexImage2D(GL_TEXTURE_2D, mipLevel, glFormat, dimensions.x, dimensions.y, 0, glFormat, glType, imageData);
                 
                 CS_ASSERT_NOGLERROR("An OpenGL error occurred while uploading uncompressed texture data.");
             }
             
+            /// Uploads a band of rows of uncompressed image data to an existing level of the
+            /// currently bound texture.
+            ///
+            /// @param format
+            ///     The format of the image data.
+            /// @param mipLevel
+            ///     The mip level the image data should be uploaded to.
+            /// @param width
+            ///     The width of the mip level.
+            /// @param firstRow
+            ///     The first row contained in the image data.
+            /// @param numRows
+            ///     The number of rows contained in the image data.
+            /// @param imageData
+            ///     The image data.
+            ///
+            void UploadImageDataRowsNoCompression(ChilliSource::ImageFormat format, GLint mipLevel, s32 width, u32 firstRow, u32 numRows, const u8* imageData)
+            {
+                GLenum glFormat, glType;
+                GetGLFormatAndType(format, glFormat, glType);
+                
+                glTexSubImage2D(GL_TEXTURE_2D, mipLevel, 0, GLint(firstRow), width, GLsizei(numRows), glFormat, glType, imageData);
+                
+                CS_ASSERT_NOGLERROR("An OpenGL error occurred while uploading uncompressed texture rows.");
+            }
+            
             /// Uploads the given ETC1 image data to texture memory.
             ///
             /// @param format
@@ -181,6 +234,37 @@ namespace CSBackend
                 CS_ASSERT_NOGLERROR("An OpenGL error occurred while uploading PVR4 texture data.");
             }
             
+            /// Uploads the given precomputed, uncompressed mip levels to texture memory. The given
+            /// first mip level is uploaded as the top level of the texture, allowing a streamed
+            /// texture to be displayed before its larger levels are available.
+            ///
+            /// @param renderTexture
+            ///     The RenderTexture containing image format data.
+            /// @param firstMipLevel
+            ///     The first mip level contained in the image data.
+            /// @param imageData
+            ///     The image data, containing the first mip level and all smaller levels, largest
+            ///     first. This may be null.
+            /// @param imageDataSize
+            ///     The size, in bytes, of the image data.
+            ///
+            void UploadImageDataMipLevels(const ChilliSource::RenderTexture* renderTexture, u32 firstMipLevel, const u8* imageData, u32 imageDataSize)
+            {
+                //Mip levels are tightly packed so rows are not necessarily 4 byte aligned.
+                glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+                
+                u32 offset = 0;
+                for (u32 mipLevel = firstMipLevel; mipLevel < renderTexture->GetNumMipLevels(); ++mipLevel)
+                {
+                    UploadImageDataNoCompression(renderTexture->GetImageFormat(), GLint(mipLevel - firstMipLevel), renderTexture->GetMipLevelDimensions(mipLevel), imageData ? imageData + offset : nullptr);
+                    offset += renderTexture->GetMipLevelDataSize(mipLevel);
+                }
+                
+                CS_ASSERT(!imageData || offset == imageDataSize, "Texture data size does not match the size of the mip levels.");
+                
+                glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+            }
+            
             /// Applies the given wrap mode to the currently bound texture.
             ///
             /// @param wrapModeS
@@ -254,6 +338,26 @@ namespace CSBackend
                 CS_ASSERT_NOGLERROR("An OpenGL error occurred while applying texture filter mode.");
             }
             
+            /// Calculates the size of the data for the given mip level and all smaller levels.
+            ///
+            /// @param renderTexture
+            ///     The RenderTexture containing image format data.
+            /// @param firstMipLevel
+            ///     The first mip level of the chain.
+            ///
+            /// @return The size of the mip chain data.
+            ///
+            u32 CalcMipChainDataSize(const ChilliSource::RenderTexture* renderTexture, u32 firstMipLevel)
+            {
+                u32 dataSize = 0;
+                for (u32 mipLevel = firstMipLevel; mipLevel < renderTexture->GetNumMipLevels(); ++mipLevel)
+                {
+                    dataSize += renderTexture->GetMipLevelDataSize(mipLevel);
+                }
+                
+                return dataSize;
+            }
+            
             /// Creates a new OpenGL texture with the given texture data.
             ///
             /// @param data
@@ -262,10 +366,12 @@ namespace CSBackend
             ///     The size of the texture data.
             /// @param renderTexture
             ///     The RenderTexture containing image format data.
+            /// @param firstMipLevel
+            ///     The first mip level contained in the texture data.
             ///
             /// @return Handle to the texture
             ///
-            GLuint BuildTexture(const u8* data, u32 dataSize, const ChilliSource::RenderTexture* renderTexture) noexcept
+            GLuint BuildTexture(const u8* data, u32 dataSize, const ChilliSource::RenderTexture* renderTexture, u32 firstMipLevel) noexcept
             {
                 GLuint handle;
                 glGenTextures(1, &handle);
@@ -275,10 +381,24 @@ namespace CSBackend
                 
                 const auto& dimensions = renderTexture->GetDimensions();
                 
+                if(renderTexture->GetNumMipLevels() > 1)
+                {
+                    CS_ASSERT(ChilliSource::MathUtils::IsPowerOfTwo(dimensions.x) && ChilliSource::MathUtils::IsPowerOfTwo(dimensions.y), "Mipmapped images must be a power of two.");
+                    
+                    UploadImageDataMipLevels(renderTexture, firstMipLevel, data, dataSize);
+                    
+                    ApplyFilterMode(renderTexture->GetFilterMode(), renderTexture->IsMipmapped());
+                    ApplyWrapMode(renderTexture->GetWrapModeS(), renderTexture->GetWrapModeT());
+                    
+                    CS_ASSERT_NOGLERROR("An OpenGL error occurred while building texture.");
+                    
+                    return handle;
+                }
+                
                 switch(renderTexture->GetImageCompression())
                 {
                     case ChilliSource::ImageCompression::k_none:
-                        UploadImageDataNoCompression(renderTexture->GetImageFormat(), dimensions, data);
+                        UploadImageDataNoCompression(renderTexture->GetImageFormat(), 0, dimensions, data);
                         break;
                     case ChilliSource::ImageCompression::k_ETC1:
                         UploadImageDataETC1(renderTexture->GetImageFormat(), dimensions, data, dataSize);
@@ -308,8 +428,8 @@ namespace CSBackend
         }
         
         //------------------------------------------------------------------------------
-        GLTexture::GLTexture(const u8* data, u32 dataSize, ChilliSource::RenderTexture* renderTexture) noexcept
-            :m_imageDataSize(dataSize), m_renderTexture(renderTexture)
+        GLTexture::GLTexture(const u8* data, u32 dataSize, u32 firstMipLevel, ChilliSource::RenderTexture* renderTexture) noexcept
+            :m_renderTexture(renderTexture), m_imageDataSize(dataSize), m_firstMipLevel(firstMipLevel)
         {
 #ifdef CS_ENABLE_DEBUG
             auto renderCapabilities = ChilliSource::Application::Get()->GetSystem<ChilliSource::RenderCapabilities>();
@@ -317,7 +437,7 @@ namespace CSBackend
             CS_ASSERT(u32(dimensions.x) <= renderCapabilities->GetMaxTextureSize() && u32(dimensions.y) <= renderCapabilities->GetMaxTextureSize(),
                       "OpenGL does not support textures of this size on this device (" + ChilliSource::ToString(dimensions.x) + ", " + ChilliSource::ToString(dimensions.y) + ")");
 #endif
-            m_handle = BuildTexture(data, dataSize, m_renderTexture);
+            m_handle = BuildTexture(data, dataSize, m_renderTexture, m_firstMipLevel);
             
             if(k_shouldBackupMeshDataFromMemory && renderTexture->ShouldBackupData() && data)
             {
@@ -327,6 +447,125 @@ namespace CSBackend
             }
         }
         
+        //------------------------------------------------------------------------------
+        void GLTexture::StreamMipLevelRows(const u8* data, u32 dataSize, u32 firstMipLevel, u32 mipLevel, u32 firstRow) noexcept
+        {
+            CS_ASSERT(mipLevel >= firstMipLevel && mipLevel < m_renderTexture->GetNumMipLevels(), "Mip level is not part of the chain which is being streamed.");
+            
+            //Rows for a chain no larger than the loaded one are out of date, and rows streamed
+            //while the context is lost cannot be uploaded.
+            if (m_invalidData || firstMipLevel >= m_firstMipLevel)
+            {
+                return;
+            }
+            
+            //A larger chain is only started once the pending one has been fully streamed, so if
+            //one arrives the pending chain is missing rows and will never complete.
+            if (m_pendingHandle != 0 && firstMipLevel != m_pendingFirstMipLevel)
+            {
+                if (firstMipLevel > m_pendingFirstMipLevel)
+                {
+                    return;
+                }
+                
+                DiscardPendingMipLevels();
+            }
+            
+            glActiveTexture(GL_TEXTURE0);
+            
+            if (m_pendingHandle == 0)
+            {
+                glGenTextures(1, &m_pendingHandle);
+                glBindTexture(GL_TEXTURE_2D, m_pendingHandle);
+                
+                ApplyFilterMode(m_renderTexture->GetFilterMode(), m_renderTexture->IsMipmapped());
+                ApplyWrapMode(m_renderTexture->GetWrapModeS(), m_renderTexture->GetWrapModeT());
+                
+                m_pendingFirstMipLevel = firstMipLevel;
+                
+                if(m_imageDataBackup)
+                {
+                    m_pendingImageDataBackup = std::unique_ptr<u8[]>(new u8[CalcMipChainDataSize(m_renderTexture, firstMipLevel)]);
+                }
+            }
+            else
+            {
+                glBindTexture(GL_TEXTURE_2D, m_pendingHandle);
+            }
+            
+            auto dimensions = m_renderTexture->GetMipLevelDimensions(mipLevel);
+            auto rowSize = m_renderTexture->GetMipLevelDataSize(mipLevel) / u32(dimensions.y);
+            CS_ASSERT(dataSize > 0 && dataSize % rowSize == 0, "Texture data must contain a whole number of rows.");
+            
+            //Mip levels are tightly packed so rows are not necessarily 4 byte aligned.
+            glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+            
+            auto glMipLevel = GLint(mipLevel - firstMipLevel);
+            if ((m_pendingAllocatedMipLevels & (1u << mipLevel)) == 0)
+            {
+                UploadImageDataNoCompression(m_renderTexture->GetImageFormat(), glMipLevel, dimensions, nullptr);
+                m_pendingAllocatedMipLevels |= (1u << mipLevel);
+            }
+            
+            UploadImageDataRowsNoCompression(m_renderTexture->GetImageFormat(), glMipLevel, dimensions.x, firstRow, dataSize / rowSize, data);
+            
+            glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+            
+            CS_ASSERT_NOGLERROR("An OpenGL error occurred while streaming texture mip levels.");
+            
+            if(m_pendingImageDataBackup)
+            {
+                auto offset = m_renderTexture->GetMipLevelDataOffset(mipLevel) - m_renderTexture->GetMipLevelDataOffset(firstMipLevel) + firstRow * rowSize;
+                memcpy(m_pendingImageDataBackup.get() + offset, data, dataSize);
+            }
+            
+            m_pendingDataSize += dataSize;
+            
+            auto chainDataSize = CalcMipChainDataSize(m_renderTexture, firstMipLevel);
+            CS_ASSERT(m_pendingDataSize <= chainDataSize, "Too much data has been streamed for the mip chain.");
+            
+            if (m_pendingDataSize == chainDataSize)
+            {
+                glDeleteTextures(1, &m_handle);
+                m_handle = m_pendingHandle;
+                m_firstMipLevel = firstMipLevel;
+                m_imageDataSize = chainDataSize;
+                
+                if(m_pendingImageDataBackup)
+                {
+                    m_imageDataBackup = std::unique_ptr<const u8[]>(m_pendingImageDataBackup.release());
+                }
+                
+                m_pendingHandle = 0;
+                m_pendingDataSize = 0;
+                m_pendingAllocatedMipLevels = 0;
+            }
+        }
+        
+        //------------------------------------------------------------------------------
+        void GLTexture::Invalidate() noexcept
+        {
+            m_invalidData = true;
+            
+            //The pending chain is lost along with the context. Its remaining rows restart it but
+            //it can no longer complete, so it is only replaced by the next larger chain, if any.
+            m_pendingHandle = 0;
+            m_pendingDataSize = 0;
+            m_pendingAllocatedMipLevels = 0;
+            m_pendingImageDataBackup.reset();
+        }
+        
+        //------------------------------------------------------------------------------
+        void GLTexture::DiscardPendingMipLevels() noexcept
+        {
+            glDeleteTextures(1, &m_pendingHandle);
+            
+            m_pendingHandle = 0;
+            m_pendingDataSize = 0;
+            m_pendingAllocatedMipLevels = 0;
+            m_pendingImageDataBackup.reset();
+        }
+        
         //------------------------------------------------------------------------------
         void GLTexture::Restore() noexcept
         {
@@ -334,11 +573,11 @@ namespace CSBackend
             {
                 if(m_imageDataBackup)
                 {
-                    m_handle = BuildTexture(m_imageDataBackup.get(), m_imageDataSize, m_renderTexture);
+                    m_handle = BuildTexture(m_imageDataBackup.get(), m_imageDataSize, m_renderTexture, m_firstMipLevel);
                 }
                 else
                 {
-                    m_handle = BuildTexture(nullptr, 0, m_renderTexture);
+                    m_handle = BuildTexture(nullptr, 0, m_renderTexture, m_firstMipLevel);
                 }
                 m_invalidData = false;
             }
@@ -350,6 +589,11 @@ namespace CSBackend
             if(!m_invalidData)
             {
                 glDeleteTextures(1, &m_handle);
+                
+                if(m_pendingHandle != 0)
+                {
+                    glDeleteTextures(1, &m_pendingHandle);
+                }
             }
         }
     }
@@ -56,13 +56,38 @@ namespace CSBackend
             ///     The texture data.
             /// @param dataSize
             ///     The size of the texture data.
+            /// @param firstMipLevel
+            ///     The first mip level contained in the texture data, if the texture has
+            ///     precomputed mip levels.
             ///
-            GLTexture(const u8* data, u32 dataSize, ChilliSource::RenderTexture* renderTexture) noexcept;
+            GLTexture(const u8* data, u32 dataSize, u32 firstMipLevel, ChilliSource::RenderTexture* renderTexture) noexcept;
             
             /// @return The OpenGL texture handle.
             ///
             GLuint GetHandle() noexcept { return m_handle; }
             
+            /// @return The first mip level of the render texture which has been loaded. This
+            /// will be greater than 0 while a streamed texture is still being loaded.
+            ///
+            u32 GetFirstMipLevel() const noexcept { return m_firstMipLevel; }
+            
+            /// Streams a band of rows for a level of a larger precomputed mip chain into a
+            /// texture which has only been partially loaded. The chain is built on a separate
+            /// texture, which replaces the current one once all of its rows have been streamed.
+            ///
+            /// @param data
+            ///     The row data for the mip level.
+            /// @param dataSize
+            ///     The size of the row data.
+            /// @param firstMipLevel
+            ///     The first mip level of the chain which is being built.
+            /// @param mipLevel
+            ///     The mip level the row data belongs to.
+            /// @param firstRow
+            ///     The first row contained in the row data.
+            ///
+            void StreamMipLevelRows(const u8* data, u32 dataSize, u32 firstMipLevel, u32 mipLevel, u32 firstRow) noexcept;
+            
             /// @return The OpenGL texture handle.
             ///
             bool IsDataInvalid() const noexcept { return m_invalidData; }
@@ -77,7 +102,7 @@ namespace CSBackend
             /// on Android. Function will set a flag to handle safe destructing of this object, preventing
             /// us from trying to delete invalid memory.
             ///
-            void Invalidate() noexcept { m_invalidData = true; }
+            void Invalidate() noexcept;
             
             /// Destroys the OpenGL texture that this represents.
             ///
@@ -85,6 +110,11 @@ namespace CSBackend
             
         private:
             
+            /// Deletes the texture for a mip chain which is being streamed but will not be
+            /// completed.
+            ///
+            void DiscardPendingMipLevels() noexcept;
+            
             GLuint m_handle = 0;
             
             ChilliSource::RenderTexture* m_renderTexture;
@@ -93,6 +123,14 @@ namespace CSBackend
             
             u32 m_imageDataSize = 0;
             
+            u32 m_firstMipLevel = 0;
+            
+            GLuint m_pendingHandle = 0;
+            std::unique_ptr<u8[]> m_pendingImageDataBackup;
+            u32 m_pendingFirstMipLevel = 0;
+            u32 m_pendingDataSize = 0;
+            u32 m_pendingAllocatedMipLevels = 0;
+            
             bool m_invalidData = false;
         };
     }
@@ -66,6 +66,7 @@
 #include <ChilliSource/Rendering/Material/MaterialProvider.h>
 #include <ChilliSource/Rendering/Material/MaterialFactory.h>
 #include <ChilliSource/Rendering/Material/RenderMaterialGroupManager.h>
+#include <ChilliSource/Rendering/Model/AnimatedModelSystem.h>
 #include <ChilliSource/Rendering/Model/RenderMeshManager.h>
 #include <ChilliSource/Rendering/Particle/CSParticleProvider.h>
 #include <ChilliSource/Rendering/Particle/Affector/ParticleAffectorDefFactory.h>
@@ -320,6 +321,7 @@ namespace ChilliSource
         CreateSystem<TextureProvider>();
         CreateSystem<FontProvider>();
         CreateSystem<RenderComponentFactory>();
+        m_animatedModelSystem = CreateSystem<AnimatedModelSystem>();
         
         //Particles
         CreateSystem<CSParticleProvider>();
@@ -368,7 +370,11 @@ namespace ChilliSource
         auto activeState = m_stateManager->GetActiveState();
         CS_ASSERT(activeState, "Must have active state.");
         
+        m_animatedModelSystem->EvaluatePoses();
+        
         auto scene = activeState->GetScene();
+        scene->ResolveTransforms();
+        
         auto clearColour = scene->GetClearColour();
         auto camera = scene->GetActiveCamera();
         
@@ -436,6 +436,7 @@ namespace ChilliSource
         StateManager* m_stateManager = nullptr;
         TaskScheduler* m_taskScheduler = nullptr;
         Renderer* m_renderer = nullptr;
+        AnimatedModelSystem* m_animatedModelSystem = nullptr;
         Screen* m_screen = nullptr;
         PlatformSystem* m_platformSystem = nullptr;
         FileSystem* m_fileSystem = nullptr;
@@ -45,12 +45,14 @@ namespace ChilliSource
         ///         Whether or not map buffer is supported.
         /// @param isHighPrecisionFloatsSupported
         ///         Whether or not the fragment shader supports highp floats.
+        /// @param isInstancingSupported
+        ///         Whether or not hardware instanced drawing is supported.
         /// @param maxTextureSize
         ///         The maximum texture size available on this device.
         /// @param numTextureUnits
         ///         The number of texture units supported by this device.
         ///
-        RenderInfo(bool  sShadowMapsSupported, bool  sDepthTexturesSupported, bool isMapBuffersSupported, bool isHighPrecisionFloatsSupported, u32 maxTextureSize, u32 numTextureUnits) noexcept;
+        RenderInfo(bool  sShadowMapsSupported, bool  sDepthTexturesSupported, bool isMapBuffersSupported, bool isHighPrecisionFloatsSupported, bool isInstancingSupported, u32 maxTextureSize, u32 numTextureUnits) noexcept;
        
         /// @return Whether or not shadow mapping is supported.
         ///
@@ -68,6 +70,10 @@ namespace ChilliSource
         ///
         bool IsHighPrecisionFloatsSupported() const noexcept { return m_isHighPrecisionFloatsSupported; }
         
+        /// @return Whether or not hardware instanced drawing is supported.
+        ///
+        bool IsInstancingSupported() const noexcept { return m_isInstancingSupported; }
+        
         /// @return The maximum texture size available on this device.
         ///
         u32 GetMaxTextureSize() const noexcept { return m_maxTextureSize; }
@@ -82,6 +88,7 @@ namespace ChilliSource
         bool m_isDepthTexturesSupported;
         bool m_isMapBuffersSupported;
         bool m_isHighPrecisionFloatsSupported;
+        bool m_isInstancingSupported;
         
         u32 m_maxTextureSize;
         u32 m_maxTextureUnits;
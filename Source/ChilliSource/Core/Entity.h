@@ -34,5 +34,6 @@
 #include <ChilliSource/Core/Entity/Entity.h>
 #include <ChilliSource/Core/Entity/PrimitiveEntityFactory.h>
 #include <ChilliSource/Core/Entity/Transform.h>
+#include <ChilliSource/Core/Entity/TransformStore.h>
 
 #endif
\ No newline at end of file
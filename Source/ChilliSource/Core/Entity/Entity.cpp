@@ -212,6 +212,7 @@ namespace ChilliSource
         
         if(GetScene() != nullptr)
         {
+            AddVolumeToScene(in_component.get());
             in_component->OnAddedToScene();
             if (m_appActive == true)
             {
@@ -245,6 +246,7 @@ namespace ChilliSource
                         in_component->OnSuspend();
                     }
                     in_component->OnRemovedFromScene();
+                    RemoveVolumeFromScene(in_component);
                 }
                 
                 in_component->OnRemovedFromEntity();
@@ -275,6 +277,7 @@ namespace ChilliSource
                     component->OnSuspend();
                 }
                 component->OnRemovedFromScene();
+                RemoveVolumeFromScene(component);
             }
             
             component->OnRemovedFromEntity();
@@ -384,6 +387,7 @@ namespace ChilliSource
     {
         for (u32 i = 0; i < m_components.size(); ++i)
         {
+            AddVolumeToScene(m_components[i].get());
             m_components[i]->OnAddedToScene();
         }
         
@@ -428,6 +432,25 @@ namespace ChilliSource
         for (auto it = m_components.rbegin(); it != m_components.rend(); ++it)
         {
             (*it)->OnRemovedFromScene();
+            RemoveVolumeFromScene(it->get());
+        }
+    }
+    //-------------------------------------------------------------
+    //-------------------------------------------------------------
+    void Entity::AddVolumeToScene(Component* in_component)
+    {
+        if(in_component->IsA(VolumeComponent::InterfaceID))
+        {
+            m_scene->AddVolume(static_cast<VolumeComponent*>(in_component));
+        }
+    }
+    //-------------------------------------------------------------
+    //-------------------------------------------------------------
+    void Entity::RemoveVolumeFromScene(Component* in_component)
+    {
+        if(in_component->IsA(VolumeComponent::InterfaceID))
+        {
+            m_scene->RemoveVolume(static_cast<VolumeComponent*>(in_component));
         }
     }
     //----------------------------------------------------
@@ -469,6 +469,20 @@ namespace ChilliSource
         /// @author S Downie
         //-------------------------------------------------------------
         void OnRemovedFromScene();
+        //-------------------------------------------------------------
+        /// Adds the given component to the scene's spatial index if it
+        /// is a volume component.
+        ///
+        /// @param in_component - The component.
+        //-------------------------------------------------------------
+        void AddVolumeToScene(Component* in_component);
+        //-------------------------------------------------------------
+        /// Removes the given component from the scene's spatial index
+        /// if it is a volume component.
+        ///
+        /// @param in_component - The component.
+        //-------------------------------------------------------------
+        void RemoveVolumeFromScene(Component* in_component);
         
     private:
         
@@ -28,6 +28,10 @@
 
 #include <ChilliSource/Core/Entity/Transform.h>
 
+#include <ChilliSource/Core/Base/Application.h>
+#include <ChilliSource/Core/Entity/TransformStore.h>
+#include <ChilliSource/Core/Threading/TaskScheduler.h>
+
 #include <algorithm>
 
 namespace ChilliSource
@@ -37,7 +41,7 @@ namespace ChilliSource
     ///
     /// Default
     //----------------------------------------------------------------
-    Transform::Transform() : mbIsTransformCacheValid(false), mbIsParentTransformCacheValid(false), mvScale(1,1,1), mpParentTransform(nullptr)
+    Transform::Transform() : mbIsTransformCacheValid(false), mbIsParentTransformCacheValid(false), mvScale(1,1,1), mpParentTransform(nullptr), mpTransformStore(nullptr), muTransformStoreIndex(TransformStore::k_invalidIndex)
     {
     
     }
@@ -423,6 +427,12 @@ namespace ChilliSource
     //----------------------------------------------------------------
     const Matrix4& Transform::GetLocalTransform() const
     {
+        //Our own cache can only be updated on the main thread, so other threads use the last resolved local transform
+        if(mpTransformStore && (mpTransformStore->IsResolved() || !Application::Get()->GetTaskScheduler()->IsMainThread()))
+        {
+            return mpTransformStore->GetLocalTransform(muTransformStoreIndex);
+        }
+        
         //Check if the transform needs to be re-calculated
         if(!mbIsTransformCacheValid)
         {
@@ -439,6 +449,20 @@ namespace ChilliSource
     //----------------------------------------------------------------
     const Matrix4& Transform::GetWorldTransform() const
     {
+        //If we are in a transform store we can use the resolved world transform. If there are changes pending
+        //it will not be up to date, so calculate it directly from the parent chain instead. This writes to our
+        //own cache so is only done on the main thread; other threads use the last resolved world transform.
+        if(mpTransformStore)
+        {
+            if(mpTransformStore->IsResolved() || !Application::Get()->GetTaskScheduler()->IsMainThread())
+            {
+                return mpTransformStore->GetWorldTransform(muTransformStoreIndex);
+            }
+            
+            mmatWorldTransform = (mpParentTransform) ? GetLocalTransform() * mpParentTransform->GetWorldTransform() : GetLocalTransform();
+            return mmatWorldTransform;
+        }
+        
         //If we have a parent transform we must apply it to
         //our local transform to get the relative transformation
         if(mpParentTransform)
@@ -516,6 +540,11 @@ namespace ChilliSource
     //----------------------------------------------------------------
     bool Transform::IsTransformValid() const
     {
+        if(mpTransformStore)
+        {
+            return mpTransformStore->IsResolved();
+        }
+        
         return mbIsTransformCacheValid && mbIsParentTransformCacheValid;
     }
     //----------------------------------------------------------------
@@ -528,8 +557,19 @@ namespace ChilliSource
     //----------------------------------------------------------------
     void Transform::SetParentTransform(Transform* inpTransform)
     {
+        if(mpTransformStore)
+        {
+            mpTransformStore->Detach(this);
+        }
+        
         mpParentTransform = inpTransform;
         
+        //Join the parent's transform store, if it has one, along with all of our children
+        if(mpParentTransform && mpParentTransform->mpTransformStore)
+        {
+            mpParentTransform->mpTransformStore->Attach(this);
+        }
+        
         OnParentTransformChanged();
     }
     //----------------------------------------------------------------
@@ -603,6 +643,16 @@ namespace ChilliSource
         return mTransformChangedEvent;
     }
     //----------------------------------------------------------------
+    /// Resolve Changes
+    //----------------------------------------------------------------
+    void Transform::ResolveChanges() const
+    {
+        if(mpTransformStore && !mpTransformStore->IsResolved())
+        {
+            mpTransformStore->Resolve(Application::Get()->GetTaskScheduler()->GetGameLogicTaskContext());
+        }
+    }
+    //----------------------------------------------------------------
     /// On Transform Changed 
     ///
     /// Triggered when our transform changes so we can 
@@ -612,6 +662,13 @@ namespace ChilliSource
     {
         mbIsTransformCacheValid = false;
         
+        //The transform store will update our children and notify listeners when it is next resolved
+        if(mpTransformStore)
+        {
+            mpTransformStore->SetDirty(muTransformStoreIndex);
+            return;
+        }
+        
         for(std::vector<Transform*>::iterator it = mChildTransforms.begin(); it != mChildTransforms.end(); ++it)
         {
             (*it)->OnParentTransformChanged();
@@ -635,6 +692,11 @@ namespace ChilliSource
     //----------------------------------------------------------------
     void Transform::Reset()
     {
+        if(mpTransformStore)
+        {
+            mpTransformStore->Detach(this);
+        }
+        
         mbIsTransformCacheValid = false;
         mbIsParentTransformCacheValid = false;
         mvPosition = Vector3::k_zero;
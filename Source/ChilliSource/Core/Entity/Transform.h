@@ -39,6 +39,20 @@
 
 namespace ChilliSource
 {
+    //----------------------------------------------------------------
+    /// Describes the position, scale and orientation of an object,
+    /// relative to an optional parent transform.
+    ///
+    /// Transforms which belong to an entity in a scene are backed by
+    /// the scene's transform store. Changes to these only flag the
+    /// transform as dirty; world matrices are resolved for the whole
+    /// scene once per frame, prior to the render snapshot, after which
+    /// the transform changed events are sent. Querying the world
+    /// transform in the meantime calculates it directly from the
+    /// parent chain on the main thread, while other threads read it
+    /// as of the last resolve. Transforms outside of a scene are
+    /// updated and send their transform changed events immediately.
+    //----------------------------------------------------------------
     class Transform
     {
     public:
@@ -257,6 +271,11 @@ namespace ChilliSource
         //----------------------------------------------------------------
         /// Get World Transform
         ///
+        /// For transforms in a scene this can be read from any thread
+        /// other than while the scene's transforms are being resolved.
+        /// Other threads read the world transform as of the last time
+        /// they were resolved.
+        ///
         /// @return The tranform in relation to its parent transform
         //----------------------------------------------------------------
         const Matrix4& GetWorldTransform() const;
@@ -326,11 +345,26 @@ namespace ChilliSource
         /// Get Tranform Changed Event
         ///
         /// Subscribe to this event for notifications of when this
-        /// transform is invalidated
+        /// transform is invalidated. For transforms in a scene this
+        /// is sent once per frame, when the scene's transform store
+        /// is resolved, rather than on every change.
         ///
         /// @return TransformChangedDelegate event
         //----------------------------------------------------------------
         IConnectableEvent<TransformChangedDelegate>& GetTransformChangedEvent();
+        //----------------------------------------------------------------
+        /// Resolve Changes
+        ///
+        /// Resolves any pending changes to the transforms in the same
+        /// scene as this one and sends their transform changed events.
+        /// This should be called before reading any state which is
+        /// cached from transform changed events, so it reflects changes
+        /// made earlier in the frame. Does nothing for transforms which
+        /// are not in a scene.
+        ///
+        /// This must be called on the main thread.
+        //----------------------------------------------------------------
+        void ResolveChanges() const;
         
         //----------------------------------------------------------------
         /// Resets the transform back to identity and removes any
@@ -341,6 +375,7 @@ namespace ChilliSource
         void Reset();
         
     private:
+        friend class TransformStore;
         
         //----------------------------------------------------------------
         /// On Transform Changed 
@@ -376,6 +411,9 @@ namespace ChilliSource
         
         std::vector<Transform*> mChildTransforms;
         
+        TransformStore* mpTransformStore;
+        u32 muTransformStoreIndex;
+        
         mutable bool mbIsTransformCacheValid;
         mutable bool mbIsParentTransformCacheValid;
     };
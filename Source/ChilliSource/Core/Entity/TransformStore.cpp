@@ -0,0 +1,321 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2016 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#include <ChilliSource/Core/Entity/TransformStore.h>
+
+#include <ChilliSource/Core/Entity/Transform.h>
+#include <ChilliSource/Core/Threading/TaskContext.h>
+
+#include <algorithm>
+
+namespace ChilliSource
+{
+    namespace
+    {
+        constexpr u32 k_minTransformsPerBatch = 256;
+    }
+    
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    void TransformStore::AddRoot(Transform* in_transform) noexcept
+    {
+        CS_ASSERT(in_transform != nullptr, "Cannot add a null transform.");
+        CS_ASSERT(in_transform->mpParentTransform == nullptr, "Cannot add a transform with a parent as a root.");
+        CS_ASSERT(in_transform->mpTransformStore == nullptr, "Cannot add a transform which is already in a store.");
+        
+        m_roots.push_back(in_transform);
+        Attach(in_transform);
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    void TransformStore::RemoveRoot(Transform* in_transform) noexcept
+    {
+        CS_ASSERT(in_transform != nullptr, "Cannot remove a null transform.");
+        CS_ASSERT(std::find(m_roots.begin(), m_roots.end(), in_transform) != m_roots.end(), "Cannot remove a transform which is not a root in this store.");
+        
+        Detach(in_transform);
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    void TransformStore::RemoveAll() noexcept
+    {
+        while (m_roots.empty() == false)
+        {
+            Detach(m_roots.back());
+        }
+        
+        m_transforms.clear();
+        m_parentIndices.clear();
+        m_localTransforms.clear();
+        m_worldTransforms.clear();
+        m_dirtyFlags.clear();
+        m_changedFlags.clear();
+        m_depthOffsets.clear();
+        
+        m_isOrderingDirty = false;
+        m_hasPendingChanges = false;
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    bool TransformStore::IsResolved() const noexcept
+    {
+        return (m_isOrderingDirty == false && m_hasPendingChanges == false);
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    void TransformStore::Resolve(const TaskContext& in_taskContext) noexcept
+    {
+        //changes made by transform changed listeners while resolving are left for the next pass.
+        if (m_isResolving == true)
+        {
+            return;
+        }
+        
+        if (m_isOrderingDirty == true)
+        {
+            RebuildOrdering();
+        }
+        
+        if (m_hasPendingChanges == false)
+        {
+            return;
+        }
+        
+        //each depth level only depends on the level above it, so the transforms within a level can be processed in parallel.
+        for (u32 depth = 0; depth + 1 < u32(m_depthOffsets.size()); ++depth)
+        {
+            u32 levelStart = m_depthOffsets[depth];
+            u32 levelSize = m_depthOffsets[depth + 1] - levelStart;
+            
+            in_taskContext.ParallelFor(levelSize, k_minTransformsPerBatch, [=](const TaskContext& in_innerTaskContext, u32 in_startIndex, u32 in_endIndex)
+            {
+                ResolveRange(levelStart + in_startIndex, levelStart + in_endIndex);
+            });
+        }
+        
+        m_hasPendingChanges = false;
+        m_isResolving = true;
+        
+        //Notify listeners in depth order. Listeners may change transforms, which will be resolved on the next pass, or add and
+        //remove transforms, which null out entries but never reallocate the arrays until the ordering is next rebuilt.
+        for (u32 i = 0; i < u32(m_transforms.size()); ++i)
+        {
+            if (m_changedFlags[i] != 0)
+            {
+                m_changedFlags[i] = 0;
+                
+                if (m_transforms[i] != nullptr)
+                {
+                    m_transforms[i]->mTransformChangedEvent.NotifyConnections();
+                }
+            }
+        }
+        
+        m_isResolving = false;
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    void TransformStore::Attach(Transform* in_transform) noexcept
+    {
+        in_transform->mpTransformStore = this;
+        in_transform->muTransformStoreIndex = k_invalidIndex;
+        
+        for (auto child : in_transform->mChildTransforms)
+        {
+            Attach(child);
+        }
+        
+        m_isOrderingDirty = true;
+        m_hasPendingChanges = true;
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    void TransformStore::Detach(Transform* in_transform) noexcept
+    {
+        CS_ASSERT(in_transform->mpTransformStore == this, "Cannot detach a transform which is not in this store.");
+        
+        auto rootIt = std::find(m_roots.begin(), m_roots.end(), in_transform);
+        if (rootIt != m_roots.end())
+        {
+            m_roots.erase(rootIt);
+        }
+        
+        if (in_transform->muTransformStoreIndex != k_invalidIndex)
+        {
+            m_transforms[in_transform->muTransformStoreIndex] = nullptr;
+        }
+        
+        //the transform no longer has a resolved world matrix, so its own cache needs to be rebuilt.
+        in_transform->mpTransformStore = nullptr;
+        in_transform->muTransformStoreIndex = k_invalidIndex;
+        in_transform->mbIsTransformCacheValid = false;
+        in_transform->mbIsParentTransformCacheValid = false;
+        
+        for (auto child : in_transform->mChildTransforms)
+        {
+            Detach(child);
+        }
+        
+        m_isOrderingDirty = true;
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    void TransformStore::SetDirty(u32 in_index) noexcept
+    {
+        if (in_index != k_invalidIndex)
+        {
+            m_dirtyFlags[in_index] = 1;
+        }
+        
+        m_hasPendingChanges = true;
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    const Matrix4& TransformStore::GetLocalTransform(u32 in_index) const noexcept
+    {
+        CS_ASSERT(in_index != k_invalidIndex, "Cannot get the local transform of a transform which has not been resolved.");
+        
+        return m_localTransforms[in_index];
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    const Matrix4& TransformStore::GetWorldTransform(u32 in_index) const noexcept
+    {
+        CS_ASSERT(in_index != k_invalidIndex, "Cannot get the world transform of a transform which has not been resolved.");
+        
+        return m_worldTransforms[in_index];
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    void TransformStore::RebuildOrdering() noexcept
+    {
+        std::vector<Matrix4> previousLocalTransforms;
+        std::vector<Matrix4> previousWorldTransforms;
+        std::vector<u8> previousDirtyFlags;
+        
+        std::swap(previousLocalTransforms, m_localTransforms);
+        std::swap(previousWorldTransforms, m_worldTransforms);
+        std::swap(previousDirtyFlags, m_dirtyFlags);
+        
+        u32 previousSize = u32(m_transforms.size());
+        m_transforms.clear();
+        m_parentIndices.clear();
+        m_changedFlags.clear();
+        m_depthOffsets.clear();
+        
+        m_localTransforms.reserve(previousSize);
+        m_worldTransforms.reserve(previousSize);
+        m_dirtyFlags.reserve(previousSize);
+        
+        //transforms which were already in the store keep their resolved state, while new transforms always need resolving.
+        auto addTransform = [&](Transform* in_transform, u32 in_parentIndex)
+        {
+            u32 previousIndex = in_transform->muTransformStoreIndex;
+            in_transform->muTransformStoreIndex = u32(m_transforms.size());
+            
+            m_transforms.push_back(in_transform);
+            m_parentIndices.push_back(in_parentIndex);
+            
+            if (previousIndex != k_invalidIndex)
+            {
+                m_localTransforms.push_back(previousLocalTransforms[previousIndex]);
+                m_worldTransforms.push_back(previousWorldTransforms[previousIndex]);
+                m_dirtyFlags.push_back(previousDirtyFlags[previousIndex]);
+            }
+            else
+            {
+                m_localTransforms.push_back(Matrix4::k_identity);
+                m_worldTransforms.push_back(Matrix4::k_identity);
+                m_dirtyFlags.push_back(1);
+            }
+        };
+        
+        for (auto root : m_roots)
+        {
+            addTransform(root, k_invalidIndex);
+        }
+        
+        //breadth first, so that each depth level is contiguous and follows the level above it.
+        u32 levelStart = 0;
+        while (levelStart < u32(m_transforms.size()))
+        {
+            u32 levelEnd = u32(m_transforms.size());
+            m_depthOffsets.push_back(levelStart);
+            
+            for (u32 i = levelStart; i < levelEnd; ++i)
+            {
+                for (auto child : m_transforms[i]->mChildTransforms)
+                {
+                    addTransform(child, i);
+                }
+            }
+            
+            levelStart = levelEnd;
+        }
+        
+        m_depthOffsets.push_back(u32(m_transforms.size()));
+        m_changedFlags.resize(m_transforms.size(), 0);
+        
+        m_isOrderingDirty = false;
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    void TransformStore::ResolveRange(u32 in_startIndex, u32 in_endIndex) noexcept
+    {
+        for (u32 i = in_startIndex; i < in_endIndex; ++i)
+        {
+            const Transform* transform = m_transforms[i];
+            u32 parentIndex = m_parentIndices[i];
+            bool isParentChanged = (parentIndex != k_invalidIndex && m_changedFlags[parentIndex] != 0);
+            
+            if (m_dirtyFlags[i] != 0)
+            {
+                m_dirtyFlags[i] = 0;
+                m_localTransforms[i] = Matrix4::CreateTransform(transform->mvPosition, transform->mvScale, transform->mqOrientation);
+            }
+            else if (isParentChanged == false)
+            {
+                continue;
+            }
+            
+            m_changedFlags[i] = 1;
+            
+            if (parentIndex != k_invalidIndex)
+            {
+                m_worldTransforms[i] = m_localTransforms[i] * m_worldTransforms[parentIndex];
+            }
+            else
+            {
+                m_worldTransforms[i] = m_localTransforms[i];
+            }
+        }
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    TransformStore::~TransformStore() noexcept
+    {
+        RemoveAll();
+    }
+}
@@ -0,0 +1,171 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2016 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#ifndef _CHILLISOURCE_CORE_ENTITY_TRANSFORMSTORE_H_
+#define _CHILLISOURCE_CORE_ENTITY_TRANSFORMSTORE_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Math/Matrix4.h>
+
+#include <vector>
+
+namespace ChilliSource
+{
+    //------------------------------------------------------------------------------
+    /// Stores the local and world matrices of every transform in a scene in
+    /// contiguous arrays, ordered by depth in the hierarchy such that each
+    /// transform's parent always precedes it.
+    ///
+    /// Changes to a transform in the store only flag it as dirty. The world
+    /// matrices of all dirty transforms, and their descendants, are then resolved
+    /// in a single pass once per frame, processing each depth level in parallel.
+    /// Consumers of state cached from transforms can resolve the store earlier
+    /// through Transform::ResolveChanges(). Once resolved, the transform changed
+    /// events of each affected transform are sent on the main thread.
+    ///
+    /// Transforms act as a facade over the store, so this should rarely need to
+    /// be used directly. Other than reading the last resolved matrices while the
+    /// store is not being resolved, this is not thread-safe and should only be
+    /// accessed from the main thread.
+    //------------------------------------------------------------------------------
+    class TransformStore final
+    {
+    public:
+        CS_DECLARE_NOCOPY(TransformStore);
+        //------------------------------------------------------------------------------
+        /// Constructor.
+        //------------------------------------------------------------------------------
+        TransformStore() = default;
+        //------------------------------------------------------------------------------
+        /// Adds the given transform, and all of its descendants, to the store. The
+        /// transform cannot have a parent or already be in a store. Descendants later
+        /// added to or removed from the hierarchy are added to or removed from the
+        /// store automatically.
+        ///
+        /// @param in_transform - The root transform to add.
+        //------------------------------------------------------------------------------
+        void AddRoot(Transform* in_transform) noexcept;
+        //------------------------------------------------------------------------------
+        /// Removes the given root transform, and all of its descendants, from the
+        /// store.
+        ///
+        /// @param in_transform - The root transform to remove.
+        //------------------------------------------------------------------------------
+        void RemoveRoot(Transform* in_transform) noexcept;
+        //------------------------------------------------------------------------------
+        /// Removes all transforms from the store.
+        //------------------------------------------------------------------------------
+        void RemoveAll() noexcept;
+        //------------------------------------------------------------------------------
+        /// @return Whether or not the world matrices of all transforms in the store
+        /// are up to date.
+        //------------------------------------------------------------------------------
+        bool IsResolved() const noexcept;
+        //------------------------------------------------------------------------------
+        /// Recalculates the world matrix of every transform which has changed since
+        /// the store was last resolved, then notifies the transform changed event of
+        /// each. Each depth level in the hierarchy is processed in parallel. Calls
+        /// made from a transform changed event do nothing.
+        ///
+        /// This must be called on the main thread.
+        ///
+        /// @param in_taskContext - The task context used to process the transforms
+        /// in parallel.
+        //------------------------------------------------------------------------------
+        void Resolve(const TaskContext& in_taskContext) noexcept;
+        //------------------------------------------------------------------------------
+        /// Destructor.
+        //------------------------------------------------------------------------------
+        ~TransformStore() noexcept;
+        
+    private:
+        friend class Transform;
+        
+        static constexpr u32 k_invalidIndex = 0xffffffff;
+        
+        //------------------------------------------------------------------------------
+        /// Adds the given transform and its descendants to the store. They will be
+        /// assigned a position in the store the next time it is resolved.
+        ///
+        /// @param in_transform - The transform to attach.
+        //------------------------------------------------------------------------------
+        void Attach(Transform* in_transform) noexcept;
+        //------------------------------------------------------------------------------
+        /// Removes the given transform and its descendants from the store.
+        ///
+        /// @param in_transform - The transform to detach.
+        //------------------------------------------------------------------------------
+        void Detach(Transform* in_transform) noexcept;
+        //------------------------------------------------------------------------------
+        /// Flags the given transform as having changed since the store was last
+        /// resolved.
+        ///
+        /// @param in_index - The index of the transform in the store.
+        //------------------------------------------------------------------------------
+        void SetDirty(u32 in_index) noexcept;
+        //------------------------------------------------------------------------------
+        /// @param in_index - The index of the transform in the store.
+        ///
+        /// @return The local matrix of the transform as of the last resolve.
+        //------------------------------------------------------------------------------
+        const Matrix4& GetLocalTransform(u32 in_index) const noexcept;
+        //------------------------------------------------------------------------------
+        /// @param in_index - The index of the transform in the store.
+        ///
+        /// @return The world matrix of the transform as of the last resolve.
+        //------------------------------------------------------------------------------
+        const Matrix4& GetWorldTransform(u32 in_index) const noexcept;
+        //------------------------------------------------------------------------------
+        /// Rebuilds the depth ordered arrays from the root transforms. Transforms
+        /// which were already in the store retain their matrices and dirty state,
+        /// while newly added transforms are flagged as dirty.
+        //------------------------------------------------------------------------------
+        void RebuildOrdering() noexcept;
+        //------------------------------------------------------------------------------
+        /// Resolves the given range of transforms. The parents of all transforms in
+        /// the range must already have been resolved.
+        ///
+        /// @param in_startIndex - The first index in the range.
+        /// @param in_endIndex - The end of the range (exclusive).
+        //------------------------------------------------------------------------------
+        void ResolveRange(u32 in_startIndex, u32 in_endIndex) noexcept;
+        
+        std::vector<Transform*> m_roots;
+        
+        std::vector<Transform*> m_transforms;
+        std::vector<u32> m_parentIndices;
+        std::vector<Matrix4> m_localTransforms;
+        std::vector<Matrix4> m_worldTransforms;
+        std::vector<u8> m_dirtyFlags;
+        std::vector<u8> m_changedFlags;
+        std::vector<u32> m_depthOffsets;
+        
+        bool m_isOrderingDirty = false;
+        bool m_hasPendingChanges = false;
+        bool m_isResolving = false;
+    };
+}
+
+#endif
@@ -84,6 +84,7 @@ namespace ChilliSource
     CS_FORWARDDECLARE_CLASS(Entity);
     CS_FORWARDDECLARE_CLASS(PrimitiveEntityFactory);
     CS_FORWARDDECLARE_CLASS(Transform);
+    CS_FORWARDDECLARE_CLASS(TransformStore);
     //---------------------------------------------------------
     /// Event
     //---------------------------------------------------------
@@ -136,6 +137,8 @@ namespace ChilliSource
     CS_FORWARDDECLARE_CLASS(Line);
     CS_FORWARDDECLARE_CLASS(Plane);
     CS_FORWARDDECLARE_CLASS(Frustum);
+    CS_FORWARDDECLARE_CLASS(AABBTree);
+    CS_FORWARDDECLARE_CLASS(SphereBatch);
     CS_FORWARDDECLARE_STRUCT(UnifiedScalar);
     CS_FORWARDDECLARE_STRUCT(UnifiedVector2);
     CS_FORWARDDECLARE_STRUCT(UnifiedRectangle);
@@ -218,10 +221,12 @@ namespace ChilliSource
     //---------------------------------------------------------
     CS_FORWARDDECLARE_CLASS(SingleThreadTaskPool);
     CS_FORWARDDECLARE_CLASS(TaskContext);
+    CS_FORWARDDECLARE_CLASS(TaskGraph);
     CS_FORWARDDECLARE_CLASS(TaskPool);
     CS_FORWARDDECLARE_CLASS(TaskScheduler);
     CS_FORWARDDECLARE_CLASS(TaskScheduler);
     CS_FORWARDDECLARE_CLASS(ThreadPool);
+    enum class FileTaskPriority;
     enum class TaskType;
     //---------------------------------------------------------
     /// Time
@@ -37,6 +37,9 @@
 
 #include <minizip/unzip.h>
 
+#include <algorithm>
+#include <vector>
+
 namespace ChilliSource
 {
     namespace
@@ -73,6 +76,30 @@ namespace ChilliSource
             u32 m_originalDataSize;
             u32 m_compressedDataSize;
         };
+        //------------------------------------------------------
+        /// A container for the imformation provided in the
+        /// csimage header version 4.
+        //------------------------------------------------------
+        struct ImageHeaderVersion4
+        {
+            u32 m_width;
+            u32 m_height;
+            u32 m_imageFormat;
+            u32 m_compression;
+            u32 m_numMipLevels;
+        };
+        //------------------------------------------------------
+        /// A container for the imformation provided for each
+        /// mip level in a csimage version 4 file. The data
+        /// offset is relative to the start of the file.
+        //------------------------------------------------------
+        struct MipLevelHeaderVersion4
+        {
+            u64 m_checksum;
+            u32 m_originalDataSize;
+            u32 m_compressedDataSize;
+            u32 m_dataOffset;
+        };
         //-------------------------------------------------------
         /// @author S Downie
         ///
@@ -195,6 +222,129 @@ namespace ChilliSource
             Image* outpImage = (Image*)out_resource.get();
             outpImage->Build(desc, std::move(imageData));
         }
+        //-------------------------------------------------------
+        /// Reads a version 4 formatted .csimage file. Version 4
+        /// files contain a precomputed chain of mip levels, each
+        /// of which is compressed separately and can be found
+        /// through the offset in its mip level header. The levels
+        /// are read into a single buffer, largest first.
+        ///
+        /// @param Pointer to image data file
+        /// @param Pointer to resource destination
+        ///
+        /// @return Whether or not the image could be read.
+        //-------------------------------------------------------
+        bool ReadFileVersion4(const IBinaryInputStreamUPtr& in_stream, const ResourceSPtr& out_resource)
+        {
+            //Read the header
+            ImageHeaderVersion4 sHeader;
+            in_stream->Read((u8*)&sHeader.m_width, sizeof(u32));
+            in_stream->Read((u8*)&sHeader.m_height, sizeof(u32));
+            in_stream->Read((u8*)&sHeader.m_imageFormat, sizeof(u32));
+            in_stream->Read((u8*)&sHeader.m_compression, sizeof(u32));
+            in_stream->Read((u8*)&sHeader.m_numMipLevels, sizeof(u32));
+            
+            //A full chain halves the largest dimension down to 1, so any more levels than that are invalid.
+            u32 udwMaxNumMipLevels = 1;
+            for(u32 udwLargestDimension = std::max(sHeader.m_width, sHeader.m_height); udwLargestDimension > 1; udwLargestDimension >>= 1)
+            {
+                ++udwMaxNumMipLevels;
+            }
+            
+            if(sHeader.m_numMipLevels == 0 || sHeader.m_numMipLevels > udwMaxNumMipLevels)
+            {
+                CS_LOG_ERROR("Invalid CSImage mip level count: " + ToString(sHeader.m_numMipLevels));
+                return false;
+            }
+            
+            std::vector<MipLevelHeaderVersion4> aMipLevelHeaders(sHeader.m_numMipLevels);
+            for(auto& sMipLevelHeader : aMipLevelHeaders)
+            {
+                in_stream->Read((u8*)&sMipLevelHeader.m_checksum, sizeof(u64));
+                in_stream->Read((u8*)&sMipLevelHeader.m_originalDataSize, sizeof(u32));
+                in_stream->Read((u8*)&sMipLevelHeader.m_compressedDataSize, sizeof(u32));
+                in_stream->Read((u8*)&sMipLevelHeader.m_dataOffset, sizeof(u32));
+            }
+            
+            //Calculate where each level lives in the output buffer
+            ImageFormat eFormat = ImageFormat::k_RGBA8888;
+            std::vector<u32> aMipLevelOffsets(sHeader.m_numMipLevels);
+            u32 udwSize = 0;
+            for(u32 i = 0; i < sHeader.m_numMipLevels; ++i)
+            {
+                u32 udwMipLevelSize = 0;
+                if(GetFormatInfo(sHeader.m_imageFormat, std::max(sHeader.m_width >> i, 1u), std::max(sHeader.m_height >> i, 1u), eFormat, udwMipLevelSize) == false)
+                {
+                    CS_LOG_ERROR("Invalid CSImage format: " + ToString(sHeader.m_imageFormat));
+                    return false;
+                }
+                
+                if(udwMipLevelSize != aMipLevelHeaders[i].m_originalDataSize)
+                {
+                    CS_LOG_ERROR("CSImage mip level " + ToString(i) + " size of " + ToString(aMipLevelHeaders[i].m_originalDataSize) + " does not match its dimensions.");
+                    return false;
+                }
+                
+                aMipLevelOffsets[i] = udwSize;
+                udwSize += udwMipLevelSize;
+            }
+            
+            u8* pubyBitmapData = new u8[udwSize];
+            std::vector<u8> aubyCompressedData;
+            
+            //Levels are stored smallest first, so are read in that order to keep reads sequential
+            for(u32 i = sHeader.m_numMipLevels; i > 0; --i)
+            {
+                const auto& sMipLevelHeader = aMipLevelHeaders[i - 1];
+                u8* pubyMipLevelData = pubyBitmapData + aMipLevelOffsets[i - 1];
+                
+                in_stream->SetReadPosition(sMipLevelHeader.m_dataOffset);
+                
+                if(sHeader.m_compression != 0)
+                {
+                    aubyCompressedData.resize(sMipLevelHeader.m_compressedDataSize);
+                    in_stream->Read(aubyCompressedData.data(), sMipLevelHeader.m_compressedDataSize);
+                    
+                    z_stream infstream;
+                    infstream.zalloc = Z_NULL;
+                    infstream.zfree = Z_NULL;
+                    infstream.opaque = Z_NULL;
+                    infstream.avail_in = sMipLevelHeader.m_compressedDataSize;
+                    infstream.next_in = (Bytef*)aubyCompressedData.data();
+                    infstream.avail_out = sMipLevelHeader.m_originalDataSize;
+                    infstream.next_out = (Bytef*)pubyMipLevelData;
+                    
+                    inflateInit(&infstream);
+                    inflate(&infstream, Z_FINISH);
+                    inflateEnd(&infstream);
+                    
+                    u32 udwInflatedChecksum = HashCRC32::GenerateHashCode((const s8*)pubyMipLevelData, sMipLevelHeader.m_originalDataSize);
+                    if(sMipLevelHeader.m_checksum != (u64)udwInflatedChecksum)
+                    {
+                        CS_LOG_ERROR("CSImage mip level " + ToString(i - 1) + " checksum of "+ToString(udwInflatedChecksum)+" does not match expected checksum "+ToString(sMipLevelHeader.m_checksum));
+                    }
+                }
+                else
+                {
+                    in_stream->Read(pubyMipLevelData, sMipLevelHeader.m_originalDataSize);
+                }
+            }
+            
+            Image::ImageDataUPtr imageData(pubyBitmapData);
+            
+            Image::Descriptor desc;
+            desc.m_format = eFormat;
+            desc.m_compression = ImageCompression::k_none;
+            desc.m_width = sHeader.m_width;
+            desc.m_height = sHeader.m_height;
+            desc.m_dataSize = udwSize;
+            desc.m_numMipLevels = sHeader.m_numMipLevels;
+            
+            Image* outpImage = (Image*)out_resource.get();
+            outpImage->Build(desc, std::move(imageData));
+            
+            return true;
+        }
         //----------------------------------------------------
         /// Performs the heavy lifting for the 2 create methods
         ///
@@ -204,8 +354,10 @@ namespace ChilliSource
         /// @param The filepath.
         /// @param Completion delegate
         /// @param [Out] The output resource.
+        /// @param The context of the file task the image is loaded in. The load fails
+        /// if this is cancelled. May be null if loading synchronously.
         //----------------------------------------------------
-        void LoadImage(StorageLocation in_storageLocation, const std::string& in_filepath, const ResourceProvider::AsyncLoadDelegate& in_delegate, const ResourceSPtr& out_resource)
+        void LoadImage(StorageLocation in_storageLocation, const std::string& in_filepath, const ResourceProvider::AsyncLoadDelegate& in_delegate, const ResourceSPtr& out_resource, const TaskContext* in_taskContext)
         {
             auto pImageFile = Application::Get()->GetFileSystem()->CreateBinaryInputStream(in_storageLocation, in_filepath);
             
@@ -230,12 +382,43 @@ namespace ChilliSource
             //Read the version
             u32 udwVersion = 0;
             pImageFile->Read((u8*)&udwVersion, sizeof(u32));
-            CS_ASSERT(udwVersion >= 3, "Only version 3 and above supported");
+            CS_ASSERT(udwVersion >= 3 && udwVersion <= 4, "Only versions 3 and 4 supported");
 
-            ReadFileVersion3(pImageFile, out_resource);
+            if(udwVersion == 4)
+            {
+                if(ReadFileVersion4(pImageFile, out_resource) == false)
+                {
+                    out_resource->SetLoadState(Resource::LoadState::k_failed);
+                    if(in_delegate != nullptr)
+                    {
+                        Application::Get()->GetTaskScheduler()->ScheduleTask(TaskType::k_mainThread, [=](const TaskContext&) noexcept
+                        {
+                            in_delegate(out_resource);
+                        });
+                    }
+                    return;
+                }
+            }
+            else
+            {
+                ReadFileVersion3(pImageFile, out_resource);
+            }
 
             pImageFile.reset();
             
+            if(in_taskContext != nullptr && in_taskContext->IsCancelled() == true)
+            {
+                out_resource->SetLoadState(Resource::LoadState::k_failed);
+                if(in_delegate != nullptr)
+                {
+                    Application::Get()->GetTaskScheduler()->ScheduleTask(TaskType::k_mainThread, [=](const TaskContext&) noexcept
+                    {
+                        in_delegate(out_resource);
+                    });
+                }
+                return;
+            }
+            
             out_resource->SetLoadState(Resource::LoadState::k_loaded);
             if(in_delegate != nullptr)
             {
@@ -276,15 +459,15 @@ namespace ChilliSource
     //-------------------------------------------------------
     void CSImageProvider::CreateResourceFromFile(StorageLocation in_storageLocation, const std::string& in_filepath, const IResourceOptionsBaseCSPtr& in_options, const ResourceSPtr& out_resource)
     {
-        LoadImage(in_storageLocation, in_filepath, nullptr, out_resource);
+        LoadImage(in_storageLocation, in_filepath, nullptr, out_resource, nullptr);
     }
     //----------------------------------------------------
     //----------------------------------------------------
     void CSImageProvider::CreateResourceFromFileAsync(StorageLocation in_storageLocation, const std::string& in_filepath, const IResourceOptionsBaseCSPtr& in_options, const ResourceProvider::AsyncLoadDelegate& in_delegate, const ResourceSPtr& out_resource)
     {
-        Application::Get()->GetTaskScheduler()->ScheduleTask(TaskType::k_file, [=](const TaskContext&) noexcept
+        Application::Get()->GetTaskScheduler()->ScheduleTask(TaskType::k_file, [=](const TaskContext& in_taskContext) noexcept
         {
-            LoadImage(in_storageLocation, in_filepath, in_delegate, out_resource);
+            LoadImage(in_storageLocation, in_filepath, in_delegate, out_resource, &in_taskContext);
         });
     }
 }
@@ -96,4 +96,10 @@ namespace ChilliSource
     {
         return m_dataDesc.m_dataSize;
     }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    u32 Image::GetNumMipLevels() const
+    {
+        return m_dataDesc.m_numMipLevels;
+    }
 }
@@ -60,6 +60,7 @@ namespace ChilliSource
             u32 m_width;
             u32 m_height;
             u32 m_dataSize;
+            u32 m_numMipLevels = 1;
         };
         //----------------------------------------------------------------
         /// @author S Downie
@@ -110,6 +111,16 @@ namespace ChilliSource
         //----------------------------------------------------------------
         u32 GetDataSize() const;
         //----------------------------------------------------------------
+        /// Images can contain a precomputed chain of mip levels, stored
+        /// largest first and tightly packed. The width, height and
+        /// format describe the top level and the data size includes
+        /// every level.
+        ///
+        /// @return The number of mip levels in the image data,
+        /// including the top level.
+        //----------------------------------------------------------------
+        u32 GetNumMipLevels() const;
+        //----------------------------------------------------------------
         /// Use datasize, width, height, format and compression
         /// to decode
         ///
@@ -58,6 +58,7 @@ namespace ChilliSource
             desc.m_height = in_image->GetHeight();
             desc.m_dataSize = rawBuffer.m_size;
             desc.m_compression = in_image->GetCompression();
+            desc.m_numMipLevels = in_image->GetNumMipLevels();
             desc.m_format = ImageFormat::k_RGB888;
             in_image->Build(desc, std::move(rawBuffer.m_data));
         }
@@ -74,6 +75,7 @@ namespace ChilliSource
             desc.m_height = in_image->GetHeight();
             desc.m_dataSize = rawBuffer.m_size;
             desc.m_compression = in_image->GetCompression();
+            desc.m_numMipLevels = in_image->GetNumMipLevels();
             desc.m_format = ImageFormat::k_RGBA4444;
             in_image->Build(desc, std::move(rawBuffer.m_data));
         }
@@ -90,6 +92,7 @@ namespace ChilliSource
             desc.m_height = in_image->GetHeight();
             desc.m_dataSize = rawBuffer.m_size;
             desc.m_compression = in_image->GetCompression();
+            desc.m_numMipLevels = in_image->GetNumMipLevels();
             desc.m_format = ImageFormat::k_RGB565;
             in_image->Build(desc, std::move(rawBuffer.m_data));
         }
@@ -106,6 +109,7 @@ namespace ChilliSource
             desc.m_height = in_image->GetHeight();
             desc.m_dataSize = rawBuffer.m_size;
             desc.m_compression = in_image->GetCompression();
+            desc.m_numMipLevels = in_image->GetNumMipLevels();
             desc.m_format = ImageFormat::k_LumA88;
             in_image->Build(desc, std::move(rawBuffer.m_data));
         }
@@ -122,6 +126,7 @@ namespace ChilliSource
             desc.m_height = in_image->GetHeight();
             desc.m_dataSize = rawBuffer.m_size;
             desc.m_compression = in_image->GetCompression();
+            desc.m_numMipLevels = in_image->GetNumMipLevels();
             desc.m_format = ImageFormat::k_Lum8;
             in_image->Build(desc, std::move(rawBuffer.m_data));
         }
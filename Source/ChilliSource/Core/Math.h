@@ -36,12 +36,15 @@
 #include <ChilliSource/Core/Math/Matrix4.h>
 #include <ChilliSource/Core/Math/Quaternion.h>
 #include <ChilliSource/Core/Math/Random.h>
+#include <ChilliSource/Core/Math/SIMD.h>
 #include <ChilliSource/Core/Math/UnifiedCoordinates.h>
 #include <ChilliSource/Core/Math/Vector2.h>
 #include <ChilliSource/Core/Math/Vector3.h>
 #include <ChilliSource/Core/Math/Vector4.h>
+#include <ChilliSource/Core/Math/Geometry/AABBTree.h>
 #include <ChilliSource/Core/Math/Geometry/Curves.h>
 #include <ChilliSource/Core/Math/Geometry/ShapeIntersection.h>
 #include <ChilliSource/Core/Math/Geometry/Shapes.h>
+#include <ChilliSource/Core/Math/Geometry/SphereBatch.h>
 
 #endif
\ No newline at end of file
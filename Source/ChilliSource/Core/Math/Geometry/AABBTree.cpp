@@ -0,0 +1,750 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2016 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#include <ChilliSource/Core/Math/Geometry/AABBTree.h>
+
+#include <ChilliSource/Core/Math/Geometry/Shapes.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace ChilliSource
+{
+    namespace
+    {
+        constexpr f32 k_fatMarginFraction = 0.1f;
+        constexpr f32 k_maxFatAreaRatio = 4.0f;
+        constexpr u32 k_fixedQueryStackSize = 64;
+        
+        //------------------------------------------------------------------------------
+        /// A stack of node indices used while traversing the tree. The stack lives on
+        /// the call stack unless the tree is unusually deep, allowing queries to be
+        /// performed without allocation, and from multiple threads at once.
+        //------------------------------------------------------------------------------
+        class QueryStack final
+        {
+        public:
+            //------------------------------------------------------------------------------
+            /// @param in_nodeIndex - The node index to push.
+            //------------------------------------------------------------------------------
+            void Push(u32 in_nodeIndex) noexcept
+            {
+                if (m_size < k_fixedQueryStackSize)
+                {
+                    m_fixed[m_size] = in_nodeIndex;
+                }
+                else
+                {
+                    m_overflow.push_back(in_nodeIndex);
+                }
+                ++m_size;
+            }
+            //------------------------------------------------------------------------------
+            /// @return The node index which was popped.
+            //------------------------------------------------------------------------------
+            u32 Pop() noexcept
+            {
+                --m_size;
+                if (m_size < k_fixedQueryStackSize)
+                {
+                    return m_fixed[m_size];
+                }
+                
+                u32 nodeIndex = m_overflow.back();
+                m_overflow.pop_back();
+                return nodeIndex;
+            }
+            //------------------------------------------------------------------------------
+            /// @return Whether or not the stack is empty.
+            //------------------------------------------------------------------------------
+            bool IsEmpty() const noexcept { return m_size == 0; }
+            
+        private:
+            u32 m_fixed[k_fixedQueryStackSize];
+            std::vector<u32> m_overflow;
+            u32 m_size = 0;
+        };
+        
+        /// @param aabb
+        ///     The bounds of an object.
+        ///
+        /// @return The margin by which the bounds should be fattened, which is proportional
+        ///     to the largest dimension of the object.
+        ///
+        Vector3 CalcFatMargin(const AABB& aabb) noexcept
+        {
+            f32 margin = std::max(std::max(aabb.GetSize().x, aabb.GetSize().y), aabb.GetSize().z) * k_fatMarginFraction;
+            return Vector3(margin, margin, margin);
+        }
+        
+        /// @param min
+        ///     The minimum corner of the box.
+        /// @param max
+        ///     The maximum corner of the box.
+        ///
+        /// @return Half of the surface area of the given box. This is used as the cost
+        ///     metric when building the tree.
+        ///
+        f32 CalcHalfSurfaceArea(const Vector3& min, const Vector3& max) noexcept
+        {
+            Vector3 size = max - min;
+            return size.x * size.y + size.y * size.z + size.z * size.x;
+        }
+        
+        /// @param minA
+        ///     The minimum corner of the first box.
+        /// @param maxA
+        ///     The maximum corner of the first box.
+        /// @param minB
+        ///     The minimum corner of the second box.
+        /// @param maxB
+        ///     The maximum corner of the second box.
+        ///
+        /// @return Whether or not the boxes overlap. Touching boxes are considered to
+        ///     overlap.
+        ///
+        bool BoxOverlapsBox(const Vector3& minA, const Vector3& maxA, const Vector3& minB, const Vector3& maxB) noexcept
+        {
+            return (minA.x <= maxB.x && maxA.x >= minB.x && minA.y <= maxB.y && maxA.y >= minB.y && minA.z <= maxB.z && maxA.z >= minB.z);
+        }
+        
+        /// @param min
+        ///     The minimum corner of the box.
+        /// @param max
+        ///     The maximum corner of the box.
+        /// @param sphere
+        ///     The sphere.
+        ///
+        /// @return Whether or not the box and sphere overlap.
+        ///
+        bool BoxOverlapsSphere(const Vector3& min, const Vector3& max, const Sphere& sphere) noexcept
+        {
+            Vector3 closestPoint = Vector3::Min(Vector3::Max(sphere.vOrigin, min), max);
+            return (closestPoint - sphere.vOrigin).LengthSquared() <= sphere.fRadius * sphere.fRadius;
+        }
+        
+        /// Tests the box against the half-line described by the ray. The length of the ray
+        /// is ignored, matching the behaviour of the AABB and OOBB ray tests.
+        ///
+        /// @param min
+        ///     The minimum corner of the box.
+        /// @param max
+        ///     The maximum corner of the box.
+        /// @param origin
+        ///     The origin of the ray.
+        /// @param inverseDirection
+        ///     The reciprocal of each component of the ray direction.
+        ///
+        /// @return Whether or not the box and ray overlap.
+        ///
+        bool BoxOverlapsRay(const Vector3& min, const Vector3& max, const Vector3& origin, const Vector3& inverseDirection) noexcept
+        {
+            f32 firstT = 0.0f;
+            f32 lastT = std::numeric_limits<f32>::infinity();
+            
+            for (u32 axis = 0; axis < 3; ++axis)
+            {
+                f32 start = (&origin.x)[axis];
+                f32 slabMin = (&min.x)[axis];
+                f32 slabMax = (&max.x)[axis];
+                f32 inverseDir = (&inverseDirection.x)[axis];
+                
+                if (std::isinf(inverseDir))
+                {
+                    if (start < slabMin || start > slabMax)
+                    {
+                        return false;
+                    }
+                }
+                else
+                {
+                    f32 t1 = (slabMin - start) * inverseDir;
+                    f32 t2 = (slabMax - start) * inverseDir;
+                    firstT = std::max(firstT, std::min(t1, t2));
+                    lastT = std::min(lastT, std::max(t1, t2));
+                    
+                    if (firstT > lastT)
+                    {
+                        return false;
+                    }
+                }
+            }
+            
+            return true;
+        }
+        
+        /// @param min
+        ///     The minimum corner of the box.
+        /// @param max
+        ///     The maximum corner of the box.
+        /// @param frustum
+        ///     The frustum.
+        /// @param [Out] isInside
+        ///     Whether or not the box is entirely inside the frustum.
+        ///
+        /// @return Whether or not the box is inside or intersects the frustum.
+        ///
+        bool BoxOverlapsFrustum(const Vector3& min, const Vector3& max, const Frustum& frustum, bool& isInside) noexcept
+        {
+            const Plane* planes[] = { &frustum.mLeftClipPlane, &frustum.mRightClipPlane, &frustum.mTopClipPlane, &frustum.mBottomClipPlane, &frustum.mNearClipPlane, &frustum.mFarClipPlane };
+            
+            isInside = true;
+            for (const auto plane : planes)
+            {
+                const auto& normal = plane->mvNormal;
+                
+                Vector3 positive(normal.x >= 0.0f ? max.x : min.x, normal.y >= 0.0f ? max.y : min.y, normal.z >= 0.0f ? max.z : min.z);
+                if (plane->DistanceFromPoint(positive) < 0.0f)
+                {
+                    isInside = false;
+                    return false;
+                }
+                
+                Vector3 negative(normal.x >= 0.0f ? min.x : max.x, normal.y >= 0.0f ? min.y : max.y, normal.z >= 0.0f ? min.z : max.z);
+                if (plane->DistanceFromPoint(negative) < 0.0f)
+                {
+                    isInside = false;
+                }
+            }
+            
+            return true;
+        }
+    }
+    
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    u32 AABBTree::Add(const AABB& in_aabb, void* in_userData) noexcept
+    {
+        u32 leafIndex = AllocateNode();
+        
+        Vector3 margin = CalcFatMargin(in_aabb);
+        
+        auto& leaf = m_nodes[leafIndex];
+        leaf.m_min = in_aabb.GetMin() - margin;
+        leaf.m_max = in_aabb.GetMax() + margin;
+        leaf.m_userData = in_userData;
+        leaf.m_height = 0;
+        
+        InsertLeaf(leafIndex);
+        ++m_numProxies;
+        
+        return leafIndex;
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    void AABBTree::Remove(u32 in_proxyId) noexcept
+    {
+        CS_ASSERT(in_proxyId < m_nodes.size() && m_nodes[in_proxyId].IsLeaf() && m_nodes[in_proxyId].m_height == 0, "Invalid proxy id.");
+        
+        RemoveLeaf(in_proxyId);
+        FreeNode(in_proxyId);
+        --m_numProxies;
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    bool AABBTree::Move(u32 in_proxyId, const AABB& in_aabb) noexcept
+    {
+        CS_ASSERT(in_proxyId < m_nodes.size() && m_nodes[in_proxyId].IsLeaf() && m_nodes[in_proxyId].m_height == 0, "Invalid proxy id.");
+        
+        Vector3 margin = CalcFatMargin(in_aabb);
+        Vector3 fatMin = in_aabb.GetMin() - margin;
+        Vector3 fatMax = in_aabb.GetMax() + margin;
+        
+        auto& leaf = m_nodes[in_proxyId];
+        
+        //the proxy only needs re-inserted if it has left its fattened bounds, or the object has shrunk enough that they are now overly conservative.
+        bool isContained = (in_aabb.GetMin().x >= leaf.m_min.x && in_aabb.GetMin().y >= leaf.m_min.y && in_aabb.GetMin().z >= leaf.m_min.z &&
+                            in_aabb.GetMax().x <= leaf.m_max.x && in_aabb.GetMax().y <= leaf.m_max.y && in_aabb.GetMax().z <= leaf.m_max.z);
+        if (isContained && CalcHalfSurfaceArea(leaf.m_min, leaf.m_max) <= k_maxFatAreaRatio * CalcHalfSurfaceArea(fatMin, fatMax))
+        {
+            return false;
+        }
+        
+        RemoveLeaf(in_proxyId);
+        
+        leaf.m_min = fatMin;
+        leaf.m_max = fatMax;
+        
+        InsertLeaf(in_proxyId);
+        
+        return true;
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    void AABBTree::Clear() noexcept
+    {
+        m_nodes.clear();
+        m_root = k_nullProxy;
+        m_freeList = k_nullProxy;
+        m_numProxies = 0;
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    void* AABBTree::GetUserData(u32 in_proxyId) const noexcept
+    {
+        CS_ASSERT(in_proxyId < m_nodes.size() && m_nodes[in_proxyId].IsLeaf() && m_nodes[in_proxyId].m_height == 0, "Invalid proxy id.");
+        
+        return m_nodes[in_proxyId].m_userData;
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    u32 AABBTree::GetHeight() const noexcept
+    {
+        return (m_root != k_nullProxy) ? u32(m_nodes[m_root].m_height) : 0;
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    void AABBTree::Query(const AABB& in_aabb, std::vector<void*>& out_userData) const noexcept
+    {
+        if (m_root == k_nullProxy)
+        {
+            return;
+        }
+        
+        QueryStack stack;
+        stack.Push(m_root);
+        while (!stack.IsEmpty())
+        {
+            const auto& node = m_nodes[stack.Pop()];
+            if (BoxOverlapsBox(node.m_min, node.m_max, in_aabb.GetMin(), in_aabb.GetMax()))
+            {
+                if (node.IsLeaf())
+                {
+                    out_userData.push_back(node.m_userData);
+                }
+                else
+                {
+                    stack.Push(node.m_child1);
+                    stack.Push(node.m_child2);
+                }
+            }
+        }
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    void AABBTree::Query(const Sphere& in_sphere, std::vector<void*>& out_userData) const noexcept
+    {
+        if (m_root == k_nullProxy)
+        {
+            return;
+        }
+        
+        QueryStack stack;
+        stack.Push(m_root);
+        while (!stack.IsEmpty())
+        {
+            const auto& node = m_nodes[stack.Pop()];
+            if (BoxOverlapsSphere(node.m_min, node.m_max, in_sphere))
+            {
+                if (node.IsLeaf())
+                {
+                    out_userData.push_back(node.m_userData);
+                }
+                else
+                {
+                    stack.Push(node.m_child1);
+                    stack.Push(node.m_child2);
+                }
+            }
+        }
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    void AABBTree::Query(const Ray& in_ray, std::vector<void*>& out_userData) const noexcept
+    {
+        if (m_root == k_nullProxy)
+        {
+            return;
+        }
+        
+        Vector3 inverseDirection(1.0f / in_ray.vDirection.x, 1.0f / in_ray.vDirection.y, 1.0f / in_ray.vDirection.z);
+        
+        QueryStack stack;
+        stack.Push(m_root);
+        while (!stack.IsEmpty())
+        {
+            const auto& node = m_nodes[stack.Pop()];
+            if (BoxOverlapsRay(node.m_min, node.m_max, in_ray.vOrigin, inverseDirection))
+            {
+                if (node.IsLeaf())
+                {
+                    out_userData.push_back(node.m_userData);
+                }
+                else
+                {
+                    stack.Push(node.m_child1);
+                    stack.Push(node.m_child2);
+                }
+            }
+        }
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    void AABBTree::Query(const Frustum& in_frustum, std::vector<void*>& out_userData) const noexcept
+    {
+        if (m_root == k_nullProxy)
+        {
+            return;
+        }
+        
+        QueryStack stack;
+        QueryStack insideStack;
+        stack.Push(m_root);
+        while (!stack.IsEmpty())
+        {
+            const auto& node = m_nodes[stack.Pop()];
+            
+            bool isInside = false;
+            if (BoxOverlapsFrustum(node.m_min, node.m_max, in_frustum, isInside))
+            {
+                if (node.IsLeaf())
+                {
+                    out_userData.push_back(node.m_userData);
+                }
+                else if (isInside)
+                {
+                    //every proxy in a sub-tree which is entirely inside the frustum can be added without further tests.
+                    insideStack.Push(node.m_child1);
+                    insideStack.Push(node.m_child2);
+                    while (!insideStack.IsEmpty())
+                    {
+                        const auto& insideNode = m_nodes[insideStack.Pop()];
+                        if (insideNode.IsLeaf())
+                        {
+                            out_userData.push_back(insideNode.m_userData);
+                        }
+                        else
+                        {
+                            insideStack.Push(insideNode.m_child1);
+                            insideStack.Push(insideNode.m_child2);
+                        }
+                    }
+                }
+                else
+                {
+                    stack.Push(node.m_child1);
+                    stack.Push(node.m_child2);
+                }
+            }
+        }
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    u32 AABBTree::AllocateNode() noexcept
+    {
+        if (m_freeList == k_nullProxy)
+        {
+            m_nodes.push_back(Node());
+            return u32(m_nodes.size() - 1);
+        }
+        
+        u32 nodeIndex = m_freeList;
+        m_freeList = m_nodes[nodeIndex].m_parent;
+        m_nodes[nodeIndex] = Node();
+        return nodeIndex;
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    void AABBTree::FreeNode(u32 in_nodeIndex) noexcept
+    {
+        auto& node = m_nodes[in_nodeIndex];
+        node.m_parent = m_freeList;
+        node.m_child1 = k_nullProxy;
+        node.m_child2 = k_nullProxy;
+        node.m_userData = nullptr;
+        node.m_height = -1;
+        m_freeList = in_nodeIndex;
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    void AABBTree::InsertLeaf(u32 in_leafIndex) noexcept
+    {
+        if (m_root == k_nullProxy)
+        {
+            m_root = in_leafIndex;
+            m_nodes[m_root].m_parent = k_nullProxy;
+            return;
+        }
+        
+        Vector3 leafMin = m_nodes[in_leafIndex].m_min;
+        Vector3 leafMax = m_nodes[in_leafIndex].m_max;
+        
+        //descend the tree, choosing the child which would result in the lowest cost, until it is cheaper to become a sibling of the current node.
+        u32 index = m_root;
+        while (!m_nodes[index].IsLeaf())
+        {
+            const auto& node = m_nodes[index];
+            const auto& child1 = m_nodes[node.m_child1];
+            const auto& child2 = m_nodes[node.m_child2];
+            
+            f32 area = CalcHalfSurfaceArea(node.m_min, node.m_max);
+            f32 combinedArea = CalcHalfSurfaceArea(Vector3::Min(node.m_min, leafMin), Vector3::Max(node.m_max, leafMax));
+            
+            f32 cost = 2.0f * combinedArea;
+            f32 inheritanceCost = 2.0f * (combinedArea - area);
+            
+            f32 cost1 = CalcHalfSurfaceArea(Vector3::Min(child1.m_min, leafMin), Vector3::Max(child1.m_max, leafMax)) + inheritanceCost;
+            if (!child1.IsLeaf())
+            {
+                cost1 -= CalcHalfSurfaceArea(child1.m_min, child1.m_max);
+            }
+            
+            f32 cost2 = CalcHalfSurfaceArea(Vector3::Min(child2.m_min, leafMin), Vector3::Max(child2.m_max, leafMax)) + inheritanceCost;
+            if (!child2.IsLeaf())
+            {
+                cost2 -= CalcHalfSurfaceArea(child2.m_min, child2.m_max);
+            }
+            
+            if (cost < cost1 && cost < cost2)
+            {
+                break;
+            }
+            
+            index = (cost1 < cost2) ? node.m_child1 : node.m_child2;
+        }
+        
+        u32 siblingIndex = index;
+        u32 oldParentIndex = m_nodes[siblingIndex].m_parent;
+        
+        //allocating may invalidate references into the node list, so nodes are accessed by index from here.
+        u32 newParentIndex = AllocateNode();
+        m_nodes[newParentIndex].m_parent = oldParentIndex;
+        m_nodes[newParentIndex].m_min = Vector3::Min(m_nodes[siblingIndex].m_min, leafMin);
+        m_nodes[newParentIndex].m_max = Vector3::Max(m_nodes[siblingIndex].m_max, leafMax);
+        m_nodes[newParentIndex].m_height = m_nodes[siblingIndex].m_height + 1;
+        m_nodes[newParentIndex].m_child1 = siblingIndex;
+        m_nodes[newParentIndex].m_child2 = in_leafIndex;
+        
+        if (oldParentIndex != k_nullProxy)
+        {
+            if (m_nodes[oldParentIndex].m_child1 == siblingIndex)
+            {
+                m_nodes[oldParentIndex].m_child1 = newParentIndex;
+            }
+            else
+            {
+                m_nodes[oldParentIndex].m_child2 = newParentIndex;
+            }
+        }
+        else
+        {
+            m_root = newParentIndex;
+        }
+        
+        m_nodes[siblingIndex].m_parent = newParentIndex;
+        m_nodes[in_leafIndex].m_parent = newParentIndex;
+        
+        RefitAncestors(newParentIndex);
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    void AABBTree::RemoveLeaf(u32 in_leafIndex) noexcept
+    {
+        if (in_leafIndex == m_root)
+        {
+            m_root = k_nullProxy;
+            return;
+        }
+        
+        u32 parentIndex = m_nodes[in_leafIndex].m_parent;
+        u32 grandParentIndex = m_nodes[parentIndex].m_parent;
+        u32 siblingIndex = (m_nodes[parentIndex].m_child1 == in_leafIndex) ? m_nodes[parentIndex].m_child2 : m_nodes[parentIndex].m_child1;
+        
+        if (grandParentIndex != k_nullProxy)
+        {
+            if (m_nodes[grandParentIndex].m_child1 == parentIndex)
+            {
+                m_nodes[grandParentIndex].m_child1 = siblingIndex;
+            }
+            else
+            {
+                m_nodes[grandParentIndex].m_child2 = siblingIndex;
+            }
+            
+            m_nodes[siblingIndex].m_parent = grandParentIndex;
+            FreeNode(parentIndex);
+            
+            RefitAncestors(grandParentIndex);
+        }
+        else
+        {
+            m_root = siblingIndex;
+            m_nodes[siblingIndex].m_parent = k_nullProxy;
+            FreeNode(parentIndex);
+        }
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    void AABBTree::RefitAncestors(u32 in_nodeIndex) noexcept
+    {
+        u32 index = in_nodeIndex;
+        while (index != k_nullProxy)
+        {
+            index = Balance(index);
+            
+            auto& node = m_nodes[index];
+            const auto& child1 = m_nodes[node.m_child1];
+            const auto& child2 = m_nodes[node.m_child2];
+            
+            node.m_height = 1 + std::max(child1.m_height, child2.m_height);
+            node.m_min = Vector3::Min(child1.m_min, child2.m_min);
+            node.m_max = Vector3::Max(child1.m_max, child2.m_max);
+            
+            index = node.m_parent;
+        }
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    u32 AABBTree::Balance(u32 in_nodeIndex) noexcept
+    {
+        auto& a = m_nodes[in_nodeIndex];
+        if (a.IsLeaf() || a.m_height < 2)
+        {
+            return in_nodeIndex;
+        }
+        
+        u32 bIndex = a.m_child1;
+        u32 cIndex = a.m_child2;
+        auto& b = m_nodes[bIndex];
+        auto& c = m_nodes[cIndex];
+        
+        s32 balance = c.m_height - b.m_height;
+        
+        if (balance > 1)
+        {
+            //rotate c up
+            u32 fIndex = c.m_child1;
+            u32 gIndex = c.m_child2;
+            auto& f = m_nodes[fIndex];
+            auto& g = m_nodes[gIndex];
+            
+            c.m_child1 = in_nodeIndex;
+            c.m_parent = a.m_parent;
+            a.m_parent = cIndex;
+            
+            if (c.m_parent != k_nullProxy)
+            {
+                if (m_nodes[c.m_parent].m_child1 == in_nodeIndex)
+                {
+                    m_nodes[c.m_parent].m_child1 = cIndex;
+                }
+                else
+                {
+                    m_nodes[c.m_parent].m_child2 = cIndex;
+                }
+            }
+            else
+            {
+                m_root = cIndex;
+            }
+            
+            if (f.m_height > g.m_height)
+            {
+                c.m_child2 = fIndex;
+                a.m_child2 = gIndex;
+                g.m_parent = in_nodeIndex;
+                a.m_min = Vector3::Min(b.m_min, g.m_min);
+                a.m_max = Vector3::Max(b.m_max, g.m_max);
+                c.m_min = Vector3::Min(a.m_min, f.m_min);
+                c.m_max = Vector3::Max(a.m_max, f.m_max);
+                a.m_height = 1 + std::max(b.m_height, g.m_height);
+                c.m_height = 1 + std::max(a.m_height, f.m_height);
+            }
+            else
+            {
+                c.m_child2 = gIndex;
+                a.m_child2 = fIndex;
+                f.m_parent = in_nodeIndex;
+                a.m_min = Vector3::Min(b.m_min, f.m_min);
+                a.m_max = Vector3::Max(b.m_max, f.m_max);
+                c.m_min = Vector3::Min(a.m_min, g.m_min);
+                c.m_max = Vector3::Max(a.m_max, g.m_max);
+                a.m_height = 1 + std::max(b.m_height, f.m_height);
+                c.m_height = 1 + std::max(a.m_height, g.m_height);
+            }
+            
+            return cIndex;
+        }
+        
+        if (balance < -1)
+        {
+            //rotate b up
+            u32 dIndex = b.m_child1;
+            u32 eIndex = b.m_child2;
+            auto& d = m_nodes[dIndex];
+            auto& e = m_nodes[eIndex];
+            
+            b.m_child1 = in_nodeIndex;
+            b.m_parent = a.m_parent;
+            a.m_parent = bIndex;
+            
+            if (b.m_parent != k_nullProxy)
+            {
+                if (m_nodes[b.m_parent].m_child1 == in_nodeIndex)
+                {
+                    m_nodes[b.m_parent].m_child1 = bIndex;
+                }
+                else
+                {
+                    m_nodes[b.m_parent].m_child2 = bIndex;
+                }
+            }
+            else
+            {
+                m_root = bIndex;
+            }
+            
+            if (d.m_height > e.m_height)
+            {
+                b.m_child2 = dIndex;
+                a.m_child1 = eIndex;
+                e.m_parent = in_nodeIndex;
+                a.m_min = Vector3::Min(c.m_min, e.m_min);
+                a.m_max = Vector3::Max(c.m_max, e.m_max);
+                b.m_min = Vector3::Min(a.m_min, d.m_min);
+                b.m_max = Vector3::Max(a.m_max, d.m_max);
+                a.m_height = 1 + std::max(c.m_height, e.m_height);
+                b.m_height = 1 + std::max(a.m_height, d.m_height);
+            }
+            else
+            {
+                b.m_child2 = eIndex;
+                a.m_child1 = dIndex;
+                d.m_parent = in_nodeIndex;
+                a.m_min = Vector3::Min(c.m_min, d.m_min);
+                a.m_max = Vector3::Max(c.m_max, d.m_max);
+                b.m_min = Vector3::Min(a.m_min, e.m_min);
+                b.m_max = Vector3::Max(a.m_max, e.m_max);
+                a.m_height = 1 + std::max(c.m_height, d.m_height);
+                b.m_height = 1 + std::max(a.m_height, e.m_height);
+            }
+            
+            return bIndex;
+        }
+        
+        return in_nodeIndex;
+    }
+}
@@ -0,0 +1,212 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2016 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#ifndef _CHILLISOURCE_CORE_MATH_GEOMETRY_AABBTREE_H_
+#define _CHILLISOURCE_CORE_MATH_GEOMETRY_AABBTREE_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Math/Vector3.h>
+
+#include <vector>
+
+namespace ChilliSource
+{
+    //------------------------------------------------------------------------------
+    /// A dynamic bounding volume hierarchy of axis-aligned bounding boxes which
+    /// can be incrementally updated as the objects it contains are added, moved
+    /// and removed.
+    ///
+    /// Each object is represented by a proxy in the tree, the bounds of which are
+    /// "fattened" by a margin proportional to the size of the object. This allows
+    /// the object to move a small amount without the tree needing to be changed.
+    /// When the tree does change it is kept balanced using tree rotations, so
+    /// queries remain logarithmic regardless of the order objects are added.
+    ///
+    /// Queries are performed against the fattened bounds, so the results are a
+    /// conservative superset of the objects which actually intersect the query
+    /// shape and should be refined by the caller if exact results are required.
+    ///
+    /// This is not thread-safe, though the query methods can be called from
+    /// multiple threads at once provided the tree is not being modified.
+    //------------------------------------------------------------------------------
+    class AABBTree final
+    {
+    public:
+        CS_DECLARE_NOCOPY(AABBTree);
+        
+        static constexpr u32 k_nullProxy = 0xffffffff;
+        
+        //------------------------------------------------------------------------------
+        /// Constructor.
+        //------------------------------------------------------------------------------
+        AABBTree() = default;
+        //------------------------------------------------------------------------------
+        /// Adds a new proxy to the tree.
+        ///
+        /// @param in_aabb - The bounds of the object the proxy represents.
+        /// @param in_userData - The user data which should be returned from queries
+        /// that find the proxy.
+        ///
+        /// @return The id of the new proxy.
+        //------------------------------------------------------------------------------
+        u32 Add(const AABB& in_aabb, void* in_userData) noexcept;
+        //------------------------------------------------------------------------------
+        /// Removes the proxy with the given id from the tree.
+        ///
+        /// @param in_proxyId - The id of the proxy to remove.
+        //------------------------------------------------------------------------------
+        void Remove(u32 in_proxyId) noexcept;
+        //------------------------------------------------------------------------------
+        /// Updates the bounds of the given proxy. If the new bounds are still within
+        /// the fattened bounds of the proxy then the tree is not changed, otherwise
+        /// the proxy is re-inserted into the tree.
+        ///
+        /// @param in_proxyId - The id of the proxy which has moved.
+        /// @param in_aabb - The new bounds of the object the proxy represents.
+        ///
+        /// @return Whether or not the proxy was re-inserted.
+        //------------------------------------------------------------------------------
+        bool Move(u32 in_proxyId, const AABB& in_aabb) noexcept;
+        //------------------------------------------------------------------------------
+        /// Removes all proxies from the tree.
+        //------------------------------------------------------------------------------
+        void Clear() noexcept;
+        //------------------------------------------------------------------------------
+        /// @param in_proxyId - The id of the proxy.
+        ///
+        /// @return The user data of the given proxy.
+        //------------------------------------------------------------------------------
+        void* GetUserData(u32 in_proxyId) const noexcept;
+        //------------------------------------------------------------------------------
+        /// @return The number of proxies in the tree.
+        //------------------------------------------------------------------------------
+        u32 GetNumProxies() const noexcept { return m_numProxies; }
+        //------------------------------------------------------------------------------
+        /// @return The height of the tree. This is intended for debugging.
+        //------------------------------------------------------------------------------
+        u32 GetHeight() const noexcept;
+        //------------------------------------------------------------------------------
+        /// Adds the user data of every proxy which intersects the given AABB to the
+        /// output list.
+        ///
+        /// @param in_aabb - The AABB to test against.
+        /// @param out_userData - [Out] The list that the user data should be added to.
+        //------------------------------------------------------------------------------
+        void Query(const AABB& in_aabb, std::vector<void*>& out_userData) const noexcept;
+        //------------------------------------------------------------------------------
+        /// Adds the user data of every proxy which intersects the given sphere to the
+        /// output list.
+        ///
+        /// @param in_sphere - The sphere to test against.
+        /// @param out_userData - [Out] The list that the user data should be added to.
+        //------------------------------------------------------------------------------
+        void Query(const Sphere& in_sphere, std::vector<void*>& out_userData) const noexcept;
+        //------------------------------------------------------------------------------
+        /// Adds the user data of every proxy which intersects the given ray to the
+        /// output list.
+        ///
+        /// @param in_ray - The ray to test against.
+        /// @param out_userData - [Out] The list that the user data should be added to.
+        //------------------------------------------------------------------------------
+        void Query(const Ray& in_ray, std::vector<void*>& out_userData) const noexcept;
+        //------------------------------------------------------------------------------
+        /// Adds the user data of every proxy which is inside or intersects the given
+        /// frustum to the output list. Sub-trees which are entirely inside the
+        /// frustum are added without testing each of their proxies.
+        ///
+        /// @param in_frustum - The frustum to test against.
+        /// @param out_userData - [Out] The list that the user data should be added to.
+        //------------------------------------------------------------------------------
+        void Query(const Frustum& in_frustum, std::vector<void*>& out_userData) const noexcept;
+        
+    private:
+        //------------------------------------------------------------------------------
+        /// A single node in the tree. Leaf nodes represent a proxy, while all other
+        /// nodes have exactly two children. Nodes which are not in use form a free
+        /// list through the parent index.
+        //------------------------------------------------------------------------------
+        struct Node final
+        {
+            Vector3 m_min;
+            Vector3 m_max;
+            void* m_userData = nullptr;
+            u32 m_parent = k_nullProxy;
+            u32 m_child1 = k_nullProxy;
+            u32 m_child2 = k_nullProxy;
+            s32 m_height = -1;
+            
+            bool IsLeaf() const noexcept { return m_child1 == k_nullProxy; }
+        };
+        
+        //------------------------------------------------------------------------------
+        /// @return The index of a new node, taken from the free list if possible.
+        //------------------------------------------------------------------------------
+        u32 AllocateNode() noexcept;
+        //------------------------------------------------------------------------------
+        /// Returns the given node to the free list.
+        ///
+        /// @param in_nodeIndex - The index of the node to free.
+        //------------------------------------------------------------------------------
+        void FreeNode(u32 in_nodeIndex) noexcept;
+        //------------------------------------------------------------------------------
+        /// Inserts the given leaf into the tree, choosing the sibling which results
+        /// in the lowest increase in total surface area, then re-balances the tree
+        /// above it.
+        ///
+        /// @param in_leafIndex - The index of the leaf to insert.
+        //------------------------------------------------------------------------------
+        void InsertLeaf(u32 in_leafIndex) noexcept;
+        //------------------------------------------------------------------------------
+        /// Removes the given leaf from the tree, replacing its parent with its
+        /// sibling, then re-balances the tree above it.
+        ///
+        /// @param in_leafIndex - The index of the leaf to remove.
+        //------------------------------------------------------------------------------
+        void RemoveLeaf(u32 in_leafIndex) noexcept;
+        //------------------------------------------------------------------------------
+        /// Walks from the given node to the root, re-balancing and refitting the
+        /// bounds of each node.
+        ///
+        /// @param in_nodeIndex - The index of the first node to refit.
+        //------------------------------------------------------------------------------
+        void RefitAncestors(u32 in_nodeIndex) noexcept;
+        //------------------------------------------------------------------------------
+        /// Performs a left or right rotation if the sub-tree with the given node as
+        /// its root is imbalanced.
+        ///
+        /// @param in_nodeIndex - The index of the node to balance.
+        ///
+        /// @return The index of the new root of the sub-tree.
+        //------------------------------------------------------------------------------
+        u32 Balance(u32 in_nodeIndex) noexcept;
+        
+        std::vector<Node> m_nodes;
+        u32 m_root = k_nullProxy;
+        u32 m_freeList = k_nullProxy;
+        u32 m_numProxies = 0;
+    };
+}
+
+#endif
@@ -89,6 +89,35 @@ namespace ChilliSource
                     (inAABBLHS.GetMax().z > inAABBRHS.GetMin().z && inAABBLHS.GetMin().z < inAABBRHS.GetMax().z);
         }
         //----------------------------------------------------------------
+        /// AABB vs Sphere
+        //----------------------------------------------------------------
+        bool Intersects(const AABB& inAABB, const Sphere& inSphere)
+        {
+            //Find the point in the box closest to the centre of the sphere
+            Vector3 vClosestPoint = Vector3::Min(Vector3::Max(inSphere.vOrigin, inAABB.GetMin()), inAABB.GetMax());
+            
+            return (vClosestPoint - inSphere.vOrigin).LengthSquared() <= (inSphere.fRadius * inSphere.fRadius);
+        }
+        //----------------------------------------------------------------
+        /// AABB vs Plane
+        //----------------------------------------------------------------
+        ShapeIntersection::Result Intersects(const AABB& inAABB, const Plane& inPlane)
+        {
+            //Project the half size of the box onto the plane normal to get the
+            //"radius" of the box in the direction of the normal
+            const Vector3& vHalfSize = inAABB.GetHalfSize();
+            f32 fRadius = vHalfSize.x * std::fabs(inPlane.mvNormal.x) + vHalfSize.y * std::fabs(inPlane.mvNormal.y) + vHalfSize.z * std::fabs(inPlane.mvNormal.z);
+            f32 fDist = Vector3::DotProduct(inAABB.GetOrigin(), inPlane.mvNormal) + inPlane.mfD;
+            
+            if(fDist < -fRadius)
+                return Result::k_outside;
+            
+            if(std::fabs(fDist) < fRadius)
+                return Result::k_intersect;
+            
+            return Result::k_inside;
+        }
+        //----------------------------------------------------------------
         /// Sphere vs Ray
         //----------------------------------------------------------------
         bool Intersects(const Sphere& inSphere, const Ray& inRay)
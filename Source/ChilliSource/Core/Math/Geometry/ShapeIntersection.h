@@ -56,6 +56,14 @@ namespace ChilliSource
         //----------------------------------------------------------------
         bool Intersects(const AABB& inAABBLHS, const AABB& inAABBRHS);
         //----------------------------------------------------------------
+        /// AABB vs Sphere
+        //----------------------------------------------------------------
+        bool Intersects(const AABB& inAABB, const Sphere& inSphere);
+        //----------------------------------------------------------------
+        /// AABB vs Plane
+        //----------------------------------------------------------------
+        Result Intersects(const AABB& inAABB, const Plane& inPlane);
+        //----------------------------------------------------------------
         /// Sphere vs Ray
         //----------------------------------------------------------------
         bool Intersects(const Sphere& inSphere, const Ray& inRay);
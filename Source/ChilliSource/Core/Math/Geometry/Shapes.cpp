@@ -763,6 +763,29 @@ namespace ChilliSource
         if(ShapeIntersection::Intersects(inBoundingSphere, mFarClipPlane) == ShapeIntersection::Result::k_outside)
             return false;
 
+        return true;
+    }
+    //----------------------------------------------------------
+    /// AABB Cull Test
+    ///
+    /// Test if the bounding box lies within the frustum and
+    /// determine whether it should be culled. This is
+    /// conservative; boxes near the corners of the frustum
+    /// may not be culled even if they are outside it.
+    ///
+    /// @param AABB
+    /// @return Whether it lies within the bounds
+    //-----------------------------------------------------------
+    bool Frustum::AABBCullTest(const AABB& inBoundingBox) const
+    {
+        const Plane* apPlanes[] = { &mLeftClipPlane, &mRightClipPlane, &mTopClipPlane, &mBottomClipPlane, &mNearClipPlane, &mFarClipPlane };
+        
+        for(const Plane* pPlane : apPlanes)
+        {
+            if(ShapeIntersection::Intersects(inBoundingBox, *pPlane) == ShapeIntersection::Result::k_outside)
+                return false;
+        }
+        
         return true;
     }
 }
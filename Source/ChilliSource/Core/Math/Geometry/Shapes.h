@@ -555,6 +555,18 @@ namespace ChilliSource
         /// @return Whether it lies within the bounds
         //-----------------------------------------------------------
         bool SphereCullTest(const Sphere& inBoundingSphere) const;
+        //----------------------------------------------------------
+        /// AABB Cull Test
+        ///
+        /// Test if the bounding box lies within the frustum and
+        /// determine whether it should be culled. This is
+        /// conservative; boxes near the corners of the frustum
+        /// may not be culled even if they are outside it.
+        ///
+        /// @param AABB
+        /// @return Whether it lies within the bounds
+        //-----------------------------------------------------------
+        bool AABBCullTest(const AABB& inBoundingBox) const;
 
     public:
 
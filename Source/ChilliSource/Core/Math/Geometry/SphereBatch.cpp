@@ -0,0 +1,180 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2016 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#include <ChilliSource/Core/Math/Geometry/SphereBatch.h>
+
+#include <ChilliSource/Core/Math/Geometry/Shapes.h>
+#include <ChilliSource/Core/Math/SIMD.h>
+
+#include <algorithm>
+
+namespace ChilliSource
+{
+    namespace
+    {
+        constexpr u32 k_numFrustumPlanes = 6;
+        
+        //------------------------------------------------------------------------------
+        /// Calls the given test function for each group of SIMD::k_width spheres in
+        /// the given range, and packs the resulting bits into the visibility mask.
+        /// Bits for any padding beyond the last sphere are cleared.
+        ///
+        /// @param in_numSpheres - The number of spheres in the batch.
+        /// @param in_startIndex - The first sphere in the range.
+        /// @param in_endIndex - The end of the range (exclusive).
+        /// @param out_visibilityMask - [Out] The visibility mask for the whole batch.
+        /// @param in_testFunction - The function which tests a group of spheres. It
+        /// should have the signature u32(u32 firstIndex) and return the mask bits for
+        /// the group.
+        //------------------------------------------------------------------------------
+        template <typename TTestFunction> void CullRange(u32 in_numSpheres, u32 in_startIndex, u32 in_endIndex, u32* out_visibilityMask, const TTestFunction& in_testFunction) noexcept
+        {
+            CS_ASSERT(in_startIndex % SphereBatch::k_spheresPerMaskWord == 0, "Cull range must start on a mask word boundary.");
+            CS_ASSERT(in_endIndex % SphereBatch::k_spheresPerMaskWord == 0 || in_endIndex == in_numSpheres, "Cull range must end on a mask word boundary or at the end of the batch.");
+            CS_ASSERT(in_endIndex <= in_numSpheres, "Cull range is out of bounds.");
+            
+            for (u32 wordStartIndex = in_startIndex; wordStartIndex < in_endIndex; wordStartIndex += SphereBatch::k_spheresPerMaskWord)
+            {
+                u32 word = 0;
+                for (u32 offset = 0; offset < SphereBatch::k_spheresPerMaskWord; offset += SIMD::k_width)
+                {
+                    word |= in_testFunction(wordStartIndex + offset) << offset;
+                }
+                
+                u32 numSpheresInWord = in_numSpheres - wordStartIndex;
+                if (numSpheresInWord < SphereBatch::k_spheresPerMaskWord)
+                {
+                    word &= (1u << numSpheresInWord) - 1;
+                }
+                
+                out_visibilityMask[wordStartIndex / SphereBatch::k_spheresPerMaskWord] = word;
+            }
+        }
+    }
+    
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    u32 SphereBatch::CalcNumMaskWords(u32 in_numSpheres) noexcept
+    {
+        return (in_numSpheres + k_spheresPerMaskWord - 1) / k_spheresPerMaskWord;
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    SphereBatch::SphereBatch(u32 in_numSpheres) noexcept
+        : m_numSpheres(in_numSpheres)
+    {
+        // Padding to a whole number of mask words means every group of spheres
+        // can be loaded without bounds checks.
+        u32 paddedSize = CalcNumMaskWords(m_numSpheres) * k_spheresPerMaskWord;
+        m_x.resize(paddedSize, 0.0f);
+        m_y.resize(paddedSize, 0.0f);
+        m_z.resize(paddedSize, 0.0f);
+        m_radius.resize(paddedSize, 0.0f);
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    void SphereBatch::Set(u32 in_index, const Sphere& in_sphere) noexcept
+    {
+        CS_ASSERT(in_index < m_numSpheres, "Sphere index is out of bounds.");
+        
+        m_x[in_index] = in_sphere.vOrigin.x;
+        m_y[in_index] = in_sphere.vOrigin.y;
+        m_z[in_index] = in_sphere.vOrigin.z;
+        m_radius[in_index] = in_sphere.fRadius;
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    void SphereBatch::CullAgainstFrustum(const Frustum& in_frustum, u32 in_startIndex, u32 in_endIndex, u32* out_visibilityMask) const noexcept
+    {
+        const Plane* planes[k_numFrustumPlanes] =
+        {
+            &in_frustum.mLeftClipPlane, &in_frustum.mRightClipPlane, &in_frustum.mTopClipPlane,
+            &in_frustum.mBottomClipPlane, &in_frustum.mNearClipPlane, &in_frustum.mFarClipPlane
+        };
+        
+        SIMD::Float4 normalX[k_numFrustumPlanes];
+        SIMD::Float4 normalY[k_numFrustumPlanes];
+        SIMD::Float4 normalZ[k_numFrustumPlanes];
+        SIMD::Float4 distance[k_numFrustumPlanes];
+        for (u32 i = 0; i < k_numFrustumPlanes; ++i)
+        {
+            normalX[i] = SIMD::Splat(planes[i]->mvNormal.x);
+            normalY[i] = SIMD::Splat(planes[i]->mvNormal.y);
+            normalZ[i] = SIMD::Splat(planes[i]->mvNormal.z);
+            distance[i] = SIMD::Splat(planes[i]->mfD);
+        }
+        
+        const SIMD::Float4 zero = SIMD::Splat(0.0f);
+        
+        CullRange(m_numSpheres, in_startIndex, in_endIndex, out_visibilityMask, [&](u32 in_firstIndex) noexcept -> u32
+        {
+            SIMD::Float4 x = SIMD::Load(m_x.data() + in_firstIndex);
+            SIMD::Float4 y = SIMD::Load(m_y.data() + in_firstIndex);
+            SIMD::Float4 z = SIMD::Load(m_z.data() + in_firstIndex);
+            SIMD::Float4 negativeRadius = SIMD::Subtract(zero, SIMD::Load(m_radius.data() + in_firstIndex));
+            
+            // A sphere is culled if it is entirely behind any one of the planes. The
+            // signed distance is calculated in the same order as the scalar test.
+            SIMD::Float4 outside = SIMD::GreaterThan(zero, zero);
+            for (u32 i = 0; i < k_numFrustumPlanes; ++i)
+            {
+                SIMD::Float4 signedDistance = SIMD::Multiply(x, normalX[i]);
+                signedDistance = SIMD::MultiplyAdd(y, normalY[i], signedDistance);
+                signedDistance = SIMD::MultiplyAdd(z, normalZ[i], signedDistance);
+                signedDistance = SIMD::Add(signedDistance, distance[i]);
+                
+                outside = SIMD::Or(outside, SIMD::GreaterThan(negativeRadius, signedDistance));
+            }
+            
+            return ~SIMD::GetMaskBits(outside) & ((1u << SIMD::k_width) - 1);
+        });
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    void SphereBatch::CullAgainstSphere(const Sphere& in_sphere, u32 in_startIndex, u32 in_endIndex, u32* out_visibilityMask) const noexcept
+    {
+        const SIMD::Float4 x = SIMD::Splat(in_sphere.vOrigin.x);
+        const SIMD::Float4 y = SIMD::Splat(in_sphere.vOrigin.y);
+        const SIMD::Float4 z = SIMD::Splat(in_sphere.vOrigin.z);
+        const SIMD::Float4 radius = SIMD::Splat(in_sphere.fRadius);
+        const SIMD::Float4 zero = SIMD::Splat(0.0f);
+        
+        CullRange(m_numSpheres, in_startIndex, in_endIndex, out_visibilityMask, [&](u32 in_firstIndex) noexcept -> u32
+        {
+            // This matches the scalar sphere intersection test, which compares the
+            // distance between the centres on each axis.
+            SIMD::Float4 radiusSum = SIMD::Add(radius, SIMD::Load(m_radius.data() + in_firstIndex));
+            SIMD::Float4 deltaX = SIMD::Subtract(x, SIMD::Load(m_x.data() + in_firstIndex));
+            SIMD::Float4 deltaY = SIMD::Subtract(y, SIMD::Load(m_y.data() + in_firstIndex));
+            SIMD::Float4 deltaZ = SIMD::Subtract(z, SIMD::Load(m_z.data() + in_firstIndex));
+            
+            SIMD::Float4 inside = SIMD::GreaterThan(radiusSum, SIMD::Max(deltaX, SIMD::Subtract(zero, deltaX)));
+            inside = SIMD::And(inside, SIMD::GreaterThan(radiusSum, SIMD::Max(deltaY, SIMD::Subtract(zero, deltaY))));
+            inside = SIMD::And(inside, SIMD::GreaterThan(radiusSum, SIMD::Max(deltaZ, SIMD::Subtract(zero, deltaZ))));
+            
+            return SIMD::GetMaskBits(inside);
+        });
+    }
+}
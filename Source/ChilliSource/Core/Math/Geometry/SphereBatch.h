@@ -0,0 +1,117 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2016 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#ifndef _CHILLISOURCE_CORE_MATH_GEOMETRY_SPHEREBATCH_H_
+#define _CHILLISOURCE_CORE_MATH_GEOMETRY_SPHEREBATCH_H_
+
+#include <ChilliSource/ChilliSource.h>
+
+#include <vector>
+
+namespace ChilliSource
+{
+    //------------------------------------------------------------------------------
+    /// A fixed size collection of bounding spheres, stored as a structure of
+    /// arrays so they can be culled several at a time using SIMD.
+    ///
+    /// Culling outputs a visibility mask with one bit per sphere, packed into
+    /// 32 bit words such that bit (i % 32) of word (i / 32) corresponds to sphere
+    /// i. A batch can be culled in parallel by splitting it into ranges which
+    /// start on a word boundary: each range then writes to its own words, so no
+    /// synchronisation is required and the output does not depend on how the
+    /// work was split.
+    ///
+    /// Different spheres can be set and culled from multiple threads at once,
+    /// provided the same range isn't accessed by more than one thread.
+    //------------------------------------------------------------------------------
+    class SphereBatch final
+    {
+    public:
+        static constexpr u32 k_spheresPerMaskWord = 32;
+        
+        //------------------------------------------------------------------------------
+        /// @param in_numSpheres - The number of spheres.
+        ///
+        /// @return The number of words in the visibility mask for the given number
+        /// of spheres.
+        //------------------------------------------------------------------------------
+        static u32 CalcNumMaskWords(u32 in_numSpheres) noexcept;
+        //------------------------------------------------------------------------------
+        /// Constructor. Creates a batch with the given number of spheres, all of
+        /// which are initially zero sized and positioned at the origin.
+        ///
+        /// @param in_numSpheres - The number of spheres in the batch.
+        //------------------------------------------------------------------------------
+        SphereBatch(u32 in_numSpheres = 0) noexcept;
+        //------------------------------------------------------------------------------
+        /// @return The number of spheres in the batch.
+        //------------------------------------------------------------------------------
+        u32 GetNumSpheres() const noexcept { return m_numSpheres; }
+        //------------------------------------------------------------------------------
+        /// Sets the sphere at the given index.
+        ///
+        /// @param in_index - The index of the sphere.
+        /// @param in_sphere - The sphere.
+        //------------------------------------------------------------------------------
+        void Set(u32 in_index, const Sphere& in_sphere) noexcept;
+        //------------------------------------------------------------------------------
+        /// Tests the given range of spheres against the given frustum. The bit for
+        /// each sphere is set if it is at least partially inside the frustum, giving
+        /// the same result as Frustum::SphereCullTest().
+        ///
+        /// @param in_frustum - The frustum to test against.
+        /// @param in_startIndex - The first sphere in the range. This must be a
+        /// multiple of k_spheresPerMaskWord.
+        /// @param in_endIndex - The end of the range (exclusive). This must either be
+        /// a multiple of k_spheresPerMaskWord or the number of spheres in the batch.
+        /// @param out_visibilityMask - [Out] The visibility mask for the whole batch.
+        /// Only the words covering the range are written.
+        //------------------------------------------------------------------------------
+        void CullAgainstFrustum(const Frustum& in_frustum, u32 in_startIndex, u32 in_endIndex, u32* out_visibilityMask) const noexcept;
+        //------------------------------------------------------------------------------
+        /// Tests the given range of spheres against the given sphere. The bit for
+        /// each sphere is set if it intersects the sphere, giving the same result as
+        /// ShapeIntersection::Intersects().
+        ///
+        /// @param in_sphere - The sphere to test against.
+        /// @param in_startIndex - The first sphere in the range. This must be a
+        /// multiple of k_spheresPerMaskWord.
+        /// @param in_endIndex - The end of the range (exclusive). This must either be
+        /// a multiple of k_spheresPerMaskWord or the number of spheres in the batch.
+        /// @param out_visibilityMask - [Out] The visibility mask for the whole batch.
+        /// Only the words covering the range are written.
+        //------------------------------------------------------------------------------
+        void CullAgainstSphere(const Sphere& in_sphere, u32 in_startIndex, u32 in_endIndex, u32* out_visibilityMask) const noexcept;
+        
+    private:
+        u32 m_numSpheres = 0;
+        std::vector<f32> m_x;
+        std::vector<f32> m_y;
+        std::vector<f32> m_z;
+        std::vector<f32> m_radius;
+    };
+}
+
+#endif
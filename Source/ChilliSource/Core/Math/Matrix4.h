@@ -41,6 +41,11 @@ namespace ChilliSource
     /// would not be used directly, instead the f32 typedef Matrix4
     /// should be used.
     ///
+    /// The f32 instantiation uses SIMD for multiplication and
+    /// inversion where available. Multiplication gives the same
+    /// result as the generic implementation, while the inverse
+    /// may differ by a few ULPs.
+    ///
     /// @author Ian Copland
     //-------------------------------------------------------------
     template <typename TType> class GenericMatrix4 final
@@ -658,6 +663,7 @@ namespace ChilliSource
 #include <ChilliSource/Core/Math/Quaternion.h>
 #include <ChilliSource/Core/Math/Vector3.h>
 #include <ChilliSource/Core/Math/Vector4.h>
+#include <ChilliSource/Core/Math/SIMD.h>
 
 #include <cmath>
 
@@ -1340,6 +1346,112 @@ namespace ChilliSource
     {
         return !(in_a == in_b);
     }
+    
+#if !defined(CS_SIMD_NONE)
+    //------------------------------------------------------
+    /// SIMD specialisations of the f32 instantiation. Each
+    /// row of the product is accumulated in the same order
+    /// as the generic implementation so the results are
+    /// identical.
+    //------------------------------------------------------
+    template <> inline GenericMatrix4<f32> operator*(const GenericMatrix4<f32>& in_a, const GenericMatrix4<f32>& in_b)
+    {
+        const SIMD::Float4 b0 = SIMD::Load(in_b.m);
+        const SIMD::Float4 b1 = SIMD::Load(in_b.m + 4);
+        const SIMD::Float4 b2 = SIMD::Load(in_b.m + 8);
+        const SIMD::Float4 b3 = SIMD::Load(in_b.m + 12);
+        
+        SIMD::Float4 row0 = SIMD::Multiply(SIMD::Splat(in_a.m[0]), b0);
+        SIMD::Float4 row1 = SIMD::Multiply(SIMD::Splat(in_a.m[4]), b0);
+        SIMD::Float4 row2 = SIMD::Multiply(SIMD::Splat(in_a.m[8]), b0);
+        SIMD::Float4 row3 = SIMD::Multiply(SIMD::Splat(in_a.m[12]), b0);
+        
+        row0 = SIMD::MultiplyAdd(SIMD::Splat(in_a.m[1]), b1, row0);
+        row1 = SIMD::MultiplyAdd(SIMD::Splat(in_a.m[5]), b1, row1);
+        row2 = SIMD::MultiplyAdd(SIMD::Splat(in_a.m[9]), b1, row2);
+        row3 = SIMD::MultiplyAdd(SIMD::Splat(in_a.m[13]), b1, row3);
+        
+        row0 = SIMD::MultiplyAdd(SIMD::Splat(in_a.m[2]), b2, row0);
+        row1 = SIMD::MultiplyAdd(SIMD::Splat(in_a.m[6]), b2, row1);
+        row2 = SIMD::MultiplyAdd(SIMD::Splat(in_a.m[10]), b2, row2);
+        row3 = SIMD::MultiplyAdd(SIMD::Splat(in_a.m[14]), b2, row3);
+        
+        row0 = SIMD::MultiplyAdd(SIMD::Splat(in_a.m[3]), b3, row0);
+        row1 = SIMD::MultiplyAdd(SIMD::Splat(in_a.m[7]), b3, row1);
+        row2 = SIMD::MultiplyAdd(SIMD::Splat(in_a.m[11]), b3, row2);
+        row3 = SIMD::MultiplyAdd(SIMD::Splat(in_a.m[15]), b3, row3);
+        
+        GenericMatrix4<f32> c;
+        SIMD::Store(c.m, row0);
+        SIMD::Store(c.m + 4, row1);
+        SIMD::Store(c.m + 8, row2);
+        SIMD::Store(c.m + 12, row3);
+        return c;
+    }
+    //------------------------------------------------------
+    //------------------------------------------------------
+    template <> inline GenericMatrix4<f32>& GenericMatrix4<f32>::operator*=(const GenericMatrix4<f32>& in_b)
+    {
+        *this = *this * in_b;
+        return *this;
+    }
+    //------------------------------------------------------
+    /// Inverts using the 2x2 sub-determinants of the upper
+    /// and lower halves of the matrix, which are shared
+    /// between the cofactors. The cofactors of each output
+    /// row are then calculated together.
+    //------------------------------------------------------
+    template <> inline GenericMatrix4<f32> GenericMatrix4<f32>::Inverse(const GenericMatrix4<f32>& in_a)
+    {
+        const f32* a = in_a.m;
+        
+        const f32 s0 = a[0] * a[5] - a[4] * a[1];
+        const f32 s1 = a[0] * a[6] - a[4] * a[2];
+        const f32 s2 = a[0] * a[7] - a[4] * a[3];
+        const f32 s3 = a[1] * a[6] - a[5] * a[2];
+        const f32 s4 = a[1] * a[7] - a[5] * a[3];
+        const f32 s5 = a[2] * a[7] - a[6] * a[3];
+        
+        const f32 c5 = a[10] * a[15] - a[14] * a[11];
+        const f32 c4 = a[9] * a[15] - a[13] * a[11];
+        const f32 c3 = a[9] * a[14] - a[13] * a[10];
+        const f32 c2 = a[8] * a[15] - a[12] * a[11];
+        const f32 c1 = a[8] * a[14] - a[12] * a[10];
+        const f32 c0 = a[8] * a[13] - a[12] * a[9];
+        
+        const f32 det = s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+        if (det == 0.0f)
+        {
+            return in_a;
+        }
+        
+        const SIMD::Float4 invDet = SIMD::Splat(1.0f / det);
+        
+        GenericMatrix4<f32> b;
+        
+        SIMD::Float4 row = SIMD::Multiply(SIMD::Set(a[5], -a[1], a[13], -a[9]), SIMD::Set(c5, c5, s5, s5));
+        row = SIMD::Subtract(row, SIMD::Multiply(SIMD::Set(a[6], -a[2], a[14], -a[10]), SIMD::Set(c4, c4, s4, s4)));
+        row = SIMD::MultiplyAdd(SIMD::Set(a[7], -a[3], a[15], -a[11]), SIMD::Set(c3, c3, s3, s3), row);
+        SIMD::Store(b.m, SIMD::Multiply(row, invDet));
+        
+        row = SIMD::Multiply(SIMD::Set(-a[4], a[0], -a[12], a[8]), SIMD::Set(c5, c5, s5, s5));
+        row = SIMD::Subtract(row, SIMD::Multiply(SIMD::Set(-a[6], a[2], -a[14], a[10]), SIMD::Set(c2, c2, s2, s2)));
+        row = SIMD::MultiplyAdd(SIMD::Set(-a[7], a[3], -a[15], a[11]), SIMD::Set(c1, c1, s1, s1), row);
+        SIMD::Store(b.m + 4, SIMD::Multiply(row, invDet));
+        
+        row = SIMD::Multiply(SIMD::Set(a[4], -a[0], a[12], -a[8]), SIMD::Set(c4, c4, s4, s4));
+        row = SIMD::Subtract(row, SIMD::Multiply(SIMD::Set(a[5], -a[1], a[13], -a[9]), SIMD::Set(c2, c2, s2, s2)));
+        row = SIMD::MultiplyAdd(SIMD::Set(a[7], -a[3], a[15], -a[11]), SIMD::Set(c0, c0, s0, s0), row);
+        SIMD::Store(b.m + 8, SIMD::Multiply(row, invDet));
+        
+        row = SIMD::Multiply(SIMD::Set(-a[4], a[0], -a[12], a[8]), SIMD::Set(c3, c3, s3, s3));
+        row = SIMD::Subtract(row, SIMD::Multiply(SIMD::Set(-a[5], a[1], -a[13], a[9]), SIMD::Set(c1, c1, s1, s1)));
+        row = SIMD::MultiplyAdd(SIMD::Set(-a[6], a[2], -a[14], a[10]), SIMD::Set(c0, c0, s0, s0), row);
+        SIMD::Store(b.m + 12, SIMD::Multiply(row, invDet));
+        
+        return b;
+    }
+#endif
 }
 
 #endif
\ No newline at end of file
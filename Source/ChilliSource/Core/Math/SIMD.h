@@ -0,0 +1,369 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2016 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#ifndef _CHILLISOURCE_CORE_MATH_SIMD_H_
+#define _CHILLISOURCE_CORE_MATH_SIMD_H_
+
+#include <ChilliSource/ChilliSource.h>
+
+#include <algorithm>
+
+//------------------------------------------------------------
+// Selects the SIMD instruction set used by the SIMD functions.
+// SSE2 is used on x86 and NEON on ARM, otherwise a scalar
+// implementation is used. The scalar implementation can be
+// forced by declaring CS_DISABLE_SIMD.
+//------------------------------------------------------------
+#if defined(CS_DISABLE_SIMD)
+#   define CS_SIMD_NONE
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#   define CS_SIMD_SSE
+#   include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#   define CS_SIMD_NEON
+#   include <arm_neon.h>
+#else
+#   define CS_SIMD_NONE
+#endif
+
+namespace ChilliSource
+{
+    //---------------------------------------------------------
+    /// A thin, platform independent layer over 4-wide SIMD
+    /// floating point operations. This is intended for use in
+    /// tight loops over structure-of-arrays data, processing
+    /// four elements of each stream at a time.
+    ///
+    /// Loads and stores do not require aligned memory.
+    //---------------------------------------------------------
+    namespace SIMD
+    {
+        /// The number of elements processed by each SIMD operation.
+        ///
+        constexpr u32 k_width = 4;
+
+#if defined(CS_SIMD_SSE)
+        using Float4 = __m128;
+#elif defined(CS_SIMD_NEON)
+        using Float4 = float32x4_t;
+#else
+        struct Float4 final
+        {
+            f32 m_values[k_width];
+        };
+#endif
+        //---------------------------------------------------------
+        /// @param in_value - The number of elements.
+        ///
+        /// @return The given number of elements rounded up to a
+        /// multiple of the SIMD width.
+        //---------------------------------------------------------
+        inline u32 RoundUp(u32 in_value) noexcept
+        {
+            return (in_value + k_width - 1) & ~(k_width - 1);
+        }
+        //---------------------------------------------------------
+        /// @param in_values - The four values to load.
+        ///
+        /// @return The loaded values.
+        //---------------------------------------------------------
+        inline Float4 Load(const f32* in_values) noexcept
+        {
+#if defined(CS_SIMD_SSE)
+            return _mm_loadu_ps(in_values);
+#elif defined(CS_SIMD_NEON)
+            return vld1q_f32(in_values);
+#else
+            return Float4 { { in_values[0], in_values[1], in_values[2], in_values[3] } };
+#endif
+        }
+        //---------------------------------------------------------
+        /// @param in_value - The value.
+        ///
+        /// @return The given value in all four elements.
+        //---------------------------------------------------------
+        inline Float4 Splat(f32 in_value) noexcept
+        {
+#if defined(CS_SIMD_SSE)
+            return _mm_set1_ps(in_value);
+#elif defined(CS_SIMD_NEON)
+            return vdupq_n_f32(in_value);
+#else
+            return Float4 { { in_value, in_value, in_value, in_value } };
+#endif
+        }
+        //---------------------------------------------------------
+        /// @param in_x - The first value.
+        /// @param in_y - The second value.
+        /// @param in_z - The third value.
+        /// @param in_w - The fourth value.
+        ///
+        /// @return The given values, in order.
+        //---------------------------------------------------------
+        inline Float4 Set(f32 in_x, f32 in_y, f32 in_z, f32 in_w) noexcept
+        {
+#if defined(CS_SIMD_SSE)
+            return _mm_setr_ps(in_x, in_y, in_z, in_w);
+#elif defined(CS_SIMD_NEON)
+            const f32 values[k_width] = { in_x, in_y, in_z, in_w };
+            return vld1q_f32(values);
+#else
+            return Float4 { { in_x, in_y, in_z, in_w } };
+#endif
+        }
+        //---------------------------------------------------------
+        /// Writes the four values to the given memory.
+        ///
+        /// @param out_values - [Out] The destination.
+        /// @param in_value - The values to store.
+        //---------------------------------------------------------
+        inline void Store(f32* out_values, Float4 in_value) noexcept
+        {
+#if defined(CS_SIMD_SSE)
+            _mm_storeu_ps(out_values, in_value);
+#elif defined(CS_SIMD_NEON)
+            vst1q_f32(out_values, in_value);
+#else
+            std::copy(in_value.m_values, in_value.m_values + k_width, out_values);
+#endif
+        }
+        //---------------------------------------------------------
+        /// @return The per element a + b.
+        //---------------------------------------------------------
+        inline Float4 Add(Float4 in_a, Float4 in_b) noexcept
+        {
+#if defined(CS_SIMD_SSE)
+            return _mm_add_ps(in_a, in_b);
+#elif defined(CS_SIMD_NEON)
+            return vaddq_f32(in_a, in_b);
+#else
+            return Float4 { { in_a.m_values[0] + in_b.m_values[0], in_a.m_values[1] + in_b.m_values[1], in_a.m_values[2] + in_b.m_values[2], in_a.m_values[3] + in_b.m_values[3] } };
+#endif
+        }
+        //---------------------------------------------------------
+        /// @return The per element a - b.
+        //---------------------------------------------------------
+        inline Float4 Subtract(Float4 in_a, Float4 in_b) noexcept
+        {
+#if defined(CS_SIMD_SSE)
+            return _mm_sub_ps(in_a, in_b);
+#elif defined(CS_SIMD_NEON)
+            return vsubq_f32(in_a, in_b);
+#else
+            return Float4 { { in_a.m_values[0] - in_b.m_values[0], in_a.m_values[1] - in_b.m_values[1], in_a.m_values[2] - in_b.m_values[2], in_a.m_values[3] - in_b.m_values[3] } };
+#endif
+        }
+        //---------------------------------------------------------
+        /// @return The per element a * b.
+        //---------------------------------------------------------
+        inline Float4 Multiply(Float4 in_a, Float4 in_b) noexcept
+        {
+#if defined(CS_SIMD_SSE)
+            return _mm_mul_ps(in_a, in_b);
+#elif defined(CS_SIMD_NEON)
+            return vmulq_f32(in_a, in_b);
+#else
+            return Float4 { { in_a.m_values[0] * in_b.m_values[0], in_a.m_values[1] * in_b.m_values[1], in_a.m_values[2] * in_b.m_values[2], in_a.m_values[3] * in_b.m_values[3] } };
+#endif
+        }
+        //---------------------------------------------------------
+        /// The result is not fused on all platforms, so may differ
+        /// in the last bit from a separate multiply and add.
+        ///
+        /// @return The per element a * b + c.
+        //---------------------------------------------------------
+        inline Float4 MultiplyAdd(Float4 in_a, Float4 in_b, Float4 in_c) noexcept
+        {
+#if defined(CS_SIMD_NEON)
+            return vmlaq_f32(in_c, in_a, in_b);
+#else
+            return Add(Multiply(in_a, in_b), in_c);
+#endif
+        }
+        //---------------------------------------------------------
+        /// @return The per element a / b.
+        //---------------------------------------------------------
+        inline Float4 Divide(Float4 in_a, Float4 in_b) noexcept
+        {
+#if defined(CS_SIMD_SSE)
+            return _mm_div_ps(in_a, in_b);
+#elif defined(CS_SIMD_NEON) && defined(__aarch64__)
+            return vdivq_f32(in_a, in_b);
+#elif defined(CS_SIMD_NEON)
+            //ARMv7 NEON has no divide, so refine the reciprocal estimate with two Newton-Raphson steps.
+            float32x4_t reciprocal = vrecpeq_f32(in_b);
+            reciprocal = vmulq_f32(vrecpsq_f32(in_b, reciprocal), reciprocal);
+            reciprocal = vmulq_f32(vrecpsq_f32(in_b, reciprocal), reciprocal);
+            return vmulq_f32(in_a, reciprocal);
+#else
+            return Float4 { { in_a.m_values[0] / in_b.m_values[0], in_a.m_values[1] / in_b.m_values[1], in_a.m_values[2] / in_b.m_values[2], in_a.m_values[3] / in_b.m_values[3] } };
+#endif
+        }
+        //---------------------------------------------------------
+        /// @return The per element minimum of a and b.
+        //---------------------------------------------------------
+        inline Float4 Min(Float4 in_a, Float4 in_b) noexcept
+        {
+#if defined(CS_SIMD_SSE)
+            return _mm_min_ps(in_a, in_b);
+#elif defined(CS_SIMD_NEON)
+            return vminq_f32(in_a, in_b);
+#else
+            return Float4 { { std::min(in_a.m_values[0], in_b.m_values[0]), std::min(in_a.m_values[1], in_b.m_values[1]), std::min(in_a.m_values[2], in_b.m_values[2]), std::min(in_a.m_values[3], in_b.m_values[3]) } };
+#endif
+        }
+        //---------------------------------------------------------
+        /// @return The per element maximum of a and b.
+        //---------------------------------------------------------
+        inline Float4 Max(Float4 in_a, Float4 in_b) noexcept
+        {
+#if defined(CS_SIMD_SSE)
+            return _mm_max_ps(in_a, in_b);
+#elif defined(CS_SIMD_NEON)
+            return vmaxq_f32(in_a, in_b);
+#else
+            return Float4 { { std::max(in_a.m_values[0], in_b.m_values[0]), std::max(in_a.m_values[1], in_b.m_values[1]), std::max(in_a.m_values[2], in_b.m_values[2]), std::max(in_a.m_values[3], in_b.m_values[3]) } };
+#endif
+        }
+        //---------------------------------------------------------
+        /// @return The per element value clamped to the given range.
+        //---------------------------------------------------------
+        inline Float4 Clamp(Float4 in_value, Float4 in_min, Float4 in_max) noexcept
+        {
+            return Min(Max(in_value, in_min), in_max);
+        }
+        //---------------------------------------------------------
+        /// @return A per element mask which has all bits set where
+        /// a > b, and no bits set otherwise. This should only be
+        /// used with Select() and the other mask functions.
+        //---------------------------------------------------------
+        inline Float4 GreaterThan(Float4 in_a, Float4 in_b) noexcept
+        {
+#if defined(CS_SIMD_SSE)
+            return _mm_cmpgt_ps(in_a, in_b);
+#elif defined(CS_SIMD_NEON)
+            return vreinterpretq_f32_u32(vcgtq_f32(in_a, in_b));
+#else
+            Float4 output;
+            for (u32 i = 0; i < k_width; ++i)
+            {
+                output.m_values[i] = (in_a.m_values[i] > in_b.m_values[i]) ? 1.0f : 0.0f;
+            }
+            return output;
+#endif
+        }
+        //---------------------------------------------------------
+        /// @return A per element mask which is set where both of
+        /// the given masks are set.
+        //---------------------------------------------------------
+        inline Float4 And(Float4 in_maskA, Float4 in_maskB) noexcept
+        {
+#if defined(CS_SIMD_SSE)
+            return _mm_and_ps(in_maskA, in_maskB);
+#elif defined(CS_SIMD_NEON)
+            return vreinterpretq_f32_u32(vandq_u32(vreinterpretq_u32_f32(in_maskA), vreinterpretq_u32_f32(in_maskB)));
+#else
+            Float4 output;
+            for (u32 i = 0; i < k_width; ++i)
+            {
+                output.m_values[i] = (in_maskA.m_values[i] != 0.0f && in_maskB.m_values[i] != 0.0f) ? 1.0f : 0.0f;
+            }
+            return output;
+#endif
+        }
+        //---------------------------------------------------------
+        /// @return A per element mask which is set where either of
+        /// the given masks are set.
+        //---------------------------------------------------------
+        inline Float4 Or(Float4 in_maskA, Float4 in_maskB) noexcept
+        {
+#if defined(CS_SIMD_SSE)
+            return _mm_or_ps(in_maskA, in_maskB);
+#elif defined(CS_SIMD_NEON)
+            return vreinterpretq_f32_u32(vorrq_u32(vreinterpretq_u32_f32(in_maskA), vreinterpretq_u32_f32(in_maskB)));
+#else
+            Float4 output;
+            for (u32 i = 0; i < k_width; ++i)
+            {
+                output.m_values[i] = (in_maskA.m_values[i] != 0.0f || in_maskB.m_values[i] != 0.0f) ? 1.0f : 0.0f;
+            }
+            return output;
+#endif
+        }
+        //---------------------------------------------------------
+        /// @param in_mask - A mask created with one of the comparison
+        /// functions.
+        ///
+        /// @return The mask packed into the lowest four bits of an
+        /// integer, with bit N set if element N of the mask is set.
+        //---------------------------------------------------------
+        inline u32 GetMaskBits(Float4 in_mask) noexcept
+        {
+#if defined(CS_SIMD_SSE)
+            return u32(_mm_movemask_ps(in_mask));
+#elif defined(CS_SIMD_NEON)
+            const u32 weights[k_width] = { 1, 2, 4, 8 };
+            uint32x4_t bits = vandq_u32(vreinterpretq_u32_f32(in_mask), vld1q_u32(weights));
+            uint32x2_t sums = vadd_u32(vget_low_u32(bits), vget_high_u32(bits));
+            return vget_lane_u32(vpadd_u32(sums, sums), 0);
+#else
+            u32 output = 0;
+            for (u32 i = 0; i < k_width; ++i)
+            {
+                if (in_mask.m_values[i] != 0.0f)
+                {
+                    output |= 1u << i;
+                }
+            }
+            return output;
+#endif
+        }
+        //---------------------------------------------------------
+        /// @param in_mask - A mask created with one of the comparison
+        /// functions.
+        /// @param in_a - The values used where the mask is set.
+        /// @param in_b - The values used where the mask is not set.
+        ///
+        /// @return The per element selection of a or b.
+        //---------------------------------------------------------
+        inline Float4 Select(Float4 in_mask, Float4 in_a, Float4 in_b) noexcept
+        {
+#if defined(CS_SIMD_SSE)
+            return _mm_or_ps(_mm_and_ps(in_mask, in_a), _mm_andnot_ps(in_mask, in_b));
+#elif defined(CS_SIMD_NEON)
+            return vbslq_f32(vreinterpretq_u32_f32(in_mask), in_a, in_b);
+#else
+            Float4 output;
+            for (u32 i = 0; i < k_width; ++i)
+            {
+                output.m_values[i] = (in_mask.m_values[i] != 0.0f) ? in_a.m_values[i] : in_b.m_values[i];
+            }
+            return output;
+#endif
+        }
+    }
+}
+
+#endif
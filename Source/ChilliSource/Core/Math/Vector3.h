@@ -182,6 +182,19 @@ namespace ChilliSource
         //-----------------------------------------------------
         static GenericVector3<TType> Transform3x4(const GenericVector3<TType>& in_a, const GenericMatrix4<TType>& in_transform);
         //-----------------------------------------------------
+        /// Transforms each of the given points by the given
+        /// matrix, as with the single point version of
+        /// Transform3x4(). The input and output may be the same
+        /// array.
+        ///
+        /// @param The points to transform.
+        /// @param The number of points.
+        /// @param The transform matrix.
+        /// @param [Out] The transformed points. This must be
+        /// large enough for the given number of points.
+        //-----------------------------------------------------
+        static void Transform3x4(const GenericVector3<TType>* in_points, u32 in_numPoints, const GenericMatrix4<TType>& in_transform, GenericVector3<TType>* out_points);
+        //-----------------------------------------------------
         /// Constructor
         ///
         /// @author Ian Copland
@@ -516,6 +529,7 @@ namespace ChilliSource
 #include <ChilliSource/Core/Math/Matrix4.h>
 #include <ChilliSource/Core/Math/Quaternion.h>
 #include <ChilliSource/Core/Math/Vector2.h>
+#include <ChilliSource/Core/Math/SIMD.h>
 
 #include <algorithm>
 #include <assert.h>
@@ -642,6 +656,15 @@ namespace ChilliSource
     }
     //-----------------------------------------------------
     //-----------------------------------------------------
+    template <typename TType> void GenericVector3<TType>::Transform3x4(const GenericVector3<TType>* in_points, u32 in_numPoints, const GenericMatrix4<TType>& in_transform, GenericVector3<TType>* out_points)
+    {
+        for (u32 i = 0; i < in_numPoints; ++i)
+        {
+            out_points[i] = Transform3x4(in_points[i], in_transform);
+        }
+    }
+    //-----------------------------------------------------
+    //-----------------------------------------------------
     template <typename TType> GenericVector3<TType>::GenericVector3()
     : x(0), y(0), z(0)
     {
@@ -937,6 +960,48 @@ namespace ChilliSource
         in_a.z = -in_a.z;
         return in_a;
     }
+    
+#if !defined(CS_SIMD_NONE)
+    //-----------------------------------------------------
+    /// SIMD specialisations of the f32 instantiation. The
+    /// matrix rows are accumulated in the same order as the
+    /// generic implementation so the results are identical.
+    //-----------------------------------------------------
+    template <> inline GenericVector3<f32> GenericVector3<f32>::Transform3x4(const GenericVector3<f32>& in_a, const GenericMatrix4<f32>& in_transform)
+    {
+        SIMD::Float4 result = SIMD::Multiply(SIMD::Splat(in_a.x), SIMD::Load(in_transform.m));
+        result = SIMD::MultiplyAdd(SIMD::Splat(in_a.y), SIMD::Load(in_transform.m + 4), result);
+        result = SIMD::MultiplyAdd(SIMD::Splat(in_a.z), SIMD::Load(in_transform.m + 8), result);
+        result = SIMD::Add(result, SIMD::Load(in_transform.m + 12));
+        
+        f32 values[SIMD::k_width];
+        SIMD::Store(values, result);
+        return GenericVector3<f32>(values[0], values[1], values[2]);
+    }
+    //-----------------------------------------------------
+    //-----------------------------------------------------
+    template <> inline void GenericVector3<f32>::Transform3x4(const GenericVector3<f32>* in_points, u32 in_numPoints, const GenericMatrix4<f32>& in_transform, GenericVector3<f32>* out_points)
+    {
+        const SIMD::Float4 row0 = SIMD::Load(in_transform.m);
+        const SIMD::Float4 row1 = SIMD::Load(in_transform.m + 4);
+        const SIMD::Float4 row2 = SIMD::Load(in_transform.m + 8);
+        const SIMD::Float4 row3 = SIMD::Load(in_transform.m + 12);
+        
+        for (u32 i = 0; i < in_numPoints; ++i)
+        {
+            SIMD::Float4 result = SIMD::Multiply(SIMD::Splat(in_points[i].x), row0);
+            result = SIMD::MultiplyAdd(SIMD::Splat(in_points[i].y), row1, result);
+            result = SIMD::MultiplyAdd(SIMD::Splat(in_points[i].z), row2, result);
+            result = SIMD::Add(result, row3);
+            
+            f32 values[SIMD::k_width];
+            SIMD::Store(values, result);
+            out_points[i].x = values[0];
+            out_points[i].y = values[1];
+            out_points[i].z = values[2];
+        }
+    }
+#endif
 }
 
 #endif
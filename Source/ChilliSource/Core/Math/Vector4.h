@@ -446,6 +446,7 @@ namespace ChilliSource
 #include <ChilliSource/Core/Math/Matrix4.h>
 #include <ChilliSource/Core/Math/Vector2.h>
 #include <ChilliSource/Core/Math/Vector3.h>
+#include <ChilliSource/Core/Math/SIMD.h>
 
 #include <algorithm>
 #include <assert.h>
@@ -811,6 +812,32 @@ namespace ChilliSource
         in_a.w = -in_a.w;
         return in_a;
     }
+    
+#if !defined(CS_SIMD_NONE)
+    //-----------------------------------------------------
+    /// SIMD specialisations of the f32 instantiation. The
+    /// matrix rows are accumulated in the same order as the
+    /// generic implementation so the results are identical.
+    //-----------------------------------------------------
+    template <> inline GenericVector4<f32> operator*(const GenericVector4<f32>& in_a, const GenericMatrix4<f32>& in_b)
+    {
+        SIMD::Float4 result = SIMD::Multiply(SIMD::Splat(in_a.x), SIMD::Load(in_b.m));
+        result = SIMD::MultiplyAdd(SIMD::Splat(in_a.y), SIMD::Load(in_b.m + 4), result);
+        result = SIMD::MultiplyAdd(SIMD::Splat(in_a.z), SIMD::Load(in_b.m + 8), result);
+        result = SIMD::MultiplyAdd(SIMD::Splat(in_a.w), SIMD::Load(in_b.m + 12), result);
+        
+        f32 values[SIMD::k_width];
+        SIMD::Store(values, result);
+        return GenericVector4<f32>(values[0], values[1], values[2], values[3]);
+    }
+    //-----------------------------------------------------
+    //-----------------------------------------------------
+    template <> inline GenericVector4<f32>& GenericVector4<f32>::operator*=(const GenericMatrix4<f32>& in_b)
+    {
+        *this = *this * in_b;
+        return *this;
+    }
+#endif
 }
 
 #endif
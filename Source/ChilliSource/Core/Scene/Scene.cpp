@@ -28,10 +28,53 @@
 
 #include <ChilliSource/Core/Scene/Scene.h>
 
+#include <ChilliSource/Core/Base/Application.h>
+#include <ChilliSource/Core/Math/Geometry/ShapeIntersection.h>
+#include <ChilliSource/Core/Threading/TaskScheduler.h>
+#include <ChilliSource/Rendering/Base/RenderSnapshot.h>
+#include <ChilliSource/Rendering/Camera/RenderCamera.h>
+
 #include <algorithm>
 
 namespace ChilliSource
 {
+    namespace
+    {
+        //--------------------------------------------------------------------------------------------------
+        /// Calculates the bounds of the given volume in the scene's spatial index. Not all volumes have
+        /// an AABB which contains their OOBB, so this encloses both, ensuring that the index returns
+        /// every volume that either test could find.
+        ///
+        /// @param in_volumeComponent - The volume.
+        ///
+        /// @return The bounds of the volume.
+        //--------------------------------------------------------------------------------------------------
+        AABB CalcVolumeBounds(VolumeComponent* in_volumeComponent) noexcept
+        {
+            const OOBB& oobb = in_volumeComponent->GetOOBB();
+            const Matrix4& transform = oobb.GetTransform();
+            AABB localBox(oobb.GetOrigin(), oobb.GetSize());
+            
+            Vector3 corners[] =
+            {
+                localBox.FrontTopLeft(), localBox.FrontTopRight(), localBox.FrontBottomLeft(), localBox.FrontBottomRight(),
+                localBox.BackTopLeft(), localBox.BackTopRight(), localBox.BackBottomLeft(), localBox.BackBottomRight()
+            };
+            Vector3::Transform3x4(corners, 8, transform, corners);
+            
+            Vector3 min = corners[0];
+            Vector3 max = corners[0];
+            for (const auto& corner : corners)
+            {
+                min = Vector3::Min(min, corner);
+                max = Vector3::Max(max, corner);
+            }
+            
+            AABB bounds((min + max) * 0.5f, max - min);
+            return bounds.Union(in_volumeComponent->GetAABB());
+        }
+    }
+    
     CS_DEFINE_NAMEDTYPE(Scene);
     
     //-------------------------------------------------------
@@ -95,8 +138,16 @@ namespace ChilliSource
     }
     //-------------------------------------------------------
     //-------------------------------------------------------
+    void Scene::ResolveTransforms() noexcept
+    {
+        m_transformStore.Resolve(Application::Get()->GetTaskScheduler()->GetGameLogicTaskContext());
+    }
+    //-------------------------------------------------------
+    //-------------------------------------------------------
     void Scene::RenderSnapshotEntities(RenderSnapshot& in_renderSnapshot) noexcept
     {
+        UpdateVolumesInView(in_renderSnapshot.GetRenderCamera());
+        
         for(u32 i=0; i<m_entities.size(); ++i)
         {
             m_entities[i]->OnRenderSnapshot(in_renderSnapshot);
@@ -137,6 +188,12 @@ namespace ChilliSource
                   + ToString(std::numeric_limits<u32>::max()) + ".");
         
         m_entities.push_back(in_entity);
+        
+        //child entities are added to the transform store along with their parent.
+        if (in_entity->GetParent() == nullptr)
+        {
+            m_transformStore.AddRoot(&in_entity->GetTransform());
+        }
 
         in_entity->SetScene(this);
         in_entity->OnAddedToScene();
@@ -174,6 +231,7 @@ namespace ChilliSource
             }
         }
         
+        m_transformStore.RemoveAll();
         m_entities.clear();
     }
     //-------------------------------------------------------
@@ -206,14 +264,16 @@ namespace ChilliSource
     //--------------------------------------------------------------------------------------------------
     void Scene::QuerySceneForIntersection(const Ray &in_ray, std::vector<VolumeComponent*>& out_volumeComponents)
     {
-        std::vector<VolumeComponent*> intersectableComponents;
-        QuerySceneForComponents(intersectableComponents);
+        UpdateVolumes();
         
-        //Loop through the render components and check for intersection
+        m_volumeQueryResults.clear();
+        m_volumeTree.Query(in_ray, m_volumeQueryResults);
+        
+        //Check each of the candidates from the spatial index for intersection
         //If any intersect then add them to the intersect list
-        for(std::vector<VolumeComponent*>::iterator it = intersectableComponents.begin(); it != intersectableComponents.end(); ++it)
+        for(void* userData : m_volumeQueryResults)
         {
-            VolumeComponent* component = (*it);
+            VolumeComponent* component = static_cast<VolumeComponent*>(userData);
             
             f32 nearIntersection, farIntersection = 0.0f;
             
@@ -227,6 +287,183 @@ namespace ChilliSource
     }
     //--------------------------------------------------------------------------------------------------
     //--------------------------------------------------------------------------------------------------
+    void Scene::QuerySceneForIntersection(const Sphere& in_sphere, std::vector<VolumeComponent*>& out_volumeComponents)
+    {
+        UpdateVolumes();
+        
+        m_volumeQueryResults.clear();
+        m_volumeTree.Query(in_sphere, m_volumeQueryResults);
+        
+        for(void* userData : m_volumeQueryResults)
+        {
+            VolumeComponent* component = static_cast<VolumeComponent*>(userData);
+            if(ShapeIntersection::Intersects(component->GetAABB(), in_sphere))
+            {
+                out_volumeComponents.push_back(component);
+            }
+        }
+    }
+    //--------------------------------------------------------------------------------------------------
+    //--------------------------------------------------------------------------------------------------
+    void Scene::QuerySceneForIntersection(const AABB& in_aabb, std::vector<VolumeComponent*>& out_volumeComponents)
+    {
+        UpdateVolumes();
+        
+        m_volumeQueryResults.clear();
+        m_volumeTree.Query(in_aabb, m_volumeQueryResults);
+        
+        for(void* userData : m_volumeQueryResults)
+        {
+            VolumeComponent* component = static_cast<VolumeComponent*>(userData);
+            if(ShapeIntersection::Intersects(component->GetAABB(), in_aabb))
+            {
+                out_volumeComponents.push_back(component);
+            }
+        }
+    }
+    //--------------------------------------------------------------------------------------------------
+    //--------------------------------------------------------------------------------------------------
+    void Scene::QuerySceneForIntersection(const Frustum& in_frustum, std::vector<VolumeComponent*>& out_volumeComponents)
+    {
+        UpdateVolumes();
+        
+        m_volumeQueryResults.clear();
+        m_volumeTree.Query(in_frustum, m_volumeQueryResults);
+        
+        for(void* userData : m_volumeQueryResults)
+        {
+            VolumeComponent* component = static_cast<VolumeComponent*>(userData);
+            if(in_frustum.AABBCullTest(component->GetAABB()))
+            {
+                out_volumeComponents.push_back(component);
+            }
+        }
+    }
+    //--------------------------------------------------------------------------------------------------
+    //--------------------------------------------------------------------------------------------------
+    bool Scene::IsVolumeInView(const VolumeComponent* in_volumeComponent) const noexcept
+    {
+        CS_ASSERT(in_volumeComponent->m_volumeScene == this, "Volume is not in this scene.");
+        CS_ASSERT(m_isViewValid, "Cannot check if a volume is in view outside of the render snapshot.");
+        
+        return (in_volumeComponent->m_volumeInViewStamp == m_viewStamp);
+    }
+    //--------------------------------------------------------------------------------------------------
+    //--------------------------------------------------------------------------------------------------
+    void Scene::AddVolume(VolumeComponent* in_volumeComponent) noexcept
+    {
+        CS_ASSERT(in_volumeComponent->m_volumeScene == nullptr, "Volume is already in a scene.");
+        
+        in_volumeComponent->m_volumeScene = this;
+        in_volumeComponent->m_volumeInViewStamp = 0;
+        
+        //the volume is inserted into the tree the next time it is updated, as its bounds may not be valid until it has been fully added to the scene.
+        InvalidateVolume(in_volumeComponent);
+    }
+    //--------------------------------------------------------------------------------------------------
+    //--------------------------------------------------------------------------------------------------
+    void Scene::RemoveVolume(VolumeComponent* in_volumeComponent) noexcept
+    {
+        CS_ASSERT(in_volumeComponent->m_volumeScene == this, "Volume is not in this scene.");
+        
+        if (in_volumeComponent->m_isVolumeDirty)
+        {
+            auto it = std::find(m_dirtyVolumes.begin(), m_dirtyVolumes.end(), in_volumeComponent);
+            CS_ASSERT(it != m_dirtyVolumes.end(), "Dirty volume is not in the dirty list.");
+            
+            std::swap(*it, m_dirtyVolumes.back());
+            m_dirtyVolumes.pop_back();
+        }
+        
+        if (in_volumeComponent->m_volumeProxyId != AABBTree::k_nullProxy)
+        {
+            m_volumeTree.Remove(in_volumeComponent->m_volumeProxyId);
+        }
+        
+        in_volumeComponent->m_volumeScene = nullptr;
+        in_volumeComponent->m_volumeProxyId = AABBTree::k_nullProxy;
+        in_volumeComponent->m_volumeInViewStamp = 0;
+        in_volumeComponent->m_isVolumeDirty = false;
+    }
+    //--------------------------------------------------------------------------------------------------
+    //--------------------------------------------------------------------------------------------------
+    void Scene::InvalidateVolume(VolumeComponent* in_volumeComponent) noexcept
+    {
+        if (!in_volumeComponent->m_isVolumeDirty)
+        {
+            in_volumeComponent->m_isVolumeDirty = true;
+            m_dirtyVolumes.push_back(in_volumeComponent);
+        }
+    }
+    //--------------------------------------------------------------------------------------------------
+    //--------------------------------------------------------------------------------------------------
+    void Scene::UpdateVolumes() noexcept
+    {
+        //volumes are invalidated by transform changed events, so any pending transform changes need to be resolved first.
+        ResolveTransforms();
+        
+        for (auto volumeComponent : m_dirtyVolumes)
+        {
+            auto bounds = CalcVolumeBounds(volumeComponent);
+            
+            if (volumeComponent->m_volumeProxyId == AABBTree::k_nullProxy)
+            {
+                volumeComponent->m_volumeProxyId = m_volumeTree.Add(bounds, volumeComponent);
+            }
+            else
+            {
+                m_volumeTree.Move(volumeComponent->m_volumeProxyId, bounds);
+            }
+            
+            if (m_isViewValid)
+            {
+                volumeComponent->m_volumeInViewStamp = m_viewFrustum.AABBCullTest(volumeComponent->GetAABB()) ? m_viewStamp : 0;
+            }
+            
+            volumeComponent->m_isVolumeDirty = false;
+        }
+        
+        m_dirtyVolumes.clear();
+    }
+    //--------------------------------------------------------------------------------------------------
+    //--------------------------------------------------------------------------------------------------
+    void Scene::UpdateVolumesInView(const RenderCamera& in_renderCamera) noexcept
+    {
+        if (m_isViewValid && in_renderCamera.GetViewProjectionMatrix() != m_viewProjectionMatrix)
+        {
+            m_isViewValid = false;
+        }
+        
+        UpdateVolumes();
+        
+        if (!m_isViewValid)
+        {
+            m_viewProjectionMatrix = in_renderCamera.GetViewProjectionMatrix();
+            m_viewFrustum = in_renderCamera.GetFrustrum();
+            m_isViewValid = true;
+            
+            //changing the stamp marks every volume as out of view, so only those which are found need to be updated.
+            ++m_viewStamp;
+            if (m_viewStamp == 0)
+            {
+                ++m_viewStamp;
+            }
+            
+            m_volumeQueryResults.clear();
+            m_volumeTree.Query(m_viewFrustum, m_volumeQueryResults);
+            
+            for (void* userData : m_volumeQueryResults)
+            {
+                VolumeComponent* component = static_cast<VolumeComponent*>(userData);
+                if (m_viewFrustum.AABBCullTest(component->GetAABB()))
+                {
+                    component->m_volumeInViewStamp = m_viewStamp;
+                }
+            }
+        }
+    }
+    //--------------------------------------------------------------------------------------------------
+    //--------------------------------------------------------------------------------------------------
     void Scene::Remove(Entity* in_entity)
     {
         CS_ASSERT(in_entity != nullptr, "Cannot remove a null entity");
@@ -254,6 +491,11 @@ namespace ChilliSource
             in_entity->OnRemovedFromScene();
             in_entity->SetScene(nullptr);
             
+            if (in_entity->GetParent() == nullptr)
+            {
+                m_transformStore.RemoveRoot(&in_entity->GetTransform());
+            }
+            
             //the iterator may have been invalidated during OnBackground, OnSuspend or OnRemovedFromScene, so re-calculate it
             it = std::find_if(m_entities.begin(), m_entities.end(), searchPredicate);
             
@@ -32,6 +32,9 @@
 #include <ChilliSource/ChilliSource.h>
 #include <ChilliSource/Core/Base/Colour.h>
 #include <ChilliSource/Core/Entity/Entity.h>
+#include <ChilliSource/Core/Entity/TransformStore.h>
+#include <ChilliSource/Core/Math/Matrix4.h>
+#include <ChilliSource/Core/Math/Geometry/AABBTree.h>
 #include <ChilliSource/Core/Math/Geometry/Shapes.h>
 #include <ChilliSource/Core/System/StateSystem.h>
 #include <ChilliSource/Core/Volume/VolumeComponent.h>
@@ -161,6 +164,14 @@ namespace ChilliSource
         //-------------------------------------------------------
         void FixedUpdateEntities(f32 in_timeSinceLastUpdate);
         //-------------------------------------------------------
+        /// Resolves the world transforms of all entities in the
+        /// scene which have changed since the last time this was
+        /// called, and sends their transform changed events.
+        /// This is called once per frame prior to the render
+        /// snapshot event.
+        //-------------------------------------------------------
+        void ResolveTransforms() noexcept;
+        //-------------------------------------------------------
         /// Sends the render snapshot event to all entities in
         /// the scene.
         ///
@@ -187,6 +198,9 @@ namespace ChilliSource
         /// list. The list order is undefined. Use the query intersection value on the volume component
         /// to sort by depth
         ///
+        /// Candidates are found using the scene's spatial index before being tested against the OOBB
+        /// of each volume.
+        ///
         /// @author S Downie
         ///
         /// @param Ray to check intersection
@@ -194,6 +208,42 @@ namespace ChilliSource
         //--------------------------------------------------------------------------------------------------
         void QuerySceneForIntersection(const Ray &in_ray, std::vector<VolumeComponent*>& out_volumeComponents);
         //--------------------------------------------------------------------------------------------------
+        /// Adds any volumes in the scene whose AABB intersects the given sphere to the list. The list
+        /// order is undefined.
+        ///
+        /// @param in_sphere - The sphere to check intersection with.
+        /// @param out_volumeComponents - [Out] Container to fill with intersecting components.
+        //--------------------------------------------------------------------------------------------------
+        void QuerySceneForIntersection(const Sphere& in_sphere, std::vector<VolumeComponent*>& out_volumeComponents);
+        //--------------------------------------------------------------------------------------------------
+        /// Adds any volumes in the scene whose AABB intersects the given AABB to the list. The list
+        /// order is undefined.
+        ///
+        /// @param in_aabb - The AABB to check intersection with.
+        /// @param out_volumeComponents - [Out] Container to fill with intersecting components.
+        //--------------------------------------------------------------------------------------------------
+        void QuerySceneForIntersection(const AABB& in_aabb, std::vector<VolumeComponent*>& out_volumeComponents);
+        //--------------------------------------------------------------------------------------------------
+        /// Adds any volumes in the scene whose AABB is inside or intersects the given frustum to the
+        /// list. The list order is undefined.
+        ///
+        /// @param in_frustum - The frustum to check intersection with.
+        /// @param out_volumeComponents - [Out] Container to fill with intersecting components.
+        //--------------------------------------------------------------------------------------------------
+        void QuerySceneForIntersection(const Frustum& in_frustum, std::vector<VolumeComponent*>& out_volumeComponents);
+        //--------------------------------------------------------------------------------------------------
+        /// Whether or not the given volume was within the view of the camera during the current render
+        /// snapshot. The results are cached between frames; volumes are only re-tested if either they
+        /// or the camera have changed.
+        ///
+        /// This is only valid while the scene is being render snapshotted.
+        ///
+        /// @param in_volumeComponent - The volume, which must be in this scene.
+        ///
+        /// @return Whether or not the volume is in view.
+        //--------------------------------------------------------------------------------------------------
+        bool IsVolumeInView(const VolumeComponent* in_volumeComponent) const noexcept;
+        //--------------------------------------------------------------------------------------------------
         /// Traverse the scene for the given component type and fill the list with those components
         ///
         /// @author S Downie
@@ -244,6 +294,7 @@ namespace ChilliSource
         
     private:
         friend class Entity;
+        friend class VolumeComponent;
         
         //-------------------------------------------------------
         /// Private to enforce use of factory method
@@ -259,10 +310,56 @@ namespace ChilliSource
         /// @param Entity
         //-------------------------------------------------------
         void Remove(Entity* inpEntity);
+        //-------------------------------------------------------
+        /// Adds the given volume to the spatial index. It will
+        /// be inserted the next time the index is updated.
+        ///
+        /// @param in_volumeComponent - The volume to add.
+        //-------------------------------------------------------
+        void AddVolume(VolumeComponent* in_volumeComponent) noexcept;
+        //-------------------------------------------------------
+        /// Removes the given volume from the spatial index.
+        ///
+        /// @param in_volumeComponent - The volume to remove.
+        //-------------------------------------------------------
+        void RemoveVolume(VolumeComponent* in_volumeComponent) noexcept;
+        //-------------------------------------------------------
+        /// Flags the given volume as changed, so its entry in
+        /// the spatial index is updated the next time the
+        /// index is updated.
+        ///
+        /// @param in_volumeComponent - The volume which has
+        /// changed.
+        //-------------------------------------------------------
+        void InvalidateVolume(VolumeComponent* in_volumeComponent) noexcept;
+        //-------------------------------------------------------
+        /// Resolves any pending transform changes, then updates
+        /// the entry of each changed volume in the spatial
+        /// index. If the cached camera view is still valid, the
+        /// changed volumes are also re-tested against it.
+        //-------------------------------------------------------
+        void UpdateVolumes() noexcept;
+        //-------------------------------------------------------
+        /// Updates which volumes are in view of the given
+        /// camera. If the camera hasn't changed since the last
+        /// call, only volumes which have changed are re-tested,
+        /// otherwise the spatial index is queried.
+        ///
+        /// @param in_renderCamera - The camera.
+        //-------------------------------------------------------
+        void UpdateVolumesInView(const RenderCamera& in_renderCamera) noexcept;
         
     private:
         
         SharedEntityList m_entities;
+        TransformStore m_transformStore;
+        AABBTree m_volumeTree;
+        std::vector<VolumeComponent*> m_dirtyVolumes;
+        std::vector<void*> m_volumeQueryResults;
+        Matrix4 m_viewProjectionMatrix;
+        Frustum m_viewFrustum;
+        u32 m_viewStamp = 0;
+        bool m_isViewValid = false;
         Colour m_clearColour;
         bool m_entitiesActive = false;
         bool m_entitiesForegrounded = false;
@@ -30,11 +30,14 @@
 #define _CHILLISOURCE_CORE_THREADING_H_
 
 #include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Threading/FileTaskPriority.h>
 #include <ChilliSource/Core/Threading/SingleThreadTaskPool.h>
 #include <ChilliSource/Core/Threading/Task.h>
 #include <ChilliSource/Core/Threading/TaskContext.h>
+#include <ChilliSource/Core/Threading/TaskGraph.h>
 #include <ChilliSource/Core/Threading/TaskPool.h>
 #include <ChilliSource/Core/Threading/TaskScheduler.h>
 #include <ChilliSource/Core/Threading/TaskType.h>
+#include <ChilliSource/Core/Threading/WorkStealingQueue.h>
 
 #endif
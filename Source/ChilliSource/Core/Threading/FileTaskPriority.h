@@ -0,0 +1,53 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2016 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#ifndef _CHILLISOURCE_CORE_THREADING_FILETASKPRIORITY_H_
+#define _CHILLISOURCE_CORE_THREADING_FILETASKPRIORITY_H_
+
+#include <ChilliSource/ChilliSource.h>
+
+namespace ChilliSource
+{
+    //------------------------------------------------------------------------------
+    /// An enum describing the priority of a file task. Queued file tasks with a
+    /// higher priority are always started before those with a lower priority.
+    /// Tasks of equal priority are started in the order they were scheduled.
+    ///
+    /// Low: Background work which can be deferred, for example pre-caching.
+    ///
+    /// Normal: The default priority for file tasks.
+    ///
+    /// High: Streaming critical work which should jump the queue, for example
+    /// resources which are required for the next frame.
+    //------------------------------------------------------------------------------
+    enum class FileTaskPriority
+    {
+        k_low,
+        k_normal,
+        k_high
+    };
+}
+
+#endif
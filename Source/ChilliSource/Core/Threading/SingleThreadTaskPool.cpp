@@ -41,23 +41,38 @@ namespace ChilliSource
     }
     //------------------------------------------------------------------------------
     //------------------------------------------------------------------------------
-    void SingleThreadTaskPool::AddTasks(const std::vector<Task>& in_tasks) noexcept
+    void SingleThreadTaskPool::AddTask(Task&& in_task) noexcept
     {
         std::unique_lock<std::mutex> lock(m_taskQueueMutex);
-        m_taskQueue.insert(m_taskQueue.end(), in_tasks.begin(), in_tasks.end());
+        m_taskQueue.push_back(std::move(in_task));
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    void SingleThreadTaskPool::AddTasks(std::vector<Task>&& in_tasks) noexcept
+    {
+        std::unique_lock<std::mutex> lock(m_taskQueueMutex);
+        for (auto& task : in_tasks)
+        {
+            m_taskQueue.push_back(std::move(task));
+        }
+        lock.unlock();
+        
+        in_tasks.clear();
     }
     //------------------------------------------------------------------------------
     //------------------------------------------------------------------------------
     void SingleThreadTaskPool::PerformTasks() noexcept
     {
+        //The processing queue is swapped rather than copied so that both queues retain their capacity.
         std::unique_lock<std::mutex> lock(m_taskQueueMutex);
-        auto localTaskQueue = m_taskQueue;
-        m_taskQueue.clear();
+        std::swap(m_taskQueue, m_processingTaskQueue);
         lock.unlock();
 
-        for (const auto& task : localTaskQueue)
+        for (const auto& task : m_processingTaskQueue)
         {
             task(m_taskContext);
         }
+        
+        m_processingTaskQueue.clear();
     }
 }
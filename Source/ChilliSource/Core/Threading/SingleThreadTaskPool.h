@@ -36,6 +36,7 @@
 #include <condition_variable>
 #include <mutex>
 #include <thread>
+#include <vector>
 
 namespace ChilliSource
 {
@@ -58,6 +59,13 @@ namespace ChilliSource
         //------------------------------------------------------------------------------
         SingleThreadTaskPool(TaskType in_taskContext);
         //------------------------------------------------------------------------------
+        /// Adds a single task to the pool. The task will be executed when
+        /// PerformTasks() is called.
+        ///
+        /// @param in_task - The task to be added to the pool.
+        //------------------------------------------------------------------------------
+        void AddTask(Task&& in_task) noexcept;
+        //------------------------------------------------------------------------------
         /// Adds a series of tasks to the pool. The tasks will be executed when 
         /// PerformTasks() is called.
         ///
@@ -65,10 +73,10 @@ namespace ChilliSource
         ///
         /// @param in_tasks - The tasks to be added to the pool.
         //------------------------------------------------------------------------------
-        void AddTasks(const std::vector<Task>& in_tasks) noexcept;
+        void AddTasks(std::vector<Task>&& in_tasks) noexcept;
         //------------------------------------------------------------------------------
-        /// Performs all tasks in the task pool. The task queue is copied locally and
-        /// cleared before processing all tasks. This means that any tasks queued while
+        /// Performs all tasks in the task pool. The task queue is swapped with a local
+        /// queue before processing all tasks. This means that any tasks queued while
         /// performing single thread tasks will be perfomed during the next call to
         /// PerformTasks() rather than the current one.
         ///
@@ -81,6 +89,7 @@ namespace ChilliSource
         const TaskContext m_taskContext;
         
         std::vector<Task> m_taskQueue;
+        std::vector<Task> m_processingTaskQueue;
         std::mutex m_taskQueueMutex;
     };
 }
@@ -31,20 +31,298 @@
 
 #include <ChilliSource/ChilliSource.h>
 
-#include <functional>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
 
 namespace ChilliSource
 {
     //------------------------------------------------------------------------------
-    /// A delegate describing a single task. A context is provided which provides
-    /// information on the task and provides the ability to launch child tasks.
+    /// A move-only delegate describing a single task. A context is provided which
+    /// provides information on the task and provides the ability to launch child
+    /// tasks.
     ///
-    /// @author Ian Copland
-    ///
-    /// @param in_taskContext - The task context.
+    /// Unlike std::function, the captured state of the callable is stored in a fixed
+    /// size inline buffer where possible, so creating and moving tasks doesn't
+    /// require a heap allocation. If the callable is too large to fit in the inline
+    /// buffer it is stored externally on the free store. The frame allocator isn't
+    /// used for this as it isn't thread-safe, while tasks are frequently created on
+    /// one thread and destroyed on another.
+    //------------------------------------------------------------------------------
+    class Task final
+    {
+    public:
+        //------------------------------------------------------------------------------
+        /// The size and alignment of the inline capture buffer. These are chosen so
+        /// that an entire task fits within a single 64 byte cache line.
+        //------------------------------------------------------------------------------
+        static constexpr std::size_t k_inlineCaptureSize = 56;
+        static constexpr std::size_t k_inlineCaptureAlignment = 8;
+        //------------------------------------------------------------------------------
+        /// Constructs an empty task.
+        //------------------------------------------------------------------------------
+        Task() noexcept = default;
+        //------------------------------------------------------------------------------
+        /// Constructs an empty task.
+        //------------------------------------------------------------------------------
+        Task(std::nullptr_t) noexcept;
+        //------------------------------------------------------------------------------
+        /// Constructs a task from the given callable. If the callable will fit in the
+        /// inline capture buffer it will be stored there, otherwise it will be allocated
+        /// from the free store.
+        ///
+        /// @param in_callable - The callable object. This must be callable with a const
+        /// TaskContext reference.
+        //------------------------------------------------------------------------------
+        template <typename TCallable, typename = typename std::enable_if<!std::is_same<typename std::decay<TCallable>::type, Task>::value>::type>
+        Task(TCallable&& in_callable) noexcept;
+        //------------------------------------------------------------------------------
+        /// Move constructor.
+        ///
+        /// @param in_toMove - The task to move.
+        //------------------------------------------------------------------------------
+        Task(Task&& in_toMove) noexcept;
+        //------------------------------------------------------------------------------
+        /// Move assignment.
+        ///
+        /// @param in_toMove - The task to move.
+        ///
+        /// @return A reference to this.
+        //------------------------------------------------------------------------------
+        Task& operator=(Task&& in_toMove) noexcept;
+        //------------------------------------------------------------------------------
+        /// @return Whether or not this task contains a callable.
+        //------------------------------------------------------------------------------
+        explicit operator bool() const noexcept;
+        //------------------------------------------------------------------------------
+        /// @return Whether or not the callable is stored in the inline capture buffer.
+        /// This will be false for empty tasks.
+        //------------------------------------------------------------------------------
+        bool IsInline() const noexcept;
+        //------------------------------------------------------------------------------
+        /// Executes the task. This must not be called on an empty task.
+        ///
+        /// @param in_taskContext - The task context.
+        //------------------------------------------------------------------------------
+        void operator()(const TaskContext& in_taskContext) const noexcept;
+        //------------------------------------------------------------------------------
+        /// Destructor.
+        //------------------------------------------------------------------------------
+        ~Task() noexcept;
+        
+    private:
+        Task(const Task&) = delete;
+        Task& operator=(const Task&) = delete;
+        
+        //------------------------------------------------------------------------------
+        /// The type erased operations for a single type of callable, and a single
+        /// storage type.
+        //------------------------------------------------------------------------------
+        struct Operations final
+        {
+            void (*m_invoke)(void* in_callable, const TaskContext& in_taskContext);
+            void (*m_move)(void* in_destination, void* in_source);
+            void (*m_destroy)(void* in_callable);
+            bool m_isInline;
+        };
+        //------------------------------------------------------------------------------
+        /// The state of a callable which is stored outside the inline buffer.
+        //------------------------------------------------------------------------------
+        struct ExternalStorage final
+        {
+            void* m_callable;
+        };
+        //------------------------------------------------------------------------------
+        /// Whether or not the given callable type will fit in the inline buffer.
+        //------------------------------------------------------------------------------
+        template <typename TCallable> struct FitsInline final
+        {
+            static constexpr bool value = sizeof(TCallable) <= k_inlineCaptureSize && alignof(TCallable) <= k_inlineCaptureAlignment && std::is_nothrow_move_constructible<TCallable>::value;
+        };
+        //------------------------------------------------------------------------------
+        /// Stores the given callable either inline or on the free store.
+        ///
+        /// @param in_callable - The callable.
+        //------------------------------------------------------------------------------
+        template <typename TCallable> void Store(TCallable&& in_callable) noexcept;
+        //------------------------------------------------------------------------------
+        /// @return A pointer to the stored callable, or null if empty.
+        //------------------------------------------------------------------------------
+        void* GetCallable() const noexcept;
+        //------------------------------------------------------------------------------
+        /// Destroys the stored callable, if there is one, leaving the task empty.
+        //------------------------------------------------------------------------------
+        void Reset() noexcept;
+        
+        template <typename TCallable> static void Invoke(void* in_callable, const TaskContext& in_taskContext);
+        template <typename TCallable> static void Move(void* in_destination, void* in_source);
+        template <typename TCallable> static void Destroy(void* in_callable);
+        template <typename TCallable> static const Operations* GetInlineOperations() noexcept;
+        template <typename TCallable> static const Operations* GetExternalOperations() noexcept;
+        
+        const Operations* m_operations = nullptr;
+        union
+        {
+            typename std::aligned_storage<k_inlineCaptureSize, k_inlineCaptureAlignment>::type m_inlineStorage;
+            ExternalStorage m_externalStorage;
+        };
+    };
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    inline Task::Task(std::nullptr_t) noexcept
+    {
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    template <typename TCallable, typename> Task::Task(TCallable&& in_callable) noexcept
+    {
+        Store(std::forward<TCallable>(in_callable));
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    inline Task::Task(Task&& in_toMove) noexcept
+    {
+        *this = std::move(in_toMove);
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    inline Task& Task::operator=(Task&& in_toMove) noexcept
+    {
+        if (this != &in_toMove)
+        {
+            Reset();
+            
+            if (in_toMove.m_operations)
+            {
+                m_operations = in_toMove.m_operations;
+                
+                if (m_operations->m_isInline)
+                {
+                    m_operations->m_move(&m_inlineStorage, &in_toMove.m_inlineStorage);
+                    in_toMove.Reset();
+                }
+                else
+                {
+                    //ownership of the external callable is transferred, so the source must not destroy it.
+                    m_externalStorage = in_toMove.m_externalStorage;
+                    in_toMove.m_operations = nullptr;
+                }
+            }
+        }
+        
+        return *this;
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    inline Task::operator bool() const noexcept
+    {
+        return (m_operations != nullptr);
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    inline bool Task::IsInline() const noexcept
+    {
+        return (m_operations != nullptr && m_operations->m_isInline);
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    inline void Task::operator()(const TaskContext& in_taskContext) const noexcept
+    {
+        CS_ASSERT(m_operations, "Cannot execute an empty task.");
+        
+        m_operations->m_invoke(GetCallable(), in_taskContext);
+    }
+    //------------------------------------------------------------------------------
     //------------------------------------------------------------------------------
-    using Task = std::function<void(const TaskContext& in_taskContext) noexcept>;
+    template <typename TCallable> void Task::Store(TCallable&& in_callable) noexcept
+    {
+        using CallableType = typename std::decay<TCallable>::type;
+        
+        if (FitsInline<CallableType>::value)
+        {
+            new (&m_inlineStorage) CallableType(std::forward<TCallable>(in_callable));
+            m_operations = GetInlineOperations<CallableType>();
+        }
+        else
+        {
+            void* memory = ::operator new(sizeof(CallableType));
+            m_externalStorage.m_callable = new (memory) CallableType(std::forward<TCallable>(in_callable));
+            m_operations = GetExternalOperations<CallableType>();
+        }
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    inline void* Task::GetCallable() const noexcept
+    {
+        if (!m_operations)
+        {
+            return nullptr;
+        }
+        
+        if (m_operations->m_isInline)
+        {
+            return const_cast<void*>(static_cast<const void*>(&m_inlineStorage));
+        }
+        
+        return m_externalStorage.m_callable;
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    inline void Task::Reset() noexcept
+    {
+        if (!m_operations)
+        {
+            return;
+        }
+        
+        m_operations->m_destroy(GetCallable());
+        
+        if (!m_operations->m_isInline)
+        {
+            ::operator delete(m_externalStorage.m_callable);
+        }
+        
+        m_operations = nullptr;
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    template <typename TCallable> void Task::Invoke(void* in_callable, const TaskContext& in_taskContext)
+    {
+        (*static_cast<TCallable*>(in_callable))(in_taskContext);
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    template <typename TCallable> void Task::Move(void* in_destination, void* in_source)
+    {
+        new (in_destination) TCallable(std::move(*static_cast<TCallable*>(in_source)));
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    template <typename TCallable> void Task::Destroy(void* in_callable)
+    {
+        static_cast<TCallable*>(in_callable)->~TCallable();
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    template <typename TCallable> const Task::Operations* Task::GetInlineOperations() noexcept
+    {
+        static const Operations k_operations = { &Invoke<TCallable>, &Move<TCallable>, &Destroy<TCallable>, true };
+        return &k_operations;
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    template <typename TCallable> const Task::Operations* Task::GetExternalOperations() noexcept
+    {
+        static const Operations k_operations = { &Invoke<TCallable>, nullptr, &Destroy<TCallable>, false };
+        return &k_operations;
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    inline Task::~Task() noexcept
+    {
+        Reset();
+    }
 }
 
-
 #endif
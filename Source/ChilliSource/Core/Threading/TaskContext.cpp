@@ -29,15 +29,25 @@
 #include <ChilliSource/Core/Threading/TaskContext.h>
 
 #include <ChilliSource/Core/Base/Application.h>
+#include <ChilliSource/Core/Threading/TaskPool.h>
 #include <ChilliSource/Core/Threading/TaskType.h>
 #include <ChilliSource/Core/Threading/TaskScheduler.h>
 
+#include <algorithm>
+
 namespace ChilliSource
 {
+    namespace
+    {
+        constexpr u32 k_parallelForBatchesPerThread = 4;
+    }
+    
+    constexpr u32 TaskContext::k_maxParallelForBatches;
+    
     //------------------------------------------------------------------------------
     //------------------------------------------------------------------------------
-    TaskContext::TaskContext(TaskType in_taskType, TaskPool* in_taskPool) noexcept
-        : m_taskType(in_taskType), m_taskPool(in_taskPool)
+    TaskContext::TaskContext(TaskType in_taskType, TaskPool* in_taskPool, const std::atomic<bool>* in_cancellationFlag) noexcept
+        : m_taskType(in_taskType), m_taskPool(in_taskPool), m_cancellationFlag(in_cancellationFlag)
     {
         if (m_taskType == TaskType::k_mainThread || m_taskType == TaskType::k_system || m_taskType == TaskType::k_file)
         {
@@ -56,32 +66,45 @@ namespace ChilliSource
     }
     //------------------------------------------------------------------------------
     //------------------------------------------------------------------------------
+    bool TaskContext::IsCancelled() const noexcept
+    {
+        return (m_cancellationFlag && m_cancellationFlag->load(std::memory_order_relaxed));
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
     void TaskContext::ProcessChildTasks(const std::vector<Task>& in_tasks) const noexcept
     {
-		CS_ASSERT(in_tasks.size() > 0, "No tasks provided to run.");
+        ProcessChildTasks(in_tasks.data(), u32(in_tasks.size()));
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    void TaskContext::ProcessChildTasks(const Task* in_tasks, u32 in_numTasks) const noexcept
+    {
+		CS_ASSERT(in_numTasks > 0, "No tasks provided to run.");
         if (m_taskType == TaskType::k_mainThread || m_taskType == TaskType::k_system || m_taskType == TaskType::k_file)
         {
-            for (const auto& task : in_tasks)
+            for (u32 i = 0; i < in_numTasks; ++i)
             {
-                task(*this);
+                in_tasks[i](*this);
             }
         }
-        else if (m_taskType == TaskType::k_gameLogic)
+        else
         {
-            std::vector<Task> gameLogicTasks;
-            for (const auto& task : in_tasks)
-            {
-                gameLogicTasks.push_back([=](const TaskContext&)
-                {
-                    task(*this);
-                });
-            }
-            
-            m_taskPool->AddTasksAndYield(gameLogicTasks);
+            m_taskPool->AddTasksAndYield(in_tasks, in_numTasks, *this);
         }
-        else
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    u32 TaskContext::CalcGrainSize(u32 in_numItems, u32 in_minGrainSize) const noexcept
+    {
+        if (!m_taskPool || m_taskPool->GetNumThreads() <= 1)
         {
-            m_taskPool->AddTasksAndYield(in_tasks);
+            return std::max(in_numItems, 1u);
         }
+        
+        u32 numBatches = std::min(m_taskPool->GetNumThreads() * k_parallelForBatchesPerThread, k_maxParallelForBatches);
+        u32 grainSize = (in_numItems + numBatches - 1) / numBatches;
+        
+        return std::max(std::max(grainSize, in_minGrainSize), 1u);
     }
 }
@@ -32,6 +32,9 @@
 #include <ChilliSource/ChilliSource.h>
 #include <ChilliSource/Core/Threading/Task.h>
 
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <vector>
 
 namespace ChilliSource
@@ -46,6 +49,8 @@ namespace ChilliSource
     class TaskContext final
     {
     public:
+        static constexpr u32 k_maxParallelForBatches = 32;
+        
         //------------------------------------------------------------------------------
         /// Constructs a task context of the given type.
         ///
@@ -54,8 +59,10 @@ namespace ChilliSource
         /// @param in_taskType - The type of task this context represents.
         /// @param in_taskPool - The task pool that this task and its children should be
         /// run within. This should not be provided for main thread and file task types.
+        /// @param in_cancellationFlag - (Optional) A flag which is set if the task is
+        /// cancelled while it is running. Must outlive the context.
         //------------------------------------------------------------------------------
-        TaskContext(TaskType in_taskType, TaskPool* in_taskPool = nullptr) noexcept;
+        TaskContext(TaskType in_taskType, TaskPool* in_taskPool = nullptr, const std::atomic<bool>* in_cancellationFlag = nullptr) noexcept;
         //------------------------------------------------------------------------------
         /// @author Ian Copland
         ///
@@ -63,6 +70,14 @@ namespace ChilliSource
         //------------------------------------------------------------------------------
         TaskType GetType() const noexcept;
         //------------------------------------------------------------------------------
+        /// Whether or not the task has been cancelled while running. Currently only
+        /// file tasks can be cancelled. Long running tasks should check this
+        /// periodically and exit early if it is set.
+        ///
+        /// @return Whether or not the task has been cancelled.
+        //------------------------------------------------------------------------------
+        bool IsCancelled() const noexcept;
+        //------------------------------------------------------------------------------
         /// Schedules the given child tasks and yields until they have completed. Child
         /// tasks must be of the same type as the parent.
         ///
@@ -73,10 +88,80 @@ namespace ChilliSource
         /// @param in_tasks - The tasks to be processed.
         //------------------------------------------------------------------------------
         void ProcessChildTasks(const std::vector<Task>& in_tasks) const noexcept;
+        //------------------------------------------------------------------------------
+        /// Schedules the given array of child tasks and yields until they have
+        /// completed. Child tasks must be of the same type as the parent.
+        ///
+        /// Child tasks are provided with a task context.
+        ///
+        /// @param in_tasks - The array of tasks to be processed.
+        /// @param in_numTasks - The number of tasks in the array.
+        //------------------------------------------------------------------------------
+        void ProcessChildTasks(const Task* in_tasks, u32 in_numTasks) const noexcept;
+        //------------------------------------------------------------------------------
+        /// Splits the given range of items into batches and processes each batch as a
+        /// child task, yielding until all batches are complete.
+        ///
+        /// The batch size adapts to the number of threads available to this context,
+        /// so that there are a few batches per thread to allow for load balancing, but
+        /// will never be smaller than the given minimum grain size. The number of batches
+        /// is capped so that the batch tasks can be stored on the stack rather than
+        /// allocated for each call. If this context has no task pool the whole range is
+        /// processed as a single batch on the current thread.
+        ///
+        /// @param in_numItems - The number of items in the range.
+        /// @param in_minGrainSize - The minimum number of items per batch.
+        /// @param in_function - The function which will be called for each batch. This
+        /// should have the signature void(const TaskContext&, u32 startIndex, u32
+        /// endIndex), where endIndex is exclusive.
+        //------------------------------------------------------------------------------
+        template <typename TFunction> void ParallelFor(u32 in_numItems, u32 in_minGrainSize, const TFunction& in_function) const noexcept;
+        //------------------------------------------------------------------------------
+        /// Calculates the batch size that should be used to process the given number
+        /// of items in parallel, based on the number of threads in the task pool. This
+        /// never results in more than k_maxParallelForBatches batches.
+        ///
+        /// @param in_numItems - The number of items in the range.
+        /// @param in_minGrainSize - The minimum number of items per batch.
+        ///
+        /// @return The grain size.
+        //------------------------------------------------------------------------------
+        u32 CalcGrainSize(u32 in_numItems, u32 in_minGrainSize) const noexcept;
         
         TaskType m_taskType;
         TaskPool* m_taskPool = nullptr;
+        const std::atomic<bool>* m_cancellationFlag = nullptr;
     };
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    template <typename TFunction> void TaskContext::ParallelFor(u32 in_numItems, u32 in_minGrainSize, const TFunction& in_function) const noexcept
+    {
+        if (in_numItems == 0)
+        {
+            return;
+        }
+        
+        u32 grainSize = CalcGrainSize(in_numItems, in_minGrainSize);
+        if (grainSize >= in_numItems)
+        {
+            in_function(*this, 0, in_numItems);
+            return;
+        }
+        
+        std::array<Task, k_maxParallelForBatches> tasks;
+        u32 numTasks = 0;
+        
+        for (u32 startIndex = 0; startIndex < in_numItems; startIndex += grainSize)
+        {
+            u32 endIndex = std::min(startIndex + grainSize, in_numItems);
+            tasks[numTasks++] = [&in_function, startIndex, endIndex](const TaskContext& in_taskContext) noexcept
+            {
+                in_function(in_taskContext, startIndex, endIndex);
+            };
+        }
+        
+        ProcessChildTasks(tasks.data(), numTasks);
+    }
 }
 
 #endif
@@ -0,0 +1,88 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2016 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#include <ChilliSource/Core/Threading/TaskGraph.h>
+
+namespace ChilliSource
+{
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    TaskGraph::NodeId TaskGraph::AddNode(Task&& in_task, const std::vector<NodeId>& in_predecessors) noexcept
+    {
+        CS_ASSERT(!m_isScheduled, "Cannot add nodes to a task graph which has been scheduled.");
+        CS_ASSERT(static_cast<bool>(in_task), "Cannot add an empty task to a task graph.");
+        
+        NodeId nodeId = NodeId(m_nodes.size());
+        
+        Node node;
+        node.m_task = std::move(in_task);
+        node.m_numPredecessors = u32(in_predecessors.size());
+        m_nodes.push_back(std::move(node));
+        
+        for (auto predecessor : in_predecessors)
+        {
+            CS_ASSERT(predecessor < nodeId, "Task graph predecessors must be added before their successors.");
+            m_nodes[predecessor].m_successors.push_back(nodeId);
+        }
+        
+        return nodeId;
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    u32 TaskGraph::GetNumNodes() const noexcept
+    {
+        return u32(m_nodes.size());
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    void TaskGraph::Prepare(Task&& in_completionTask) noexcept
+    {
+        CS_ASSERT(!m_isScheduled, "A task graph can only be scheduled once.");
+        
+        m_isScheduled = true;
+        m_completionTask = std::move(in_completionTask);
+        m_numIncompleteNodes.reset(new std::atomic<u32>(u32(m_nodes.size())));
+        
+        m_pendingPredecessors.reset(new std::atomic<u32>[m_nodes.size()]);
+        for (std::size_t i = 0; i < m_nodes.size(); ++i)
+        {
+            m_pendingPredecessors[i] = m_nodes[i].m_numPredecessors;
+        }
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    bool TaskGraph::CompleteNode(NodeId in_nodeId, std::vector<NodeId>& out_readyNodes) noexcept
+    {
+        for (auto successor : m_nodes[in_nodeId].m_successors)
+        {
+            if (--m_pendingPredecessors[successor] == 0)
+            {
+                out_readyNodes.push_back(successor);
+            }
+        }
+        
+        return (--(*m_numIncompleteNodes) == 0);
+    }
+}
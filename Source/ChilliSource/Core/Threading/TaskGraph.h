@@ -0,0 +1,131 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2016 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#ifndef _CHILLISOURCE_CORE_THREADING_TASKGRAPH_H_
+#define _CHILLISOURCE_CORE_THREADING_TASKGRAPH_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Threading/Task.h>
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+namespace ChilliSource
+{
+    //------------------------------------------------------------------------------
+    /// A collection of tasks with dependencies between them. Each node in the graph
+    /// declares the nodes which must complete before it can be started. Once the
+    /// graph is scheduled through the TaskScheduler each node is scheduled as soon
+    /// as all of its predecessors are complete, without any thread blocking on a
+    /// join. This allows independent chains of work to overlap freely.
+    ///
+    /// Predecessors must be added to the graph before their successors, which
+    /// guarantees that the graph is acyclic.
+    ///
+    /// A graph can only be scheduled once. This is not thread-safe while it is being
+    /// built.
+    //------------------------------------------------------------------------------
+    class TaskGraph final
+    {
+    public:
+        CS_DECLARE_NOCOPY(TaskGraph);
+        
+        using NodeId = u32;
+        //------------------------------------------------------------------------------
+        /// Constructs a new empty graph.
+        //------------------------------------------------------------------------------
+        TaskGraph() = default;
+        //------------------------------------------------------------------------------
+        /// Move constructor.
+        ///
+        /// @param in_toMove - The graph to move.
+        //------------------------------------------------------------------------------
+        TaskGraph(TaskGraph&& in_toMove) = default;
+        //------------------------------------------------------------------------------
+        /// Move assignment.
+        ///
+        /// @param in_toMove - The graph to move.
+        ///
+        /// @return A reference to this.
+        //------------------------------------------------------------------------------
+        TaskGraph& operator=(TaskGraph&& in_toMove) = default;
+        //------------------------------------------------------------------------------
+        /// Adds a new node to the graph which will be started once all of the given
+        /// predecessors have completed.
+        ///
+        /// @param in_task - The task which the node will perform.
+        /// @param in_predecessors - (Optional) The nodes which must complete before
+        /// this node is started. These must already exist in the graph.
+        ///
+        /// @return The Id of the new node.
+        //------------------------------------------------------------------------------
+        NodeId AddNode(Task&& in_task, const std::vector<NodeId>& in_predecessors = std::vector<NodeId>()) noexcept;
+        //------------------------------------------------------------------------------
+        /// @return The number of nodes in the graph.
+        //------------------------------------------------------------------------------
+        u32 GetNumNodes() const noexcept;
+        
+    private:
+        friend class TaskScheduler;
+        
+        //------------------------------------------------------------------------------
+        /// A single node in the graph.
+        //------------------------------------------------------------------------------
+        struct Node final
+        {
+            Task m_task;
+            u32 m_numPredecessors = 0;
+            std::vector<NodeId> m_successors;
+        };
+        //------------------------------------------------------------------------------
+        /// Prepares the runtime state of the graph prior to it being scheduled.
+        ///
+        /// @param in_completionTask - The task to schedule once all nodes are
+        /// complete. May be empty.
+        //------------------------------------------------------------------------------
+        void Prepare(Task&& in_completionTask) noexcept;
+        //------------------------------------------------------------------------------
+        /// Marks the given node as complete. Any successors which no longer have any
+        /// outstanding predecessors are added to the ready list.
+        ///
+        /// This is thread-safe.
+        ///
+        /// @param in_nodeId - The completed node.
+        /// @param out_readyNodes - [Out] The list to which ready nodes will be added.
+        ///
+        /// @return Whether or not this was the last node in the graph to complete.
+        //------------------------------------------------------------------------------
+        bool CompleteNode(NodeId in_nodeId, std::vector<NodeId>& out_readyNodes) noexcept;
+        
+        std::vector<Node> m_nodes;
+        std::unique_ptr<std::atomic<u32>[]> m_pendingPredecessors;
+        std::unique_ptr<std::atomic<u32>> m_numIncompleteNodes;
+        Task m_completionTask;
+        bool m_isScheduled = false;
+    };
+}
+
+#endif
@@ -39,16 +39,47 @@
 
 namespace ChilliSource
 {
+    namespace
+    {
+        constexpr std::size_t k_nodeBatchSize = 64;
+        
+        //------------------------------------------------------------------------------
+        /// Generates the next value in a xorshift sequence. This is used for picking
+        /// steal victims as it is cheap, and doesn't require any shared state.
+        ///
+        /// @param io_state - [In/Out] The current state of the sequence. Must not be 0.
+        ///
+        /// @return The next value in the sequence.
+        //------------------------------------------------------------------------------
+        u32 NextRandom(u32& io_state) noexcept
+        {
+            io_state ^= io_state << 13;
+            io_state ^= io_state >> 17;
+            io_state ^= io_state << 5;
+            return io_state;
+        }
+    }
+    
     //------------------------------------------------------------------------------
     //------------------------------------------------------------------------------
     TaskPool::TaskPool(TaskType in_taskType, u32 in_numThreads) noexcept
-        : m_numThreads(in_numThreads), m_taskContext(in_taskType, this), m_isFinished(false), m_taskCountHeuristic(0)
+        : m_numThreads(in_numThreads), m_taskContext(in_taskType, this), m_taskCountHeuristic(0), m_numSleepingThreads(0), m_isFinished(false)
     {
         CS_ASSERT(in_taskType == TaskType::k_small || in_taskType == TaskType::k_large, "Task type must be small or large");
         
+        m_workers.reserve(m_numThreads);
         for (u32 i = 0; i < m_numThreads; ++i)
         {
-            m_threads.push_back(std::thread(MakeDelegate(this, &TaskPool::ProcessTasks)));
+            std::unique_ptr<Worker> worker(new Worker());
+            worker->m_freeNodes.reserve(k_nodeBatchSize * 2);
+            worker->m_randomState = 2654435761u * (i + 1);
+            m_workers.push_back(std::move(worker));
+        }
+        
+        m_threads.reserve(m_numThreads);
+        for (u32 i = 0; i < m_numThreads; ++i)
+        {
+            m_threads.push_back(std::thread(MakeDelegate(this, &TaskPool::ProcessTasks), i));
         }
     }
     //------------------------------------------------------------------------------
@@ -59,78 +90,303 @@ namespace ChilliSource
     }
     //------------------------------------------------------------------------------
     //------------------------------------------------------------------------------
-    void TaskPool::AddTasks(const std::vector<Task>& in_tasks) noexcept
+    void TaskPool::AddTask(Task&& in_task) noexcept
+    {
+        QueueTasks(GetCurrentThreadIndex(), &in_task, nullptr, 1, nullptr, nullptr);
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    void TaskPool::AddTasks(std::vector<Task>&& in_tasks) noexcept
+    {
+        QueueTasks(GetCurrentThreadIndex(), in_tasks.data(), nullptr, in_tasks.size(), nullptr, nullptr);
+        in_tasks.clear();
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    void TaskPool::AddTasks(std::vector<Task>&& in_tasks, const TaskContext& in_taskContext, CompletionCounter& in_counter) noexcept
+    {
+        QueueTasks(GetCurrentThreadIndex(), in_tasks.data(), nullptr, in_tasks.size(), &in_taskContext, &in_counter);
+        in_tasks.clear();
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    void TaskPool::AddTasksAndYield(const std::vector<Task>& in_tasks) noexcept
     {
-        std::unique_lock<std::mutex> queueLock(m_taskQueueMutex);
-        m_taskQueue.insert(m_taskQueue.begin(), in_tasks.begin(), in_tasks.end());
-        m_taskCountHeuristic += u32(in_tasks.size());
+        AddTasksAndYield(in_tasks.data(), in_tasks.size(), m_taskContext);
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    void TaskPool::AddTasksAndYield(const Task* in_tasks, std::size_t in_numTasks, const TaskContext& in_taskContext) noexcept
+    {
+        if (in_numTasks == 0)
+        {
+            return;
+        }
+        
+        CompletionCounter counter(m_sleepMutex, m_emptyWaitCondition);
         
-        if (in_tasks.size() > 1)
+        s32 threadIndex = GetCurrentThreadIndex();
+        QueueTasks(threadIndex, nullptr, in_tasks, in_numTasks, &in_taskContext, &counter);
+        
+        while (!counter.m_isFinished)
         {
-            m_emptyWaitCondition.notify_all();
+            PerformTask(threadIndex, counter.m_isFinished);
         }
-        else
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    s32 TaskPool::GetCurrentThreadIndex() const noexcept
+    {
+        auto threadId = std::this_thread::get_id();
+        for (u32 i = 0; i < u32(m_threads.size()); ++i)
         {
-            m_emptyWaitCondition.notify_one();
+            if (m_threads[i].get_id() == threadId)
+            {
+                return s32(i);
+            }
         }
+        
+        return -1;
     }
     //------------------------------------------------------------------------------
     //------------------------------------------------------------------------------
-    void TaskPool::AddTasksAndYield(const std::vector<Task>& in_tasks) noexcept
+    void TaskPool::AllocateNodes(s32 in_threadIndex, std::size_t in_numNodes, TaskNode** out_nodes) noexcept
     {
-        std::atomic<u32> taskCount(u32(in_tasks.size()));
-        std::atomic<bool> finished(false);
+        std::size_t numAllocated = 0;
         
-        std::vector<Task> tasksWithCounter;
-        for (const auto& task : in_tasks)
+        if (in_threadIndex >= 0)
         {
-            tasksWithCounter.push_back([=, &task, &taskCount, &finished](const TaskContext& in_taskContext) noexcept
+            auto& freeNodes = m_workers[in_threadIndex]->m_freeNodes;
+            while (numAllocated < in_numNodes && !freeNodes.empty())
             {
-                task(in_taskContext);
-
-                if (--taskCount == 0)
+                out_nodes[numAllocated++] = freeNodes.back();
+                freeNodes.pop_back();
+            }
+        }
+        
+        if (numAllocated < in_numNodes)
+        {
+            std::unique_lock<std::mutex> lock(m_sharedFreeNodesMutex);
+            
+            while (m_sharedFreeNodes.size() < in_numNodes - numAllocated)
+            {
+                std::unique_ptr<TaskNode[]> block(new TaskNode[k_nodeBatchSize]);
+                for (std::size_t i = 0; i < k_nodeBatchSize; ++i)
                 {
-                    std::unique_lock<std::mutex> queueLock(m_taskQueueMutex);
-                    finished = true;
-                    m_emptyWaitCondition.notify_all();
+                    m_sharedFreeNodes.push_back(&block[i]);
                 }
-            });
+                m_nodeBlocks.push_back(std::move(block));
+            }
+            
+            while (numAllocated < in_numNodes)
+            {
+                out_nodes[numAllocated++] = m_sharedFreeNodes.back();
+                m_sharedFreeNodes.pop_back();
+            }
+        }
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    void TaskPool::FreeNode(s32 in_threadIndex, TaskNode* in_node) noexcept
+    {
+        in_node->m_task = nullptr;
+        in_node->m_borrowedTask = nullptr;
+        in_node->m_taskContext = nullptr;
+        in_node->m_counter = nullptr;
+        
+        if (in_threadIndex >= 0)
+        {
+            auto& freeNodes = m_workers[in_threadIndex]->m_freeNodes;
+            if (freeNodes.size() < freeNodes.capacity())
+            {
+                freeNodes.push_back(in_node);
+                return;
+            }
+            
+            //the local free list is full, so return half of it to the shared list.
+            std::unique_lock<std::mutex> lock(m_sharedFreeNodesMutex);
+            m_sharedFreeNodes.insert(m_sharedFreeNodes.end(), freeNodes.end() - k_nodeBatchSize, freeNodes.end());
+            lock.unlock();
+            
+            freeNodes.resize(freeNodes.size() - k_nodeBatchSize);
+            freeNodes.push_back(in_node);
+        }
+        else
+        {
+            std::unique_lock<std::mutex> lock(m_sharedFreeNodesMutex);
+            m_sharedFreeNodes.push_back(in_node);
+        }
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    void TaskPool::PushNodes(s32 in_threadIndex, TaskNode* const* in_nodes, std::size_t in_numNodes) noexcept
+    {
+        //Both the local deque and shared stack are popped from the back, so nodes are pushed in reverse.
+        if (in_threadIndex >= 0)
+        {
+            auto& taskQueue = m_workers[in_threadIndex]->m_taskQueue;
+            for (std::size_t i = in_numNodes; i > 0; --i)
+            {
+                taskQueue.Push(in_nodes[i - 1]);
+            }
+        }
+        else
+        {
+            std::unique_lock<std::mutex> lock(m_sharedTaskStackMutex);
+            for (std::size_t i = in_numNodes; i > 0; --i)
+            {
+                m_sharedTaskStack.push_back(in_nodes[i - 1]);
+            }
+        }
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    void TaskPool::QueueTasks(s32 in_threadIndex, Task* in_ownedTasks, const Task* in_borrowedTasks, std::size_t in_numTasks, const TaskContext* in_taskContext, CompletionCounter* in_counter) noexcept
+    {
+        if (in_numTasks == 0)
+        {
+            return;
+        }
+        
+        if (in_counter)
+        {
+            in_counter->m_count += u32(in_numTasks);
         }
         
-        AddTasks(tasksWithCounter);
+        //The count is incremented prior to the tasks becoming available so that it never under flows. A thread
+        //which sees the count before the tasks are pushed will simply spin until they are available.
+        m_taskCountHeuristic += u32(in_numTasks);
+        
+        //Nodes are queued in fixed size batches, starting with the last batch, so that the first task is the first
+        //to be popped.
+        TaskNode* nodes[k_nodeBatchSize];
+        std::size_t batchEnd = in_numTasks;
+        while (batchEnd > 0)
+        {
+            std::size_t batchStart = (batchEnd > k_nodeBatchSize) ? batchEnd - k_nodeBatchSize : 0;
+            std::size_t batchSize = batchEnd - batchStart;
+            
+            AllocateNodes(in_threadIndex, batchSize, nodes);
+            for (std::size_t i = 0; i < batchSize; ++i)
+            {
+                auto node = nodes[i];
+                if (in_ownedTasks)
+                {
+                    node->m_task = std::move(in_ownedTasks[batchStart + i]);
+                }
+                else
+                {
+                    node->m_borrowedTask = &in_borrowedTasks[batchStart + i];
+                }
+                node->m_taskContext = in_taskContext;
+                node->m_counter = in_counter;
+            }
+            
+            PushNodes(in_threadIndex, nodes, batchSize);
+            batchEnd = batchStart;
+        }
         
-        while (!finished)
+        if (m_numSleepingThreads > 0)
         {
-            PerformTask(finished);
+            std::unique_lock<std::mutex> sleepLock(m_sleepMutex);
+            if (in_numTasks > 1)
+            {
+                m_emptyWaitCondition.notify_all();
+            }
+            else
+            {
+                m_emptyWaitCondition.notify_one();
+            }
         }
     }
     //------------------------------------------------------------------------------
     //------------------------------------------------------------------------------
-    void TaskPool::PerformTask(const std::atomic<bool>& in_forceContinue) noexcept
+    TaskPool::TaskNode* TaskPool::FindTask(s32 in_threadIndex) noexcept
     {
-        std::unique_lock<std::mutex> queueLock(m_taskQueueMutex);
+        TaskNode* node = nullptr;
         
-        if (m_taskQueue.empty() && !in_forceContinue)
+        if (in_threadIndex >= 0 && m_workers[in_threadIndex]->m_taskQueue.Pop(node))
         {
-            m_emptyWaitCondition.wait(queueLock);
+            return node;
         }
         
-        if (m_taskQueue.empty())
+        if (m_numThreads > 0)
         {
-            return;
+            u32 startIndex = 0;
+            if (in_threadIndex >= 0)
+            {
+                startIndex = NextRandom(m_workers[in_threadIndex]->m_randomState) % m_numThreads;
+            }
+            
+            for (u32 i = 0; i < m_numThreads; ++i)
+            {
+                u32 victimIndex = (startIndex + i) % m_numThreads;
+                if (s32(victimIndex) != in_threadIndex && m_workers[victimIndex]->m_taskQueue.Steal(node))
+                {
+                    return node;
+                }
+            }
+        }
+        
+        std::unique_lock<std::mutex> lock(m_sharedTaskStackMutex);
+        if (!m_sharedTaskStack.empty())
+        {
+            node = m_sharedTaskStack.back();
+            m_sharedTaskStack.pop_back();
+        }
+        
+        return node;
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    void TaskPool::PerformTask(s32 in_threadIndex, const std::atomic<bool>& in_forceContinue) noexcept
+    {
+        TaskNode* node = nullptr;
+        if (m_taskCountHeuristic > 0)
+        {
+            node = FindTask(in_threadIndex);
         }
         
-        Task task = m_taskQueue.front();
-        m_taskQueue.pop_front();
-        --m_taskCountHeuristic;
+        if (node)
+        {
+            --m_taskCountHeuristic;
+            
+            const Task& task = node->m_borrowedTask ? *node->m_borrowedTask : node->m_task;
+            task(node->m_taskContext ? *node->m_taskContext : m_taskContext);
             
-        queueLock.unlock();
+            auto counter = node->m_counter;
+            FreeNode(in_threadIndex, node);
+            
+            if (counter && --counter->m_count == 0)
+            {
+                //The counter may be destroyed as soon as the finished flag is set, so the mutex and condition
+                //must be accessed via local references.
+                auto& mutex = counter->m_mutex;
+                auto& condition = counter->m_condition;
+                
+                std::unique_lock<std::mutex> counterLock(mutex);
+                counter->m_isFinished = true;
+                condition.notify_all();
+            }
+            
+            return;
+        }
+        
+        //The sleeping thread count is incremented before checking the task count, and tasks are counted before
+        //checking for sleeping threads, so either this thread will see the new tasks or it will be notified.
+        std::unique_lock<std::mutex> sleepLock(m_sleepMutex);
+        ++m_numSleepingThreads;
+        
+        if (m_taskCountHeuristic == 0 && !in_forceContinue)
+        {
+            m_emptyWaitCondition.wait(sleepLock);
+        }
         
-        task(m_taskContext);
+        --m_numSleepingThreads;
     }
     //------------------------------------------------------------------------------
     //------------------------------------------------------------------------------
-    void TaskPool::ProcessTasks() noexcept
+    void TaskPool::ProcessTasks(u32 in_threadIndex) noexcept
     {
 #ifdef CS_TARGETPLATFORM_ANDROID
         CSBackend::Android::JavaVirtualMachine::Get()->AttachCurrentThread();
@@ -138,7 +394,7 @@ namespace ChilliSource
 
         while (!m_isFinished || m_taskCountHeuristic > 0)
         {
-            PerformTask(m_isFinished);
+            PerformTask(s32(in_threadIndex), m_isFinished);
         }
         
 #ifdef CS_TARGETPLATFORM_ANDROID
@@ -149,9 +405,9 @@ namespace ChilliSource
     //------------------------------------------------------------------------------
     TaskPool::~TaskPool() noexcept
     {
-        std::unique_lock<std::mutex> queueLock(m_taskQueueMutex);
+        std::unique_lock<std::mutex> sleepLock(m_sleepMutex);
         m_isFinished = true;
-        queueLock.unlock();
+        sleepLock.unlock();
         
         m_emptyWaitCondition.notify_all();
         for (auto& thread : m_threads)
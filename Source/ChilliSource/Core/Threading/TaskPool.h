@@ -30,13 +30,15 @@
 #define _CHILLISOURCE_CORE_THREADING_TASKPOOL_H_
 
 #include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Threading/Task.h>
 #include <ChilliSource/Core/Threading/TaskContext.h>
+#include <ChilliSource/Core/Threading/WorkStealingQueue.h>
 
 #include <atomic>
 #include <condition_variable>
-#include <deque>
 #include <mutex>
 #include <thread>
+#include <vector>
 
 namespace ChilliSource
 {
@@ -44,9 +46,16 @@ namespace ChilliSource
     /// A collection of tasks which will be performed on one of the worker threads
     /// owned by the pool.
     ///
-    /// Currently this does no task stealing or other clever tricks for performance;
-    /// all tasks are drawn from a single global queue which is locked on every
-    /// access.
+    /// Each worker thread owns a lock-free work stealing deque. Tasks added from a
+    /// worker thread are pushed onto that worker's deque, and the worker processes
+    /// its own deque in LIFO order. When a worker runs out of tasks it attempts to
+    /// steal from the other end of a randomly selected victim's deque. Tasks added
+    /// from threads not owned by the pool are placed in a shared queue, which is
+    /// only locked when tasks are added externally or when a worker has no local
+    /// or stolen tasks to perform.
+    ///
+    /// Queued tasks are stored in recycled task nodes, so once the pool has warmed
+    /// up adding and performing tasks doesn't allocate.
     ///
     /// This is thread-safe.
     ///
@@ -57,6 +66,24 @@ namespace ChilliSource
     public:
         CS_DECLARE_NOCOPY(TaskPool);
         //------------------------------------------------------------------------------
+        /// Tracks completion of a group of tasks. The count is decremented as each task
+        /// in the group finishes. When it reaches zero the finished flag is set and the
+        /// condition is notified while holding the given mutex, allowing other threads
+        /// to safely wait on the group.
+        //------------------------------------------------------------------------------
+        struct CompletionCounter final
+        {
+            CompletionCounter(std::mutex& in_mutex, std::condition_variable& in_condition) noexcept
+                : m_count(0), m_isFinished(false), m_mutex(in_mutex), m_condition(in_condition)
+            {
+            }
+            
+            std::atomic<u32> m_count;
+            std::atomic<bool> m_isFinished;
+            std::mutex& m_mutex;
+            std::condition_variable& m_condition;
+        };
+        //------------------------------------------------------------------------------
         /// Constructs a new task pool with the given number of threads.
         ///
         /// @author Ian Copland
@@ -74,6 +101,13 @@ namespace ChilliSource
         //------------------------------------------------------------------------------
         u32 GetNumThreads() const noexcept;
         //------------------------------------------------------------------------------
+        /// Adds a single task to the pool. The task will be executed as soon as a
+        /// thread becomes free.
+        ///
+        /// @param in_task - The task to be added to the pool.
+        //------------------------------------------------------------------------------
+        void AddTask(Task&& in_task) noexcept;
+        //------------------------------------------------------------------------------
         /// Adds a series of tasks to the pool. These task will be executed as soon as a
         /// thread becomes free.
         ///
@@ -81,17 +115,43 @@ namespace ChilliSource
         ///
         /// @param in_tasks - The tasks to be added to the pool.
         //------------------------------------------------------------------------------
-        void AddTasks(const std::vector<Task>& in_tasks) noexcept;
+        void AddTasks(std::vector<Task>&& in_tasks) noexcept;
+        //------------------------------------------------------------------------------
+        /// Adds a series of tasks to the pool which will be performed with the given
+        /// task context rather than the task context of the pool. The completion
+        /// counter is incremented by the number of tasks, and decremented as each
+        /// finishes.
+        ///
+        /// @param in_tasks - The tasks to be added to the pool.
+        /// @param in_taskContext - The context the tasks will be performed with. This
+        /// must outlive the tasks.
+        /// @param in_counter - The completion counter. This must outlive the tasks.
+        //------------------------------------------------------------------------------
+        void AddTasks(std::vector<Task>&& in_tasks, const TaskContext& in_taskContext, CompletionCounter& in_counter) noexcept;
         //------------------------------------------------------------------------------
         /// Performs the given series of tasks and yields until they are finished. While
         /// yielding, other tasks will be processed.
         ///
+        /// The tasks are not copied, they are performed in place.
+        ///
         /// @author Ian Copland
         ///
         /// @param in_tasks - The tasks to be added to the pool.
         //------------------------------------------------------------------------------
         void AddTasksAndYield(const std::vector<Task>& in_tasks) noexcept;
         //------------------------------------------------------------------------------
+        /// Performs the given series of tasks with the given task context rather than
+        /// the task context of the pool, and yields until they are finished. While
+        /// yielding, other tasks will be processed.
+        ///
+        /// The tasks are not copied, they are performed in place.
+        ///
+        /// @param in_tasks - The array of tasks to be added to the pool.
+        /// @param in_numTasks - The number of tasks in the array.
+        /// @param in_taskContext - The context the tasks will be performed with.
+        //------------------------------------------------------------------------------
+        void AddTasksAndYield(const Task* in_tasks, std::size_t in_numTasks, const TaskContext& in_taskContext) noexcept;
+        //------------------------------------------------------------------------------
         /// Waits for any currently running tasks to finish then joins all owned threads.
         ///
         /// @author Ian Copland
@@ -99,9 +159,93 @@ namespace ChilliSource
         ~TaskPool() noexcept;
         
     private:
+        //------------------------------------------------------------------------------
+        /// A queued task. Either the task is owned by the node, or it refers to a task
+        /// owned by a thread which is yielding on it.
+        //------------------------------------------------------------------------------
+        struct TaskNode final
+        {
+            Task m_task;
+            const Task* m_borrowedTask = nullptr;
+            const TaskContext* m_taskContext = nullptr;
+            CompletionCounter* m_counter = nullptr;
+        };
+        //------------------------------------------------------------------------------
+        /// The state owned by a single worker thread.
+        //------------------------------------------------------------------------------
+        struct Worker final
+        {
+            WorkStealingQueue<TaskNode*> m_taskQueue;
+            std::vector<TaskNode*> m_freeNodes;
+            u32 m_randomState = 0;
+        };
+        //------------------------------------------------------------------------------
+        /// This can only be called after the task pool has been fully constructed.
+        ///
+        /// @return The index of the current thread within the task pool, or -1 if the
+        /// current thread is not owned by this pool.
+        //------------------------------------------------------------------------------
+        s32 GetCurrentThreadIndex() const noexcept;
+        //------------------------------------------------------------------------------
+        /// Gets the requested number of free task nodes, first from the calling
+        /// thread's local free list and then from the shared free list. New nodes are
+        /// only allocated if both are empty.
+        ///
+        /// @param in_threadIndex - The index of the calling thread, or -1 if the
+        /// calling thread isn't owned by this pool.
+        /// @param in_numNodes - The number of nodes required.
+        /// @param out_nodes - [Out] The output node array. This must be at least
+        /// in_numNodes long.
+        //------------------------------------------------------------------------------
+        void AllocateNodes(s32 in_threadIndex, std::size_t in_numNodes, TaskNode** out_nodes) noexcept;
+        //------------------------------------------------------------------------------
+        /// Resets the given node and returns it to the calling thread's free list. If
+        /// the local free list is becoming large, a batch is returned to the shared
+        /// free list.
+        ///
+        /// @param in_threadIndex - The index of the calling thread, or -1 if the
+        /// calling thread isn't owned by this pool.
+        /// @param in_node - The node to free.
+        //------------------------------------------------------------------------------
+        void FreeNode(s32 in_threadIndex, TaskNode* in_node) noexcept;
+        //------------------------------------------------------------------------------
+        /// Pushes the given nodes into the queue appropriate for the calling thread. The
+        /// nodes are pushed such that they will be popped in the order given.
+        ///
+        /// @param in_threadIndex - The index of the calling thread, or -1 if the
+        /// calling thread isn't owned by this pool.
+        /// @param in_nodes - The nodes to push.
+        /// @param in_numNodes - The number of nodes to push.
+        //------------------------------------------------------------------------------
+        void PushNodes(s32 in_threadIndex, TaskNode* const* in_nodes, std::size_t in_numNodes) noexcept;
+        //------------------------------------------------------------------------------
+        /// Queues the given tasks, optionally with a context and completion counter,
+        /// then wakes any sleeping threads.
+        ///
+        /// @param in_threadIndex - The index of the calling thread, or -1 if the
+        /// calling thread isn't owned by this pool.
+        /// @param in_ownedTasks - Tasks which will be moved into the pool. May be null.
+        /// @param in_borrowedTasks - Tasks which will be performed in place. May be null.
+        /// @param in_numTasks - The number of tasks.
+        /// @param in_taskContext - The task context, or null to use the pool context.
+        /// @param in_counter - The completion counter. May be null.
+        //------------------------------------------------------------------------------
+        void QueueTasks(s32 in_threadIndex, Task* in_ownedTasks, const Task* in_borrowedTasks, std::size_t in_numTasks, const TaskContext* in_taskContext, CompletionCounter* in_counter) noexcept;
+        //------------------------------------------------------------------------------
+        /// Attempts to find a task to perform. The local deque of the given thread is
+        /// tried first, followed by the deques of other threads, starting at a random
+        /// victim, and finally the shared queue.
+        ///
+        /// @param in_threadIndex - The index of the calling thread, or -1 if the
+        /// calling thread isn't owned by this pool.
+        ///
+        /// @return The task node, or null if no task could be found.
+        //------------------------------------------------------------------------------
+        TaskNode* FindTask(s32 in_threadIndex) noexcept;
         //------------------------------------------------------------------------------
         /// Performs a task from the task pool. This must be called from one of the
-        /// threads owned by the task pool.
+        /// threads owned by the task pool, or from a thread that is yielding on tasks
+        /// added to the pool.
         ///
         /// A flag is provided which can be changed by other threads to notify that
         /// the current thread should continue regardless of whether there are any tasks
@@ -109,25 +253,37 @@ namespace ChilliSource
         ///
         /// @author Ian Copland
         ///
+        /// @param in_threadIndex - The index of the calling thread, or -1 if the
+        /// calling thread isn't owned by this pool.
         /// @param in_forceContinue - The force continue flag.
         //------------------------------------------------------------------------------
-        void PerformTask(const std::atomic<bool>& in_forceContinue) noexcept;
+        void PerformTask(s32 in_threadIndex, const std::atomic<bool>& in_forceContinue) noexcept;
         //------------------------------------------------------------------------------
         /// Continues to perform tasks until the task pool is deallocated. If there are
         /// no tasks currently available this will sleep until a task is added.
         ///
         /// @author Ian Copland
+        ///
+        /// @param in_threadIndex - The index of the thread within the pool.
         //------------------------------------------------------------------------------
-        void ProcessTasks() noexcept;
+        void ProcessTasks(u32 in_threadIndex) noexcept;
         
         const u32 m_numThreads;
         const TaskContext m_taskContext;
 
         std::vector<std::thread> m_threads;
+        std::vector<std::unique_ptr<Worker>> m_workers;
         
         std::atomic<u32> m_taskCountHeuristic;
-        std::deque<Task> m_taskQueue;
-        std::mutex m_taskQueueMutex;
+        std::vector<TaskNode*> m_sharedTaskStack;
+        std::mutex m_sharedTaskStackMutex;
+        
+        std::vector<std::unique_ptr<TaskNode[]>> m_nodeBlocks;
+        std::vector<TaskNode*> m_sharedFreeNodes;
+        std::mutex m_sharedFreeNodesMutex;
+        
+        std::atomic<u32> m_numSleepingThreads;
+        std::mutex m_sleepMutex;
         std::condition_variable m_emptyWaitCondition;
         
         std::atomic<bool> m_isFinished;
@@ -34,9 +34,15 @@
 #include <ChilliSource/Core/Threading/TaskType.h>
 
 #include <algorithm>
+#include <iterator>
 
 namespace ChilliSource
 {
+    namespace
+    {
+        constexpr u32 k_defaultNumFileLanes = 2;
+    }
+    
     CS_DEFINE_NAMEDTYPE(TaskScheduler);
     //------------------------------------------------------------------------------
     //------------------------------------------------------------------------------
@@ -47,7 +53,7 @@ namespace ChilliSource
     //------------------------------------------------------------------------------
     //------------------------------------------------------------------------------
     TaskScheduler::TaskScheduler() noexcept
-        : m_gameLogicTaskCount(0)
+        : m_gameLogicTaskCounter(m_gameLogicTaskMutex, m_gameLogicTaskCondition), m_numFileLanes(k_defaultNumFileLanes)
     {
     }
     //------------------------------------------------------------------------------
@@ -64,101 +70,282 @@ namespace ChilliSource
     }
     //------------------------------------------------------------------------------
     //------------------------------------------------------------------------------
-    void TaskScheduler::ScheduleTask(TaskType in_taskType, const Task& in_task) noexcept
+    const TaskContext& TaskScheduler::GetGameLogicTaskContext() const noexcept
     {
-        std::vector<Task> tasks = { in_task };
-        ScheduleTasks(in_taskType, tasks);
+        CS_ASSERT(IsMainThread() == true, "The game logic task context can only be used directly from the main thread.");
+        
+        return *m_gameLogicTaskContext;
     }
     //------------------------------------------------------------------------------
     //------------------------------------------------------------------------------
-    void TaskScheduler::ScheduleTasks(TaskType in_taskType, const std::vector<Task>& in_tasks) noexcept
+    void TaskScheduler::ScheduleTask(TaskType in_taskType, Task&& in_task) noexcept
     {
         switch (in_taskType)
         {
             case TaskType::k_small:
             {
-                m_smallTaskPool->AddTasks(in_tasks);
+                m_smallTaskPool->AddTask(std::move(in_task));
                 break;
             }
             case TaskType::k_large:
             {
-                m_largeTaskPool->AddTasks(in_tasks);
+                m_largeTaskPool->AddTask(std::move(in_task));
                 break;
             }
             case TaskType::k_mainThread:
             {
-                m_mainThreadTaskPool->AddTasks(in_tasks);
+                m_mainThreadTaskPool->AddTask(std::move(in_task));
                 break;
             }
             case TaskType::k_system:
             {
-                m_systemThreadTaskPool->AddTasks(in_tasks);
+                m_systemThreadTaskPool->AddTask(std::move(in_task));
                 break;
             }
             case TaskType::k_gameLogic:
+            case TaskType::k_file:
             {
-                std::vector<Task> gameLogicTasks;
-                gameLogicTasks.reserve(in_tasks.size());
-                for (const auto& task : in_tasks)
-                {
-                    gameLogicTasks.push_back([=](const TaskContext&)
-                    {
-                        task(TaskContext(TaskType::k_gameLogic, m_smallTaskPool.get()));
-
-                        if (--m_gameLogicTaskCount == 0)
-                        {
-                            m_gameLogicTaskCondition.notify_all();
-                        }
-                    });
-                }
-
-                m_gameLogicTaskCount += u32(gameLogicTasks.size());
-                m_smallTaskPool->AddTasks(gameLogicTasks);
+                std::vector<Task> tasks;
+                tasks.push_back(std::move(in_task));
+                ScheduleTasks(in_taskType, std::move(tasks));
+                break;
+            }
+        }
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    void TaskScheduler::ScheduleTasks(TaskType in_taskType, std::vector<Task>&& in_tasks) noexcept
+    {
+        switch (in_taskType)
+        {
+            case TaskType::k_small:
+            {
+                m_smallTaskPool->AddTasks(std::move(in_tasks));
+                break;
+            }
+            case TaskType::k_large:
+            {
+                m_largeTaskPool->AddTasks(std::move(in_tasks));
+                break;
+            }
+            case TaskType::k_mainThread:
+            {
+                m_mainThreadTaskPool->AddTasks(std::move(in_tasks));
+                break;
+            }
+            case TaskType::k_system:
+            {
+                m_systemThreadTaskPool->AddTasks(std::move(in_tasks));
+                break;
+            }
+            case TaskType::k_gameLogic:
+            {
+                m_smallTaskPool->AddTasks(std::move(in_tasks), *m_gameLogicTaskContext, m_gameLogicTaskCounter);
                 break;
             }
             case TaskType::k_file:
             {
-                std::unique_lock<std::mutex> lock(m_fileTaskMutex);
-
-                m_fileTaskQueue.insert(m_fileTaskQueue.begin(), in_tasks.begin(), in_tasks.end());
-
-                if (!m_isFileTaskRunning)
-                {
-                    m_isFileTaskRunning = true;
-                    auto task = m_fileTaskQueue.front();
-                    m_fileTaskQueue.pop_front();
-                    lock.unlock();
-
-                    StartNextFileTask(task);
-                }
+                QueueFileTasks(std::move(in_tasks), FileTaskPriority::k_normal);
                 break;
             }
         }
     }
     //------------------------------------------------------------------------------
     //------------------------------------------------------------------------------
-    void TaskScheduler::ScheduleTasks(TaskType in_taskType, const std::vector<Task>& in_tasks, const Task& in_completionTask) noexcept
+    void TaskScheduler::ScheduleTasks(TaskType in_taskType, std::vector<Task>&& in_tasks, Task&& in_completionTask) noexcept
     {
+        struct CompletionState final
+        {
+            std::atomic<u32> m_taskCount;
+            std::vector<Task> m_tasks;
+            Task m_completionTask;
+        };
+        
         //TODO: This should be allocated from a pool to reduce memory fragmentation.
-        auto taskCount = std::make_shared<std::atomic<u32>>(u32(in_tasks.size()));
+        auto state = std::make_shared<CompletionState>();
+        state->m_taskCount = u32(in_tasks.size());
+        state->m_tasks = std::move(in_tasks);
+        state->m_completionTask = std::move(in_completionTask);
         
+        //The tasks are kept in the shared state, so each wrapper only captures an index and is small enough to be
+        //stored inline.
         std::vector<Task> tasksWithCounter;
-        tasksWithCounter.reserve(in_tasks.size());
+        tasksWithCounter.reserve(state->m_tasks.size());
 
-        for (const auto& task : in_tasks)
+        for (std::size_t i = 0; i < state->m_tasks.size(); ++i)
         {
             tasksWithCounter.push_back([=](const TaskContext& in_taskContext)
             {
-                task(in_taskContext);
+                state->m_tasks[i](in_taskContext);
                 
-                if (--(*taskCount) == 0)
+                if (--(state->m_taskCount) == 0)
                 {
-                    ScheduleTask(in_taskType, in_completionTask);
+                    ScheduleTask(in_taskType, std::move(state->m_completionTask));
                 }
             });
         }
 
-        ScheduleTasks(in_taskType, tasksWithCounter);
+        ScheduleTasks(in_taskType, std::move(tasksWithCounter));
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    void TaskScheduler::ScheduleTaskGraph(TaskType in_taskType, TaskGraph&& in_taskGraph, Task&& in_completionTask) noexcept
+    {
+        if (in_taskGraph.GetNumNodes() == 0)
+        {
+            if (in_completionTask)
+            {
+                ScheduleTask(in_taskType, std::move(in_completionTask));
+            }
+            return;
+        }
+        
+        auto graph = std::make_shared<TaskGraph>(std::move(in_taskGraph));
+        graph->Prepare(std::move(in_completionTask));
+        
+        std::vector<TaskGraph::NodeId> rootNodes;
+        for (TaskGraph::NodeId nodeId = 0; nodeId < graph->GetNumNodes(); ++nodeId)
+        {
+            if (graph->m_nodes[nodeId].m_numPredecessors == 0)
+            {
+                rootNodes.push_back(nodeId);
+            }
+        }
+        
+        CS_ASSERT(!rootNodes.empty(), "A task graph must contain at least one node without predecessors.");
+        ScheduleTaskGraphNodes(in_taskType, graph, rootNodes);
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    TaskScheduler::FileTaskId TaskScheduler::ScheduleFileTask(Task&& in_task, FileTaskPriority in_priority) noexcept
+    {
+        std::vector<Task> tasks;
+        tasks.push_back(std::move(in_task));
+        
+        std::vector<FileTaskId> ids;
+        QueueFileTasks(std::move(tasks), in_priority, &ids);
+        
+        return ids.front();
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    bool TaskScheduler::CancelFileTask(FileTaskId in_fileTaskId) noexcept
+    {
+        std::unique_lock<std::mutex> lock(m_fileTaskMutex);
+        
+        for (auto& queue : m_fileTaskQueues)
+        {
+            auto it = std::find_if(queue.begin(), queue.end(), [=](const QueuedFileTask& in_queuedTask) { return in_queuedTask.m_id == in_fileTaskId; });
+            if (it != queue.end())
+            {
+                queue.erase(it);
+                
+                m_fileTaskMetrics.m_queueDepth--;
+                m_fileTaskMetrics.m_numCancelled++;
+                return true;
+            }
+        }
+        
+        for (auto& lane : m_fileLanes)
+        {
+            if (lane->m_isRunning && lane->m_currentTaskId == in_fileTaskId)
+            {
+                lane->m_isCancelled = true;
+                return true;
+            }
+        }
+        
+        return false;
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    bool TaskScheduler::SetFileTaskPriority(FileTaskId in_fileTaskId, FileTaskPriority in_priority) noexcept
+    {
+        std::unique_lock<std::mutex> lock(m_fileTaskMutex);
+        
+        for (auto& queue : m_fileTaskQueues)
+        {
+            auto it = std::find_if(queue.begin(), queue.end(), [=](const QueuedFileTask& in_queuedTask) { return in_queuedTask.m_id == in_fileTaskId; });
+            if (it != queue.end())
+            {
+                auto queuedTask = std::move(*it);
+                queue.erase(it);
+                
+                m_fileTaskQueues[u32(in_priority)].push_back(std::move(queuedTask));
+                return true;
+            }
+        }
+        
+        return false;
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    void TaskScheduler::SetNumFileLanes(u32 in_numFileLanes) noexcept
+    {
+        CS_ASSERT(in_numFileLanes > 0, "There must be at least one file lane.");
+        
+        std::unique_lock<std::mutex> lock(m_fileTaskMutex);
+        m_numFileLanes = in_numFileLanes;
+        StartIdleFileLanes(lock);
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    u32 TaskScheduler::GetNumFileLanes() const noexcept
+    {
+        std::unique_lock<std::mutex> lock(m_fileTaskMutex);
+        return CalcNumActiveFileLanes();
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    TaskScheduler::FileTaskMetrics TaskScheduler::GetFileTaskMetrics() const noexcept
+    {
+        std::unique_lock<std::mutex> lock(m_fileTaskMutex);
+        return m_fileTaskMetrics;
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    void TaskScheduler::ResetFileTaskMetrics() noexcept
+    {
+        std::unique_lock<std::mutex> lock(m_fileTaskMutex);
+        
+        m_fileTaskMetrics.m_peakQueueDepth = m_fileTaskMetrics.m_queueDepth;
+        m_fileTaskMetrics.m_numCompleted = 0;
+        m_fileTaskMetrics.m_numCancelled = 0;
+        m_fileTaskMetrics.m_averageWaitTime = 0.0;
+        m_fileTaskMetrics.m_maxWaitTime = 0.0;
+        m_totalFileTaskWaitTime = 0.0;
+        m_numStartedFileTasks = 0;
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    void TaskScheduler::ScheduleTaskGraphNodes(TaskType in_taskType, const std::shared_ptr<TaskGraph>& in_taskGraph, const std::vector<u32>& in_nodeIds) noexcept
+    {
+        std::vector<Task> tasks;
+        tasks.reserve(in_nodeIds.size());
+        
+        for (auto nodeId : in_nodeIds)
+        {
+            auto taskGraph = in_taskGraph;
+            tasks.push_back([=](const TaskContext& in_taskContext)
+            {
+                taskGraph->m_nodes[nodeId].m_task(in_taskContext);
+                
+                std::vector<TaskGraph::NodeId> readyNodes;
+                if (taskGraph->CompleteNode(nodeId, readyNodes))
+                {
+                    if (taskGraph->m_completionTask)
+                    {
+                        ScheduleTask(in_taskType, std::move(taskGraph->m_completionTask));
+                    }
+                }
+                else if (!readyNodes.empty())
+                {
+                    ScheduleTaskGraphNodes(in_taskType, taskGraph, readyNodes);
+                }
+            });
+        }
+        
+        ScheduleTasks(in_taskType, std::move(tasks));
     }
     //------------------------------------------------------------------------------
     //------------------------------------------------------------------------------
@@ -167,7 +354,7 @@ namespace ChilliSource
         //wait on all game logic tasks completing.
         std::unique_lock<std::mutex> lock(m_gameLogicTaskMutex);
         
-        while (m_gameLogicTaskCount != 0)
+        while (m_gameLogicTaskCounter.m_count != 0)
         {
             m_gameLogicTaskCondition.wait(lock);
         }
@@ -184,32 +371,117 @@ namespace ChilliSource
     }
     //------------------------------------------------------------------------------
     //------------------------------------------------------------------------------
-    void TaskScheduler::StartNextFileTask(const Task& in_task) noexcept
+    void TaskScheduler::QueueFileTasks(std::vector<Task>&& in_tasks, FileTaskPriority in_priority, std::vector<FileTaskId>* out_ids) noexcept
     {
-        std::vector<Task> tasks;
-        tasks.reserve(1);
-
-        tasks.push_back([=](const TaskContext& in_taskContext)
+        auto queuedTime = std::chrono::steady_clock::now();
+        
+        std::unique_lock<std::mutex> lock(m_fileTaskMutex);
+        
+        auto& queue = m_fileTaskQueues[u32(in_priority)];
+        for (auto& task : in_tasks)
+        {
+            FileTaskId id = m_nextFileTaskId++;
+            if (out_ids)
+            {
+                out_ids->push_back(id);
+            }
+            
+            QueuedFileTask queuedTask;
+            queuedTask.m_id = id;
+            queuedTask.m_queuedTime = queuedTime;
+            queuedTask.m_task = std::move(task);
+            queue.push_back(std::move(queuedTask));
+        }
+        
+        m_fileTaskMetrics.m_queueDepth += u32(in_tasks.size());
+        m_fileTaskMetrics.m_peakQueueDepth = std::max(m_fileTaskMetrics.m_peakQueueDepth, m_fileTaskMetrics.m_queueDepth);
+        
+        in_tasks.clear();
+        
+        StartIdleFileLanes(lock);
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    u32 TaskScheduler::CalcNumActiveFileLanes() const noexcept
+    {
+        return std::min(m_numFileLanes, m_maxNumFileLanes);
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    void TaskScheduler::StartIdleFileLanes(std::unique_lock<std::mutex>& in_lock) noexcept
+    {
+        std::vector<u32> lanesToStart;
+        
+        u32 numActiveLanes = CalcNumActiveFileLanes();
+        u32 numIdleLanesNeeded = std::min(m_fileTaskMetrics.m_queueDepth, numActiveLanes - std::min(numActiveLanes, m_fileTaskMetrics.m_numRunning));
+        for (u32 laneIndex = 0; laneIndex < numActiveLanes && lanesToStart.size() < numIdleLanesNeeded; ++laneIndex)
         {
-            in_task(TaskContext(TaskType::k_file));
+            if (laneIndex >= m_fileLanes.size())
+            {
+                std::unique_ptr<FileLane> lane(new FileLane());
+                lane->m_isCancelled = false;
+                m_fileLanes.push_back(std::move(lane));
+            }
             
+            if (!m_fileLanes[laneIndex]->m_isRunning)
+            {
+                m_fileLanes[laneIndex]->m_isRunning = true;
+                m_fileTaskMetrics.m_numRunning++;
+                lanesToStart.push_back(laneIndex);
+            }
+        }
+        
+        in_lock.unlock();
+        
+        for (auto laneIndex : lanesToStart)
+        {
+            StartNextFileTask(laneIndex);
+        }
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    void TaskScheduler::StartNextFileTask(u32 in_laneIndex) noexcept
+    {
+        m_largeTaskPool->AddTask([=](const TaskContext& in_taskContext)
+        {
             std::unique_lock<std::mutex> lock(m_fileTaskMutex);
             
-            if (m_fileTaskQueue.empty())
+            FileLane& lane = *m_fileLanes[in_laneIndex];
+            
+            auto queueIt = std::find_if(m_fileTaskQueues.rbegin(), m_fileTaskQueues.rend(), [](const std::deque<QueuedFileTask>& in_queue) { return !in_queue.empty(); });
+            if (queueIt == m_fileTaskQueues.rend() || in_laneIndex >= CalcNumActiveFileLanes())
             {
-                m_isFileTaskRunning = false;
+                lane.m_isRunning = false;
+                m_fileTaskMetrics.m_numRunning--;
                 return;
             }
             
-            auto task = m_fileTaskQueue.front();
-            m_fileTaskQueue.pop_front();
+            auto queuedTask = std::move(queueIt->front());
+            queueIt->pop_front();
+            
+            f64 waitTime = std::chrono::duration<f64>(std::chrono::steady_clock::now() - queuedTask.m_queuedTime).count();
+            m_totalFileTaskWaitTime += waitTime;
+            m_numStartedFileTasks++;
+            m_fileTaskMetrics.m_averageWaitTime = m_totalFileTaskWaitTime / f64(m_numStartedFileTasks);
+            m_fileTaskMetrics.m_maxWaitTime = std::max(m_fileTaskMetrics.m_maxWaitTime, waitTime);
+            m_fileTaskMetrics.m_queueDepth--;
+            
+            lane.m_currentTaskId = queuedTask.m_id;
+            lane.m_isCancelled = false;
+            
+            lock.unlock();
+            
+            queuedTask.m_task(TaskContext(TaskType::k_file, nullptr, &lane.m_isCancelled));
+            
+            lock.lock();
+            
+            lane.m_currentTaskId = 0;
+            m_fileTaskMetrics.m_numCompleted++;
             
             lock.unlock();
             
-            StartNextFileTask(task);
+            StartNextFileTask(in_laneIndex);
         });
-
-        m_largeTaskPool->AddTasks(tasks);
     }
     //------------------------------------------------------------------------------
     //------------------------------------------------------------------------------
@@ -225,6 +497,14 @@ namespace ChilliSource
         
         m_smallTaskPool = TaskPoolUPtr(new TaskPool(TaskType::k_small, threadsPerPool));
         m_largeTaskPool = TaskPoolUPtr(new TaskPool(TaskType::k_large, threadsPerPool));
+        
+        //File lanes block on I/O while occupying a large task thread, so at least one large task thread is always
+        //left free for other large tasks.
+        std::unique_lock<std::mutex> fileTaskLock(m_fileTaskMutex);
+        m_maxNumFileLanes = u32(std::max(1, threadsPerPool - 1));
+        fileTaskLock.unlock();
+        
+        m_gameLogicTaskContext = std::unique_ptr<TaskContext>(new TaskContext(TaskType::k_gameLogic, m_smallTaskPool.get()));
         m_mainThreadTaskPool = SingleThreadTaskPoolUPtr(new SingleThreadTaskPool(TaskType::k_mainThread));
         m_systemThreadTaskPool = SingleThreadTaskPoolUPtr(new SingleThreadTaskPool(TaskType::k_system));
 
@@ -31,11 +31,18 @@
 
 #include <ChilliSource/ChilliSource.h>
 #include <ChilliSource/Core/System/AppSystem.h>
+#include <ChilliSource/Core/Threading/FileTaskPriority.h>
 #include <ChilliSource/Core/Threading/SingleThreadTaskPool.h>
 #include <ChilliSource/Core/Threading/Task.h>
+#include <ChilliSource/Core/Threading/TaskGraph.h>
 #include <ChilliSource/Core/Threading/TaskPool.h>
 #include <ChilliSource/Core/Threading/TaskType.h>
 
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <deque>
+
 namespace ChilliSource
 {
     //------------------------------------------------------------------------------
@@ -54,6 +61,24 @@ namespace ChilliSource
     {
     public:
         CS_DECLARE_NAMEDTYPE(TaskScheduler);
+        
+        using FileTaskId = u64;
+        //------------------------------------------------------------------------------
+        /// Counters describing the state of the file task queue. These can be used to
+        /// tune the number of file lanes for a given device. Only tasks which were
+        /// removed from the queue before starting are counted as cancelled; a running
+        /// task which is asked to cancel is counted as completed once it returns.
+        //------------------------------------------------------------------------------
+        struct FileTaskMetrics final
+        {
+            u32 m_queueDepth = 0;
+            u32 m_peakQueueDepth = 0;
+            u32 m_numRunning = 0;
+            u64 m_numCompleted = 0;
+            u64 m_numCancelled = 0;
+            f64 m_averageWaitTime = 0.0;
+            f64 m_maxWaitTime = 0.0;
+        };
         //------------------------------------------------------------------------------
         /// Allows querying of whether or not this system implements the interface
         /// described by the given interface Id. Typically this is not called directly
@@ -73,6 +98,15 @@ namespace ChilliSource
         //------------------------------------------------------------------------------
         bool IsMainThread() const noexcept;
         //------------------------------------------------------------------------------
+        /// Provides the task context used by game logic tasks. This can be used on the
+        /// main thread to split per-frame work into game logic tasks and block until
+        /// they complete, for example using TaskContext::ParallelFor(). The main thread
+        /// will help process the tasks while it waits.
+        ///
+        /// @return The game logic task context.
+        //------------------------------------------------------------------------------
+        const TaskContext& GetGameLogicTaskContext() const noexcept;
+        //------------------------------------------------------------------------------
         /// Schedules a single task which will be executed in a manner dependant on the
         /// task type.
         ///
@@ -83,7 +117,7 @@ namespace ChilliSource
         /// @param in_taskType - The type of task.
         /// @param in_task - The task to be scheduled.
         //------------------------------------------------------------------------------
-        void ScheduleTask(TaskType in_taskType, const Task& in_task) noexcept;
+        void ScheduleTask(TaskType in_taskType, Task&& in_task) noexcept;
         //------------------------------------------------------------------------------
         /// Schedules a batch of tasks which will be executed in a manner dependant on
         /// the task type.
@@ -95,7 +129,7 @@ namespace ChilliSource
         /// @param in_taskType - The type of task.
         /// @param in_tasks - The tasks to be scheduled.
         //------------------------------------------------------------------------------
-        void ScheduleTasks(TaskType in_taskType, const std::vector<Task>& in_tasks) noexcept;
+        void ScheduleTasks(TaskType in_taskType, std::vector<Task>&& in_tasks) noexcept;
         //------------------------------------------------------------------------------
         /// Schedules a batch of tasks which will be executed in a manner dependant on
         /// the task type. Once all tasks have finished executing a completion task will
@@ -112,7 +146,81 @@ namespace ChilliSource
         /// @param in_completionTask - A task which is scheduled when the other tasks 
         /// have all completed.
         //------------------------------------------------------------------------------
-        void ScheduleTasks(TaskType in_taskType, const std::vector<Task>& in_tasks, const Task& in_completionTask) noexcept;
+        void ScheduleTasks(TaskType in_taskType, std::vector<Task>&& in_tasks, Task&& in_completionTask) noexcept;
+        //------------------------------------------------------------------------------
+        /// Schedules a graph of tasks. Each node in the graph is scheduled as soon as
+        /// all of its predecessors have finished, so independent chains of work can
+        /// overlap. This does not block. Once all nodes have finished executing the
+        /// completion task will be scheduled.
+        ///
+        /// All tasks, including the completion task, will be of the same type.
+        ///
+        /// @param in_taskType - The type of task.
+        /// @param in_taskGraph - The graph to be scheduled.
+        /// @param in_completionTask - (Optional) A task which is scheduled when all
+        /// nodes in the graph have completed.
+        //------------------------------------------------------------------------------
+        void ScheduleTaskGraph(TaskType in_taskType, TaskGraph&& in_taskGraph, Task&& in_completionTask = nullptr) noexcept;
+        //------------------------------------------------------------------------------
+        /// Schedules a file task with the given priority. Queued file tasks with a
+        /// higher priority are always started first. This is equivelent to scheduling
+        /// a task with the k_file task type, but allows the task to later be cancelled
+        /// or have its priority changed.
+        ///
+        /// @param in_task - The task to be scheduled.
+        /// @param in_priority - (Optional) The priority of the task. Defaults to normal.
+        ///
+        /// @return The id of the scheduled file task.
+        //------------------------------------------------------------------------------
+        FileTaskId ScheduleFileTask(Task&& in_task, FileTaskPriority in_priority = FileTaskPriority::k_normal) noexcept;
+        //------------------------------------------------------------------------------
+        /// Cancels the given file task. If the task hasn't yet started it is removed
+        /// from the queue and will never be run. If it is currently running then its
+        /// task context will report that it has been cancelled, allowing it to exit
+        /// early. If the task has already finished this does nothing.
+        ///
+        /// @param in_fileTaskId - The id of the file task.
+        ///
+        /// @return Whether or not the task was queued or running.
+        //------------------------------------------------------------------------------
+        bool CancelFileTask(FileTaskId in_fileTaskId) noexcept;
+        //------------------------------------------------------------------------------
+        /// Changes the priority of a queued file task. This has no effect on tasks
+        /// which have already started. The task is placed at the back of the queue for
+        /// its new priority.
+        ///
+        /// @param in_fileTaskId - The id of the file task.
+        /// @param in_priority - The new priority.
+        ///
+        /// @return Whether or not the task was still queued.
+        //------------------------------------------------------------------------------
+        bool SetFileTaskPriority(FileTaskId in_fileTaskId, FileTaskPriority in_priority) noexcept;
+        //------------------------------------------------------------------------------
+        /// Sets the number of file tasks which can be run concurrently. If this is
+        /// reduced, any lanes over the new limit will finish their current task before
+        /// stopping. Must be at least one.
+        ///
+        /// File tasks run on the large task pool, so the number of lanes is capped below
+        /// the number of large task threads. This ensures file I/O can never occupy every
+        /// large task thread.
+        ///
+        /// @param in_numFileLanes - The number of file lanes.
+        //------------------------------------------------------------------------------
+        void SetNumFileLanes(u32 in_numFileLanes) noexcept;
+        //------------------------------------------------------------------------------
+        /// @return The number of file tasks which can be run concurrently. This may be
+        /// less than the number requested if it exceeds the cap.
+        //------------------------------------------------------------------------------
+        u32 GetNumFileLanes() const noexcept;
+        //------------------------------------------------------------------------------
+        /// @return A snapshot of the current file task queue counters.
+        //------------------------------------------------------------------------------
+        FileTaskMetrics GetFileTaskMetrics() const noexcept;
+        //------------------------------------------------------------------------------
+        /// Resets the cumulative file task counters, i.e the peak queue depth, the
+        /// completed and cancelled counts and the wait times.
+        //------------------------------------------------------------------------------
+        void ResetFileTaskMetrics() noexcept;
         
     private:
         friend class Application;
@@ -151,14 +259,67 @@ namespace ChilliSource
         void ExecuteSystemThreadTasks() noexcept;
     private:
         //------------------------------------------------------------------------------
-        /// Adds the given task to the large task pool. Once the task is complete then
-        /// this is called again for the next task in the file queue. If the file queue
-        /// is empty then flag indication whether or not file tasks are running is set
-        /// to false.
+        /// A file task which is waiting in the queue.
+        //------------------------------------------------------------------------------
+        struct QueuedFileTask final
+        {
+            FileTaskId m_id;
+            std::chrono::steady_clock::time_point m_queuedTime;
+            Task m_task;
+        };
+        //------------------------------------------------------------------------------
+        /// The state of a single file lane. Lanes are never destroyed once created,
+        /// so that the cancellation flag remains valid while a task is running.
+        //------------------------------------------------------------------------------
+        struct FileLane final
+        {
+            bool m_isRunning = false;
+            FileTaskId m_currentTaskId = 0;
+            std::atomic<bool> m_isCancelled;
+        };
+        //------------------------------------------------------------------------------
+        /// Adds file tasks to the queue for the given priority, and starts any idle
+        /// file lanes.
         ///
-        /// @author Ian Copland
+        /// @param in_tasks - The tasks to be queued.
+        /// @param in_priority - The priority of the tasks.
+        /// @param out_ids - (Optional) [Out] The ids of the queued tasks.
+        //------------------------------------------------------------------------------
+        void QueueFileTasks(std::vector<Task>&& in_tasks, FileTaskPriority in_priority, std::vector<FileTaskId>* out_ids = nullptr) noexcept;
+        //------------------------------------------------------------------------------
+        /// The file task mutex must be locked prior to calling this.
+        ///
+        /// @return The number of file lanes which can currently run: the requested
+        /// number of lanes, capped below the number of large task threads.
+        //------------------------------------------------------------------------------
+        u32 CalcNumActiveFileLanes() const noexcept;
+        //------------------------------------------------------------------------------
+        /// Starts idle file lanes, up to the lane limit, while there are queued file
+        /// tasks. The file task mutex must be locked prior to calling this, and will
+        /// be unlocked when it returns.
+        ///
+        /// @param in_lock - The lock on the file task mutex.
+        //------------------------------------------------------------------------------
+        void StartIdleFileLanes(std::unique_lock<std::mutex>& in_lock) noexcept;
+        //------------------------------------------------------------------------------
+        /// Adds a task to the large task pool which will pop and perform the highest
+        /// priority task in the file queue on the given lane. Once the file task is
+        /// complete then this is called again if the file queue is not empty. If the
+        /// file queue is empty, or the lane is over the lane limit, then the lane is
+        /// marked as idle.
+        ///
+        /// @param in_laneIndex - The index of the lane.
+        //------------------------------------------------------------------------------
+        void StartNextFileTask(u32 in_laneIndex) noexcept;
+        //------------------------------------------------------------------------------
+        /// Schedules the given nodes from a task graph. When each node completes any
+        /// successors which are now ready are scheduled in turn.
+        ///
+        /// @param in_taskType - The type of task.
+        /// @param in_taskGraph - The graph the nodes belong to.
+        /// @param in_nodeIds - The nodes which are ready to be scheduled.
         //------------------------------------------------------------------------------
-        void StartNextFileTask(const Task& in_task) noexcept;
+        void ScheduleTaskGraphNodes(TaskType in_taskType, const std::shared_ptr<TaskGraph>& in_taskGraph, const std::vector<u32>& in_nodeIds) noexcept;
         //------------------------------------------------------------------------------
         /// Cleans up the Task Scheduler, joining on all existing threads and then
         /// destroying them.
@@ -181,13 +342,20 @@ namespace ChilliSource
         SingleThreadTaskPoolUPtr m_mainThreadTaskPool;
         SingleThreadTaskPoolUPtr m_systemThreadTaskPool;
         
-        std::atomic<u32> m_gameLogicTaskCount;
         std::condition_variable m_gameLogicTaskCondition;
         std::mutex m_gameLogicTaskMutex;
+        TaskPool::CompletionCounter m_gameLogicTaskCounter;
+        std::unique_ptr<TaskContext> m_gameLogicTaskContext;
         
-        std::mutex m_fileTaskMutex;
-        bool m_isFileTaskRunning = false;
-        std::deque<Task> m_fileTaskQueue;
+        mutable std::mutex m_fileTaskMutex;
+        std::array<std::deque<QueuedFileTask>, 3> m_fileTaskQueues;
+        std::vector<std::unique_ptr<FileLane>> m_fileLanes;
+        u32 m_numFileLanes;
+        u32 m_maxNumFileLanes = 1;
+        FileTaskId m_nextFileTaskId = 1;
+        FileTaskMetrics m_fileTaskMetrics;
+        f64 m_totalFileTaskWaitTime = 0.0;
+        u64 m_numStartedFileTasks = 0;
 
         std::thread::id m_mainThreadId;
     };
@@ -58,7 +58,8 @@ namespace ChilliSource
     ///
     /// File Task: A large task specifically for processing file input or output.
     /// All background processing of files should use this rather than standard
-    /// large tasks.
+    /// large tasks. A limited number of file tasks are run concurrently, and
+    /// TaskScheduler::ScheduleFileTask() can be used to provide a priority.
     ///
     /// @author Ian Copland
     //------------------------------------------------------------------------------
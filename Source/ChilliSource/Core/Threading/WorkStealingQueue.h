@@ -0,0 +1,262 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2016 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#ifndef _CHILLISOURCE_CORE_THREADING_WORKSTEALINGQUEUE_H_
+#define _CHILLISOURCE_CORE_THREADING_WORKSTEALINGQUEUE_H_
+
+#include <ChilliSource/ChilliSource.h>
+
+#include <atomic>
+#include <vector>
+
+namespace ChilliSource
+{
+    //------------------------------------------------------------------------------
+    /// A lock-free, dynamically growing work stealing deque, based on the deque
+    /// described by Chase and Lev, using the C11 memory orderings described by Le
+    /// et al in "Correct and Efficient Work-Stealing for Weak Memory Models".
+    ///
+    /// The owning thread pushes and pops from the bottom of the deque, while any
+    /// other thread may steal from the top. Only the owning thread may call Push()
+    /// and Pop(); Steal() can be called from any thread.
+    ///
+    /// Elements are copied in and out of the deque with relaxed atomics, so TType
+    /// should be a small trivially copyable type, typically a pointer.
+    ///
+    /// When the deque grows, the previous buffer is retained until the deque is
+    /// destroyed as concurrent stealers may still be reading from it.
+    //------------------------------------------------------------------------------
+    template <typename TType> class WorkStealingQueue final
+    {
+    public:
+        CS_DECLARE_NOCOPY(WorkStealingQueue);
+        //------------------------------------------------------------------------------
+        /// Constructs a new, empty deque with the given initial capacity.
+        ///
+        /// @param in_initialCapacity - The initial capacity. Must be a power of two.
+        //------------------------------------------------------------------------------
+        WorkStealingQueue(u32 in_initialCapacity = 256) noexcept;
+        //------------------------------------------------------------------------------
+        /// This is only a heuristic as the size may be changed by other threads at any
+        /// time.
+        ///
+        /// @return Whether or not the deque is currently empty.
+        //------------------------------------------------------------------------------
+        bool IsEmpty() const noexcept;
+        //------------------------------------------------------------------------------
+        /// Pushes the given value onto the bottom of the deque, growing the deque if
+        /// required. This must only be called from the owning thread.
+        ///
+        /// @param in_value - The value to push.
+        //------------------------------------------------------------------------------
+        void Push(TType in_value) noexcept;
+        //------------------------------------------------------------------------------
+        /// Pops a value from the bottom of the deque. This must only be called from the
+        /// owning thread.
+        ///
+        /// @param out_value - [Out] The popped value. This is only set if a value was
+        /// successfully popped.
+        ///
+        /// @return Whether or not a value was popped.
+        //------------------------------------------------------------------------------
+        bool Pop(TType& out_value) noexcept;
+        //------------------------------------------------------------------------------
+        /// Attempts to steal a value from the top of the deque. This can be called from
+        /// any thread. This can fail if another thread steals or pops the same value
+        /// concurrently, in which case false is returned even though the deque may not
+        /// be empty.
+        ///
+        /// @param out_value - [Out] The stolen value. This is only set if a value was
+        /// successfully stolen.
+        ///
+        /// @return Whether or not a value was stolen.
+        //------------------------------------------------------------------------------
+        bool Steal(TType& out_value) noexcept;
+        //------------------------------------------------------------------------------
+        /// Destructor.
+        //------------------------------------------------------------------------------
+        ~WorkStealingQueue() noexcept;
+        
+    private:
+        //------------------------------------------------------------------------------
+        /// A circular buffer of atomic elements, indexed by a monotonically increasing
+        /// index.
+        //------------------------------------------------------------------------------
+        struct Buffer final
+        {
+            Buffer(s64 in_capacity) noexcept
+                : m_capacity(in_capacity), m_mask(in_capacity - 1), m_elements(new std::atomic<TType>[in_capacity])
+            {
+            }
+            
+            TType Get(s64 in_index) const noexcept
+            {
+                return m_elements[in_index & m_mask].load(std::memory_order_relaxed);
+            }
+            
+            void Put(s64 in_index, TType in_value) noexcept
+            {
+                m_elements[in_index & m_mask].store(in_value, std::memory_order_relaxed);
+            }
+            
+            const s64 m_capacity;
+            const s64 m_mask;
+            std::unique_ptr<std::atomic<TType>[]> m_elements;
+        };
+        //------------------------------------------------------------------------------
+        /// Creates a new buffer of twice the size, copies the live range into it and
+        /// retires the old buffer.
+        ///
+        /// @param in_buffer - The current buffer.
+        /// @param in_top - The current top index.
+        /// @param in_bottom - The current bottom index.
+        ///
+        /// @return The new buffer.
+        //------------------------------------------------------------------------------
+        Buffer* Grow(Buffer* in_buffer, s64 in_top, s64 in_bottom) noexcept;
+        
+        std::atomic<s64> m_top;
+        std::atomic<s64> m_bottom;
+        std::atomic<Buffer*> m_buffer;
+        std::vector<std::unique_ptr<Buffer>> m_buffers;
+    };
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    template <typename TType> WorkStealingQueue<TType>::WorkStealingQueue(u32 in_initialCapacity) noexcept
+        : m_top(0), m_bottom(0)
+    {
+        CS_ASSERT(in_initialCapacity > 0 && (in_initialCapacity & (in_initialCapacity - 1)) == 0, "Initial capacity must be a power of two.");
+        
+        m_buffers.push_back(std::unique_ptr<Buffer>(new Buffer(s64(in_initialCapacity))));
+        m_buffer.store(m_buffers.back().get(), std::memory_order_relaxed);
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    template <typename TType> bool WorkStealingQueue<TType>::IsEmpty() const noexcept
+    {
+        s64 bottom = m_bottom.load(std::memory_order_relaxed);
+        s64 top = m_top.load(std::memory_order_relaxed);
+        return bottom <= top;
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    template <typename TType> void WorkStealingQueue<TType>::Push(TType in_value) noexcept
+    {
+        s64 bottom = m_bottom.load(std::memory_order_relaxed);
+        s64 top = m_top.load(std::memory_order_acquire);
+        Buffer* buffer = m_buffer.load(std::memory_order_relaxed);
+        
+        if (bottom - top > buffer->m_capacity - 1)
+        {
+            buffer = Grow(buffer, top, bottom);
+        }
+        
+        buffer->Put(bottom, in_value);
+        std::atomic_thread_fence(std::memory_order_release);
+        m_bottom.store(bottom + 1, std::memory_order_relaxed);
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    template <typename TType> bool WorkStealingQueue<TType>::Pop(TType& out_value) noexcept
+    {
+        s64 bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+        Buffer* buffer = m_buffer.load(std::memory_order_relaxed);
+        m_bottom.store(bottom, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        s64 top = m_top.load(std::memory_order_relaxed);
+        
+        if (top > bottom)
+        {
+            m_bottom.store(bottom + 1, std::memory_order_relaxed);
+            return false;
+        }
+        
+        bool success = true;
+        TType value = buffer->Get(bottom);
+        
+        if (top == bottom)
+        {
+            //this is the last element so we need to race any stealers for it.
+            success = m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+            m_bottom.store(bottom + 1, std::memory_order_relaxed);
+        }
+        
+        if (success)
+        {
+            out_value = value;
+        }
+        
+        return success;
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    template <typename TType> bool WorkStealingQueue<TType>::Steal(TType& out_value) noexcept
+    {
+        s64 top = m_top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        s64 bottom = m_bottom.load(std::memory_order_acquire);
+        
+        if (top >= bottom)
+        {
+            return false;
+        }
+        
+        //Consume ordering would be sufficient here, but it is treated as acquire by all current compilers.
+        Buffer* buffer = m_buffer.load(std::memory_order_acquire);
+        TType value = buffer->Get(top);
+        
+        if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+        {
+            return false;
+        }
+        
+        out_value = value;
+        return true;
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    template <typename TType> typename WorkStealingQueue<TType>::Buffer* WorkStealingQueue<TType>::Grow(Buffer* in_buffer, s64 in_top, s64 in_bottom) noexcept
+    {
+        std::unique_ptr<Buffer> newBuffer(new Buffer(in_buffer->m_capacity * 2));
+        for (s64 i = in_top; i < in_bottom; ++i)
+        {
+            newBuffer->Put(i, in_buffer->Get(i));
+        }
+        
+        Buffer* output = newBuffer.get();
+        m_buffers.push_back(std::move(newBuffer));
+        m_buffer.store(output, std::memory_order_release);
+        
+        return output;
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    template <typename TType> WorkStealingQueue<TType>::~WorkStealingQueue() noexcept
+    {
+        CS_ASSERT(IsEmpty(), "Work stealing queue destroyed while it still contains values.");
+    }
+}
+
+#endif
@@ -28,7 +28,29 @@
 
 #include <ChilliSource/Core/Volume/VolumeComponent.h>
 
+#include <ChilliSource/Core/Entity/Entity.h>
+#include <ChilliSource/Core/Scene/Scene.h>
+
 namespace ChilliSource
 {
     CS_DEFINE_NAMEDTYPE(VolumeComponent);
+    
+    //----------------------------------------------------
+    //----------------------------------------------------
+    void VolumeComponent::InvalidateVolume()
+    {
+        if(m_volumeScene != nullptr)
+        {
+            m_volumeScene->InvalidateVolume(this);
+        }
+    }
+    //----------------------------------------------------
+    //----------------------------------------------------
+    void VolumeComponent::ResolveTransformChanges()
+    {
+        if(GetEntity() != nullptr)
+        {
+            GetEntity()->GetTransform().ResolveChanges();
+        }
+    }
 }
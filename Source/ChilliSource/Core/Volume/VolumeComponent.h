@@ -31,6 +31,7 @@
 
 #include <ChilliSource/ChilliSource.h>
 #include <ChilliSource/Core/Entity/Component.h>
+#include <ChilliSource/Core/Math/Geometry/AABBTree.h>
 #include <ChilliSource/Core/Math/Geometry/Shapes.h>
 
 namespace ChilliSource
@@ -83,6 +84,36 @@ namespace ChilliSource
         virtual bool IsVisible() const = 0;
 
         f32 mfQueryIntersectionValue;
+        
+    protected:
+        //----------------------------------------------------
+        /// Invalidate Volume
+        ///
+        /// Notifies the scene that the bounds of the volume
+        /// have changed, so that its entry in the scene's
+        /// spatial index is updated prior to the next query.
+        /// Sub-classes should call this whenever the value
+        /// returned from GetAABB() may have changed.
+        //----------------------------------------------------
+        void InvalidateVolume();
+        //----------------------------------------------------
+        /// Resolve Transform Changes
+        ///
+        /// Transform changed events for entities in a scene
+        /// are deferred until the scene's transforms are
+        /// resolved. Sub-classes which cache their bounds
+        /// from these events should call this before reading
+        /// the cached bounds.
+        //----------------------------------------------------
+        void ResolveTransformChanges();
+        
+    private:
+        friend class Scene;
+        
+        Scene* m_volumeScene = nullptr;
+        u32 m_volumeProxyId = AABBTree::k_nullProxy;
+        u32 m_volumeInViewStamp = 0;
+        bool m_isVolumeDirty = false;
     };
 }
 
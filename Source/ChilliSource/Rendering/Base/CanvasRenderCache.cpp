@@ -0,0 +1,175 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2016 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#include <ChilliSource/Rendering/Base/CanvasRenderCache.h>
+
+#include <ChilliSource/Core/Base/Colour.h>
+#include <ChilliSource/Core/Base/ColourUtils.h>
+#include <ChilliSource/Core/Math/Matrix4.h>
+#include <ChilliSource/Rendering/Texture/UVs.h>
+
+#include <limits>
+
+namespace ChilliSource
+{
+    namespace
+    {
+        constexpr u32 k_verticesPerSprite = 4;
+        constexpr u32 k_indicesPerSprite = 6;
+        constexpr u32 k_maxVerticesPerBatch = 65536;
+        
+        const u16 k_spriteIndices[k_indicesPerSprite] { 0, 1, 2, 1, 3, 2 };
+    }
+    
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    void CanvasRenderCache::AddSprite(const Matrix4& in_worldMatrix, const Vector3& in_localPosition, const Vector2& in_localSize, const UVs& in_uvs, const Colour& in_colour,
+                                      AlignmentAnchor in_alignmentAnchor, const TextureCSPtr& in_texture)
+    {
+        AddSprite(in_worldMatrix, in_localPosition, in_localSize, in_uvs, ColourUtils::ColourToByteColour(in_colour), in_alignmentAnchor, in_texture);
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    void CanvasRenderCache::AddSprite(const Matrix4& in_worldMatrix, const Vector3& in_localPosition, const Vector2& in_localSize, const UVs& in_uvs, const ByteColour& in_colour,
+                                      AlignmentAnchor in_alignmentAnchor, const TextureCSPtr& in_texture)
+    {
+        auto& batch = GetBatchForAppend(in_texture, k_verticesPerSprite);
+        
+        //build the local corners in the same way as the sprite mesh builder, then transform them into screen space.
+        Vector2 halfSize = 0.5f * in_localSize;
+        Vector2 anchor = GetAnchorPoint(in_alignmentAnchor, halfSize);
+        Vector4 centre = Vector4(in_localPosition, 1.0f) + Vector4(-anchor.x, -anchor.y, 0.0f, 0.0f);
+        
+        Vertex vertices[k_verticesPerSprite];
+        vertices[0].m_position = (centre + Vector4(-halfSize.x, halfSize.y, 0.0f, 0.0f)) * in_worldMatrix;
+        vertices[1].m_position = (centre + Vector4(-halfSize.x, -halfSize.y, 0.0f, 0.0f)) * in_worldMatrix;
+        vertices[2].m_position = (centre + Vector4(halfSize.x, halfSize.y, 0.0f, 0.0f)) * in_worldMatrix;
+        vertices[3].m_position = (centre + Vector4(halfSize.x, -halfSize.y, 0.0f, 0.0f)) * in_worldMatrix;
+        
+        vertices[0].m_uv = Vector2(in_uvs.m_u, in_uvs.m_v);
+        vertices[1].m_uv = Vector2(in_uvs.m_u, in_uvs.m_v + in_uvs.m_t);
+        vertices[2].m_uv = Vector2(in_uvs.m_u + in_uvs.m_s, in_uvs.m_v);
+        vertices[3].m_uv = Vector2(in_uvs.m_u + in_uvs.m_s, in_uvs.m_v + in_uvs.m_t);
+        
+        for (auto& vertex : vertices)
+        {
+            vertex.m_colour = in_colour;
+            m_vertices.push_back(vertex);
+            
+            Vector3 position(vertex.m_position.x, vertex.m_position.y, vertex.m_position.z);
+            batch.m_minBounds = Vector3::Min(batch.m_minBounds, position);
+            batch.m_maxBounds = Vector3::Max(batch.m_maxBounds, position);
+        }
+        
+        for (auto index : k_spriteIndices)
+        {
+            m_indices.push_back(u16(batch.m_numVertices + index));
+        }
+        
+        batch.m_numVertices += k_verticesPerSprite;
+        batch.m_numIndices += k_indicesPerSprite;
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    void CanvasRenderCache::AddRenderCache(const CanvasRenderCache& in_renderCache, const Matrix4& in_worldMatrix)
+    {
+        CS_ASSERT(&in_renderCache != this, "Cannot append a render cache to itself.");
+        
+        for (const auto& sourceBatch : in_renderCache.m_batches)
+        {
+            auto& batch = GetBatchForAppend(sourceBatch.m_texture, sourceBatch.m_numVertices);
+            
+            for (u32 i = 0; i < sourceBatch.m_numIndices; ++i)
+            {
+                m_indices.push_back(u16(batch.m_numVertices + in_renderCache.m_indices[sourceBatch.m_firstIndex + i]));
+            }
+            
+            for (u32 i = 0; i < sourceBatch.m_numVertices; ++i)
+            {
+                Vertex vertex = in_renderCache.m_vertices[sourceBatch.m_firstVertex + i];
+                vertex.m_position = vertex.m_position * in_worldMatrix;
+                m_vertices.push_back(vertex);
+                
+                Vector3 position(vertex.m_position.x, vertex.m_position.y, vertex.m_position.z);
+                batch.m_minBounds = Vector3::Min(batch.m_minBounds, position);
+                batch.m_maxBounds = Vector3::Max(batch.m_maxBounds, position);
+            }
+            
+            batch.m_numVertices += sourceBatch.m_numVertices;
+            batch.m_numIndices += sourceBatch.m_numIndices;
+        }
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    bool CanvasRenderCache::IsEmpty() const
+    {
+        return m_batches.empty();
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    const std::vector<CanvasRenderCache::Batch>& CanvasRenderCache::GetBatches() const
+    {
+        return m_batches;
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    const std::vector<CanvasRenderCache::Vertex>& CanvasRenderCache::GetVertices() const
+    {
+        return m_vertices;
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    const std::vector<u16>& CanvasRenderCache::GetIndices() const
+    {
+        return m_indices;
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    void CanvasRenderCache::Clear()
+    {
+        m_batches.clear();
+        m_vertices.clear();
+        m_indices.clear();
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    CanvasRenderCache::Batch& CanvasRenderCache::GetBatchForAppend(const TextureCSPtr& in_texture, u32 in_numVertices)
+    {
+        CS_ASSERT(in_numVertices <= k_maxVerticesPerBatch, "Too many vertices to fit in a single batch.");
+        
+        if (m_batches.empty() == true || m_batches.back().m_texture != in_texture || m_batches.back().m_numVertices + in_numVertices > k_maxVerticesPerBatch)
+        {
+            Batch batch;
+            batch.m_texture = in_texture;
+            batch.m_firstVertex = u32(m_vertices.size());
+            batch.m_firstIndex = u32(m_indices.size());
+            batch.m_minBounds = Vector3(std::numeric_limits<f32>::max(), std::numeric_limits<f32>::max(), std::numeric_limits<f32>::max());
+            batch.m_maxBounds = Vector3(std::numeric_limits<f32>::lowest(), std::numeric_limits<f32>::lowest(), std::numeric_limits<f32>::lowest());
+            m_batches.push_back(batch);
+        }
+        
+        return m_batches.back();
+    }
+}
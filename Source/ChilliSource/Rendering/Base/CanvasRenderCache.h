@@ -0,0 +1,164 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2016 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#ifndef _CHILLISOURCE_RENDERING_BASE_CANVASRENDERCACHE_H_
+#define _CHILLISOURCE_RENDERING_BASE_CANVASRENDERCACHE_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Base/ByteColour.h>
+#include <ChilliSource/Core/Math/Vector2.h>
+#include <ChilliSource/Core/Math/Vector3.h>
+#include <ChilliSource/Core/Math/Vector4.h>
+#include <ChilliSource/Rendering/Base/AlignmentAnchors.h>
+
+#include <vector>
+
+namespace ChilliSource
+{
+    //------------------------------------------------------------------------------
+    /// A retained batch of pre-transformed UI sprites. Sprites are grouped into
+    /// batches of consecutive sprites which share a texture, allowing content
+    /// which hasn't changed since it was built to be submitted in subsequent
+    /// frames without rebuilding each sprite.
+    ///
+    /// The canvas renderer records widget hierarchies into a cache in screen
+    /// space, and builds text into a cache in the local space of the text so it
+    /// can be drawn with any transform.
+    ///
+    /// This is not thread-safe and should only be accessed from the main thread.
+    //------------------------------------------------------------------------------
+    class CanvasRenderCache final
+    {
+    public:
+        CS_DECLARE_NOCOPY(CanvasRenderCache);
+        //------------------------------------------------------------------------------
+        /// A single vertex in the cache. This matches the sprite vertex format.
+        //------------------------------------------------------------------------------
+        struct Vertex final
+        {
+            Vector4 m_position;
+            Vector2 m_uv;
+            ByteColour m_colour;
+        };
+        //------------------------------------------------------------------------------
+        /// A range of consecutive sprites which all use the same texture. Indices are
+        /// relative to the first vertex in the batch, so each batch is limited to the
+        /// range of 16-bit indices.
+        //------------------------------------------------------------------------------
+        struct Batch final
+        {
+            TextureCSPtr m_texture;
+            u32 m_firstVertex = 0;
+            u32 m_numVertices = 0;
+            u32 m_firstIndex = 0;
+            u32 m_numIndices = 0;
+            Vector3 m_minBounds;
+            Vector3 m_maxBounds;
+        };
+        //------------------------------------------------------------------------------
+        /// Constructor.
+        //------------------------------------------------------------------------------
+        CanvasRenderCache() = default;
+        //------------------------------------------------------------------------------
+        /// Transforms the given sprite into screen space and appends it to the cache.
+        /// The sprite will be added to the last batch if it uses the same texture,
+        /// otherwise a new batch will be started.
+        ///
+        /// @param in_worldMatrix - The screen space transform of the sprite.
+        /// @param in_localPosition - The local position of the sprite.
+        /// @param in_localSize - The local size of the sprite.
+        /// @param in_uvs - The UVs of the sprite.
+        /// @param in_colour - The colour of the sprite.
+        /// @param in_alignmentAnchor - The alignment anchor of the sprite.
+        /// @param in_texture - The texture of the sprite.
+        //------------------------------------------------------------------------------
+        void AddSprite(const Matrix4& in_worldMatrix, const Vector3& in_localPosition, const Vector2& in_localSize, const UVs& in_uvs, const Colour& in_colour,
+                       AlignmentAnchor in_alignmentAnchor, const TextureCSPtr& in_texture);
+        //------------------------------------------------------------------------------
+        /// Transforms the given sprite into screen space and appends it to the cache.
+        /// The sprite will be added to the last batch if it uses the same texture,
+        /// otherwise a new batch will be started.
+        ///
+        /// @param in_worldMatrix - The screen space transform of the sprite.
+        /// @param in_localPosition - The local position of the sprite.
+        /// @param in_localSize - The local size of the sprite.
+        /// @param in_uvs - The UVs of the sprite.
+        /// @param in_colour - The colour of the sprite.
+        /// @param in_alignmentAnchor - The alignment anchor of the sprite.
+        /// @param in_texture - The texture of the sprite.
+        //------------------------------------------------------------------------------
+        void AddSprite(const Matrix4& in_worldMatrix, const Vector3& in_localPosition, const Vector2& in_localSize, const UVs& in_uvs, const ByteColour& in_colour,
+                       AlignmentAnchor in_alignmentAnchor, const TextureCSPtr& in_texture);
+        //------------------------------------------------------------------------------
+        /// Transforms the contents of another cache and appends them to this cache.
+        /// Batches are merged with the last batch in this cache where they share a
+        /// texture.
+        ///
+        /// @param in_renderCache - The cache to append. This cannot be this cache.
+        /// @param in_worldMatrix - The transform to apply to the appended vertices.
+        //------------------------------------------------------------------------------
+        void AddRenderCache(const CanvasRenderCache& in_renderCache, const Matrix4& in_worldMatrix);
+        //------------------------------------------------------------------------------
+        /// @return Whether or not the cache contains any sprites.
+        //------------------------------------------------------------------------------
+        bool IsEmpty() const;
+        //------------------------------------------------------------------------------
+        /// @return The list of batches in the order they should be rendered.
+        //------------------------------------------------------------------------------
+        const std::vector<Batch>& GetBatches() const;
+        //------------------------------------------------------------------------------
+        /// @return The transformed vertices of every batch.
+        //------------------------------------------------------------------------------
+        const std::vector<Vertex>& GetVertices() const;
+        //------------------------------------------------------------------------------
+        /// @return The indices of every batch. These are relative to the first vertex
+        /// in the batch.
+        //------------------------------------------------------------------------------
+        const std::vector<u16>& GetIndices() const;
+        //------------------------------------------------------------------------------
+        /// Removes all sprites from the cache. Allocated memory is retained, so
+        /// re-recording a cache of similar size will not allocate.
+        //------------------------------------------------------------------------------
+        void Clear();
+        
+    private:
+        //------------------------------------------------------------------------------
+        /// Returns the batch which the given number of vertices with the given
+        /// texture should be appended to, starting a new batch if required.
+        ///
+        /// @param in_texture - The texture of the vertices.
+        /// @param in_numVertices - The number of vertices which will be appended.
+        ///
+        /// @return The batch.
+        //------------------------------------------------------------------------------
+        Batch& GetBatchForAppend(const TextureCSPtr& in_texture, u32 in_numVertices);
+        
+        std::vector<Batch> m_batches;
+        std::vector<Vertex> m_vertices;
+        std::vector<u16> m_indices;
+    };
+}
+
+#endif
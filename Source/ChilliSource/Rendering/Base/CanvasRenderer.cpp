@@ -30,20 +30,30 @@
 
 #include <ChilliSource/Core/Base/Application.h>
 #include <ChilliSource/Core/Base/ColourUtils.h>
+#include <ChilliSource/Core/Base/Screen.h>
 #include <ChilliSource/Core/Math/MathUtils.h>
+#include <ChilliSource/Core/Memory/UniquePtr.h>
 #include <ChilliSource/Core/Resource/ResourcePool.h>
 #include <ChilliSource/Core/State/State.h>
 #include <ChilliSource/Core/State/StateManager.h>
 #include <ChilliSource/Core/String/UTF8StringUtils.h>
+#include <ChilliSource/Rendering/Base/AlignmentAnchors.h>
+#include <ChilliSource/Rendering/Base/CanvasRenderCache.h>
 #include <ChilliSource/Rendering/Base/RenderSnapshot.h>
 #include <ChilliSource/Rendering/Font/Font.h>
 #include <ChilliSource/Rendering/Material/Material.h>
 #include <ChilliSource/Rendering/Material/MaterialFactory.h>
+#include <ChilliSource/Rendering/Model/IndexFormat.h>
+#include <ChilliSource/Rendering/Model/PolygonType.h>
+#include <ChilliSource/Rendering/Model/RenderDynamicMesh.h>
+#include <ChilliSource/Rendering/Model/VertexFormat.h>
 #include <ChilliSource/Rendering/Sprite/SpriteMeshBuilder.h>
 #include <ChilliSource/Rendering/Texture/Texture.h>
 #include <ChilliSource/UI/Base/Canvas.h>
 
 #include <algorithm>
+#include <cmath>
+#include <limits>
 
 namespace ChilliSource
 {
@@ -51,6 +61,8 @@ namespace ChilliSource
     {
         const f32 k_maxAutoScaleIterations = 10.0f;//Max number of recursions to find the correct scale
         const f32 k_autoScaleTolerance = 0.01f;//Min difference in max/min scaling to warrant further recursion for AutoScaled text
+        const u32 k_renderCacheVerticesPerSprite = 4;
+        const u32 k_renderCacheIndicesPerSprite = 6;
         
         //------------------------------------------------------
         /// Converts a 2D transformation matrix to a 3D
@@ -612,6 +624,122 @@ namespace ChilliSource
             }
         }
         
+        /// Clips the given sprite to the given screen space clip bounds. If the sprite is axis
+        /// aligned in screen space, its local position, size and UVs are adjusted such that only
+        /// the part within the bounds remains. Rotated sprites cannot be represented this way once
+        /// clipped, so are left unchanged unless they fall entirely outside the bounds.
+        ///
+        /// @param clipBottomLeft
+        ///     The bottom left of the clip bounds in screen space.
+        /// @param clipTopRight
+        ///     The top right of the clip bounds in screen space.
+        /// @param worldMatrix
+        ///     The world matrix of the sprite.
+        /// @param localPosition
+        ///     [In/Out] The local position of the sprite.
+        /// @param localSize
+        ///     [In/Out] The local size of the sprite.
+        /// @param uvs
+        ///     [In/Out] The UVs of the sprite.
+        /// @param alignmentAnchor
+        ///     [In/Out] The alignment anchor of the sprite.
+        ///
+        /// @return Whether or not any of the sprite remains after clipping.
+        ///
+        bool ClipSprite(const Vector2& clipBottomLeft, const Vector2& clipTopRight, const Matrix4& worldMatrix, Vector3& localPosition, Vector2& localSize, UVs& uvs,
+                        AlignmentAnchor& alignmentAnchor) noexcept
+        {
+            Vector2 halfSize = 0.5f * localSize;
+            Vector2 centre = Vector2(localPosition.x, localPosition.y) - GetAnchorPoint(alignmentAnchor, halfSize);
+            Vector2 localMin = centre - halfSize;
+            Vector2 localMax = centre + halfSize;
+            
+            bool isAxisAligned = (worldMatrix.m[1] == 0.0f && worldMatrix.m[4] == 0.0f);
+            if (isAxisAligned == false || worldMatrix.m[0] == 0.0f || worldMatrix.m[5] == 0.0f)
+            {
+                Vector2 worldCentre = Vector2(centre.x * worldMatrix.m[0] + centre.y * worldMatrix.m[4] + worldMatrix.m[12], centre.x * worldMatrix.m[1] + centre.y * worldMatrix.m[5] + worldMatrix.m[13]);
+                Vector2 worldHalfExtents = Vector2(std::abs(worldMatrix.m[0]) * halfSize.x + std::abs(worldMatrix.m[4]) * halfSize.y, std::abs(worldMatrix.m[1]) * halfSize.x + std::abs(worldMatrix.m[5]) * halfSize.y);
+                
+                return (worldCentre.x + worldHalfExtents.x >= clipBottomLeft.x && worldCentre.x - worldHalfExtents.x <= clipTopRight.x &&
+                        worldCentre.y + worldHalfExtents.y >= clipBottomLeft.y && worldCentre.y - worldHalfExtents.y <= clipTopRight.y);
+            }
+            
+            //transform the clip bounds into the local space of the sprite. Scale may be negative, so the corners may swap.
+            Vector2 worldScale(worldMatrix.m[0], worldMatrix.m[5]);
+            Vector2 worldTranslation(worldMatrix.m[12], worldMatrix.m[13]);
+            Vector2 localClipA = (clipBottomLeft - worldTranslation) / worldScale;
+            Vector2 localClipB = (clipTopRight - worldTranslation) / worldScale;
+            
+            Vector2 clippedMin = Vector2::Max(localMin, Vector2::Min(localClipA, localClipB));
+            Vector2 clippedMax = Vector2::Min(localMax, Vector2::Max(localClipA, localClipB));
+            
+            if (clippedMin.x >= clippedMax.x || clippedMin.y >= clippedMax.y)
+            {
+                return false;
+            }
+            
+            if (clippedMin == localMin && clippedMax == localMax)
+            {
+                return true;
+            }
+            
+            //U increases with x, V increases as y decreases.
+            Vector2 localSpan = localMax - localMin;
+            UVs clippedUVs;
+            clippedUVs.m_u = uvs.m_u + uvs.m_s * (clippedMin.x - localMin.x) / localSpan.x;
+            clippedUVs.m_s = uvs.m_s * (clippedMax.x - clippedMin.x) / localSpan.x;
+            clippedUVs.m_v = uvs.m_v + uvs.m_t * (localMax.y - clippedMax.y) / localSpan.y;
+            clippedUVs.m_t = uvs.m_t * (clippedMax.y - clippedMin.y) / localSpan.y;
+            
+            localPosition = Vector3(0.5f * (clippedMin + clippedMax), localPosition.z);
+            localSize = clippedMax - clippedMin;
+            uvs = clippedUVs;
+            alignmentAnchor = AlignmentAnchor::k_middleCentre;
+            
+            return true;
+        }
+        
+        /// Rebuilds the given mesh of axis aligned sprites, such as one created by BuildTextMesh(),
+        /// with each sprite clipped to the given screen space clip bounds. The output is in screen
+        /// space.
+        ///
+        /// @param renderCache
+        ///     The mesh to clip. Every four vertices must describe an axis aligned sprite.
+        /// @param worldMatrix
+        ///     The transform from the space of the mesh to screen space.
+        /// @param clipBottomLeft
+        ///     The bottom left of the clip bounds in screen space.
+        /// @param clipTopRight
+        ///     The top right of the clip bounds in screen space.
+        /// @param clippedRenderCache
+        ///     [Out] The cache to build the clipped mesh into.
+        ///
+        void ClipRenderCache(const CanvasRenderCache& renderCache, const Matrix4& worldMatrix, const Vector2& clipBottomLeft, const Vector2& clipTopRight,
+                             CanvasRenderCache* clippedRenderCache) noexcept
+        {
+            clippedRenderCache->Clear();
+            
+            const auto& vertices = renderCache.GetVertices();
+            for (const auto& batch : renderCache.GetBatches())
+            {
+                for (u32 i = batch.m_firstVertex; i < batch.m_firstVertex + batch.m_numVertices; i += 4)
+                {
+                    const auto& topLeft = vertices[i];
+                    const auto& bottomRight = vertices[i + 3];
+                    
+                    Vector3 localPosition(0.5f * (topLeft.m_position.x + bottomRight.m_position.x), 0.5f * (topLeft.m_position.y + bottomRight.m_position.y), topLeft.m_position.z);
+                    Vector2 localSize(bottomRight.m_position.x - topLeft.m_position.x, topLeft.m_position.y - bottomRight.m_position.y);
+                    UVs uvs(topLeft.m_uv.x, topLeft.m_uv.y, bottomRight.m_uv.x - topLeft.m_uv.x, bottomRight.m_uv.y - topLeft.m_uv.y);
+                    AlignmentAnchor anchor = AlignmentAnchor::k_middleCentre;
+                    
+                    if (ClipSprite(clipBottomLeft, clipTopRight, worldMatrix, localPosition, localSize, uvs, anchor) == true)
+                    {
+                        clippedRenderCache->AddSprite(worldMatrix, localPosition, localSize, uvs, topLeft.m_colour, anchor, batch.m_texture);
+                    }
+                }
+            }
+        }
+        
         /// Creates a new render object containing a dynamic mesh that describes the sprite and
         /// adds it to the snapshot.
         ///
@@ -675,28 +803,77 @@ namespace ChilliSource
         CS_ASSERT(materialFactory != nullptr, "Must have a material factory");
         
         m_materialPool = CanvasMaterialPoolUPtr(new CanvasMaterialPool(materialFactory));
+        
+        m_textMesh = CanvasRenderCacheUPtr(new CanvasRenderCache());
+        m_clippedMesh = CanvasRenderCacheUPtr(new CanvasRenderCache());
     }
     //----------------------------------------------------------------------------
     //----------------------------------------------------------------------------
     void CanvasRenderer::PushClipBounds(const Vector2& in_blPosition, const Vector2& in_size)
     {
-        //TODO: Added support for scissor regions
-        CS_LOG_FATAL("Support for clip bounds is not currently implemented.");
+        Vector2 bottomLeft = in_blPosition;
+        Vector2 topRight = in_blPosition + in_size;
+        
+        if (m_clipPositions.empty() == false)
+        {
+            bottomLeft = Vector2::Max(bottomLeft, m_clipPositions.back());
+            topRight = Vector2::Min(topRight, m_clipPositions.back() + m_clipSizes.back());
+        }
+        
+        m_clipPositions.push_back(bottomLeft);
+        m_clipSizes.push_back(Vector2::Max(topRight - bottomLeft, Vector2::k_zero));
     }
     //----------------------------------------------------------------------------
     //----------------------------------------------------------------------------
     void CanvasRenderer::PopClipBounds()
     {
-        //TODO: Added support for scissor regions
-        CS_LOG_FATAL("Support for clip bounds is not currently implemented.");
+        CS_ASSERT(m_clipPositions.empty() == false, "Cannot pop clip bounds as none have been pushed.");
+        
+        m_clipPositions.pop_back();
+        m_clipSizes.pop_back();
+    }
+    //----------------------------------------------------------------------------
+    //----------------------------------------------------------------------------
+    bool CanvasRenderer::IsWithinClipBounds(const Vector2& in_blPosition, const Vector2& in_size) const
+    {
+        Vector2 clipBottomLeft = Vector2::k_zero;
+        Vector2 clipSize = m_screen->GetResolution();
+        
+        if (m_clipPositions.empty() == false)
+        {
+            clipBottomLeft = m_clipPositions.back();
+            clipSize = m_clipSizes.back();
+        }
+        
+        Vector2 topRight = in_blPosition + in_size;
+        Vector2 clipTopRight = clipBottomLeft + clipSize;
+        
+        return (topRight.x >= clipBottomLeft.x && in_blPosition.x <= clipTopRight.x && topRight.y >= clipBottomLeft.y && in_blPosition.y <= clipTopRight.y);
     }
     //----------------------------------------------------------------------------
     //----------------------------------------------------------------------------
     void CanvasRenderer::DrawBox(const Matrix3& in_transform, const Vector2& in_size, const Vector2& in_offset, const TextureCSPtr& in_texture, const UVs& in_UVs,
                                  const Colour& in_colour, AlignmentAnchor in_anchor)
     {
+        Matrix4 worldMatrix = Convert2DTransformTo3D(in_transform);
+        Vector3 localPosition(in_offset, 0.0f);
+        Vector2 localSize = in_size;
+        UVs uvs = in_UVs;
+        AlignmentAnchor anchor = in_anchor;
+        
+        if (m_clipPositions.empty() == false && ClipSprite(m_clipPositions.back(), m_clipPositions.back() + m_clipSizes.back(), worldMatrix, localPosition, localSize, uvs, anchor) == false)
+        {
+            return;
+        }
+        
+        if (m_renderCache != nullptr)
+        {
+            m_renderCache->AddSprite(worldMatrix, localPosition, localSize, uvs, in_colour, anchor, in_texture);
+            return;
+        }
+        
         auto material = m_materialPool->GetMaterial(in_texture);
-        AddSpriteRenderObject(m_currentRenderSnapshot, Vector3(in_offset, 0.0f), in_size, in_UVs, in_colour, in_anchor, Convert2DTransformTo3D(in_transform), material, m_nextPriority++);
+        AddSpriteRenderObject(m_currentRenderSnapshot, localPosition, localSize, uvs, in_colour, anchor, worldMatrix, material, m_nextPriority++);
     }
     //----------------------------------------------------------------------------
     //----------------------------------------------------------------------------
@@ -767,15 +944,156 @@ namespace ChilliSource
     //----------------------------------------------------------------------------
     void CanvasRenderer::DrawText(const std::vector<DisplayCharacterInfo>& in_characters, const Matrix3& in_transform, const Colour& in_colour, const TextureCSPtr& in_texture)
     {
-        auto material = m_materialPool->GetMaterial(in_texture);
-
-        Matrix4 matTransform = Convert2DTransformTo3D(in_transform);
-        Matrix4 matTransformedLocal;
-
+        BuildTextMesh(in_characters, in_colour, in_texture, m_textMesh.get());
+        DrawText(*m_textMesh, in_transform);
+    }
+    //----------------------------------------------------------------------------
+    //----------------------------------------------------------------------------
+    void CanvasRenderer::BuildTextMesh(const std::vector<DisplayCharacterInfo>& in_characters, const Colour& in_colour, const TextureCSPtr& in_texture, CanvasRenderCache* out_textMesh) const
+    {
+        CS_ASSERT(out_textMesh != nullptr, "Cannot build text into a null mesh.");
+        
+        out_textMesh->Clear();
+        
+        //characters are positioned directly in text space, so no per-character transform is needed.
         for (const auto& character : in_characters)
         {
-            matTransformedLocal = Matrix4::CreateTranslation(Vector3(character.m_position, 0.0f)) * matTransform;
-            AddSpriteRenderObject(m_currentRenderSnapshot, Vector3::k_zero, character.m_packedImageSize, character.m_UVs, in_colour, AlignmentAnchor::k_topLeft, matTransformedLocal, material, m_nextPriority++);
+            out_textMesh->AddSprite(Matrix4::k_identity, Vector3(character.m_position, 0.0f), character.m_packedImageSize, character.m_UVs, in_colour, AlignmentAnchor::k_topLeft, in_texture);
+        }
+    }
+    //----------------------------------------------------------------------------
+    //----------------------------------------------------------------------------
+    void CanvasRenderer::DrawText(const CanvasRenderCache& in_textMesh, const Matrix3& in_transform)
+    {
+        if (in_textMesh.IsEmpty() == true)
+        {
+            return;
+        }
+        
+        Matrix4 worldMatrix = Convert2DTransformTo3D(in_transform);
+        const CanvasRenderCache* renderCache = &in_textMesh;
+        
+        if (m_clipPositions.empty() == false)
+        {
+            Vector2 clipBottomLeft = m_clipPositions.back();
+            Vector2 clipTopRight = clipBottomLeft + m_clipSizes.back();
+            
+            //find the screen space bounds of the text to check whether any clipping is actually required.
+            Vector2 bottomLeft(std::numeric_limits<f32>::max(), std::numeric_limits<f32>::max());
+            Vector2 topRight(std::numeric_limits<f32>::lowest(), std::numeric_limits<f32>::lowest());
+            for (const auto& batch : in_textMesh.GetBatches())
+            {
+                for (u32 corner = 0; corner < 4; ++corner)
+                {
+                    Vector4 localCorner((corner & 1) ? batch.m_maxBounds.x : batch.m_minBounds.x, (corner & 2) ? batch.m_maxBounds.y : batch.m_minBounds.y, 0.0f, 1.0f);
+                    Vector4 screenCorner = localCorner * worldMatrix;
+                    bottomLeft = Vector2::Min(bottomLeft, Vector2(screenCorner.x, screenCorner.y));
+                    topRight = Vector2::Max(topRight, Vector2(screenCorner.x, screenCorner.y));
+                }
+            }
+            
+            if (bottomLeft.x > clipTopRight.x || bottomLeft.y > clipTopRight.y || topRight.x < clipBottomLeft.x || topRight.y < clipBottomLeft.y)
+            {
+                return;
+            }
+            
+            if (bottomLeft.x < clipBottomLeft.x || bottomLeft.y < clipBottomLeft.y || topRight.x > clipTopRight.x || topRight.y > clipTopRight.y)
+            {
+                ClipRenderCache(in_textMesh, worldMatrix, clipBottomLeft, clipTopRight, m_clippedMesh.get());
+                
+                renderCache = m_clippedMesh.get();
+                worldMatrix = Matrix4::k_identity;
+            }
+        }
+        
+        if (m_renderCache != nullptr)
+        {
+            m_renderCache->AddRenderCache(*renderCache, worldMatrix);
+        }
+        else
+        {
+            AddRenderCacheRenderObjects(*renderCache, worldMatrix);
+        }
+    }
+    //----------------------------------------------------------------------------
+    //----------------------------------------------------------------------------
+    void CanvasRenderer::BeginRenderCache(CanvasRenderCache* in_renderCache)
+    {
+        CS_ASSERT(in_renderCache != nullptr, "Cannot record into a null render cache.");
+        CS_ASSERT(m_renderCache == nullptr, "Cannot begin recording a render cache while another is being recorded.");
+        
+        m_renderCache = in_renderCache;
+        m_renderCache->Clear();
+    }
+    //----------------------------------------------------------------------------
+    //----------------------------------------------------------------------------
+    void CanvasRenderer::EndRenderCache()
+    {
+        CS_ASSERT(m_renderCache != nullptr, "Cannot end recording a render cache as none is being recorded.");
+        
+        m_renderCache = nullptr;
+    }
+    //----------------------------------------------------------------------------
+    //----------------------------------------------------------------------------
+    bool CanvasRenderer::IsRecordingRenderCache() const
+    {
+        return (m_renderCache != nullptr);
+    }
+    //----------------------------------------------------------------------------
+    //----------------------------------------------------------------------------
+    void CanvasRenderer::DrawRenderCache(const CanvasRenderCache& in_renderCache)
+    {
+        CS_ASSERT(m_renderCache == nullptr, "Cannot draw a render cache while recording one.");
+        
+        AddRenderCacheRenderObjects(in_renderCache, Matrix4::k_identity);
+    }
+    //----------------------------------------------------------------------------
+    //----------------------------------------------------------------------------
+    void CanvasRenderer::AddRenderCacheRenderObjects(const CanvasRenderCache& in_renderCache, const Matrix4& in_worldMatrix)
+    {
+        auto allocator = m_currentRenderSnapshot->GetFrameAllocator();
+        const auto& vertices = in_renderCache.GetVertices();
+        const auto& indices = in_renderCache.GetIndices();
+        
+        //a single mesh's vertex data must fit in a single frame allocation, so larger batches are split into multiple meshes on sprite boundaries.
+        const u32 maxSpritesPerMesh = u32(allocator->GetMaxAllocationSize() / (k_renderCacheVerticesPerSprite * sizeof(CanvasRenderCache::Vertex)));
+        CS_ASSERT(maxSpritesPerMesh > 0, "Frame allocator cannot fit a single sprite.");
+        
+        f32 maxAxisScale = std::max(std::max(in_worldMatrix.GetRight().Length(), in_worldMatrix.GetUp().Length()), in_worldMatrix.GetForward().Length());
+        
+        for (const auto& batch : in_renderCache.GetBatches())
+        {
+            Sphere localBoundingSphere(0.5f * (batch.m_minBounds + batch.m_maxBounds), 0.5f * (batch.m_maxBounds - batch.m_minBounds).Length());
+            Sphere boundingSphere(localBoundingSphere.vOrigin * in_worldMatrix, localBoundingSphere.fRadius * maxAxisScale);
+            auto material = m_materialPool->GetMaterial(batch.m_texture);
+            
+            const u32 numSprites = batch.m_numVertices / k_renderCacheVerticesPerSprite;
+            for (u32 firstSprite = 0; firstSprite < numSprites; firstSprite += maxSpritesPerMesh)
+            {
+                const u32 numMeshSprites = std::min(numSprites - firstSprite, maxSpritesPerMesh);
+                const u32 firstVertex = firstSprite * k_renderCacheVerticesPerSprite;
+                const u32 firstIndex = firstSprite * k_renderCacheIndicesPerSprite;
+                const u32 numVertices = numMeshSprites * k_renderCacheVerticesPerSprite;
+                const u32 numIndices = numMeshSprites * k_renderCacheIndicesPerSprite;
+                const u32 vertexDataSize = numVertices * sizeof(CanvasRenderCache::Vertex);
+                const u32 indexDataSize = numIndices * sizeof(u16);
+                
+                auto vertexData = MakeUniqueArray<u8>(*allocator, vertexDataSize);
+                auto indexData = MakeUniqueArray<u8>(*allocator, indexDataSize);
+                memcpy(vertexData.get(), vertices.data() + batch.m_firstVertex + firstVertex, vertexDataSize);
+                
+                auto meshIndices = reinterpret_cast<u16*>(indexData.get());
+                for (u32 i = 0; i < numIndices; ++i)
+                {
+                    meshIndices[i] = u16(indices[batch.m_firstIndex + firstIndex + i] - firstVertex);
+                }
+                
+                auto renderDynamicMesh = MakeUnique<RenderDynamicMesh>(*allocator, PolygonType::k_triangle, VertexFormat::k_sprite, IndexFormat::k_short, numVertices, numIndices, localBoundingSphere,
+                                                                       std::move(vertexData), vertexDataSize, std::move(indexData), indexDataSize);
+                
+                m_currentRenderSnapshot->AddRenderObject(RenderObject(material->GetRenderMaterialGroup(), renderDynamicMesh.get(), in_worldMatrix, boundingSphere, false, RenderLayer::k_ui, m_nextPriority++));
+                m_currentRenderSnapshot->AddRenderDynamicMesh(std::move(renderDynamicMesh));
+            }
         }
     }
     //----------------------------------------------------------------------------
@@ -793,8 +1111,12 @@ namespace ChilliSource
         
         activeUICanvas->Draw(this);
         
+        CS_ASSERT(m_clipPositions.empty() == true, "Clip bounds were pushed but not popped.");
+        
         m_currentRenderSnapshot = nullptr;
         
+        m_textMesh->Clear();
+        m_clippedMesh->Clear();
         m_materialPool->Clear();
     }
     //----------------------------------------------------------------------------
@@ -803,5 +1125,8 @@ namespace ChilliSource
     {
         m_materialPool->Clear();
         m_materialPool.reset();
+        
+        m_textMesh.reset();
+        m_clippedMesh.reset();
     }
 }
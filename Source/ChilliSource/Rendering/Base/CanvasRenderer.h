@@ -33,6 +33,7 @@
 #include <ChilliSource/Core/Math/Geometry/Shapes.h>
 #include <ChilliSource/Core/System/AppSystem.h>
 #include <ChilliSource/Rendering/Base/CanvasMaterialPool.h>
+#include <ChilliSource/Rendering/Base/CanvasRenderCache.h>
 #include <ChilliSource/Rendering/Base/HorizontalTextJustification.h>
 #include <ChilliSource/Rendering/Base/VerticalTextJustification.h>
 #include <ChilliSource/Rendering/Texture/UVs.h>
@@ -110,9 +111,12 @@ namespace ChilliSource
         //----------------------------------------------------------------------------
         bool IsA(InterfaceIDType in_interfaceId) const override;
         //----------------------------------------------------------------------------
-        /// Set the bounds beyond which any subviews will clip
-        /// Pushes to a stack which tracks when to enable and
-        /// disable scissoring
+        /// Pushes new clip bounds to the clip stack. The bounds are intersected with
+        /// the current clip bounds, if there are any, and anything drawn until the
+        /// bounds are popped is clipped to the result. Clipping is performed on the
+        /// CPU by adjusting the positions and UVs of each sprite, so doesn't break
+        /// batching. Sprites which are rotated cannot be clipped in this way, so are
+        /// only culled if they fall entirely outside the bounds.
         ///
         /// @author A Mackie
         ///
@@ -121,12 +125,28 @@ namespace ChilliSource
         //----------------------------------------------------------------------------
         void PushClipBounds(const Vector2& in_blPosition, const Vector2& in_size);
         //----------------------------------------------------------------------------
-        /// Pop the scissor tracking stack and disable clipping if the stack is empty
+        /// Pops the last clip bounds from the clip stack, restoring the previous
+        /// clip bounds. If the stack is empty after this then drawing is no longer
+        /// clipped.
         ///
         /// @author A Mackie
         //----------------------------------------------------------------------------
         void PopClipBounds();
         //----------------------------------------------------------------------------
+        /// Checks whether any part of the given screen space region falls within the
+        /// current clip bounds. If no clip bounds have been pushed this checks
+        /// against the screen. This can be used to skip drawing anything which
+        /// would be entirely clipped.
+        ///
+        /// @param in_blPosition - The bottom left corner of the region in screen
+        /// space.
+        /// @param in_size - The size of the region in screen space.
+        ///
+        /// @return Whether or not the region is at least partially within the
+        /// current clip bounds.
+        //----------------------------------------------------------------------------
+        bool IsWithinClipBounds(const Vector2& in_blPosition, const Vector2& in_size) const;
+        //----------------------------------------------------------------------------
         /// Build a sprite box and render it to screen
         ///
         /// @param Transform
@@ -158,6 +178,9 @@ namespace ChilliSource
         BuiltText BuildText(const std::string& in_text, const FontCSPtr& in_font, const Vector2& in_bounds, const TextProperties& in_textProperties, f32& out_textScale) const;
         //----------------------------------------------------------------------------
         /// Build the sprites for each given character and render them to screen.
+        /// The whole block of text is submitted as a single mesh. If the text is
+        /// drawn every frame without changing, prefer building it once with
+        /// BuildTextMesh() and drawing the retained mesh instead.
         ///
         /// @param Characters in text space
         /// @param Transform to screen space
@@ -165,6 +188,54 @@ namespace ChilliSource
         /// @param Texture
         //----------------------------------------------------------------------------
         void DrawText(const std::vector<DisplayCharacterInfo>& in_characters, const Matrix3& in_transform, const Colour& in_colour, const TextureCSPtr& in_texture);
+        //----------------------------------------------------------------------------
+        /// Builds a single mesh containing a sprite for each of the given characters
+        /// in text space. The mesh can be retained and drawn each frame with
+        /// DrawText() for as long as the characters and colour are unchanged.
+        ///
+        /// @param in_characters - The characters in text space.
+        /// @param in_colour - The colour of the text.
+        /// @param in_texture - The font texture.
+        /// @param out_textMesh - [Out] The cache the mesh will be built into. Any
+        /// existing contents will be cleared.
+        //----------------------------------------------------------------------------
+        void BuildTextMesh(const std::vector<DisplayCharacterInfo>& in_characters, const Colour& in_colour, const TextureCSPtr& in_texture, CanvasRenderCache* out_textMesh) const;
+        //----------------------------------------------------------------------------
+        /// Renders a text mesh previously built with BuildTextMesh(). The mesh is
+        /// submitted as a single render object. If the text is partially outside
+        /// the current clip bounds, the visible part of each glyph is rebuilt into
+        /// a single mesh for this frame.
+        ///
+        /// @param in_textMesh - The text mesh.
+        /// @param in_transform - The transform from text space to screen space.
+        //----------------------------------------------------------------------------
+        void DrawText(const CanvasRenderCache& in_textMesh, const Matrix3& in_transform);
+        //----------------------------------------------------------------------------
+        /// Starts recording into the given render cache. Until EndRenderCache() is
+        /// called, everything drawn through the renderer is transformed into screen
+        /// space and stored in the cache rather than rendered. The cache is cleared
+        /// before recording begins. Recording cannot be nested.
+        ///
+        /// @param in_renderCache - The render cache to record into.
+        //----------------------------------------------------------------------------
+        void BeginRenderCache(CanvasRenderCache* in_renderCache);
+        //----------------------------------------------------------------------------
+        /// Stops recording into the current render cache.
+        //----------------------------------------------------------------------------
+        void EndRenderCache();
+        //----------------------------------------------------------------------------
+        /// @return Whether or not a render cache is currently being recorded.
+        //----------------------------------------------------------------------------
+        bool IsRecordingRenderCache() const;
+        //----------------------------------------------------------------------------
+        /// Renders the contents of a previously recorded render cache. Each batch in
+        /// the cache is submitted as a single render object, so the cost is
+        /// proportional to the number of textures used rather than the number of
+        /// sprites.
+        ///
+        /// @param in_renderCache - The render cache to render.
+        //----------------------------------------------------------------------------
+        void DrawRenderCache(const CanvasRenderCache& in_renderCache);
 
     private:
 
@@ -190,6 +261,15 @@ namespace ChilliSource
         //----------------------------------------------------------------------------
         void OnInit() override;
         //----------------------------------------------------------------------------
+        /// Adds a render object for each batch in the given render cache to the
+        /// current render snapshot.
+        ///
+        /// @param in_renderCache - The render cache.
+        /// @param in_worldMatrix - The transform from the space of the render cache
+        /// to screen space.
+        //----------------------------------------------------------------------------
+        void AddRenderCacheRenderObjects(const CanvasRenderCache& in_renderCache, const Matrix4& in_worldMatrix);
+        //----------------------------------------------------------------------------
         /// Called when the render snapshot event occurs. This iterates over all UI
         /// adding objects to the render snapshot as appropriate.
         ///
@@ -209,9 +289,12 @@ namespace ChilliSource
     private:
         RenderSnapshot* m_currentRenderSnapshot = nullptr;
         u32 m_nextPriority = 0;
+        CanvasRenderCache* m_renderCache = nullptr;
+        CanvasRenderCacheUPtr m_textMesh;
+        CanvasRenderCacheUPtr m_clippedMesh;
         
-        std::vector<Vector2> m_scissorPositions;
-        std::vector<Vector2> m_scissorSizes;
+        std::vector<Vector2> m_clipPositions;
+        std::vector<Vector2> m_clipSizes;
 
         CanvasMaterialPoolUPtr m_materialPool;
 
@@ -25,6 +25,7 @@
 #include <ChilliSource/Rendering/Base/ForwardRenderPassCompiler.h>
 
 #include <ChilliSource/Core/Math/Geometry/ShapeIntersection.h>
+#include <ChilliSource/Core/Math/Geometry/SphereBatch.h>
 #include <ChilliSource/Core/Threading/TaskScheduler.h>
 #include <ChilliSource/Rendering/Base/ForwardRenderPasses.h>
 #include <ChilliSource/Rendering/Base/RenderFrame.h>
@@ -40,20 +41,22 @@ namespace ChilliSource
 {
     namespace
     {
-        /// Converts the given RenderObject to a RenderPassObject using the given RenderMaterial.
-        /// if the given RenderMaterial does not exist in the RenderMaterialGroup contained by
-        /// the RenderObject, then this will assert.
+        /// Converts the given RenderObject to a RenderPassObject using the RenderMaterial it
+        /// resolved for the given pass. If the RenderObject doesn't have a RenderMaterial for
+        /// the pass, then this will assert.
         ///
         /// @param renderObject
         ///     The renderObject to convert.
-        /// @param renderMaterial
-        ///     The render material that should be used by the new RenderPassObject.
+        /// @param passIndex
+        ///     The index of the pass the new RenderPassObject will be rendered in.
         ///
         /// @return The new RenderPassObject.
         ///
-        RenderPassObject ConvertToRenderPassObject(const RenderObject& renderObject, const RenderMaterial* renderMaterial) noexcept
+        RenderPassObject ConvertToRenderPassObject(const RenderObject& renderObject, u32 passIndex) noexcept
         {
-            CS_ASSERT(renderObject.GetRenderMaterialGroup()->Contains(renderMaterial), "Invalid render material.");
+            CS_ASSERT(renderObject.HasRenderMaterial(passIndex), "Render object has no render material for the pass.");
+            
+            auto renderMaterial = renderObject.GetRenderMaterial(passIndex);
             
             switch (renderObject.GetType())
             {
@@ -73,53 +76,6 @@ namespace ChilliSource
             }
         }
         
-        /// Returns the vertex format of the given render object.
-        ///
-        /// @param renderObject
-        ///     The render object.
-        ///
-        /// @return The vertex format.
-        ///
-        const VertexFormat& GetVertexFormat(const RenderObject& renderObject)
-        {
-            switch (renderObject.GetType())
-            {
-                case RenderObject::Type::k_static:
-                case RenderObject::Type::k_staticAnimated:
-                    return renderObject.GetRenderMesh()->GetVertexFormat();
-                case RenderObject::Type::k_dynamic:
-                case RenderObject::Type::k_dynamicAnimated:
-                    return renderObject.GetRenderDynamicMesh()->GetVertexFormat();
-                default:
-                    CS_LOG_FATAL("Invalid RenderObject type.");
-                    return renderObject.GetRenderMesh()->GetVertexFormat();
-            }
-        }
-        
-        /// Calculate the number of targets
-        ///
-        /// @param renderFrame
-        ///     The render frame from which to calculate the numer of passes.
-        ///
-        /// @return The number of passes.
-        ///
-        u32 CalcNumTargets(const RenderFrame& renderFrame) noexcept
-        {
-            // The main target
-            constexpr u32 k_reservedTargets = 1;
-            
-            u32 numShadowCastingLights = 0;
-            for (const auto& directionalRenderLight : renderFrame.GetDirectionalRenderLights())
-            {
-                if (directionalRenderLight.GetShadowMapTarget())
-                {
-                    ++numShadowCastingLights;
-                }
-            }
-            
-            return k_reservedTargets + numShadowCastingLights;
-        }
-        
         /// Calculates main scene passes in the given render frame.
         ///
         /// @param renderFrame
@@ -138,83 +94,114 @@ namespace ChilliSource
             return k_reservedRenderPasses + numDirectionalLightPasses + numPointLightPasses;
         }
         
-        /// Filters the given list of objects to return only the objects which are a part of the requested
-        /// layer.
+        /// Filters the given list of objects to return the indices of only the objects which are a part
+        /// of the requested layer.
         ///
         /// @param renderLayer
         ///     The render layer to filter on.
         /// @param renderObjects
         ///     The list of render objects which should be filtered.
         ///
-        /// @return The list of render objects for the requested layer.
+        /// @return The indices of the render objects in the requested layer, in ascending order.
         ///
-        std::vector<RenderObject> GetLayerRenderObjects(RenderLayer renderLayer, const std::vector<RenderObject>& renderObjects) noexcept
+        std::vector<u32> GetLayerRenderObjectIndices(RenderLayer renderLayer, const std::vector<RenderObject>& renderObjects) noexcept
         {
-            std::vector<RenderObject> layerRenderObjects;
-            
+            u32 numLayerRenderObjects = 0;
             for (const auto& renderObject : renderObjects)
             {
-                if (renderObject.GetRenderLayer() == renderLayer)
+                numLayerRenderObjects += (renderObject.GetRenderLayer() == renderLayer) ? 1 : 0;
+            }
+            
+            std::vector<u32> layerRenderObjectIndices;
+            layerRenderObjectIndices.reserve(numLayerRenderObjects);
+            
+            for (u32 index = 0; index < u32(renderObjects.size()); ++index)
+            {
+                if (renderObjects[index].GetRenderLayer() == renderLayer)
                 {
-                    layerRenderObjects.push_back(renderObject);
+                    layerRenderObjectIndices.push_back(index);
                 }
             }
             
-            return layerRenderObjects;
+            return layerRenderObjectIndices;
         }
         
-        /// Parses a list of RenderObjects and generates a list of RenderPassObjects for
-        /// each RenderObject that has a ShadowMap pass defined, and has shadow casting
-        /// enabled.
+        /// Generates a list of RenderPassObjects for each of the given RenderObjects that has a
+        /// RenderMaterial for the given pass. The objects are counted first so the list is only
+        /// allocated once.
         ///
         /// @param renderObjects
-        ///     A list of RenderObjects to parse
+        ///     The list of render objects the indices refer to.
+        /// @param renderObjectIndices
+        ///     The indices of the render objects to parse.
+        /// @param passIndex
+        ///     The index of the pass the RenderPassObjects are for.
         ///
-        /// @return The collection of RenderPassObjects.
+        /// @return The collection of RenderPassObjects, in the same order as the indices.
         ///
-        std::vector<RenderPassObject> GetShadowMapRenderPassObjects(const std::vector<RenderObject>& renderObjects) noexcept
+        std::vector<RenderPassObject> GetRenderPassObjects(const std::vector<RenderObject>& renderObjects, const std::vector<u32>& renderObjectIndices, u32 passIndex) noexcept
         {
-            std::vector<RenderPassObject> baseRenderPassObjects;
+            u32 numRenderPassObjects = 0;
+            for (u32 index : renderObjectIndices)
+            {
+                numRenderPassObjects += renderObjects[index].HasRenderMaterial(passIndex) ? 1 : 0;
+            }
             
-            for (const auto& renderObject : renderObjects)
+            std::vector<RenderPassObject> renderPassObjects;
+            renderPassObjects.reserve(numRenderPassObjects);
+            
+            for (u32 index : renderObjectIndices)
             {
-                if (renderObject.ShouldCastShadows())
+                const auto& renderObject = renderObjects[index];
+                if (renderObject.HasRenderMaterial(passIndex))
                 {
-                    auto renderMaterial = renderObject.GetRenderMaterialGroup()->GetRenderMaterial(GetVertexFormat(renderObject), static_cast<u32>(ForwardRenderPasses::k_shadowMap));
-                    
-                    if (renderMaterial)
-                    {
-                        baseRenderPassObjects.push_back(ConvertToRenderPassObject(renderObject, renderMaterial));
-                    }
+                    renderPassObjects.push_back(ConvertToRenderPassObject(renderObject, passIndex));
                 }
             }
             
-            return baseRenderPassObjects;
+            return renderPassObjects;
         }
         
         /// Parses a list of RenderObjects and generates a list of RenderPassObjects for
-        /// each RenderObject that has a Base pass defined.
+        /// each RenderObject that has a ShadowMap pass defined, and has shadow casting
+        /// enabled.
         ///
         /// @param renderObjects
-        ///     A list of RenderObjects to parse
+        ///     The list of render objects the indices refer to.
+        /// @param renderObjectIndices
+        ///     The indices of the render objects to parse.
         ///
-        /// @return A collection of RenderPassObjects, one for each RenderObject Base pass
+        /// @return The collection of RenderPassObjects.
         ///
-        std::vector<RenderPassObject> GetBaseRenderPassObjects(const std::vector<RenderObject>& renderObjects) noexcept
+        std::vector<RenderPassObject> GetShadowMapRenderPassObjects(const std::vector<RenderObject>& renderObjects, const std::vector<u32>& renderObjectIndices) noexcept
         {
-            std::vector<RenderPassObject> baseRenderPassObjects;
+            std::vector<u32> shadowCasterIndices;
+            shadowCasterIndices.reserve(renderObjectIndices.size());
             
-            for (const auto& renderObject : renderObjects)
+            for (u32 index : renderObjectIndices)
             {
-                auto renderMaterial = renderObject.GetRenderMaterialGroup()->GetRenderMaterial(GetVertexFormat(renderObject), static_cast<u32>(ForwardRenderPasses::k_base));
-                
-                if (renderMaterial)
+                if (renderObjects[index].ShouldCastShadows())
                 {
-                    baseRenderPassObjects.push_back(ConvertToRenderPassObject(renderObject, renderMaterial));
+                    shadowCasterIndices.push_back(index);
                 }
             }
             
-            return baseRenderPassObjects;
+            return GetRenderPassObjects(renderObjects, shadowCasterIndices, static_cast<u32>(ForwardRenderPasses::k_shadowMap));
+        }
+        
+        /// Parses a list of RenderObjects and generates a list of RenderPassObjects for
+        /// each RenderObject that has a Base pass defined.
+        ///
+        /// @param renderObjects
+        ///     The list of render objects the indices refer to.
+        /// @param renderObjectIndices
+        ///     The indices of the render objects to parse.
+        ///
+        /// @return A collection of RenderPassObjects, one for each RenderObject Base pass
+        ///
+        std::vector<RenderPassObject> GetBaseRenderPassObjects(const std::vector<RenderObject>& renderObjects, const std::vector<u32>& renderObjectIndices) noexcept
+        {
+            return GetRenderPassObjects(renderObjects, renderObjectIndices, static_cast<u32>(ForwardRenderPasses::k_base));
         }
         
         /// Parses a list of RenderObjects and generates a list of RenderPassObjects for
@@ -222,13 +209,16 @@ namespace ChilliSource
         /// pass defined, depending on the type of directional light.
         ///
         /// @param renderObjects
-        ///     A list of RenderObjects to parse
+        ///     The list of render objects the indices refer to.
+        /// @param renderObjectIndices
+        ///     The indices of the render objects to parse.
         /// @param directionalRenderLight
         ///     The directional light to get objects for.
         ///
         /// @return A collection of RenderPassObjects, one for each RenderObject Directional pass
         ///
-        std::vector<RenderPassObject> GetDirectionalLightRenderPassObjects(const std::vector<RenderObject>& renderObjects, const DirectionalRenderLight& directionalRenderLight) noexcept
+        std::vector<RenderPassObject> GetDirectionalLightRenderPassObjects(const std::vector<RenderObject>& renderObjects, const std::vector<u32>& renderObjectIndices,
+                                                                           const DirectionalRenderLight& directionalRenderLight) noexcept
         {
             ForwardRenderPasses passType = ForwardRenderPasses::k_directionalLight;
             if (directionalRenderLight.GetShadowMapTarget())
@@ -236,19 +226,7 @@ namespace ChilliSource
                 passType = ForwardRenderPasses::k_directionalLightShadows;
             }
             
-            std::vector<RenderPassObject> renderPassObjects;
-            
-            for (const auto& renderObject : renderObjects)
-            {
-                auto renderMaterial = renderObject.GetRenderMaterialGroup()->GetRenderMaterial(GetVertexFormat(renderObject), static_cast<u32>(passType));
-                
-                if (renderMaterial)
-                {
-                    renderPassObjects.push_back(ConvertToRenderPassObject(renderObject, renderMaterial));
-                }
-            }
-            
-            return renderPassObjects;
+            return GetRenderPassObjects(renderObjects, renderObjectIndices, static_cast<u32>(passType));
         }
         
         /// Parses a list of RenderObjects and generates a list of RenderPassObjects for
@@ -256,54 +234,53 @@ namespace ChilliSource
         /// of influence of the given light.
         ///
         /// @param renderObjects
-        ///     A list of RenderObjects to parse
+        ///     The list of render objects the indices refer to.
+        /// @param renderObjectIndices
+        ///     The indices of the render objects to parse.
+        /// @param boundingSpheres
+        ///     The bounding spheres of the render objects, in the same order as the indices.
         /// @param pointRenderLight
         ///     The render light to get objects for.
         ///
         /// @return A collection of RenderPassObjects for the render light pass.
         ///
-        std::vector<RenderPassObject> GetPointLightRenderPassObjects(const std::vector<RenderObject>& renderObjects, const PointRenderLight& pointRenderLight) noexcept
+        std::vector<RenderPassObject> GetPointLightRenderPassObjects(const std::vector<RenderObject>& renderObjects, const std::vector<u32>& renderObjectIndices, const SphereBatch& boundingSpheres,
+                                                                     const PointRenderLight& pointRenderLight) noexcept
         {
             Sphere pointLightBoundingSphere(pointRenderLight.GetPosition(), pointRenderLight.GetRangeOfInfluence());
             
-            std::vector<RenderPassObject> renderPassObjects;
+            std::vector<u32> influenceMask(SphereBatch::CalcNumMaskWords(boundingSpheres.GetNumSpheres()));
+            boundingSpheres.CullAgainstSphere(pointLightBoundingSphere, 0, boundingSpheres.GetNumSpheres(), influenceMask.data());
             
-            for (const auto& renderObject : renderObjects)
+            std::vector<u32> lightObjectIndices;
+            for (u32 wordIndex = 0; wordIndex < u32(influenceMask.size()); ++wordIndex)
             {
-                auto renderMaterial = renderObject.GetRenderMaterialGroup()->GetRenderMaterial(GetVertexFormat(renderObject), static_cast<u32>(ForwardRenderPasses::k_pointLight));
-                
-                if (renderMaterial && pointLightBoundingSphere.Contains(renderObject.GetBoundingSphere()))
+                u32 word = influenceMask[wordIndex];
+                for (u32 bit = 0; word != 0; ++bit, word >>= 1)
                 {
-                    renderPassObjects.push_back(ConvertToRenderPassObject(renderObject, renderMaterial));
+                    if ((word & 1) != 0)
+                    {
+                        lightObjectIndices.push_back(renderObjectIndices[wordIndex * SphereBatch::k_spheresPerMaskWord + bit]);
+                    }
                 }
             }
             
-            return renderPassObjects;
+            return GetRenderPassObjects(renderObjects, lightObjectIndices, static_cast<u32>(ForwardRenderPasses::k_pointLight));
         }
         
         /// Parses a list of RenderObjects and generates a list of RenderPassObjects for
         /// each RenderObject that has a Transparent pass defined.
         ///
         /// @param renderObjects
-        ///     A list of RenderObjects to parse
+        ///     The list of render objects the indices refer to.
+        /// @param renderObjectIndices
+        ///     The indices of the render objects to parse.
         ///
         /// @return A collection of RenderPassObjects, one for each RenderObject Transparent pass
         ///
-        std::vector<RenderPassObject> GetTransparentRenderPassObjects(const std::vector<RenderObject>& renderObjects) noexcept
+        std::vector<RenderPassObject> GetTransparentRenderPassObjects(const std::vector<RenderObject>& renderObjects, const std::vector<u32>& renderObjectIndices) noexcept
         {
-            std::vector<RenderPassObject> transparentRenderPassObjects;
-            
-            for (const auto& renderObject : renderObjects)
-            {
-                auto renderMaterial = renderObject.GetRenderMaterialGroup()->GetRenderMaterial(GetVertexFormat(renderObject), static_cast<u32>(ForwardRenderPasses::k_transparent));
-                
-                if (renderMaterial)
-                {
-                    transparentRenderPassObjects.push_back(ConvertToRenderPassObject(renderObject, renderMaterial));
-                }
-            }
-            
-            return transparentRenderPassObjects;
+            return GetRenderPassObjects(renderObjects, renderObjectIndices, static_cast<u32>(ForwardRenderPasses::k_transparent));
         }
         
         /// Gather all render objects in the frame that are to be renderered into the default RenderTarget
@@ -319,8 +296,9 @@ namespace ChilliSource
         ///
         CameraRenderPassGroup CompleSceneCameraRenderPassGroup(const TaskContext& taskContext, const RenderFrame& renderFrame) noexcept
         {
-            auto standardRenderObjects = GetLayerRenderObjects(RenderLayer::k_standard, renderFrame.GetRenderObjects());
-            auto visibleStandardRenderObjects = RenderPassVisibilityChecker::CalculateVisibleObjects(taskContext, renderFrame.GetRenderCamera(), standardRenderObjects);
+            const auto& renderObjects = renderFrame.GetRenderObjects();
+            auto standardRenderObjectIndices = GetLayerRenderObjectIndices(RenderLayer::k_standard, renderObjects);
+            auto visibleStandardRenderObjectIndices = RenderPassVisibilityChecker::CalculateVisibleObjects(taskContext, renderFrame.GetRenderCamera(), renderObjects, standardRenderObjectIndices);
             
             u32 numPasses = CalcNumScenePasses(renderFrame);
             std::vector<RenderPass> renderPasses(numPasses);
@@ -329,9 +307,9 @@ namespace ChilliSource
             
             // Base pass
             u32 basePassIndex = nextPassIndex++;
-            tasks.push_back([=, &renderPasses, &renderFrame, &visibleStandardRenderObjects](const TaskContext& innerTaskContext)
+            tasks.push_back([=, &renderPasses, &renderFrame, &renderObjects, &visibleStandardRenderObjectIndices](const TaskContext& innerTaskContext)
             {
-                auto renderPassObjects = GetBaseRenderPassObjects(visibleStandardRenderObjects);
+                auto renderPassObjects = GetBaseRenderPassObjects(renderObjects, visibleStandardRenderObjectIndices);
                 RenderPassObjectSorter::OpaqueSort(renderFrame.GetRenderCamera(), renderPassObjects);
                 renderPasses[basePassIndex] = RenderPass(renderFrame.GetAmbientRenderLight(), std::move(renderPassObjects));
             });
@@ -340,31 +318,48 @@ namespace ChilliSource
             for (const auto& directionalLight : renderFrame.GetDirectionalRenderLights())
             {
                 u32 directionLightPassIndex = nextPassIndex++;
-                tasks.push_back([=, &renderPasses, &renderFrame, &visibleStandardRenderObjects, &directionalLight](const TaskContext& innerTaskContext)
+                tasks.push_back([=, &renderPasses, &renderFrame, &renderObjects, &visibleStandardRenderObjectIndices, &directionalLight](const TaskContext& innerTaskContext)
                 {
-                    auto renderPassObjects = GetDirectionalLightRenderPassObjects(visibleStandardRenderObjects, directionalLight);
+                    auto renderPassObjects = GetDirectionalLightRenderPassObjects(renderObjects, visibleStandardRenderObjectIndices, directionalLight);
                     RenderPassObjectSorter::OpaqueSort(renderFrame.GetRenderCamera(), renderPassObjects);
                     renderPasses[directionLightPassIndex] = RenderPass(directionalLight, std::move(renderPassObjects));
                 });
             }
             
-            // Point light pass
-            for (const auto& pointLight : renderFrame.GetPointRenderLights())
+            // Point light passes. The bounding spheres of the visible objects are gathered once and shared by every
+            // light, then the passes are built as a single batched parallel for, rather than a task per light, so that
+            // scenes with many lights don't flood the task pool with tiny tasks.
+            u32 firstPointLightPassIndex = nextPassIndex;
+            u32 numPointLights = u32(renderFrame.GetPointRenderLights().size());
+            nextPassIndex += numPointLights;
+            if (numPointLights > 0)
             {
-                u32 pointLightPassIndex = nextPassIndex++;
-                tasks.push_back([=, &renderPasses, &renderFrame, &visibleStandardRenderObjects, &pointLight](const TaskContext& innerTaskContext)
+                tasks.push_back([=, &renderPasses, &renderFrame, &renderObjects, &visibleStandardRenderObjectIndices](const TaskContext& innerTaskContext)
                 {
-                    auto renderPassObjects = GetPointLightRenderPassObjects(visibleStandardRenderObjects, pointLight);
-                    RenderPassObjectSorter::OpaqueSort(renderFrame.GetRenderCamera(), renderPassObjects);
-                    renderPasses[pointLightPassIndex] = RenderPass(pointLight, std::move(renderPassObjects));
+                    SphereBatch visibleBoundingSpheres(u32(visibleStandardRenderObjectIndices.size()));
+                    for (u32 index = 0; index < u32(visibleStandardRenderObjectIndices.size()); ++index)
+                    {
+                        visibleBoundingSpheres.Set(index, renderObjects[visibleStandardRenderObjectIndices[index]].GetBoundingSphere());
+                    }
+                    
+                    innerTaskContext.ParallelFor(numPointLights, 1, [&](const TaskContext& lightTaskContext, u32 startIndex, u32 endIndex)
+                    {
+                        for (u32 lightIndex = startIndex; lightIndex < endIndex; ++lightIndex)
+                        {
+                            const auto& pointLight = renderFrame.GetPointRenderLights()[lightIndex];
+                            auto renderPassObjects = GetPointLightRenderPassObjects(renderObjects, visibleStandardRenderObjectIndices, visibleBoundingSpheres, pointLight);
+                            RenderPassObjectSorter::OpaqueSort(renderFrame.GetRenderCamera(), renderPassObjects);
+                            renderPasses[firstPointLightPassIndex + lightIndex] = RenderPass(pointLight, std::move(renderPassObjects));
+                        }
+                    });
                 });
             }
             
             // Transparent pass
             u32 transparentPassIndex = nextPassIndex++;
-            tasks.push_back([=, &renderPasses, &renderFrame, &visibleStandardRenderObjects](const TaskContext& innerTaskContext)
+            tasks.push_back([=, &renderPasses, &renderFrame, &renderObjects, &visibleStandardRenderObjectIndices](const TaskContext& innerTaskContext)
             {
-                auto renderPassObjects = GetTransparentRenderPassObjects(visibleStandardRenderObjects);
+                auto renderPassObjects = GetTransparentRenderPassObjects(renderObjects, visibleStandardRenderObjectIndices);
                 RenderPassObjectSorter::TransparentSort(renderFrame.GetRenderCamera(), renderPassObjects);
                 renderPasses[transparentPassIndex] = RenderPass(renderFrame.GetAmbientRenderLight(), std::move(renderPassObjects));
             });
@@ -392,11 +387,12 @@ namespace ChilliSource
             auto projMatrix = Matrix4::CreateOrthographicProjectionLH(0, f32(renderFrame.GetResolution().x), 0, f32(renderFrame.GetResolution().y), k_near, k_far);
             RenderCamera uiCamera(Matrix4::k_identity, projMatrix, Quaternion::k_identity);
             
-            auto uiRenderObjects = GetLayerRenderObjects(RenderLayer::k_ui, renderFrame.GetRenderObjects());
-            auto visibleUIRenderObjects = RenderPassVisibilityChecker::CalculateVisibleObjects(taskContext, uiCamera, uiRenderObjects);
+            const auto& renderObjects = renderFrame.GetRenderObjects();
+            auto uiRenderObjectIndices = GetLayerRenderObjectIndices(RenderLayer::k_ui, renderObjects);
+            auto visibleUIRenderObjectIndices = RenderPassVisibilityChecker::CalculateVisibleObjects(taskContext, uiCamera, renderObjects, uiRenderObjectIndices);
             
-            auto uiRenderPassObjects = GetTransparentRenderPassObjects(visibleUIRenderObjects);
-            CS_ASSERT(visibleUIRenderObjects.size() == uiRenderPassObjects.size(), "Invalid number of render pass objects in transparent pass. All render objects in the UI layer should have a transparent material.");
+            auto uiRenderPassObjects = GetTransparentRenderPassObjects(renderObjects, visibleUIRenderObjectIndices);
+            CS_ASSERT(visibleUIRenderObjectIndices.size() == uiRenderPassObjects.size(), "Invalid number of render pass objects in transparent pass. All render objects in the UI layer should have a transparent material.");
             
             RenderPassObjectSorter::PrioritySort(uiRenderPassObjects);
             
@@ -453,21 +449,28 @@ namespace ChilliSource
         ///     Context to manage any spawned tasks
         /// @param renderFrame
         ///     Current frame data
+        /// Casters are culled and sorted against the light camera for the cascade rather than
+        /// the main camera, so objects outside of the view which cast shadows into it are still
+        /// rendered, while objects outside of the cascade are not.
+        ///
         /// @param directionalRenderLight
         ///     The directional light that should have a shadow map built for it.
+        /// @param cascadeIndex
+        ///     The index of the shadow cascade to build the shadow map for.
         ///
         /// @return The TargetRenderPassGroup
         ///
-        TargetRenderPassGroup CompileShadowMapTargetRenderPassGroup(const TaskContext& taskContext, const RenderFrame& renderFrame, const DirectionalRenderLight& directionalRenderLight) noexcept
+        TargetRenderPassGroup CompileShadowMapTargetRenderPassGroup(const TaskContext& taskContext, const RenderFrame& renderFrame, const DirectionalRenderLight& directionalRenderLight, u32 cascadeIndex) noexcept
         {
-            CS_ASSERT(directionalRenderLight.GetShadowMapTarget(), "Cannot compile shadow map target with light that has no shadow map target.");
+            CS_ASSERT(cascadeIndex < directionalRenderLight.GetNumShadowCascades(), "Cannot compile shadow map target for a cascade the light does not have.");
             
-            RenderCamera camera(directionalRenderLight.GetLightWorldMatrix(), directionalRenderLight.GetLightProjectionMatrix(), directionalRenderLight.GetLightOrientation());
+            RenderCamera camera(directionalRenderLight.GetLightWorldMatrix(), directionalRenderLight.GetLightProjectionMatrix(cascadeIndex), directionalRenderLight.GetLightOrientation());
             
-            auto standardRenderObjects = GetLayerRenderObjects(RenderLayer::k_standard, renderFrame.GetRenderObjects());
-            auto visibleStandardRenderObjects = RenderPassVisibilityChecker::CalculateVisibleObjects(taskContext, renderFrame.GetRenderCamera(), standardRenderObjects);
-            auto renderPassObjects = GetShadowMapRenderPassObjects(visibleStandardRenderObjects);
-            RenderPassObjectSorter::OpaqueSort(renderFrame.GetRenderCamera(), renderPassObjects);
+            const auto& renderObjects = renderFrame.GetRenderObjects();
+            auto standardRenderObjectIndices = GetLayerRenderObjectIndices(RenderLayer::k_standard, renderObjects);
+            auto visibleStandardRenderObjectIndices = RenderPassVisibilityChecker::CalculateVisibleObjects(taskContext, camera, renderObjects, standardRenderObjectIndices);
+            auto renderPassObjects = GetShadowMapRenderPassObjects(renderObjects, visibleStandardRenderObjectIndices);
+            RenderPassObjectSorter::OpaqueSort(camera, renderPassObjects);
             RenderPass renderPass(std::move(renderPassObjects));
             
             std::vector<RenderPass> renderPasses;
@@ -476,40 +479,44 @@ namespace ChilliSource
             
             std::vector<CameraRenderPassGroup> cameraRenderPassGroups;
             cameraRenderPassGroups.push_back(std::move(cameraRenderPassGroup));
-            return TargetRenderPassGroup(directionalRenderLight.GetShadowMapTarget(), Colour::k_black, std::move(cameraRenderPassGroups));
+            return TargetRenderPassGroup(directionalRenderLight.GetShadowMapTarget(cascadeIndex), Colour::k_black, std::move(cameraRenderPassGroups));
         }
     }
     
     //------------------------------------------------------------------------------
-    std::vector<TargetRenderPassGroup> ForwardRenderPassCompiler::CompileTargetRenderPassGroups(const TaskContext& taskContext, const RenderFrame& renderFrame) noexcept
+    u32 ForwardRenderPassCompiler::GetNumTargets(const RenderFrame& renderFrame) const noexcept
     {
-        auto numTargets = CalcNumTargets(renderFrame);
-        std::vector<TargetRenderPassGroup> targetRenderPassGroups(numTargets);
-        std::vector<Task> tasks;
-        u32 nextPassIndex = 0;
+        // The main target
+        constexpr u32 k_reservedTargets = 1;
+        
+        u32 numShadowMaps = 0;
+        for (const auto& directionalRenderLight : renderFrame.GetDirectionalRenderLights())
+        {
+            numShadowMaps += directionalRenderLight.GetNumShadowCascades();
+        }
+        
+        return k_reservedTargets + numShadowMaps;
+    }
+    
+    //------------------------------------------------------------------------------
+    TargetRenderPassGroup ForwardRenderPassCompiler::CompileTargetRenderPassGroup(const TaskContext& taskContext, const RenderFrame& renderFrame, u32 targetIndex) noexcept
+    {
+        CS_ASSERT(targetIndex < GetNumTargets(renderFrame), "Target index out of bounds.");
         
         // Shadow targets
+        u32 shadowTargetIndex = 0;
         for (const auto& directionalRenderLight : renderFrame.GetDirectionalRenderLights())
         {
-            if (directionalRenderLight.GetShadowMapTarget())
+            auto numShadowCascades = directionalRenderLight.GetNumShadowCascades();
+            if (targetIndex < shadowTargetIndex + numShadowCascades)
             {
-                u32 shadowPassIndex = nextPassIndex++;
-                tasks.push_back([=, &targetRenderPassGroups, &renderFrame, &directionalRenderLight](const TaskContext& innerTaskContext)
-                {
-                    targetRenderPassGroups[shadowPassIndex] = CompileShadowMapTargetRenderPassGroup(innerTaskContext, renderFrame, directionalRenderLight);
-                });
+                return CompileShadowMapTargetRenderPassGroup(taskContext, renderFrame, directionalRenderLight, targetIndex - shadowTargetIndex);
             }
+            
+            shadowTargetIndex += numShadowCascades;
         }
         
         // Main target
-        u32 mainPassIndex = nextPassIndex++;
-        tasks.push_back([=, &targetRenderPassGroups, &renderFrame](const TaskContext& innerTaskContext)
-        {
-            targetRenderPassGroups[mainPassIndex] = CompileMainTargetRenderPassGroup(innerTaskContext, renderFrame);
-        });
-        
-        taskContext.ProcessChildTasks(tasks);
-        
-        return targetRenderPassGroups;
+        return CompileMainTargetRenderPassGroup(taskContext, renderFrame);
     }
 }
\ No newline at end of file
@@ -45,16 +45,30 @@ namespace ChilliSource
     {
     public:
         
-        /// Gather all render objects in the frame into a list of target render pass groups.
+        /// Calculates the number of targets which the given frame will be rendered to. This is
+        /// a target for each shadow map cascade, plus the main target.
+        ///
+        /// @param renderFrame
+        ///     Current frame data
+        ///
+        /// @return The number of targets.
+        ///
+        u32 GetNumTargets(const RenderFrame& renderFrame) const noexcept override;
+        
+        /// Gather all render objects in the frame which are relevant to the given target into a
+        /// target render pass group. The shadow map targets come first, in light and cascade
+        /// order, followed by the main target.
         ///
         /// @param taskContext
         ///     Context to manage any spawned tasks
         /// @param renderFrame
         ///     Current frame data
+        /// @param targetIndex
+        ///     The index of the target. Must be less than GetNumTargets().
         ///
-        /// @return The list of target render pass groups
+        /// @return The target render pass group.
         ///
-        std::vector<TargetRenderPassGroup> CompileTargetRenderPassGroups(const TaskContext& taskContext, const RenderFrame& renderFrame) noexcept override;
+        TargetRenderPassGroup CompileTargetRenderPassGroup(const TaskContext& taskContext, const RenderFrame& renderFrame, u32 targetIndex) noexcept override;
     };
 }
 
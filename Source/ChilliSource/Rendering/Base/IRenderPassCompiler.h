@@ -42,16 +42,30 @@ namespace ChilliSource
     {
     public:
         
-        /// Gather all render objects in the frame into a list of target render pass groups.
+        /// Calculates the number of targets which the given frame will be rendered to. Each target
+        /// can be compiled independently of the others, allowing them to be processed as separate
+        /// nodes in the render prep task graph.
+        ///
+        /// @param renderFrame
+        ///     Current frame data
+        ///
+        /// @return The number of targets.
+        ///
+        virtual u32 GetNumTargets(const RenderFrame& renderFrame) const noexcept = 0;
+        
+        /// Gather all render objects in the frame which are relevant to the given target into a
+        /// target render pass group. Targets are rendered in index order.
         ///
         /// @param taskContext
         ///     Context to manage any spawned tasks
         /// @param renderFrame
         ///     Current frame data
+        /// @param targetIndex
+        ///     The index of the target. Must be less than GetNumTargets().
         ///
-        /// @return The list of target render pass groups
+        /// @return The target render pass group.
         ///
-        virtual std::vector<TargetRenderPassGroup> CompileTargetRenderPassGroups(const TaskContext& taskContext, const RenderFrame& renderFrame) noexcept = 0;
+        virtual TargetRenderPassGroup CompileTargetRenderPassGroup(const TaskContext& taskContext, const RenderFrame& renderFrame, u32 targetIndex) noexcept = 0;
         
         virtual ~IRenderPassCompiler() noexcept {};
         
@@ -36,12 +36,12 @@ namespace ChilliSource
     RenderCapabilitiesUPtr RenderCapabilities::Create(const RenderInfo& renderInfo) noexcept
     {
         return RenderCapabilitiesUPtr(new RenderCapabilities(renderInfo.IsShadowMappingSupported(), renderInfo.IsDepthTextureSupported(), renderInfo.IsMapBufferSupported(),
-                                                             renderInfo.IsHighPrecisionFloatsSupported(), renderInfo.GetMaxTextureSize(), renderInfo.GetNumTextureUnits()));
+                                                             renderInfo.IsHighPrecisionFloatsSupported(), renderInfo.IsInstancingSupported(), renderInfo.GetMaxTextureSize(), renderInfo.GetNumTextureUnits()));
     }
     
     //-------------------------------------------------------
-    RenderCapabilities::RenderCapabilities(bool isShadowMapsSupported, bool isDepthTexturesSupported, bool isMapBuffersSupported, bool isHighPrecisionFloatsSupported, u32 maxTextureSize, u32 numTextureUnits)
-    : m_isShadowMapsSupported(isShadowMapsSupported), m_isDepthTexturesSupported(isDepthTexturesSupported), m_isMapBuffersSupported(isMapBuffersSupported), m_isHighPrecisionFloatsSupported(isHighPrecisionFloatsSupported), m_maxTextureSize(maxTextureSize), m_maxTextureUnits(numTextureUnits)
+    RenderCapabilities::RenderCapabilities(bool isShadowMapsSupported, bool isDepthTexturesSupported, bool isMapBuffersSupported, bool isHighPrecisionFloatsSupported, bool isInstancingSupported, u32 maxTextureSize, u32 numTextureUnits)
+    : m_isShadowMapsSupported(isShadowMapsSupported), m_isDepthTexturesSupported(isDepthTexturesSupported), m_isMapBuffersSupported(isMapBuffersSupported), m_isHighPrecisionFloatsSupported(isHighPrecisionFloatsSupported), m_isInstancingSupported(isInstancingSupported), m_maxTextureSize(maxTextureSize), m_maxTextureUnits(numTextureUnits)
     {
     }
     
@@ -75,6 +75,12 @@ namespace ChilliSource
         return m_isHighPrecisionFloatsSupported;
     }
     
+    //-------------------------------------------------------
+    bool RenderCapabilities::IsInstancingSupported() const noexcept
+    {
+        return m_isInstancingSupported;
+    }
+    
     //-------------------------------------------------------
     u32 RenderCapabilities::GetMaxTextureSize() const noexcept
     {
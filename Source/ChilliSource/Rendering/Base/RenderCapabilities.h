@@ -82,6 +82,12 @@ namespace ChilliSource
         ///
         bool IsHighPrecisionFloatsSupported() const noexcept;
         
+        /// @return Whether or not hardware instanced drawing is supported. If it is, consecutive
+        ///     objects which share a material and mesh will be rendered with a single instanced
+        ///     draw call.
+        ///
+        bool IsInstancingSupported() const noexcept;
+        
         /// @return The maximum texture size available on this device.
         ///
         u32 GetMaxTextureSize() const noexcept;
@@ -100,12 +106,14 @@ namespace ChilliSource
         ///         Whether or not map buffer is supported.
         /// @param isHighPrecisionFloatsSupported
         ///         Whether or not the fragment shader supports highp floats.
+        /// @param isInstancingSupported
+        ///         Whether or not hardware instanced drawing is supported.
         /// @param maxTextureSize
         ///         The maximum texture size available on this device.
         /// @param numTextureUnits
         ///         The number of texture units supported by this device.
         ///
-        RenderCapabilities(bool isShadowMapsSupported, bool isDepthTexturesSupported, bool isMapBuffersSupported, bool isHighPrecisionFloatsSupported, u32 maxTextureSize, u32 numTextureUnits);
+        RenderCapabilities(bool isShadowMapsSupported, bool isDepthTexturesSupported, bool isMapBuffersSupported, bool isHighPrecisionFloatsSupported, bool isInstancingSupported, u32 maxTextureSize, u32 numTextureUnits);
         
     private:
         
@@ -113,6 +121,7 @@ namespace ChilliSource
         bool m_isDepthTexturesSupported;
         bool m_isMapBuffersSupported;
         bool m_isHighPrecisionFloatsSupported;
+        bool m_isInstancingSupported;
         
         u32 m_maxTextureSize;
         u32 m_maxTextureUnits;
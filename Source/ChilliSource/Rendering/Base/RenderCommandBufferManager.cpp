@@ -31,6 +31,7 @@
 #include <ChilliSource/Rendering/RenderCommand/Commands/LoadMeshRenderCommand.h>
 #include <ChilliSource/Rendering/RenderCommand/Commands/LoadShaderRenderCommand.h>
 #include <ChilliSource/Rendering/RenderCommand/Commands/LoadTextureRenderCommand.h>
+#include <ChilliSource/Rendering/RenderCommand/Commands/StreamTextureRenderCommand.h>
 #include <ChilliSource/Rendering/RenderCommand/Commands/UnloadMaterialGroupRenderCommand.h>
 #include <ChilliSource/Rendering/RenderCommand/Commands/UnloadMeshRenderCommand.h>
 #include <ChilliSource/Rendering/RenderCommand/Commands/UnloadShaderRenderCommand.h>
@@ -110,7 +111,12 @@ namespace ChilliSource
             
             for(auto& command : m_pendingTextureLoadCommands)
             {
-                preRenderCommandList->AddLoadTextureCommand(command.GetRenderTexture(), command.ClaimTextureData(), command.GetTextureDataSize());
+                preRenderCommandList->AddLoadTextureCommand(command.GetRenderTexture(), command.ClaimTextureData(), command.GetTextureDataSize(), command.GetFirstMipLevel());
+            }
+            
+            for(auto& command : m_pendingTextureStreamCommands)
+            {
+                preRenderCommandList->AddStreamTextureCommand(command.GetRenderTexture(), command.ClaimTextureData(), command.GetTextureDataSize(), command.GetFirstMipLevel(), command.GetMipLevel(), command.GetFirstRow());
             }
             
             for(auto& command : m_pendingMeshLoadCommands)
@@ -145,6 +151,7 @@ namespace ChilliSource
             
             m_pendingShaderLoadCommands.clear();
             m_pendingTextureLoadCommands.clear();
+            m_pendingTextureStreamCommands.clear();
             m_pendingMeshLoadCommands.clear();
             m_pendingMaterialGroupLoadCommands.clear();
             m_pendingShaderUnloadCommands.clear();
@@ -170,9 +177,9 @@ namespace ChilliSource
     {
         std::unique_lock<std::mutex>(m_commandBufferMutex);
         
-        for(u32 i = 0; i < renderCommandList->GetNumCommands(); ++i)
+        for(auto renderCommand : *renderCommandList)
         {
-            RecycleCommand(renderCommandList->GetCommand(i));
+            RecycleCommand(renderCommand);
         }
     }
     //------------------------------------------------------------------------------
@@ -192,6 +199,12 @@ namespace ChilliSource
                 m_pendingTextureLoadCommands.push_back(std::move(*command));
                 break;
             }
+            case RenderCommand::Type::k_streamTexture:
+            {
+                StreamTextureRenderCommand* command = static_cast<StreamTextureRenderCommand*>(renderCommand);
+                m_pendingTextureStreamCommands.push_back(std::move(*command));
+                break;
+            }
             case RenderCommand::Type::k_loadMesh:
             {
                 LoadMeshRenderCommand* command = static_cast<LoadMeshRenderCommand*>(renderCommand);
@@ -33,6 +33,7 @@
 #include <ChilliSource/Rendering/RenderCommand/Commands/LoadMeshRenderCommand.h>
 #include <ChilliSource/Rendering/RenderCommand/Commands/LoadShaderRenderCommand.h>
 #include <ChilliSource/Rendering/RenderCommand/Commands/LoadTextureRenderCommand.h>
+#include <ChilliSource/Rendering/RenderCommand/Commands/StreamTextureRenderCommand.h>
 #include <ChilliSource/Rendering/RenderCommand/Commands/UnloadMaterialGroupRenderCommand.h>
 #include <ChilliSource/Rendering/RenderCommand/Commands/UnloadMeshRenderCommand.h>
 #include <ChilliSource/Rendering/RenderCommand/Commands/UnloadShaderRenderCommand.h>
@@ -159,6 +160,7 @@ namespace ChilliSource
         
         std::vector<LoadShaderRenderCommand> m_pendingShaderLoadCommands;
         std::vector<LoadTextureRenderCommand> m_pendingTextureLoadCommands;
+        std::vector<StreamTextureRenderCommand> m_pendingTextureStreamCommands;
         std::vector<LoadMeshRenderCommand> m_pendingMeshLoadCommands;
         std::vector<LoadMaterialGroupRenderCommand> m_pendingMaterialGroupLoadCommands;
         
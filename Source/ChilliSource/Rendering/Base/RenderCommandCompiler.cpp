@@ -24,11 +24,14 @@
 
 #include <ChilliSource/Rendering/Base/RenderCommandCompiler.h>
 
+#include <ChilliSource/Core/Base/Application.h>
 #include <ChilliSource/Core/Threading/TaskScheduler.h>
 #include <ChilliSource/Rendering/Base/CameraRenderPassGroup.h>
+#include <ChilliSource/Rendering/Base/RenderCapabilities.h>
 #include <ChilliSource/Rendering/Base/RenderPass.h>
 #include <ChilliSource/Rendering/Base/TargetRenderPassGroup.h>
 #include <ChilliSource/Rendering/Model/SmallMeshBatcher.h>
+#include <ChilliSource/Rendering/RenderCommand/Commands/RenderInstancesRenderCommand.h>
 #include <ChilliSource/Rendering/Target/RenderTargetGroup.h>
 
 namespace ChilliSource
@@ -66,50 +69,27 @@ namespace ChilliSource
             return false;
         }
         
-        /// Calculates the number of render command lists required to process the given list
-        /// of target render pass groups, and pre and post command lists.
+        /// Calculates the number of render command lists required to process the given
+        /// target render pass group.
         ///
-        /// @param targetRenderPassGroups
-        ///     The list of target render pass groups.
-        /// @param preRenderCommandList
-        ///     The render command list that should be inserted at the beginning of the queue if
-        ///     the list contains any commands.
-        /// @param postRenderCommandList
-        ///     The render command list that should be inserted at the end of the queue if
-        ///     the list contains any commands.
+        /// @param targetRenderPassGroup
+        ///     The target render pass group.
         ///
         /// @return The number of render command lists required.
         ///
-        u32 CalcNumRenderCommandLists(const std::vector<TargetRenderPassGroup>& targetRenderPassGroups, const RenderCommandList* preRenderCommandList, const RenderCommandList* postRenderCommandList) noexcept
+        u32 CalcNumRenderCommandLists(const TargetRenderPassGroup& targetRenderPassGroup) noexcept
         {
-            u32 count = 0;
-            
-            if (preRenderCommandList->GetOrderedList().size() > 0)
-            {
-                ++count;
-            }
+            u32 count = 2; // target setup and cleanup
             
-            for (const auto& targetRenderPassGroup : targetRenderPassGroups)
+            for (const auto& cameraRenderPassGroup : targetRenderPassGroup.GetRenderCameraGroups())
             {
-                ++count; // target setup
-                
-                for (const auto& cameraRenderPassGroup : targetRenderPassGroup.GetRenderCameraGroups())
+                for (const auto& renderPass : cameraRenderPassGroup.GetRenderPasses())
                 {
-                    for (const auto& renderPass : cameraRenderPassGroup.GetRenderPasses())
+                    if (renderPass.GetRenderPassObjects().size() > 0)
                     {
-                        if (renderPass.GetRenderPassObjects().size() > 0)
-                        {
-                            ++count;
-                        }
+                        ++count;
                     }
                 }
-                
-                ++count; // target cleanup
-            }
-            
-            if (postRenderCommandList->GetOrderedList().size() > 0)
-            {
-                ++count;
             }
             
             return count;
@@ -160,17 +140,20 @@ namespace ChilliSource
                 case RenderPass::LightType::k_directional:
                 {
                     const auto& directionalLight = renderPass.GetDirectionalLight();
-                    auto viewProj = Matrix4::Inverse(directionalLight.GetLightWorldMatrix()) * directionalLight.GetLightProjectionMatrix();
+                    auto lightView = Matrix4::Inverse(directionalLight.GetLightWorldMatrix());
                     
-                    const auto& shadowMapTarget = directionalLight.GetShadowMapTarget();
-                    const RenderTexture* shadowMapTexture = nullptr;
-                    if (shadowMapTarget)
+                    std::array<Matrix4, DirectionalRenderLight::k_maxShadowCascades> viewProjs;
+                    std::array<const RenderTexture*, DirectionalRenderLight::k_maxShadowCascades> shadowMapTextures = {{ nullptr, nullptr, nullptr, nullptr }};
+                    for (u32 i = 0; i < directionalLight.GetNumShadowCascades(); ++i)
                     {
-                        shadowMapTexture = shadowMapTarget->GetDepthTarget();
-                        CS_ASSERT(shadowMapTexture, "Shadow map target must have depth texture.");
+                        viewProjs[i] = lightView * directionalLight.GetLightProjectionMatrix(i);
+                        
+                        shadowMapTextures[i] = directionalLight.GetShadowMapTarget(i)->GetDepthTarget();
+                        CS_ASSERT(shadowMapTextures[i], "Shadow map target must have depth texture.");
                     }
                     
-                    renderCommandList->AddApplyDirectionalLightCommand(directionalLight.GetColour(), directionalLight.GetDirection(), viewProj, directionalLight.GetShadowTolerance(), shadowMapTexture);
+                    renderCommandList->AddApplyDirectionalLightCommand(directionalLight.GetColour(), directionalLight.GetDirection(), viewProjs, directionalLight.GetShadowTolerance(), shadowMapTextures,
+                                                                       directionalLight.GetNumShadowCascades());
                     break;
                 }
                 case RenderPass::LightType::k_point:
@@ -286,17 +269,81 @@ namespace ChilliSource
             }
         }
         
+        /// Calculates the number of consecutive render pass objects, starting at the given index,
+        /// which can be rendered as instances of the same mesh. This is only the case for static,
+        /// non-animated, objects which share the same material and mesh and cannot be batched.
+        ///
+        /// @param renderPassObjects
+        ///     The list of render pass objects.
+        /// @param startIndex
+        ///     The index of the first object in the run.
+        ///
+        /// @return The number of objects in the run. This will be 1 if the object at the start
+        ///     index cannot be instanced.
+        ///
+        u32 CalcNumInstanceableObjects(const std::vector<RenderPassObject>& renderPassObjects, u32 startIndex) noexcept
+        {
+            const auto& first = renderPassObjects[startIndex];
+            if (first.GetType() != RenderPassObject::Type::k_static || SmallMeshBatcher::CanBatch(first))
+            {
+                return 1;
+            }
+            
+            u32 endIndex = startIndex + 1;
+            while (endIndex < u32(renderPassObjects.size()) && endIndex - startIndex < RenderInstancesRenderCommand::k_maxInstances)
+            {
+                const auto& renderPassObject = renderPassObjects[endIndex];
+                if (renderPassObject.GetType() != RenderPassObject::Type::k_static || renderPassObject.GetRenderMaterial() != first.GetRenderMaterial() ||
+                    renderPassObject.GetRenderMesh() != first.GetRenderMesh() || SmallMeshBatcher::CanBatch(renderPassObject))
+                {
+                    break;
+                }
+                
+                ++endIndex;
+            }
+            
+            return endIndex - startIndex;
+        }
+        
+        /// Adds a new render instances command for the given run of render pass objects.
+        ///
+        /// @param renderPassObjects
+        ///     The list of render pass objects.
+        /// @param startIndex
+        ///     The index of the first object in the run.
+        /// @param numInstances
+        ///     The number of objects in the run.
+        /// @param renderCommandList
+        ///     The render command list to add the command to.
+        /// @param worldMatrices
+        ///     Scratch storage used to gather the world matrices of each instance.
+        ///
+        void AddRenderInstancesCommand(const std::vector<RenderPassObject>& renderPassObjects, u32 startIndex, u32 numInstances, RenderCommandList* renderCommandList, std::vector<Matrix4>& worldMatrices) noexcept
+        {
+            worldMatrices.clear();
+            
+            for (u32 i = startIndex; i < startIndex + numInstances; ++i)
+            {
+                worldMatrices.push_back(renderPassObjects[i].GetWorldMatrix());
+            }
+            
+            renderCommandList->AddRenderInstancesCommand(worldMatrices.data(), numInstances);
+        }
+        
         /// Compiles the render commands for the given render pass. The render pass must contain
         /// render pass objects otherwise this will assert.
         ///
+        /// If instancing is enabled, consecutive static objects which share the same material
+        /// and mesh will be collapsed into a single render instances command.
+        ///
         /// @param renderPass
         ///     The render pass.
         /// @param renderCommandList
         ///     The render command list to add the commands to.
-        /// @param renderFrameData
-        ///     Container for all allocations which must live until the end of the frame.
+        /// @param isInstancingEnabled
+        ///     Whether or not render instances commands should be generated.
         ///
-        void CompileRenderCommandsForPass(const RenderPass& renderPass, RenderCommandList* renderCommandList) noexcept
+        void CompileRenderCommandsForPass(const RenderPass& renderPass, RenderCommandList* renderCommandList, bool isInstancingEnabled) noexcept
         {
             AddApplyLightCommand(renderPass, renderCommandList);
             
@@ -305,9 +352,13 @@ namespace ChilliSource
             
             RenderCommandListStateCache cache;
             SmallMeshBatcher batcher(renderCommandList);
+            std::vector<Matrix4> worldMatrices;
             
-            for (const auto& renderPassObject : renderPassObjects)
+            u32 index = 0;
+            while (index < u32(renderPassObjects.size()))
             {
+                const auto& renderPassObject = renderPassObjects[index];
+                
                 AddApplyMaterialCommand(renderPassObject, renderCommandList, cache, batcher);
                 
                 if (SmallMeshBatcher::CanBatch(renderPassObject))
@@ -316,6 +367,7 @@ namespace ChilliSource
                     cache.m_dynamicMesh = nullptr;
                 
                     batcher.Batch(renderPassObject);
+                    ++index;
                 }
                 else
                 {
@@ -323,9 +375,19 @@ namespace ChilliSource
                     
                     AddApplyMeshCommand(renderPassObject, renderCommandList, cache);
                     AddApplySkinnedAnimationCommand(renderPassObject, renderCommandList, cache);
-                    renderCommandList->AddRenderInstanceCommand(renderPassObject.GetWorldMatrix());
+                    
+                    u32 numInstances = isInstancingEnabled ? CalcNumInstanceableObjects(renderPassObjects, index) : 1;
+                    if (numInstances > 1)
+                    {
+                        AddRenderInstancesCommand(renderPassObjects, index, numInstances, renderCommandList, worldMatrices);
+                    }
+                    else
+                    {
+                        renderCommandList->AddRenderInstanceCommand(renderPassObject.GetWorldMatrix());
+                    }
+                    
+                    index += numInstances;
                 }
-                
             }
             
             batcher.Flush();
@@ -333,57 +395,54 @@ namespace ChilliSource
     }
     
     //------------------------------------------------------------------------------
-    RenderCommandBufferUPtr RenderCommandCompiler::CompileRenderCommands(const TaskContext& taskContext, const std::vector<TargetRenderPassGroup>& targetRenderPassGroups, RenderCommandListUPtr preRenderCommandList,
-                                                                          RenderCommandListUPtr postRenderCommandList, RenderFrameData renderFrameData) noexcept
+    std::vector<RenderCommandListUPtr> RenderCommandCompiler::CompileTargetRenderCommands(const TaskContext& taskContext, const TargetRenderPassGroup& targetRenderPassGroup, RenderCommandBuffer* renderCommandBuffer) noexcept
     {
-        u32 numLists = CalcNumRenderCommandLists(targetRenderPassGroups, preRenderCommandList.get(), postRenderCommandList.get());
-        RenderCommandBufferUPtr renderCommandBuffer(new RenderCommandBuffer(numLists, std::move(renderFrameData)));
+        bool isInstancingEnabled = Application::Get()->GetSystem<RenderCapabilities>()->IsInstancingSupported();
+        
+        std::vector<RenderCommandListUPtr> renderCommandLists;
+        renderCommandLists.reserve(CalcNumRenderCommandLists(targetRenderPassGroup));
         std::vector<Task> tasks;
-        u32 currentList = 0;
         
-        if (preRenderCommandList->GetOrderedList().size() > 0)
-        {
-            *renderCommandBuffer->GetRenderCommandList(currentList++) = std::move(*preRenderCommandList);
-        }
+        renderCommandLists.push_back(renderCommandBuffer->CreateRenderCommandList());
+        AddBeginCommand(targetRenderPassGroup, renderCommandLists.back().get());
         
-        for (const auto& targetRenderPassGroup : targetRenderPassGroups)
+        for (const auto& cameraRenderPassGroup : targetRenderPassGroup.GetRenderCameraGroups())
         {
-            AddBeginCommand(targetRenderPassGroup, renderCommandBuffer->GetRenderCommandList(currentList++));
-                
-            for (const auto& cameraRenderPassGroup : targetRenderPassGroup.GetRenderCameraGroups())
+            if (ContainsRenderPassObject(cameraRenderPassGroup))
             {
-                if (ContainsRenderPassObject(cameraRenderPassGroup))
+                bool isCameraApplied = false;
+                
+                for (const auto& renderPass : cameraRenderPassGroup.GetRenderPasses())
                 {
-                    const auto& camera = cameraRenderPassGroup.GetCamera();
-                    renderCommandBuffer->GetRenderCommandList(currentList)->AddApplyCameraCommand(camera.GetWorldMatrix().GetTranslation(), camera.GetViewProjectionMatrix());
-                    
-                    for (const auto& renderPass : cameraRenderPassGroup.GetRenderPasses())
+                    if (renderPass.GetRenderPassObjects().size() > 0)
                     {
-                        if (renderPass.GetRenderPassObjects().size() > 0)
+                        renderCommandLists.push_back(renderCommandBuffer->CreateRenderCommandList());
+                        auto renderCommandList = renderCommandLists.back().get();
+                        
+                        if (!isCameraApplied)
                         {
-                            auto renderCommandList = renderCommandBuffer->GetRenderCommandList(currentList++);
-                            tasks.push_back([=, &renderPass, &renderCommandBuffer](const TaskContext& innerTaskContext)
-                            {
-                                CompileRenderCommandsForPass(renderPass, renderCommandList);
-                            });
+                            const auto& camera = cameraRenderPassGroup.GetCamera();
+                            renderCommandList->AddApplyCameraCommand(camera.GetWorldMatrix().GetTranslation(), camera.GetViewProjectionMatrix());
+                            isCameraApplied = true;
                         }
+                        
+                        tasks.push_back([=, &renderPass](const TaskContext& innerTaskContext)
+                        {
+                            CompileRenderCommandsForPass(renderPass, renderCommandList, isInstancingEnabled);
+                        });
                     }
                 }
             }
-            
-            renderCommandBuffer->GetRenderCommandList(currentList++)->AddEndCommand();
         }
         
-        if (postRenderCommandList->GetOrderedList().size() > 0)
-        {
-            *renderCommandBuffer->GetRenderCommandList(currentList++) = std::move(*postRenderCommandList);
-        }
+        renderCommandLists.push_back(renderCommandBuffer->CreateRenderCommandList());
+        renderCommandLists.back()->AddEndCommand();
         
         if (tasks.size() > 0)
         {
             taskContext.ProcessChildTasks(tasks);
         }
         
-        return std::move(renderCommandBuffer);
+        return renderCommandLists;
     }
 }
@@ -37,28 +37,26 @@ namespace ChilliSource
     ///
     namespace RenderCommandCompiler
     {
-        /// Performs the Compile Render Commands stage of the render pipeline. This takes the
-        /// render passes generated during the Compile Render Passes stage and breaks them down
-        /// into a series of render commands. The output is an immutable render command buffer.
+        /// Performs the Compile Render Commands stage of the render pipeline for a single
+        /// target. This takes the render passes generated for the target during the Compile
+        /// Render Passes stage and breaks them down into a series of render command lists:
+        /// the target setup list, a list for each non-empty render pass, then the target
+        /// cleanup list. Each target can be compiled independently of the others, allowing
+        /// this to be run as a node in the render prep task graph.
         ///
         /// @param taskContext
         ///     The task context that child tasks should be run within. This assumes that the
         ///     method is being called from within another task, as per the render pipeline
         ///     design.
-        /// @param targetRenderPassGroups
-        ///     The list of TargetRenderPassGroups containing all of the render passes.
-        /// @param preRenderCommandList
-        ///     The RenderCommandList that should be included first. Must be moved.
-        /// @param postRenderCommandList
-        ///     The RenderCommandList that should be included last. Must be moved.
-        /// @param renderFrameData
-        ///     The container for all data allocated this frame that must persist to the end of the
-        ///     render pipeline. Must be moved.
+        /// @param targetRenderPassGroup
+        ///     The TargetRenderPassGroup containing all of the render passes for the target.
+        /// @param renderCommandBuffer
+        ///     The render command buffer which the lists are being compiled for. The lists are
+        ///     created from the buffer but not added to it.
         ///
-        /// @return The render command buffer.
+        /// @return The ordered list of render command lists for the target.
         ///
-        RenderCommandBufferUPtr CompileRenderCommands(const TaskContext& taskContext, const std::vector<TargetRenderPassGroup>& targetRenderPassGroups, RenderCommandListUPtr preRenderCommandList,
-                                                      RenderCommandListUPtr postRenderCommandList, RenderFrameData renderFrameData) noexcept;
+        std::vector<RenderCommandListUPtr> CompileTargetRenderCommands(const TaskContext& taskContext, const TargetRenderPassGroup& targetRenderPassGroup, RenderCommandBuffer* renderCommandBuffer) noexcept;
     }
 }
 
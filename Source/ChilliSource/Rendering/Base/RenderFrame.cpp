@@ -28,9 +28,9 @@ namespace ChilliSource
 {
     //------------------------------------------------------------------------------
     RenderFrame::RenderFrame(const Integer2& resolution, const Colour& clearColour, const RenderCamera& renderCamera, const AmbientRenderLight& renderAmbientLight,
-                             const std::vector<DirectionalRenderLight>& renderDirectionalLights, const std::vector<PointRenderLight>& renderPointLights, const std::vector<RenderObject>& renderObjects) noexcept
+                             const std::vector<DirectionalRenderLight>& renderDirectionalLights, const std::vector<PointRenderLight>& renderPointLights, std::vector<RenderObject> renderObjects) noexcept
         : m_resolution(resolution), m_clearColour(clearColour), m_renderCamera(renderCamera), m_renderAmbientLight(renderAmbientLight), m_renderDirectionalLights(renderDirectionalLights),
-          m_renderPointLights(renderPointLights), m_renderObjects(renderObjects)
+          m_renderPointLights(renderPointLights), m_renderObjects(std::move(renderObjects))
     {
     }
 }
@@ -61,10 +61,11 @@ namespace ChilliSource
         /// @param renderPointLights
         ///     A list of point lights in the frame.
         /// @param renderObjects
-        ///     A list of objects in the frame.
+        ///     A list of objects in the frame. This is moved into the frame rather than copied; all
+        ///     later stages refer to the objects by their index in this list.
         ///
         RenderFrame(const Integer2& resolution, const Colour& clearColour, const RenderCamera& renderCamera, const AmbientRenderLight& renderAmbientLight, const std::vector<DirectionalRenderLight>& renderDirectionalLights,
-                    const std::vector<PointRenderLight>& renderPointLights, const std::vector<RenderObject>& renderObjects) noexcept;
+                    const std::vector<PointRenderLight>& renderPointLights, std::vector<RenderObject> renderObjects) noexcept;
         
         /// @return The resolution of the viewport.
         ///
@@ -57,12 +57,12 @@ namespace ChilliSource
     //------------------------------------------------------------------------------
     RenderFrame RenderFrameCompiler::CompileRenderFrame(const Integer2& resolution, const Colour& clearColour, const RenderCamera& renderCamera, const std::vector<AmbientRenderLight>& renderAmbientLights,
                                                         const std::vector<DirectionalRenderLight>& renderDirectionalLights, const std::vector<PointRenderLight>& renderPointLights,
-                                                        const std::vector<RenderObject>& renderObjects) noexcept
+                                                        std::vector<RenderObject> renderObjects) noexcept
     {
         //TODO: Perform all render jobs in background tasks prior to building the complete render frame.
         
         auto renderAmbientLight = MergeAmbientRenderLights(renderAmbientLights);
         
-        return RenderFrame(resolution, clearColour, renderCamera, renderAmbientLight, renderDirectionalLights, renderPointLights, renderObjects);
+        return RenderFrame(resolution, clearColour, renderCamera, renderAmbientLight, renderDirectionalLights, renderPointLights, std::move(renderObjects));
     }
 }
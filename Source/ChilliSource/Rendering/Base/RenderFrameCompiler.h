@@ -55,13 +55,13 @@ namespace ChilliSource
         /// @param renderPointLights
         ///     A list of point lights in the frame.
         /// @param renderObjects
-        ///     A list of objects in the frame.
+        ///     A list of objects in the frame. This is moved into the frame.
         ///
         /// @return The compiled render frame.
         ///
         RenderFrame CompileRenderFrame(const Integer2& resolution, const Colour& clearColour, const RenderCamera& renderCamera, const std::vector<AmbientRenderLight>& renderAmbientLights,
                                        const std::vector<DirectionalRenderLight>& renderDirectionalLights, const std::vector<PointRenderLight>& renderPointLights,
-                                       const std::vector<RenderObject>& renderObjects) noexcept;
+                                       std::vector<RenderObject> renderObjects) noexcept;
     }
 }
 
@@ -24,6 +24,8 @@
 
 #include <ChilliSource/Rendering/Base/RenderObject.h>
 
+#include <ChilliSource/Rendering/Model/RenderDynamicMesh.h>
+
 namespace ChilliSource
 {
     //------------------------------------------------------------------------------
@@ -34,6 +36,8 @@ namespace ChilliSource
     {
         CS_ASSERT(m_renderMaterialGroup, "Cannot supply a null render material group.");
         CS_ASSERT(m_renderMesh, "Cannot supply a null render mesh.");
+        
+        ResolveRenderMaterials(m_renderMesh->GetVertexFormat());
     }
     
     //------------------------------------------------------------------------------
@@ -45,6 +49,8 @@ namespace ChilliSource
         CS_ASSERT(m_renderMaterialGroup, "Cannot supply a null render material group.");
         CS_ASSERT(m_renderMesh, "Cannot supply a null render mesh.");
         CS_ASSERT(m_renderSkinnedAnimation, "Cannot supply a null render skinned animation.");
+        
+        ResolveRenderMaterials(m_renderMesh->GetVertexFormat());
     }
     
     //------------------------------------------------------------------------------
@@ -55,6 +61,8 @@ namespace ChilliSource
     {
         CS_ASSERT(m_renderMaterialGroup, "Cannot supply a null render material group.");
         CS_ASSERT(m_renderDynamicMesh, "Cannot supply a null render dynamic mesh.");
+        
+        ResolveRenderMaterials(m_renderDynamicMesh->GetVertexFormat());
     }
     
     //------------------------------------------------------------------------------
@@ -66,5 +74,30 @@ namespace ChilliSource
         CS_ASSERT(m_renderMaterialGroup, "Cannot supply a null render material group.");
         CS_ASSERT(m_renderDynamicMesh, "Cannot supply a null render dynamic mesh.");
         CS_ASSERT(m_renderSkinnedAnimation, "Cannot supply a null render skinned animation.");
+        
+        ResolveRenderMaterials(m_renderDynamicMesh->GetVertexFormat());
+    }
+    
+    //------------------------------------------------------------------------------
+    const RenderMaterial* RenderObject::GetRenderMaterial(u32 passIndex) const noexcept
+    {
+        CS_ASSERT(passIndex < RenderMaterialGroup::k_numMaterialSlots, "Pass index is out of bounds.");
+        
+        if (!HasRenderMaterial(passIndex))
+        {
+            return nullptr;
+        }
+        
+        return m_renderMaterialCollection->GetRenderMaterial(passIndex);
+    }
+    
+    //------------------------------------------------------------------------------
+    void RenderObject::ResolveRenderMaterials(const VertexFormat& vertexFormat) noexcept
+    {
+        m_renderMaterialCollection = m_renderMaterialGroup->GetCollection(vertexFormat);
+        if (m_renderMaterialCollection)
+        {
+            m_renderMaterialMask = m_renderMaterialCollection->GetRenderMaterialMask();
+        }
     }
 }
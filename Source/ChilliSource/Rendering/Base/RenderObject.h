@@ -199,12 +199,47 @@ namespace ChilliSource
         ///
         u32 GetPriority() const noexcept { return m_priority; }
         
+        /// @return A mask describing which passes this object has a render material for, resolved for
+        ///     the vertex format of the mesh when the object was created. Bit n is set if the object
+        ///     has a render material for pass index n.
+        ///
+        u32 GetRenderMaterialMask() const noexcept { return m_renderMaterialMask; }
+        
+        /// @param passIndex
+        ///     The pass index to check.
+        ///
+        /// @return Whether or not the object has a render material for the given pass, and therefore
+        ///     should be included in it.
+        ///
+        bool HasRenderMaterial(u32 passIndex) const noexcept { return (m_renderMaterialMask & (1u << passIndex)) != 0; }
+        
+        /// Looks up the render material which should be used when rendering this object in the given
+        /// pass. This doesn't require the vertex format of the mesh to be compared, as the materials
+        /// were resolved when the object was created.
+        ///
+        /// @param passIndex
+        ///     The pass index to look up.
+        ///
+        /// @return The render material for the pass. May be null.
+        ///
+        const RenderMaterial* GetRenderMaterial(u32 passIndex) const noexcept;
+        
     private:
+        /// Resolves the render materials for every pass for the given vertex format, so that they don't
+        /// need to be looked up each time the object is added to a pass.
+        ///
+        /// @param vertexFormat
+        ///     The vertex format of the objects mesh.
+        ///
+        void ResolveRenderMaterials(const VertexFormat& vertexFormat) noexcept;
+        
         Type m_type;
         const RenderMaterialGroup* m_renderMaterialGroup;
         const RenderMesh* m_renderMesh = nullptr;
         const RenderDynamicMesh* m_renderDynamicMesh = nullptr;
         const RenderSkinnedAnimation* m_renderSkinnedAnimation = nullptr;
+        const RenderMaterialGroup::Collection* m_renderMaterialCollection = nullptr;
+        u32 m_renderMaterialMask = 0;
         Matrix4 m_worldMatrix;
         Sphere m_boundingSphere;
         bool m_shouldCastShadows;
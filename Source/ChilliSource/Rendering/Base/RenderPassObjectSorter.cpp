@@ -22,70 +22,322 @@
 //  THE SOFTWARE.
 //
 
+
 #include <ChilliSource/Rendering/Base/RenderPassObjectSorter.h>
 
 #include <ChilliSource/Rendering/Camera/RenderCamera.h>
 
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+
 namespace ChilliSource
 {
-    //------------------------------------------------------------------------------
-    void RenderPassObjectSorter::OpaqueSort(const RenderCamera& camera, std::vector<RenderPassObject>& renderPassObjects) noexcept
+    namespace
     {
-        std::sort(renderPassObjects.begin(), renderPassObjects.end(), [&camera](const RenderPassObject& a, const RenderPassObject& b)
+        constexpr u32 k_pointerIdBits = 20;
+        constexpr u32 k_maxPointerId = (1u << k_pointerIdBits) - 1;
+        constexpr u32 k_opaqueDepthBits = 24;
+        constexpr u32 k_radixBits = 8;
+        constexpr u32 k_radixBuckets = 1u << k_radixBits;
+        constexpr u32 k_radixPasses = 64 / k_radixBits;
+        constexpr u32 k_minRadixSortSize = 256;
+        
+        /// A sort key paired with the index of the render pass object it was generated for.
+        ///
+        struct SortEntry final
+        {
+            u64 m_key;
+            u32 m_index;
+        };
+        
+        /// Assigns a dense id to each distinct pointer it is given, in the order in which they
+        /// are first seen, allowing pointers to be packed into a small number of sort key bits
+        /// without collisions. Null is always given the id 0.
+        ///
+        class PointerIdTable final
         {
-            if (a.GetRenderMaterial() == b.GetRenderMaterial())
+        public:
+            /// @param pointer
+            ///     The pointer to get the id for.
+            ///
+            /// @return The id of the pointer, clamped to the maximum pointer id.
+            ///
+            u32 GetId(const void* pointer) noexcept
             {
-                Matrix4 wvpA = a.GetWorldMatrix() * camera.GetViewProjectionMatrix();
-                Matrix4 wvpB = b.GetWorldMatrix() * camera.GetViewProjectionMatrix();
+                if (!pointer)
+                {
+                    return 0;
+                }
                 
-                if (wvpA.GetTranslation().z == wvpB.GetTranslation().z)
+                if ((m_numIds + 1) * 2 > m_slots.size())
                 {
-                    return (a.GetRenderMesh() < b.GetRenderMesh());
+                    Grow();
                 }
-                else
+                
+                auto mask = u32(m_slots.size() - 1);
+                for (auto index = Hash(pointer) & mask;; index = (index + 1) & mask)
                 {
-                    return (wvpA.GetTranslation().z > wvpB.GetTranslation().z);
+                    auto& slot = m_slots[index];
+                    if (slot.m_pointer == pointer)
+                    {
+                        return slot.m_id;
+                    }
+                    
+                    if (!slot.m_pointer)
+                    {
+                        slot.m_pointer = pointer;
+                        slot.m_id = std::min(++m_numIds, k_maxPointerId);
+                        return slot.m_id;
+                    }
                 }
             }
-            else
+            
+        private:
+            struct Slot final
+            {
+                const void* m_pointer = nullptr;
+                u32 m_id = 0;
+            };
+            
+            /// @param pointer
+            ///     The pointer to hash.
+            ///
+            /// @return The hash of the given pointer.
+            ///
+            static u32 Hash(const void* pointer) noexcept
+            {
+                return u32((u64(reinterpret_cast<std::uintptr_t>(pointer)) * 0x9E3779B97F4A7C15ull) >> 32);
+            }
+            
+            /// Doubles the size of the table, re-inserting all existing entries.
+            ///
+            void Grow() noexcept
             {
-                return (a.GetRenderMaterial() < b.GetRenderMaterial());
+                std::vector<Slot> slots(std::max(m_slots.size() * 2, std::size_t(64)));
+                auto mask = u32(slots.size() - 1);
+                
+                for (const auto& slot : m_slots)
+                {
+                    if (slot.m_pointer)
+                    {
+                        auto index = Hash(slot.m_pointer) & mask;
+                        while (slots[index].m_pointer)
+                        {
+                            index = (index + 1) & mask;
+                        }
+                        slots[index] = slot;
+                    }
+                }
+                
+                m_slots.swap(slots);
             }
-        });
+            
+            std::vector<Slot> m_slots;
+            u32 m_numIds = 0;
+        };
+        
+        /// Converts the given float to an unsigned integer whose ordering matches the ordering
+        /// of the float values.
+        ///
+        /// @param value
+        ///     The float value.
+        ///
+        /// @return The sortable bits.
+        ///
+        u32 ToSortableBits(f32 value) noexcept
+        {
+            u32 bits;
+            std::memcpy(&bits, &value, sizeof(bits));
+            return (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+        }
+        
+        /// Calculates the view space depth of the origin of the given render pass object.
+        ///
+        /// @param viewMatrix
+        ///     The view matrix of the camera.
+        /// @param renderPassObject
+        ///     The render pass object.
+        ///
+        /// @return The view space depth.
+        ///
+        f32 CalcViewDepth(const Matrix4& viewMatrix, const RenderPassObject& renderPassObject) noexcept
+        {
+            const auto& worldMatrix = renderPassObject.GetWorldMatrix();
+            return worldMatrix.m[12] * viewMatrix.m[2] + worldMatrix.m[13] * viewMatrix.m[6] + worldMatrix.m[14] * viewMatrix.m[10] + viewMatrix.m[14];
+        }
+        
+        /// @param renderPassObject
+        ///     The render pass object.
+        ///
+        /// @return The mesh used by the render pass object, whether static or dynamic.
+        ///
+        const void* GetMesh(const RenderPassObject& renderPassObject) noexcept
+        {
+            if (renderPassObject.GetRenderMesh())
+            {
+                return renderPassObject.GetRenderMesh();
+            }
+            
+            return renderPassObject.GetRenderDynamicMesh();
+        }
+        
+        /// Sorts the given entries by key using a least significant digit radix sort. The sort
+        /// is stable, and passes over digits which are the same for every key are skipped.
+        /// Small lists are sorted with a comparison sort instead.
+        ///
+        /// @param entries
+        ///     The entries to sort.
+        ///
+        void SortEntries(std::vector<SortEntry>& entries) noexcept
+        {
+            if (entries.size() < k_minRadixSortSize)
+            {
+                std::stable_sort(entries.begin(), entries.end(), [](const SortEntry& a, const SortEntry& b)
+                {
+                    return a.m_key < b.m_key;
+                });
+                return;
+            }
+            
+            std::array<std::array<u32, k_radixBuckets>, k_radixPasses> counts;
+            for (auto& passCounts : counts)
+            {
+                passCounts.fill(0);
+            }
+            
+            for (const auto& entry : entries)
+            {
+                for (u32 pass = 0; pass < k_radixPasses; ++pass)
+                {
+                    ++counts[pass][(entry.m_key >> (pass * k_radixBits)) & (k_radixBuckets - 1)];
+                }
+            }
+            
+            std::vector<SortEntry> scratch(entries.size());
+            for (u32 pass = 0; pass < k_radixPasses; ++pass)
+            {
+                auto& passCounts = counts[pass];
+                auto shift = pass * k_radixBits;
+                
+                if (passCounts[(entries[0].m_key >> shift) & (k_radixBuckets - 1)] == entries.size())
+                {
+                    continue;
+                }
+                
+                u32 offset = 0;
+                for (auto& count : passCounts)
+                {
+                    auto bucketSize = count;
+                    count = offset;
+                    offset += bucketSize;
+                }
+                
+                for (const auto& entry : entries)
+                {
+                    scratch[passCounts[(entry.m_key >> shift) & (k_radixBuckets - 1)]++] = entry;
+                }
+                
+                entries.swap(scratch);
+            }
+        }
+        
+        /// Builds a sort key for each render pass object using the given function, sorts the
+        /// keys and then reorders the render pass objects to match.
+        ///
+        /// @param renderPassObjects
+        ///     The list of render pass objects to sort.
+        /// @param calcKey
+        ///     The function which calculates the sort key for a render pass object.
+        ///
+        template <typename TCalcKey> void SortByKey(std::vector<RenderPassObject>& renderPassObjects, TCalcKey calcKey) noexcept
+        {
+            if (renderPassObjects.size() < 2)
+            {
+                return;
+            }
+            
+            std::vector<SortEntry> entries(renderPassObjects.size());
+            for (u32 i = 0; i < renderPassObjects.size(); ++i)
+            {
+                entries[i].m_key = calcKey(renderPassObjects[i]);
+                entries[i].m_index = i;
+            }
+            
+            SortEntries(entries);
+            
+            std::vector<RenderPassObject> sortedRenderPassObjects;
+            sortedRenderPassObjects.reserve(renderPassObjects.size());
+            for (const auto& entry : entries)
+            {
+                sortedRenderPassObjects.push_back(renderPassObjects[entry.m_index]);
+            }
+            
+            renderPassObjects.swap(sortedRenderPassObjects);
+        }
     }
     
     //------------------------------------------------------------------------------
-    void RenderPassObjectSorter::TransparentSort(const RenderCamera& camera, std::vector<RenderPassObject>& renderPassObjects) noexcept
+    void RenderPassObjectSorter::OpaqueSort(const RenderCamera& camera, std::vector<RenderPassObject>& renderPassObjects) noexcept
     {
-        std::sort(renderPassObjects.begin(), renderPassObjects.end(), [&camera](const RenderPassObject& a, const RenderPassObject& b)
+        PointerIdTable materialIds;
+        PointerIdTable meshIds;
+        PointerIdTable skinnedAnimationIds;
+        std::vector<u64> skinnedAnimationDepths(1);
+        const auto& viewMatrix = camera.GetViewMatrix();
+        
+        SortByKey(renderPassObjects, [&](const RenderPassObject& renderPassObject)
         {
-            Matrix4 wvpA = a.GetWorldMatrix() * camera.GetViewProjectionMatrix();
-            Matrix4 wvpB = b.GetWorldMatrix() * camera.GetViewProjectionMatrix();
+            u64 materialId = materialIds.GetId(renderPassObject.GetRenderMaterial());
+            u64 meshId = meshIds.GetId(GetMesh(renderPassObject));
+            u64 depth = ToSortableBits(CalcViewDepth(viewMatrix, renderPassObject)) >> (32 - k_opaqueDepthBits);
             
-            if (wvpA.GetTranslation().z == wvpB.GetTranslation().z)
+            //objects which share a skinned animation are all given the depth of the first one, so
+            //they are drawn consecutively and the joint data only needs to be applied once.
+            if (auto skinnedAnimation = renderPassObject.GetRenderSkinnedAnimation())
             {
-                return (a.GetRenderMesh() < b.GetRenderMesh());
-            }
-            else
-            {
-                return (wvpA.GetTranslation().z > wvpB.GetTranslation().z);
+                auto skinnedAnimationId = skinnedAnimationIds.GetId(skinnedAnimation);
+                if (skinnedAnimationId == skinnedAnimationDepths.size())
+                {
+                    skinnedAnimationDepths.push_back(depth);
+                }
+                else
+                {
+                    depth = skinnedAnimationDepths[skinnedAnimationId];
+                }
             }
+            
+            return (materialId << (64 - k_pointerIdBits)) | (meshId << k_opaqueDepthBits) | depth;
+        });
+    }
+    
+    //------------------------------------------------------------------------------
+    void RenderPassObjectSorter::TransparentSort(const RenderCamera& camera, std::vector<RenderPassObject>& renderPassObjects) noexcept
+    {
+        PointerIdTable meshIds;
+        const auto& viewMatrix = camera.GetViewMatrix();
+        
+        SortByKey(renderPassObjects, [&](const RenderPassObject& renderPassObject)
+        {
+            u64 inverseDepth = ~ToSortableBits(CalcViewDepth(viewMatrix, renderPassObject));
+            u64 meshId = meshIds.GetId(GetMesh(renderPassObject));
+            
+            return (inverseDepth << 32) | meshId;
         });
     }
     
     //------------------------------------------------------------------------------
     void RenderPassObjectSorter::PrioritySort(std::vector<RenderPassObject>& renderPassObjects) noexcept
     {
-        std::sort(renderPassObjects.begin(), renderPassObjects.end(), [](const RenderPassObject& a, const RenderPassObject& b)
+        PointerIdTable materialIds;
+        
+        SortByKey(renderPassObjects, [&](const RenderPassObject& renderPassObject)
         {
-            if (a.GetPriority() == b.GetPriority())
-            {
-                return (a.GetRenderMaterial() < b.GetRenderMaterial());
-            }
-            else
-            {
-                return (a.GetPriority() < b.GetPriority());
-            }
+            u64 priority = renderPassObject.GetPriority();
+            u64 materialId = materialIds.GetId(renderPassObject.GetRenderMaterial());
+            
+            return (priority << 32) | materialId;
         });
     }
-}
\ No newline at end of file
+}
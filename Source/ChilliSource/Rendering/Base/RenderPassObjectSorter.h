@@ -35,12 +35,16 @@
 
 namespace ChilliSource
 {
-    /// Collection of sort functions for render pass objects
+    /// Collection of sort functions for render pass objects.
+    ///
+    /// Each sort calculates a packed 64-bit key for every object up front and then sorts
+    /// the keys with a radix sort, rather than re-evaluating object data in each comparison.
     ///
     namespace RenderPassObjectSorter
     {
-        /// Sorts a collection of opaque RenderPassObjects based on if they share a material
-        /// and then by z position (Front to back)
+        /// Sorts a collection of opaque RenderPassObjects based on if they share a material,
+        /// then if they share a mesh, and then by z position (Front to back). Objects which
+        /// share a skinned animation are kept together, at the depth of the first of them.
         ///
         /// @param camera
         ///     The camera to use to determine z-distance.
@@ -24,56 +24,70 @@
 
 #include <ChilliSource/Rendering/Base/RenderPassVisibilityChecker.h>
 
-#include <ChilliSource/Core/Threading/TaskScheduler.h>
+#include <ChilliSource/Core/Math/Geometry/SphereBatch.h>
+#include <ChilliSource/Core/Threading/TaskContext.h>
 #include <ChilliSource/Rendering/Base/ForwardRenderPasses.h>
 #include <ChilliSource/Rendering/Base/RenderFrame.h>
 #include <ChilliSource/Rendering/Base/RenderPass.h>
 #include <ChilliSource/Rendering/Base/RenderObject.h>
 #include <ChilliSource/Rendering/Base/RenderPassObject.h>
 
+#include <algorithm>
+
 namespace ChilliSource
 {
     namespace
     {
-        constexpr u32 k_objectsPerVisibilityBatch = 50;
+        constexpr u32 k_minMaskWordsPerVisibilityBatch = 4;
     }
     
     //------------------------------------------------------------------------------
-    std::vector<RenderObject> RenderPassVisibilityChecker::CalculateVisibleObjects(const TaskContext& taskContext, const RenderCamera& camera, const std::vector<RenderObject>& renderObjects) noexcept
+    std::vector<u32> RenderPassVisibilityChecker::CalculateVisibleObjects(const TaskContext& taskContext, const RenderCamera& camera, const std::vector<RenderObject>& renderObjects,
+                                                                           const std::vector<u32>& renderObjectIndices) noexcept
     {
-        std::mutex visibleObjectsMutex;
-        std::vector<RenderObject> visibleRenderObjects;
+        u32 numObjects = u32(renderObjectIndices.size());
+        SphereBatch boundingSpheres(numObjects);
+        std::vector<u32> visibilityMask(SphereBatch::CalcNumMaskWords(numObjects));
+        
+        // Each batch covers whole words of the visibility mask, so it can be written without locking and the
+        // result doesn't depend on how the work was split.
+        taskContext.ParallelFor(u32(visibilityMask.size()), k_minMaskWordsPerVisibilityBatch, [&](const TaskContext& innerTaskContext, u32 startWord, u32 endWord)
+        {
+            u32 startIndex = startWord * SphereBatch::k_spheresPerMaskWord;
+            u32 endIndex = std::min(endWord * SphereBatch::k_spheresPerMaskWord, numObjects);
+            
+            for (u32 index = startIndex; index < endIndex; ++index)
+            {
+                boundingSpheres.Set(index, renderObjects[renderObjectIndices[index]].GetBoundingSphere());
+            }
+            
+            boundingSpheres.CullAgainstFrustum(camera.GetFrustrum(), startIndex, endIndex, visibilityMask.data());
+        });
+        
+        u32 numVisibleObjects = 0;
+        for (u32 word : visibilityMask)
+        {
+            for (; word != 0; word &= word - 1)
+            {
+                ++numVisibleObjects;
+            }
+        }
         
-        u32 numTasks = 1 + (u32(renderObjects.size()) / k_objectsPerVisibilityBatch);
-        std::vector<Task> tasks;
-        for (u32 taskIndex = 0; taskIndex < numTasks; ++taskIndex)
+        std::vector<u32> visibleRenderObjectIndices;
+        visibleRenderObjectIndices.reserve(numVisibleObjects);
+        
+        for (u32 wordIndex = 0; wordIndex < u32(visibilityMask.size()); ++wordIndex)
         {
-            tasks.push_back([=, &camera, &renderObjects, &visibleObjectsMutex, &visibleRenderObjects](const TaskContext& innerTaskContext)
+            u32 word = visibilityMask[wordIndex];
+            for (u32 bit = 0; word != 0; ++bit, word >>= 1)
             {
-                std::vector<RenderObject> taskVisibleObjects;
-                for(u32 objectIndex = 0; objectIndex < k_objectsPerVisibilityBatch; ++objectIndex)
+                if ((word & 1) != 0)
                 {
-                    u32 index = taskIndex * k_objectsPerVisibilityBatch + objectIndex;
-                    if (index >= renderObjects.size())
-                    {
-                        break;
-                    }
-                    
-                    const auto& renderPassObject = renderObjects[index];
-                    
-                    if (camera.GetFrustrum().SphereCullTest(renderPassObject.GetBoundingSphere()))
-                    {
-                        taskVisibleObjects.push_back(renderPassObject);
-                    }
+                    visibleRenderObjectIndices.push_back(renderObjectIndices[wordIndex * SphereBatch::k_spheresPerMaskWord + bit]);
                 }
-                
-                std::unique_lock<std::mutex> lock(visibleObjectsMutex);
-                visibleRenderObjects.insert(visibleRenderObjects.end(), taskVisibleObjects.begin(), taskVisibleObjects.end());
-            });
+            }
         }
         
-        taskContext.ProcessChildTasks(tasks);
-        
-        return visibleRenderObjects;
+        return visibleRenderObjectIndices;
     }
-} 
\ No newline at end of file
+}
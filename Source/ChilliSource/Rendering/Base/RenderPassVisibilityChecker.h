@@ -38,19 +38,22 @@ namespace ChilliSource
     ///
     namespace RenderPassVisibilityChecker
     {
-        /// Parses a collection of RenderObjects and generates a list of them that are considered
-        /// to be visible and within the passed camera's view frustrum.
+        /// Parses a subset of a collection of RenderObjects and generates a list of those that are
+        /// considered to be visible and within the passed camera's view frustrum. The objects are
+        /// referred to by index rather than copied.
         ///
         /// @param taskContext
         ///     Context to manage any spawned tasks
         /// @param camera
         ///     The camera who will decide the objects visibility
         /// @param renderObjects
-        ///     The collection of RenderObjects whos visibility is to be checked
+        ///     The collection of RenderObjects the indices refer to.
+        /// @param renderObjectIndices
+        ///     The indices of the RenderObjects whos visibility is to be checked
         ///
-        /// @return Collection of visible RenderObjects
+        /// @return The indices of the visible RenderObjects, in the same order as they were given.
         ///
-        std::vector<RenderObject> CalculateVisibleObjects(const TaskContext& taskContext, const RenderCamera& camera, const std::vector<RenderObject>& renderObjects) noexcept;
+        std::vector<u32> CalculateVisibleObjects(const TaskContext& taskContext, const RenderCamera& camera, const std::vector<RenderObject>& renderObjects, const std::vector<u32>& renderObjectIndices) noexcept;
     }
 }
 
@@ -28,7 +28,7 @@ namespace ChilliSource
 {
     //------------------------------------------------------------------------------
     RenderSnapshot::RenderSnapshot(IAllocator* frameAllocator, const Integer2& resolution, const Colour& clearColour, const RenderCamera& in_renderCamera) noexcept
-        : m_resolution(resolution), m_clearColour(clearColour), m_renderCamera(in_renderCamera), m_preRenderCommandList(new RenderCommandList()), m_postRenderCommandList(new RenderCommandList()),
+        : m_resolution(resolution), m_clearColour(clearColour), m_renderCamera(in_renderCamera), m_preRenderCommandList(new RenderCommandList(frameAllocator)), m_postRenderCommandList(new RenderCommandList(frameAllocator)),
           m_renderFrameData(frameAllocator)
     {
     }
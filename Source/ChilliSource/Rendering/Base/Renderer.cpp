@@ -25,6 +25,7 @@
 #include <ChilliSource/Rendering/Base/Renderer.h>
 
 #include <ChilliSource/Core/Base/Application.h>
+#include <ChilliSource/Core/Threading/TaskGraph.h>
 #include <ChilliSource/Core/Threading/TaskScheduler.h>
 #include <ChilliSource/Rendering/Base/ForwardRenderPassCompiler.h>
 #include <ChilliSource/Rendering/Base/RenderCommandCompiler.h>
@@ -33,6 +34,28 @@
 
 namespace ChilliSource
 {
+    namespace
+    {
+        /// The state of a single frame which is shared between the nodes of the render prep
+        /// task graph. Each target has its own slot for its render pass group and command
+        /// lists, so nodes for different targets never write to the same data.
+        ///
+        struct RenderPrepState final
+        {
+            RenderPrepState(RenderFrame renderFrame, RenderCommandBufferUPtr renderCommandBuffer, u32 numTargets) noexcept
+                : m_renderFrame(std::move(renderFrame)), m_renderCommandBuffer(std::move(renderCommandBuffer)), m_targetRenderPassGroups(numTargets), m_targetRenderCommandLists(numTargets)
+            {
+            }
+            
+            RenderFrame m_renderFrame;
+            RenderCommandBufferUPtr m_renderCommandBuffer;
+            RenderCommandListUPtr m_preRenderCommandList;
+            RenderCommandListUPtr m_postRenderCommandList;
+            std::vector<TargetRenderPassGroup> m_targetRenderPassGroups;
+            std::vector<std::vector<RenderCommandListUPtr>> m_targetRenderCommandLists;
+        };
+    }
+    
     CS_DEFINE_NAMEDTYPE(Renderer);
     
     //------------------------------------------------------------------------------
@@ -81,12 +104,55 @@ namespace ChilliSource
             auto postRenderCommandList = m_currentSnapshot.ClaimPostRenderCommandList();
             auto renderFrameData = m_currentSnapshot.ClaimRenderFrameData();
             
-            auto renderFrame = RenderFrameCompiler::CompileRenderFrame(resolution, clearColour, renderCamera, renderAmbientLights, renderDirectionalLights, renderPointLights, renderObjects);
-            auto targetRenderPassGroups = m_renderPassCompiler->CompileTargetRenderPassGroups(taskContext, renderFrame);
-            auto renderCommandBuffer = RenderCommandCompiler::CompileRenderCommands(taskContext, targetRenderPassGroups, std::move(preRenderCommandList), std::move(postRenderCommandList), std::move(renderFrameData));
+            auto renderFrame = RenderFrameCompiler::CompileRenderFrame(resolution, clearColour, renderCamera, renderAmbientLights, renderDirectionalLights, renderPointLights, std::move(renderObjects));
+            auto numTargets = m_renderPassCompiler->GetNumTargets(renderFrame);
+            RenderCommandBufferUPtr renderCommandBuffer(new RenderCommandBuffer(std::move(renderFrameData)));
+            
+            auto state = std::make_shared<RenderPrepState>(std::move(renderFrame), std::move(renderCommandBuffer), numTargets);
+            state->m_preRenderCommandList = std::move(preRenderCommandList);
+            state->m_postRenderCommandList = std::move(postRenderCommandList);
+            
+            // Each target's render commands are compiled as soon as its own render passes are
+            // ready, so shadow and main targets flow through both stages without joining.
+            TaskGraph taskGraph;
+            for (u32 targetIndex = 0; targetIndex < numTargets; ++targetIndex)
+            {
+                auto compilePassesNode = taskGraph.AddNode([=](const TaskContext& innerTaskContext)
+                {
+                    state->m_targetRenderPassGroups[targetIndex] = m_renderPassCompiler->CompileTargetRenderPassGroup(innerTaskContext, state->m_renderFrame, targetIndex);
+                });
+                
+                taskGraph.AddNode([=](const TaskContext& innerTaskContext)
+                {
+                    state->m_targetRenderCommandLists[targetIndex] = RenderCommandCompiler::CompileTargetRenderCommands(innerTaskContext, state->m_targetRenderPassGroups[targetIndex], state->m_renderCommandBuffer.get());
+                }, { compilePassesNode });
+            }
             
-            m_commandRecycleSystem->WaitThenPushCommandBuffer(std::move(renderCommandBuffer));
-            EndRenderPrep();
+            taskScheduler->ScheduleTaskGraph(TaskType::k_small, std::move(taskGraph), [=](const TaskContext& innerTaskContext)
+            {
+                auto renderCommandBuffer = std::move(state->m_renderCommandBuffer);
+                
+                if (state->m_preRenderCommandList->GetNumCommands() > 0)
+                {
+                    renderCommandBuffer->AddRenderCommandList(std::move(state->m_preRenderCommandList));
+                }
+                
+                for (auto& targetRenderCommandLists : state->m_targetRenderCommandLists)
+                {
+                    for (auto& renderCommandList : targetRenderCommandLists)
+                    {
+                        renderCommandBuffer->AddRenderCommandList(std::move(renderCommandList));
+                    }
+                }
+                
+                if (state->m_postRenderCommandList->GetNumCommands() > 0)
+                {
+                    renderCommandBuffer->AddRenderCommandList(std::move(state->m_postRenderCommandList));
+                }
+                
+                m_commandRecycleSystem->WaitThenPushCommandBuffer(std::move(renderCommandBuffer));
+                EndRenderPrep();
+            });
         });
     }
     
@@ -139,6 +139,12 @@ namespace ChilliSource
     //------------------------------------------------------------------------------
     const Frustum& CameraComponent::GetFrustum()
     {
+        //The frustum cache is invalidated by transform changed events, which are deferred until the transform is resolved.
+        if(GetEntity())
+        {
+            GetEntity()->GetTransform().ResolveChanges();
+        }
+        
         if(m_isFrustumCacheValid == false)
         {
             UpdateFrustum();
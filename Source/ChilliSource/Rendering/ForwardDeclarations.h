@@ -39,6 +39,7 @@ namespace ChilliSource
     /// Base
     //------------------------------------------------------------
     CS_FORWARDDECLARE_CLASS(CanvasMaterialPool);
+    CS_FORWARDDECLARE_CLASS(CanvasRenderCache);
     CS_FORWARDDECLARE_CLASS(CanvasRenderer);
     CS_FORWARDDECLARE_CLASS(IRenderCommandProcessor);
     CS_FORWARDDECLARE_CLASS(IRenderPassCompiler);
@@ -101,6 +102,8 @@ namespace ChilliSource
     /// Model
     //------------------------------------------------------------
     CS_FORWARDDECLARE_CLASS(AnimatedModelComponent);
+    CS_FORWARDDECLARE_CLASS(AnimatedModelSystem);
+    CS_FORWARDDECLARE_CLASS(CompressedSkinnedAnimation);
     CS_FORWARDDECLARE_CLASS(CSAnimProvider);
     CS_FORWARDDECLARE_CLASS(CSModelProvider);
     CS_FORWARDDECLARE_CLASS(MeshDesc);
@@ -117,6 +120,7 @@ namespace ChilliSource
     CS_FORWARDDECLARE_STRUCT(SkeletonNode);
     CS_FORWARDDECLARE_CLASS(SkinnedAnimation);
     CS_FORWARDDECLARE_CLASS(SkinnedAnimationGroup);
+    CS_FORWARDDECLARE_CLASS(SkinnedAnimationResourceOptions);
     CS_FORWARDDECLARE_CLASS(SmallMeshBatcher);
     CS_FORWARDDECLARE_CLASS(StaticModelComponent);
     CS_FORWARDDECLARE_CLASS(VertexFormat);
@@ -129,6 +133,7 @@ namespace ChilliSource
     CS_FORWARDDECLARE_CLASS(CSParticleProvider);
     CS_FORWARDDECLARE_CLASS(ParticleEffect);
     CS_FORWARDDECLARE_CLASS(ParticleEffectComponent);
+    CS_FORWARDDECLARE_CLASS(ParticleBuffer);
     CS_FORWARDDECLARE_STRUCT(Particle);
     CS_FORWARDDECLARE_CLASS(ParticleDrawable);
     CS_FORWARDDECLARE_CLASS(ParticleDrawableDef);
@@ -196,6 +201,8 @@ namespace ChilliSource
     CS_FORWARDDECLARE_CLASS(RenderCommandBufferManager);
     CS_FORWARDDECLARE_CLASS(RenderCommandList);
     CS_FORWARDDECLARE_CLASS(RenderInstanceRenderCommand);
+    CS_FORWARDDECLARE_CLASS(RenderInstancesRenderCommand);
+    CS_FORWARDDECLARE_CLASS(StreamTextureRenderCommand);
     CS_FORWARDDECLARE_CLASS(UnloadMaterialGroupRenderCommand);
     CS_FORWARDDECLARE_CLASS(UnloadMeshRenderCommand);
     CS_FORWARDDECLARE_CLASS(UnloadShaderRenderCommand);
@@ -33,10 +33,15 @@
 #include <ChilliSource/Core/Resource/ResourcePool.h>
 #include <ChilliSource/Rendering/Base/RenderCapabilities.h>
 #include <ChilliSource/Rendering/Base/RenderSnapshot.h>
+#include <ChilliSource/Rendering/Camera/RenderCamera.h>
 #include <ChilliSource/Rendering/Target/RenderTargetGroupManager.h>
 #include <ChilliSource/Rendering/Texture/Texture.h>
 #include <ChilliSource/Rendering/Texture/TextureDesc.h>
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+
 namespace ChilliSource
 {
     namespace
@@ -71,6 +76,92 @@ namespace ChilliSource
                     return Integer2::k_zero;
             }
         }
+        
+        /// Calculates the world space corners of the section of the camera frustum which lies
+        /// between the given view space depths. The first four corners are at the near end of
+        /// the section and the last four are at the far end. The depths are clamped to the
+        /// camera frustum.
+        ///
+        /// @param renderCamera
+        ///     The camera whose frustum should be sectioned.
+        /// @param nearDepth
+        ///     The view space depth of the near end of the section.
+        /// @param farDepth
+        ///     The view space depth of the far end of the section.
+        ///
+        /// @return The corners of the section.
+        ///
+        std::array<Vector3, 8> CalcFrustumSectionCorners(const RenderCamera& renderCamera, f32 nearDepth, f32 farDepth) noexcept
+        {
+            auto inverseViewProjection = Matrix4::Inverse(renderCamera.GetViewProjectionMatrix());
+            const auto& view = renderCamera.GetViewMatrix();
+            
+            std::array<Vector3, 8> corners;
+            for (u32 i = 0; i < 4; ++i)
+            {
+                f32 x = (i & 1) ? 1.0f : -1.0f;
+                f32 y = (i & 2) ? 1.0f : -1.0f;
+                
+                auto nearCorner = Vector3(x, y, -1.0f) * inverseViewProjection;
+                auto farCorner = Vector3(x, y, 1.0f) * inverseViewProjection;
+                
+                f32 nearCornerDepth = (nearCorner * view).z;
+                f32 depthRange = (farCorner * view).z - nearCornerDepth;
+                
+                corners[i] = Vector3::Lerp(nearCorner, farCorner, (nearDepth - nearCornerDepth) / depthRange);
+                corners[i + 4] = Vector3::Lerp(nearCorner, farCorner, (farDepth - nearCornerDepth) / depthRange);
+            }
+            
+            return corners;
+        }
+        
+        /// Calculates a light projection which tightly encloses the given section of the camera
+        /// frustum. The projection is sized to the bounding sphere of the section so that the
+        /// texel size doesn't change as the camera rotates, and is snapped to the shadow map
+        /// texel grid so that shadow edges don't shimmer as the camera moves. The near plane is
+        /// extended towards the light so that objects outside of the section can still cast
+        /// shadows into it.
+        ///
+        /// @param sectionCorners
+        ///     The world space corners of the section of the camera frustum.
+        /// @param lightViewMatrix
+        ///     The view matrix of the light.
+        /// @param shadowMapResolution
+        ///     The resolution of the shadow map.
+        /// @param shadowVolumeNear
+        ///     The near plane of the shadow volume.
+        ///
+        /// @return The light projection matrix.
+        ///
+        Matrix4 CalcCascadeProjection(const std::array<Vector3, 8>& sectionCorners, const Matrix4& lightViewMatrix, const Integer2& shadowMapResolution, f32 shadowVolumeNear) noexcept
+        {
+            std::array<Vector3, 8> lightSpaceCorners;
+            Vector3 centre = Vector3::k_zero;
+            for (u32 i = 0; i < lightSpaceCorners.size(); ++i)
+            {
+                lightSpaceCorners[i] = sectionCorners[i] * lightViewMatrix;
+                centre += lightSpaceCorners[i];
+            }
+            centre /= f32(lightSpaceCorners.size());
+            
+            f32 radius = 0.0f;
+            for (const auto& corner : lightSpaceCorners)
+            {
+                radius = std::max(radius, (corner - centre).Length());
+            }
+            radius = std::ceil(radius * 16.0f) / 16.0f;
+            
+            f32 extent = 2.0f * radius;
+            f32 texelWidth = extent / f32(shadowMapResolution.x);
+            f32 texelHeight = extent / f32(shadowMapResolution.y);
+            centre.x = std::floor(centre.x / texelWidth) * texelWidth;
+            centre.y = std::floor(centre.y / texelHeight) * texelHeight;
+            
+            f32 nearPlane = std::min(centre.z - radius, shadowVolumeNear);
+            f32 farPlane = centre.z + radius;
+            
+            return Matrix4::CreateTranslation(-centre.x, -centre.y, 0.0f) * Matrix4::CreateOrthographicProjectionLH(extent, extent, nearPlane, farPlane);
+        }
     }
     
     CS_DEFINE_NAMEDTYPE(DirectionalLightComponent);
@@ -108,43 +199,70 @@ namespace ChilliSource
     void DirectionalLightComponent::SetShadowVolume(f32 width, f32 height, f32 near, f32 far) noexcept
     {
         m_lightProjection = Matrix4::CreateOrthographicProjectionLH(width, height, near, far);
+        m_shadowVolumeNear = near;
+    }
+    
+    //------------------------------------------------------------------------------
+    void DirectionalLightComponent::SetShadowCascades(const std::vector<f32>& splitDistances) noexcept
+    {
+        CS_ASSERT(splitDistances.size() <= DirectionalRenderLight::k_maxShadowCascades, "Too many shadow cascades.");
+        CS_ASSERT(std::is_sorted(splitDistances.begin(), splitDistances.end()), "Shadow cascade split distances must be in ascending order.");
+        
+        m_shadowCascadeSplits = splitDistances;
+        
+        if (!m_shadowMaps.empty() && m_shadowMaps.size() != std::max(m_shadowCascadeSplits.size(), std::size_t(1)))
+        {
+            TryDestroyShadowMapTarget();
+            TryCreateShadowMapTarget();
+        }
     }
     
     //------------------------------------------------------------------------------
     void DirectionalLightComponent::TryCreateShadowMapTarget() noexcept
     {
-        CS_ASSERT(!m_shadowMap, "Shadow map already exists.");
-        CS_ASSERT(!m_shadowMapTarget, "Shadow map target already exists.");
+        CS_ASSERT(m_shadowMaps.empty(), "Shadow map already exists.");
+        CS_ASSERT(m_shadowMapTargets.empty(), "Shadow map target already exists.");
 
         if(m_shadowMapResolution.x > 0 && m_shadowMapResolution.y > 0)
         {
-            auto mutableShadowMap = Application::Get()->GetResourcePool()->CreateResource<Texture>("_DirectionalLightShadowMap" + ToString(m_shadowMapId));
-            
-            TextureDesc desc(m_shadowMapResolution, ImageFormat::k_Depth16, ImageCompression::k_none);
-            mutableShadowMap->Build(nullptr, 0, desc);
-            mutableShadowMap->SetLoadState(Resource::LoadState::k_loaded);
-            
-            m_shadowMap = mutableShadowMap;
-            
-            m_shadowMapTarget = TargetGroup::CreateDepthTargetGroup(m_shadowMap);
+            auto numShadowMaps = std::max(m_shadowCascadeSplits.size(), std::size_t(1));
+            for (std::size_t i = 0; i < numShadowMaps; ++i)
+            {
+                auto name = "_DirectionalLightShadowMap" + ToString(m_shadowMapId);
+                if (i > 0)
+                {
+                    name += "_" + ToString(u32(i));
+                }
+                
+                auto mutableShadowMap = Application::Get()->GetResourcePool()->CreateResource<Texture>(name);
+                
+                TextureDesc desc(m_shadowMapResolution, ImageFormat::k_Depth16, ImageCompression::k_none);
+                mutableShadowMap->Build(nullptr, 0, desc);
+                mutableShadowMap->SetLoadState(Resource::LoadState::k_loaded);
+                
+                m_shadowMaps.push_back(mutableShadowMap);
+                m_shadowMapTargets.push_back(TargetGroup::CreateDepthTargetGroup(m_shadowMaps.back()));
+            }
         }
     }
     
     //------------------------------------------------------------------------------
     void DirectionalLightComponent::TryDestroyShadowMapTarget() noexcept
     {
-        if (m_shadowMapTarget)
-        {
-            m_shadowMapTarget.reset();
-        }
+        m_shadowMapTargets.clear();
         
-        if (m_shadowMap)
+        if (!m_shadowMaps.empty())
         {
             auto resourcePool = Application::Get()->GetResourcePool();
             
-            auto release = m_shadowMap.get();
-            m_shadowMap.reset();
-            resourcePool->Release(release);
+            for (auto& shadowMap : m_shadowMaps)
+            {
+                auto release = shadowMap.get();
+                shadowMap.reset();
+                resourcePool->Release(release);
+            }
+            
+            m_shadowMaps.clear();
         }
     }
     
@@ -169,12 +287,35 @@ namespace ChilliSource
     //------------------------------------------------------------------------------
     void DirectionalLightComponent::OnRenderSnapshot(RenderSnapshot& renderSnapshot) noexcept
     {
-        if (m_shadowMap)
+        if (!m_shadowMaps.empty() && !m_shadowCascadeSplits.empty())
+        {
+            const auto& transform = GetEntity()->GetTransform();
+            auto worldMatrix = transform.GetWorldTransform();
+            auto orientation = transform.GetWorldOrientation();
+            auto renderCamera = renderSnapshot.GetRenderCamera();
+            auto lightViewMatrix = Matrix4::Inverse(worldMatrix);
+            
+            std::array<Matrix4, DirectionalRenderLight::k_maxShadowCascades> lightProjections;
+            std::array<const RenderTargetGroup*, DirectionalRenderLight::k_maxShadowCascades> shadowMapTargets = {{ nullptr, nullptr, nullptr, nullptr }};
+            
+            f32 cascadeNear = 0.0f;
+            for (u32 i = 0; i < m_shadowCascadeSplits.size(); ++i)
+            {
+                auto sectionCorners = CalcFrustumSectionCorners(renderCamera, cascadeNear, m_shadowCascadeSplits[i]);
+                lightProjections[i] = CalcCascadeProjection(sectionCorners, lightViewMatrix, m_shadowMapResolution, m_shadowVolumeNear);
+                shadowMapTargets[i] = m_shadowMapTargets[i]->GetRenderTargetGroup();
+                cascadeNear = m_shadowCascadeSplits[i];
+            }
+            
+            renderSnapshot.AddDirectionalRenderLight(DirectionalRenderLight(GetFinalColour(), m_direction, worldMatrix, lightProjections, orientation, m_shadowTolerance, shadowMapTargets,
+                                                                            u32(m_shadowCascadeSplits.size())));
+        }
+        else if (!m_shadowMaps.empty())
         {
             const auto& transform = GetEntity()->GetTransform();
             auto worldMatrix = transform.GetWorldTransform();
             auto orientation = transform.GetWorldOrientation();
-            renderSnapshot.AddDirectionalRenderLight(DirectionalRenderLight(GetFinalColour(), m_direction, worldMatrix, m_lightProjection, orientation, m_shadowTolerance, m_shadowMapTarget->GetRenderTargetGroup()));
+            renderSnapshot.AddDirectionalRenderLight(DirectionalRenderLight(GetFinalColour(), m_direction, worldMatrix, m_lightProjection, orientation, m_shadowTolerance, m_shadowMapTargets[0]->GetRenderTargetGroup()));
         }
         else
         {
@@ -31,12 +31,19 @@
 #include <ChilliSource/Core/Math/Matrix4.h>
 #include <ChilliSource/Rendering/Target/TargetGroup.h>
 
+#include <vector>
+
 namespace ChilliSource
 {
     /// A component which describes a directional light. While this is in the scene all lit
     /// objects will have directional lighting applied to it. Optionally, the light can
     /// cast shadows.
     ///
+    /// Shadows are rendered into a single shadow map covering the shadow volume by default.
+    /// Alternatively, cascaded shadow maps can be enabled, splitting the view of the main
+    /// camera into depth ranges which each get their own shadow map fitted tightly to that
+    /// range.
+    ///
     /// This is not thread-safe and should only be accessed from the main thread.
     ///
     class DirectionalLightComponent final : public Component
@@ -123,6 +130,26 @@ namespace ChilliSource
         ///
         void SetShadowVolume(f32 width, f32 height, f32 near, f32 far) noexcept;
         
+        /// Enables cascaded shadow maps with the given split distances. Each split distance
+        /// is the view space depth from the main camera at which a cascade ends, so the first
+        /// cascade covers the range from the camera near plane to the first split, the second
+        /// from the first split to the second, and so on. Split distances must be in ascending
+        /// order, and there can be no more than DirectionalRenderLight::k_maxShadowCascades.
+        ///
+        /// Each cascade has its own shadow map at the resolution described by the shadow quality
+        /// and the light projection for each is fitted to its range of the camera frustum every
+        /// frame. The shadow volume width and height are ignored while cascades are enabled,
+        /// however shadows will still be cast from objects as near to the light as the shadow
+        /// volume near plane.
+        ///
+        /// Passing an empty list disables cascades. This has no effect if the light doesn't cast
+        /// shadows.
+        ///
+        /// @param splitDistances
+        ///     The split distances.
+        ///
+        void SetShadowCascades(const std::vector<f32>& splitDistances) noexcept;
+        
         /// @return The colour of the directional light.
         ///
         const Colour& GetColour() const noexcept { return m_colour; }
@@ -142,16 +169,22 @@ namespace ChilliSource
         ///
         f32 GetShadowTolerance() const noexcept { return m_shadowTolerance; }
         
+        /// @return The cascade split distances. This will be empty if cascaded shadow maps are
+        ///     not enabled.
+        ///
+        const std::vector<f32>& GetShadowCascades() const noexcept { return m_shadowCascadeSplits; }
+        
         /// Cleans up shadow textures if required.
         ///
         ~DirectionalLightComponent() noexcept;
         
     private:
-        /// Create the shadow map target and texture if required.
+        /// Create the shadow map targets and textures if required. There will be one for each
+        /// cascade, or a single target if cascades are not enabled.
         ///
         void TryCreateShadowMapTarget() noexcept;
         
-        /// Destroys the shadow map target and texture if required.
+        /// Destroys the shadow map targets and textures if required.
         ///
         void TryDestroyShadowMapTarget() noexcept;
         
@@ -184,10 +217,12 @@ namespace ChilliSource
         
         Vector3 m_direction;
         Matrix4 m_lightProjection;
+        f32 m_shadowVolumeNear = 0.0f;
+        std::vector<f32> m_shadowCascadeSplits;
         Integer2 m_shadowMapResolution;
         s32 m_shadowMapId = -1;
-        TextureCSPtr m_shadowMap;
-        TargetGroupUPtr m_shadowMapTarget = nullptr;
+        std::vector<TextureCSPtr> m_shadowMaps;
+        std::vector<TargetGroupUPtr> m_shadowMapTargets;
         
         EventConnectionUPtr m_transformChangedConnection;
     };
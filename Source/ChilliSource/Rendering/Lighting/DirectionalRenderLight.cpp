@@ -41,9 +41,25 @@ namespace ChilliSource
     //------------------------------------------------------------------------------
     DirectionalRenderLight::DirectionalRenderLight(const Colour& colour, const Vector3& direction, const Matrix4& lightWorldMatrix, const Matrix4& lightProjectionMatrix, const Quaternion& lightOrientation,
                                                    f32 shadowTolerance, const RenderTargetGroup* shadowMapTarget) noexcept
-        : m_colour(colour), m_direction(direction), m_lightWorldMatrix(lightWorldMatrix), m_lightProjectionMatrix(lightProjectionMatrix), m_lightOrientation(lightOrientation),
-          m_shadowTolerance(shadowTolerance), m_shadowMapTarget(shadowMapTarget)
+        : m_colour(colour), m_direction(direction), m_lightWorldMatrix(lightWorldMatrix), m_lightOrientation(lightOrientation), m_shadowTolerance(shadowTolerance), m_numShadowCascades(1)
     {
-        CS_ASSERT(m_shadowMapTarget, "Shadow map target cannot be null.");
+        CS_ASSERT(shadowMapTarget, "Shadow map target cannot be null.");
+        
+        m_lightProjectionMatrices[0] = lightProjectionMatrix;
+        m_shadowMapTargets[0] = shadowMapTarget;
+    }
+    
+    //------------------------------------------------------------------------------
+    DirectionalRenderLight::DirectionalRenderLight(const Colour& colour, const Vector3& direction, const Matrix4& lightWorldMatrix, const std::array<Matrix4, k_maxShadowCascades>& lightProjectionMatrices,
+                                                   const Quaternion& lightOrientation, f32 shadowTolerance, const std::array<const RenderTargetGroup*, k_maxShadowCascades>& shadowMapTargets, u32 numShadowCascades) noexcept
+        : m_colour(colour), m_direction(direction), m_lightWorldMatrix(lightWorldMatrix), m_lightProjectionMatrices(lightProjectionMatrices), m_lightOrientation(lightOrientation),
+          m_shadowTolerance(shadowTolerance), m_shadowMapTargets(shadowMapTargets), m_numShadowCascades(numShadowCascades)
+    {
+        CS_ASSERT(m_numShadowCascades > 0 && m_numShadowCascades <= k_maxShadowCascades, "Invalid number of shadow cascades.");
+        
+        for (u32 i = 0; i < m_numShadowCascades; ++i)
+        {
+            CS_ASSERT(m_shadowMapTargets[i], "Shadow map target cannot be null.");
+        }
     }
 }
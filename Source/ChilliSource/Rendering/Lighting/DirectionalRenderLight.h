@@ -31,14 +31,21 @@
 #include <ChilliSource/Core/Math/Quaternion.h>
 #include <ChilliSource/Core/Math/Vector3.h>
 
+#include <array>
+
 namespace ChilliSource
 {
     /// A standard-layout container for data the renderer needs which pertains to a single
     /// direction light, such as the colour and direction.
     ///
+    /// A shadow casting light has one or more shadow cascades, each of which has its own
+    /// projection and shadow map target. Cascades are ordered from nearest the camera to
+    /// furthest.
+    ///
     class DirectionalRenderLight final
     {
     public:
+        static constexpr u32 k_maxShadowCascades = 4;
         
         /// Creates a new instance of the container with default black colour and v-down direction
         /// with no shadow map.
@@ -76,6 +83,29 @@ namespace ChilliSource
         DirectionalRenderLight(const Colour& colour, const Vector3& direction, const Matrix4& lightWorldMatrix, const Matrix4& lightProjectionMatrix, const Quaternion& lightOrientation,
                                f32 shadowTolerance, const RenderTargetGroup* shadowMapTarget) noexcept;
         
+        /// Creates a new instance of the container with the given light colour and direction
+        /// and cascaded shadow map data.
+        ///
+        /// @param colour
+        ///     The colour of the light.
+        /// @param direction
+        ///     The direction of the light.
+        /// @param lightWorldMatrix
+        ///     The light world matrix, required for rendering the shadow maps.
+        /// @param lightProjectionMatrices
+        ///     The light projection matrix for each cascade.
+        /// @param lightOrientation
+        ///     The light orientation, required for rendering the shadow maps.
+        /// @param shadowTolerance
+        ///     The tolerence used to judge if an object is in shadow.
+        /// @param shadowMapTargets
+        ///     The render target group for each cascade.
+        /// @param numShadowCascades
+        ///     The number of cascades. Must be between 1 and k_maxShadowCascades.
+        ///
+        DirectionalRenderLight(const Colour& colour, const Vector3& direction, const Matrix4& lightWorldMatrix, const std::array<Matrix4, k_maxShadowCascades>& lightProjectionMatrices,
+                               const Quaternion& lightOrientation, f32 shadowTolerance, const std::array<const RenderTargetGroup*, k_maxShadowCascades>& shadowMapTargets, u32 numShadowCascades) noexcept;
+        
         /// @return The colour of the light.
         ///
         const Colour& GetColour() const noexcept { return m_colour; }
@@ -88,9 +118,12 @@ namespace ChilliSource
         ///
         const Matrix4& GetLightWorldMatrix() const noexcept { return m_lightWorldMatrix; }
         
+        /// @param cascadeIndex
+        ///     (Optional) The index of the shadow cascade. Defaults to the first.
+        ///
         /// @return The light projection matrix, required for rendering the shadow map.
         ///
-        const Matrix4& GetLightProjectionMatrix() const noexcept { return m_lightProjectionMatrix; }
+        const Matrix4& GetLightProjectionMatrix(u32 cascadeIndex = 0) const noexcept { return m_lightProjectionMatrices[cascadeIndex]; }
         
         /// @return The light orientation, required for rendering the shadow map.
         ///
@@ -100,19 +133,27 @@ namespace ChilliSource
         ///
         f32 GetShadowTolerance() const noexcept { return m_shadowTolerance; }
         
+        /// @param cascadeIndex
+        ///     (Optional) The index of the shadow cascade. Defaults to the first.
+        ///
         /// @return The render texture group which should be used for the shadow map. Will be null if there is
         ///     no shadow map.
         ///
-        const RenderTargetGroup* GetShadowMapTarget() const noexcept { return m_shadowMapTarget; }
+        const RenderTargetGroup* GetShadowMapTarget(u32 cascadeIndex = 0) const noexcept { return m_shadowMapTargets[cascadeIndex]; }
+        
+        /// @return The number of shadow cascades. This will be zero if there is no shadow map.
+        ///
+        u32 GetNumShadowCascades() const noexcept { return m_numShadowCascades; }
         
     private:
         Colour m_colour;
         Vector3 m_direction;
         Matrix4 m_lightWorldMatrix;
-        Matrix4 m_lightProjectionMatrix;
+        std::array<Matrix4, k_maxShadowCascades> m_lightProjectionMatrices;
         Quaternion m_lightOrientation;
         f32 m_shadowTolerance = 0.0f;
-        const RenderTargetGroup* m_shadowMapTarget = nullptr;
+        std::array<const RenderTargetGroup*, k_maxShadowCascades> m_shadowMapTargets = {{ nullptr, nullptr, nullptr, nullptr }};
+        u32 m_numShadowCascades = 0;
     };
 }
 
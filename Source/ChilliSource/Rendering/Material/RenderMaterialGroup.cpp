@@ -60,11 +60,23 @@ namespace ChilliSource
     {
         CS_ASSERT(passIndex < k_numMaterialSlots, "Pass index is out of bounds.");
         
+        auto collection = GetCollection(vertexFormat);
+        if (collection)
+        {
+            return collection->GetRenderMaterial(passIndex);
+        }
+        
+        return nullptr;
+    }
+    
+    //------------------------------------------------------------------------------
+    const RenderMaterialGroup::Collection* RenderMaterialGroup::GetCollection(const VertexFormat& vertexFormat) const noexcept
+    {
         for (const auto& collection : m_collections)
         {
             if (collection.GetVertexFormat() == vertexFormat)
             {
-                return collection.GetRenderMaterial(passIndex);
+                return &collection;
             }
         }
         
@@ -76,6 +88,13 @@ namespace ChilliSource
     RenderMaterialGroup::Collection::Collection(const VertexFormat& vertexFormat, const std::array<const RenderMaterial*, k_numMaterialSlots>& renderMaterials) noexcept
         : m_vertexFormat(vertexFormat), m_renderMaterials(renderMaterials)
     {
+        for (u32 passIndex = 0; passIndex < k_numMaterialSlots; ++passIndex)
+        {
+            if (m_renderMaterials[passIndex])
+            {
+                m_renderMaterialMask |= 1u << passIndex;
+            }
+        }
     }
     
     //------------------------------------------------------------------------------
@@ -83,9 +83,15 @@ namespace ChilliSource
             ///
             const RenderMaterial* GetRenderMaterial(u32 passIndex) const noexcept;
             
+            /// @return A mask describing which passes have a render material in this collection. Bit n is
+            ///     set if the render material for pass index n is not null.
+            ///
+            u32 GetRenderMaterialMask() const noexcept { return m_renderMaterialMask; }
+            
         private:
             VertexFormat m_vertexFormat;
             std::array<const RenderMaterial*, k_numMaterialSlots> m_renderMaterials;
+            u32 m_renderMaterialMask = 0;
         };
         
         /// Evaluates whether or not the given RenderMaterial is part of this group.
@@ -108,6 +114,17 @@ namespace ChilliSource
         ///
         const RenderMaterial* GetRenderMaterial(const VertexFormat& vertexFormat, u32 passIndex) const noexcept;
         
+        /// Looks up the collection of render materials for the given vertex format. This allows the
+        /// materials for every pass to be resolved with a single vertex format comparison. The
+        /// returned collection remains valid for the lifetime of the group.
+        ///
+        /// @param vertexFormat
+        ///     The vertex format for which to get the collection.
+        ///
+        /// @return The collection of render materials. May be null if the vertex format is not supported.
+        ///
+        const Collection* GetCollection(const VertexFormat& vertexFormat) const noexcept;
+        
         /// Exposes the render materials so their extra data can be set during loading
         /// and unloading.
         ///
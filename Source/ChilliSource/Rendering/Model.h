@@ -32,6 +32,8 @@
 
 #include <ChilliSource/ChilliSource.h>
 #include <ChilliSource/Rendering/Model/AnimatedModelComponent.h>
+#include <ChilliSource/Rendering/Model/AnimatedModelSystem.h>
+#include <ChilliSource/Rendering/Model/CompressedSkinnedAnimation.h>
 #include <ChilliSource/Rendering/Model/CSAnimProvider.h>
 #include <ChilliSource/Rendering/Model/CSModelProvider.h>
 #include <ChilliSource/Rendering/Model/IndexFormat.h>
@@ -49,6 +51,7 @@
 #include <ChilliSource/Rendering/Model/SkeletonDesc.h>
 #include <ChilliSource/Rendering/Model/SkinnedAnimation.h>
 #include <ChilliSource/Rendering/Model/SkinnedAnimationGroup.h>
+#include <ChilliSource/Rendering/Model/SkinnedAnimationResourceOptions.h>
 #include <ChilliSource/Rendering/Model/SmallMeshBatcher.h>
 #include <ChilliSource/Rendering/Model/StaticModelComponent.h>
 #include <ChilliSource/Rendering/Model/VertexFormat.h>
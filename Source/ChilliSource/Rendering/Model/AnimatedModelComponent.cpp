@@ -25,12 +25,17 @@
 #include <ChilliSource/Rendering/Model/AnimatedModelComponent.h>
 
 #include <ChilliSource/Core/Base/Application.h>
+#include <ChilliSource/Core/Delegate/MakeDelegate.h>
 #include <ChilliSource/Core/Entity/Entity.h>
 #include <ChilliSource/Rendering/Base/RenderSnapshot.h>
 #include <ChilliSource/Rendering/Material/Material.h>
+#include <ChilliSource/Rendering/Model/AnimatedModelSystem.h>
+#include <ChilliSource/Rendering/Model/RenderSkinnedAnimation.h>
 #include <ChilliSource/Rendering/Model/Skeleton.h>
 
 #include <algorithm>
+#include <cmath>
+#include <functional>
 #include <limits>
 
 namespace ChilliSource
@@ -83,7 +88,7 @@ namespace ChilliSource
     //------------------------------------------------------------------------------
     const AABB& AnimatedModelComponent::GetAABB() noexcept
     {
-        if(GetEntity())
+        if(GetEntity() && m_model)
         {
             //Rebuild the box
             const AABB& cAABB = m_model->GetAABB();
@@ -200,6 +205,7 @@ namespace ChilliSource
         
         m_oobb.SetSize(m_model->GetAABB().GetSize());
         m_oobb.SetOrigin(m_model->GetAABB().GetOrigin());
+        OnEntityTransformChanged();
         
         SetMaterial(GetMaterialForMesh(0));
         
@@ -219,6 +225,7 @@ namespace ChilliSource
         
         m_oobb.SetSize(m_model->GetAABB().GetSize());
         m_oobb.SetOrigin(m_model->GetAABB().GetOrigin());
+        OnEntityTransformChanged();
         
         SetMaterial(material);
         
@@ -243,6 +250,7 @@ namespace ChilliSource
         
         m_oobb.SetSize(m_model->GetAABB().GetSize());
         m_oobb.SetOrigin(m_model->GetAABB().GetOrigin());
+        OnEntityTransformChanged();
         
         Reset();
     }
@@ -373,7 +381,8 @@ namespace ChilliSource
     {
         CS_ASSERT(m_activeAnimationGroup, "There must be an active animation group.");
         
-        if (m_activeAnimationGroup->IsPrepared())
+        //a group whose pose is shared won't have been evaluated itself, but can still be faded out.
+        if (m_activeAnimationGroup->IsPrepared() || m_sharedPoseIndex >= 0)
         {
             m_fadingAnimationGroup = m_activeAnimationGroup;
             m_activeAnimationGroup = SkinnedAnimationGroupSPtr(new SkinnedAnimationGroup(m_model->GetSkeleton()));
@@ -431,6 +440,22 @@ namespace ChilliSource
         m_finished = false;
     }
     
+    //------------------------------------------------------------------------------
+    void AnimatedModelComponent::SetPoseSharingEnabled(bool enabled) noexcept
+    {
+        m_poseSharingEnabled = enabled;
+        m_animationDataDirty = true;
+    }
+    
+    //------------------------------------------------------------------------------
+    void AnimatedModelComponent::SetPoseSharingInterval(f32 interval) noexcept
+    {
+        CS_ASSERT(interval > 0.0f, "Pose sharing interval must be greater than zero.");
+        
+        m_poseSharingInterval = interval;
+        m_animationDataDirty = true;
+    }
+    
     //------------------------------------------------------------------------------
     f32 AnimatedModelComponent::GetAnimationLength() const noexcept
     {
@@ -507,15 +532,14 @@ namespace ChilliSource
     }
     
     //------------------------------------------------------------------------------
-    void AnimatedModelComponent::UpdateAnimation(f32 deltaTime) noexcept
+    void AnimatedModelComponent::EvaluatePose(f32 playbackPosition) noexcept
     {
         CS_ASSERT(GetEntity(), "Must be attached to an entity.");
         CS_ASSERT(GetEntity()->GetScene(), "Must be attached to the scene.");
         CS_ASSERT(m_activeAnimationGroup, "Must have an active animation group.");
         CS_ASSERT(m_activeAnimationGroup->GetAnimationCount() > 0, "Must have at least one attached animation.");
         
-        UpdateAnimationTimer(deltaTime);
-        m_activeAnimationGroup->BuildAnimationData(m_animationBlendType, m_playbackPosition, m_blendlinePosition);
+        m_activeAnimationGroup->BuildAnimationData(m_animationBlendType, playbackPosition, m_blendlinePosition);
         
         //if there is a group fading out, then apply this to the active data.
         if (m_fadingAnimationGroup)
@@ -533,11 +557,71 @@ namespace ChilliSource
         }
         
         m_activeAnimationGroup->BuildMatrices();
-        UpdateAttachedEntities();
+        BuildJointData();
         
+        m_sharedPoseIndex = -1;
         m_animationDataDirty = false;
     }
     
+    //------------------------------------------------------------------------------
+    bool AnimatedModelComponent::CanSharePose() const noexcept
+    {
+        return m_poseSharingEnabled && !m_fadingAnimationGroup && m_attachedEntities.empty() && m_activeAnimationGroup->GetAnimationCount() > 0;
+    }
+    
+    //------------------------------------------------------------------------------
+    f32 AnimatedModelComponent::CalcSharedPosePlaybackPosition() const noexcept
+    {
+        f32 playbackPosition = std::floor(m_playbackPosition / m_poseSharingInterval + 0.5f) * m_poseSharingInterval;
+        return std::min(playbackPosition, GetAnimationLength());
+    }
+    
+    //------------------------------------------------------------------------------
+    std::size_t AnimatedModelComponent::HashSharedPose() const noexcept
+    {
+        std::size_t hash = std::hash<const Model*>()(m_model.get());
+        hash = hash * 31 + std::size_t(m_animationBlendType);
+        hash = hash * 31 + std::hash<f32>()(m_blendlinePosition);
+        hash = hash * 31 + m_activeAnimationGroup->HashAnimations();
+        
+        return hash;
+    }
+    
+    //------------------------------------------------------------------------------
+    bool AnimatedModelComponent::HasSameSharedPose(const AnimatedModelComponent& other) const noexcept
+    {
+        return m_model == other.m_model && m_animationBlendType == other.m_animationBlendType && m_blendlinePosition == other.m_blendlinePosition
+            && m_activeAnimationGroup->HasSameAnimations(*other.m_activeAnimationGroup);
+    }
+    
+    //------------------------------------------------------------------------------
+    void AnimatedModelComponent::BuildJointData() noexcept
+    {
+        const SkinnedAnimationGroup* animationGroup = nullptr;
+        if (m_activeAnimationGroup->IsPrepared() == true)
+        {
+            animationGroup = m_activeAnimationGroup.get();
+        }
+        else if (m_fadingAnimationGroup != nullptr && m_fadingAnimationGroup->IsPrepared() == true)
+        {
+            animationGroup = m_fadingAnimationGroup.get();
+        }
+        
+        if (animationGroup == nullptr)
+        {
+            m_jointData.clear();
+            return;
+        }
+        
+        u32 jointDataSize = animationGroup->GetJointDataSize();
+        m_jointData.resize(m_model->GetNumMeshes() * jointDataSize);
+        
+        for (u32 index = 0; index < m_model->GetNumMeshes(); ++index)
+        {
+            animationGroup->BuildJointData(m_model->GetRenderMesh(index)->GetInverseBindPoseMatrices(), m_jointData.data() + index * jointDataSize);
+        }
+    }
+    
     //------------------------------------------------------------------------------
     void AnimatedModelComponent::UpdateAnimationTimer(f32 deltaTime) noexcept
     {
@@ -612,13 +696,27 @@ namespace ChilliSource
     //------------------------------------------------------------------------------
     void AnimatedModelComponent::OnAddedToScene() noexcept
     {
+        m_transformChangedConnection = GetEntity()->GetTransform().GetTransformChangedEvent().OpenConnection(MakeDelegate(this, &AnimatedModelComponent::OnEntityTransformChanged));
+        
+        m_animatedModelSystem = Application::Get()->GetSystem<AnimatedModelSystem>();
+        CS_ASSERT(m_animatedModelSystem, "Animated model system is required.");
+        m_animatedModelSystem->Add(this);
+        
         SetPlaybackPosition(0.0f);
     }
     
+    //------------------------------------------------------------------------------
+    void AnimatedModelComponent::OnEntityTransformChanged() noexcept
+    {
+        InvalidateVolume();
+    }
+    
     //------------------------------------------------------------------------------
     void AnimatedModelComponent::OnUpdate(f32 deltaTime) noexcept
     {
-        UpdateAnimation(deltaTime);
+        UpdateAnimationTimer(deltaTime);
+        
+        m_animationDataDirty = true;
     }
     
     //------------------------------------------------------------------------------
@@ -628,11 +726,16 @@ namespace ChilliSource
         CS_ASSERT(m_model->GetNumMeshes() == m_materials.size(), "Invalid number of materials.");
         CS_ASSERT(m_activeAnimationGroup, "An animated model must always have an active animation group.");
         
+        //the pose will typically have been evaluated by the animated model system, but if the animation changed after that it needs to be evaluated here.
         if (m_animationDataDirty == true)
         {
-            UpdateAnimation(0.0f);
+            EvaluatePose(m_playbackPosition);
+            UpdateAttachedEntities();
         }
         
+        CS_ASSERT(m_sharedPoseIndex >= 0 || m_jointData.empty() == false, "No render skinned animation.");
+        u32 jointDataSize = u32(m_jointData.size()) / m_model->GetNumMeshes();
+        
         for (u32 index = 0; index < m_model->GetNumMeshes(); ++index)
         {
             CS_ASSERT(m_materials[index]->GetLoadState() == Resource::LoadState::k_loaded, "Cannot use a material that hasn't been loaded yet.");
@@ -643,26 +746,34 @@ namespace ChilliSource
             const auto& transform = GetEntity()->GetTransform();
             auto boundingSphere = Sphere::Transform(renderMesh->GetBoundingSphere(), transform.GetWorldPosition(), transform.GetWorldScale());
             
-            RenderSkinnedAnimationAUPtr renderSkinnedAnimation;
-            if (m_activeAnimationGroup->IsPrepared() == true)
+            if (m_sharedPoseIndex >= 0)
             {
-                renderSkinnedAnimation = m_activeAnimationGroup->BuildRenderSkinnedAnimation(renderSnapshot.GetFrameAllocator(), renderMesh->GetInverseBindPoseMatrices());
+                auto renderSkinnedAnimation = m_animatedModelSystem->GetSharedRenderSkinnedAnimation(u32(m_sharedPoseIndex), index, renderSnapshot);
+                renderSnapshot.AddRenderObject(RenderObject(renderMaterialGroup, renderMesh, renderSkinnedAnimation, GetEntity()->GetTransform().GetWorldTransform(), boundingSphere,
+                                                            m_shadowCastingEnabled, RenderLayer::k_standard));
             }
-            else if (m_fadingAnimationGroup != nullptr && m_fadingAnimationGroup->IsPrepared() == true)
+            else
             {
-                renderSkinnedAnimation = m_fadingAnimationGroup->BuildRenderSkinnedAnimation(renderSnapshot.GetFrameAllocator(), renderMesh->GetInverseBindPoseMatrices());
+                auto jointData = MakeUniqueArray<Vector4>(*renderSnapshot.GetFrameAllocator(), jointDataSize);
+                auto meshJointData = m_jointData.begin() + index * jointDataSize;
+                std::copy(meshJointData, meshJointData + jointDataSize, jointData.get());
+                
+                auto renderSkinnedAnimation = MakeUnique<RenderSkinnedAnimation>(*renderSnapshot.GetFrameAllocator(), std::move(jointData), jointDataSize);
+                renderSnapshot.AddRenderObject(RenderObject(renderMaterialGroup, renderMesh, renderSkinnedAnimation.get(), GetEntity()->GetTransform().GetWorldTransform(), boundingSphere,
+                                                               m_shadowCastingEnabled, RenderLayer::k_standard));
+                renderSnapshot.AddRenderSkinnedAnimation(std::move(renderSkinnedAnimation));
             }
-            
-            CS_ASSERT(renderSkinnedAnimation, "No render skinned animation.");
-            renderSnapshot.AddRenderObject(RenderObject(renderMaterialGroup, renderMesh, renderSkinnedAnimation.get(), GetEntity()->GetTransform().GetWorldTransform(), boundingSphere,
-                                                           m_shadowCastingEnabled, RenderLayer::k_standard));
-            renderSnapshot.AddRenderSkinnedAnimation(std::move(renderSkinnedAnimation));
         }
     }
     
     //------------------------------------------------------------------------------
     void AnimatedModelComponent::OnRemovedFromScene() noexcept
     {
+        m_transformChangedConnection.reset();
+        
+        m_animatedModelSystem->Remove(this);
+        m_animatedModelSystem = nullptr;
+        
         DetatchAllEntities();
     }
 }
@@ -28,11 +28,13 @@
 #include <ChilliSource/ChilliSource.h>
 #include <ChilliSource/Core/Event/Event.h>
 #include <ChilliSource/Core/File/FileSystem.h>
+#include <ChilliSource/Core/Math/Vector4.h>
 #include <ChilliSource/Core/Volume/VolumeComponent.h>
 #include <ChilliSource/Rendering/Model/SkinnedAnimationGroup.h>
 #include <ChilliSource/Rendering/Model/Model.h>
 
 #include <functional>
+#include <vector>
 
 namespace ChilliSource
 {
@@ -449,6 +451,39 @@ namespace ChilliSource
         ///
         void SetBlendType(AnimationBlendType blendType) noexcept { m_animationBlendType = blendType; }
         
+        /// @return Whether or not the component may share its pose with other components.
+        ///
+        bool IsPoseSharingEnabled() const noexcept { return m_poseSharingEnabled; }
+        
+        /// Sets whether or not the component may share its pose with other components. Components
+        /// with pose sharing enabled which use the same model, the same attached animations, blend
+        /// type and blendline position, and which are at the same playback position once it has
+        /// been quantised to the pose sharing interval, are given a single shared pose. The pose is
+        /// only evaluated once and its joint data is only uploaded once per mesh, which makes this
+        /// well suited to crowds playing the same looping animations.
+        ///
+        /// The pose is not shared while an animation is fading out or while entities are attached
+        /// to the skeleton; in these cases it is evaluated as normal.
+        ///
+        /// @param enabled
+        ///     Whether or not pose sharing is enabled.
+        ///
+        void SetPoseSharingEnabled(bool enabled) noexcept;
+        
+        /// @return The interval in seconds that the playback position is quantised to when the pose
+        ///     is shared.
+        ///
+        f32 GetPoseSharingInterval() const noexcept { return m_poseSharingInterval; }
+        
+        /// Sets the interval in seconds that the playback position is quantised to when the pose is
+        /// shared. Larger intervals result in more components sharing the same pose, at the cost
+        /// of less smooth playback.
+        ///
+        /// @param interval
+        ///     The interval in seconds. Must be greater than zero.
+        ///
+        void SetPoseSharingInterval(f32 interval) noexcept;
+        
         /// @return The animation length in seconds.
         ///
         f32 GetAnimationLength() const noexcept;
@@ -492,12 +527,43 @@ namespace ChilliSource
         Event<AnimationLoopedDelegate>& GetAnimationLoopedEvent() noexcept { return m_animationLoopedEvent; }
         
     private:
-        /// Updates the animation, rebuilding the animation matrices.
+        friend class AnimatedModelSystem;
+        
+        /// Evaluates the pose of the animation at the given playback position, rebuilding the
+        /// animation matrices and the joint data for each mesh. This only touches data owned by
+        /// this component, so the poses of different components can be evaluated in parallel.
+        /// This is typically called by the AnimatedModelSystem.
         ///
-        /// @param deltaTime
-        ///     The delta time.
+        /// @param playbackPosition
+        ///     The playback position to evaluate the active animation group at.
         ///
-        void UpdateAnimation(f32 deltaTime) noexcept;
+        void EvaluatePose(f32 playbackPosition) noexcept;
+        
+        /// @return Whether or not the pose can currently be shared with other components.
+        ///
+        bool CanSharePose() const noexcept;
+        
+        /// @return The playback position quantised to the pose sharing interval. This is the
+        ///     position a shared pose is evaluated at.
+        ///
+        f32 CalcSharedPosePlaybackPosition() const noexcept;
+        
+        /// @return A hash of everything other than the playback position which determines the
+        ///     shared pose. Components for which HasSameSharedPose() is true have the same hash.
+        ///
+        std::size_t HashSharedPose() const noexcept;
+        
+        /// @param other
+        ///     The component to compare against.
+        ///
+        /// @return Whether or not the other component would produce the same pose as this one
+        ///     when evaluated at the same playback position.
+        ///
+        bool HasSameSharedPose(const AnimatedModelComponent& other) const noexcept;
+        
+        /// Builds the joint data for each mesh in the model from the current animation matrices.
+        ///
+        void BuildJointData() noexcept;
 
         /// Updates the animation timer.
         ///
@@ -517,8 +583,14 @@ namespace ChilliSource
         /// Triggered when the component is added to the scene.
         ///
         void OnAddedToScene() noexcept override;
+        
+        /// Delegate called when the owning entities transform changes, or the model is changed.
+        /// This is used to dirty the bounding volumes.
+        ///
+        void OnEntityTransformChanged() noexcept;
 
-        /// Updates the animation.
+        /// Updates the animation timer. The pose itself is evaluated later in the frame by the
+        /// AnimatedModelSystem.
         ///
         /// @param deltaTime
         ///     The delta time.
@@ -557,10 +629,17 @@ namespace ChilliSource
         f32 m_fadeBlendlinePosition = 0.0f;
         bool m_finished = false;
         bool m_animationDataDirty = true;
+        bool m_poseSharingEnabled = false;
+        f32 m_poseSharingInterval = 1.0f / 30.0f;
+        s32 m_sharedPoseIndex = -1;
         Event<AnimationCompletionDelegate> m_animationCompletionEvent;
         Event<AnimationLoopedDelegate> m_animationLoopedEvent;
         Event<AnimationChangedDelegate> m_animationChangedEvent;
         
+        EventConnectionUPtr m_transformChangedConnection;
+        AnimatedModelSystem* m_animatedModelSystem = nullptr;
+        std::vector<Vector4> m_jointData;
+        
         AABB m_aabb;
         OOBB m_oobb;
         Sphere m_boundingSphere;
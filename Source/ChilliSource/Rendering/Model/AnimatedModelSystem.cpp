@@ -0,0 +1,197 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2016 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#include <ChilliSource/Rendering/Model/AnimatedModelSystem.h>
+
+#include <ChilliSource/Core/Base/Application.h>
+#include <ChilliSource/Core/Threading/TaskScheduler.h>
+#include <ChilliSource/Rendering/Base/RenderSnapshot.h>
+#include <ChilliSource/Rendering/Model/AnimatedModelComponent.h>
+#include <ChilliSource/Rendering/Model/Model.h>
+#include <ChilliSource/Rendering/Model/RenderSkinnedAnimation.h>
+
+#include <algorithm>
+#include <functional>
+
+namespace ChilliSource
+{
+    namespace
+    {
+        constexpr u32 k_minComponentsPerBatch = 2;
+    }
+    
+    CS_DEFINE_NAMEDTYPE(AnimatedModelSystem);
+    
+    //------------------------------------------------------------------------------
+    AnimatedModelSystemUPtr AnimatedModelSystem::Create() noexcept
+    {
+        return AnimatedModelSystemUPtr(new AnimatedModelSystem());
+    }
+    
+    //------------------------------------------------------------------------------
+    bool AnimatedModelSystem::IsA(InterfaceIDType interfaceId) const noexcept
+    {
+        return (AnimatedModelSystem::InterfaceID == interfaceId);
+    }
+    
+    //------------------------------------------------------------------------------
+    void AnimatedModelSystem::Add(AnimatedModelComponent* animatedModelComponent) noexcept
+    {
+        CS_ASSERT(animatedModelComponent, "Cannot add a null component.");
+        CS_ASSERT(std::find(m_components.begin(), m_components.end(), animatedModelComponent) == m_components.end(), "Component has already been added.");
+        
+        m_components.push_back(animatedModelComponent);
+    }
+    
+    //------------------------------------------------------------------------------
+    void AnimatedModelSystem::Remove(AnimatedModelComponent* animatedModelComponent) noexcept
+    {
+        auto it = std::find(m_components.begin(), m_components.end(), animatedModelComponent);
+        CS_ASSERT(it != m_components.end(), "Component has not been added.");
+        
+        m_components.erase(it);
+    }
+    
+    //------------------------------------------------------------------------------
+    void AnimatedModelSystem::EvaluatePoses() noexcept
+    {
+        m_dirtyComponents.clear();
+        m_sharedPoseLookup.clear();
+        m_numSharedPoses = 0;
+        
+        for (auto component : m_components)
+        {
+            //shared poses only last a single frame, so any component using one must be re-added.
+            if (component->m_animationDataDirty || component->m_sharedPoseIndex >= 0)
+            {
+                if (component->CanSharePose())
+                {
+                    AddToSharedPose(component);
+                }
+                else
+                {
+                    m_dirtyComponents.push_back(component);
+                }
+            }
+        }
+        
+        const auto& taskContext = Application::Get()->GetTaskScheduler()->GetGameLogicTaskContext();
+        auto dirtyComponents = m_dirtyComponents.data();
+        auto numDirtyComponents = u32(m_dirtyComponents.size());
+        auto sharedPoses = m_sharedPoses.data();
+        taskContext.ParallelFor(numDirtyComponents + m_numSharedPoses, k_minComponentsPerBatch, [=](const TaskContext& innerTaskContext, u32 startIndex, u32 endIndex)
+        {
+            for (u32 i = startIndex; i < endIndex; ++i)
+            {
+                if (i < numDirtyComponents)
+                {
+                    dirtyComponents[i]->EvaluatePose(dirtyComponents[i]->m_playbackPosition);
+                }
+                else
+                {
+                    auto& sharedPose = sharedPoses[i - numDirtyComponents];
+                    sharedPose.m_component->EvaluatePose(sharedPose.m_playbackPosition);
+                    sharedPose.m_jointData = sharedPose.m_component->m_jointData;
+                }
+            }
+        });
+        
+        for (auto component : m_dirtyComponents)
+        {
+            component->UpdateAttachedEntities();
+        }
+        
+        for (u32 i = 0; i < m_numSharedPoses; ++i)
+        {
+            auto& sharedPose = m_sharedPoses[i];
+            auto numMeshes = sharedPose.m_component->GetModel()->GetNumMeshes();
+            
+            sharedPose.m_component->m_sharedPoseIndex = s32(i);
+            sharedPose.m_jointDataSize = u32(sharedPose.m_jointData.size()) / numMeshes;
+            sharedPose.m_renderSkinnedAnimations.assign(numMeshes, nullptr);
+        }
+    }
+    
+    //------------------------------------------------------------------------------
+    const RenderSkinnedAnimation* AnimatedModelSystem::GetSharedRenderSkinnedAnimation(u32 sharedPoseIndex, u32 meshIndex, RenderSnapshot& renderSnapshot) noexcept
+    {
+        CS_ASSERT(sharedPoseIndex < m_numSharedPoses, "Shared pose index out of bounds.");
+        
+        auto& sharedPose = m_sharedPoses[sharedPoseIndex];
+        CS_ASSERT(meshIndex < sharedPose.m_renderSkinnedAnimations.size(), "Mesh index out of bounds.");
+        CS_ASSERT(sharedPose.m_jointData.empty() == false, "Shared pose has no joint data.");
+        
+        auto& renderSkinnedAnimation = sharedPose.m_renderSkinnedAnimations[meshIndex];
+        if (!renderSkinnedAnimation)
+        {
+            auto jointData = MakeUniqueArray<Vector4>(*renderSnapshot.GetFrameAllocator(), sharedPose.m_jointDataSize);
+            auto meshJointData = sharedPose.m_jointData.begin() + meshIndex * sharedPose.m_jointDataSize;
+            std::copy(meshJointData, meshJointData + sharedPose.m_jointDataSize, jointData.get());
+            
+            auto ownedRenderSkinnedAnimation = MakeUnique<RenderSkinnedAnimation>(*renderSnapshot.GetFrameAllocator(), std::move(jointData), sharedPose.m_jointDataSize);
+            renderSkinnedAnimation = ownedRenderSkinnedAnimation.get();
+            renderSnapshot.AddRenderSkinnedAnimation(std::move(ownedRenderSkinnedAnimation));
+        }
+        
+        return renderSkinnedAnimation;
+    }
+    
+    //------------------------------------------------------------------------------
+    void AnimatedModelSystem::AddToSharedPose(AnimatedModelComponent* animatedModelComponent) noexcept
+    {
+        auto playbackPosition = animatedModelComponent->CalcSharedPosePlaybackPosition();
+        auto hash = animatedModelComponent->HashSharedPose() * 31 + std::hash<f32>()(playbackPosition);
+        
+        s32 firstWithSameHash = -1;
+        auto lookupIt = m_sharedPoseLookup.find(hash);
+        if (lookupIt != m_sharedPoseLookup.end())
+        {
+            firstWithSameHash = s32(lookupIt->second);
+            for (auto index = firstWithSameHash; index >= 0; index = m_sharedPoses[index].m_nextWithSameHash)
+            {
+                const auto& sharedPose = m_sharedPoses[index];
+                if (sharedPose.m_playbackPosition == playbackPosition && sharedPose.m_component->HasSameSharedPose(*animatedModelComponent))
+                {
+                    animatedModelComponent->m_sharedPoseIndex = index;
+                    animatedModelComponent->m_animationDataDirty = false;
+                    return;
+                }
+            }
+        }
+        
+        //the shared poses are re-used between frames so their joint data buffers don't need to be re-allocated.
+        if (m_numSharedPoses == m_sharedPoses.size())
+        {
+            m_sharedPoses.emplace_back();
+        }
+        
+        auto& sharedPose = m_sharedPoses[m_numSharedPoses];
+        sharedPose.m_component = animatedModelComponent;
+        sharedPose.m_playbackPosition = playbackPosition;
+        sharedPose.m_nextWithSameHash = firstWithSameHash;
+        
+        m_sharedPoseLookup[hash] = m_numSharedPoses++;
+    }
+}
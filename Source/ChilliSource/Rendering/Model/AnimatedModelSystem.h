@@ -0,0 +1,155 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2016 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#ifndef _CHILLISOURCE_RENDERING_MODEL_ANIMATEDMODELSYSTEM_H_
+#define _CHILLISOURCE_RENDERING_MODEL_ANIMATEDMODELSYSTEM_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Math/Vector4.h>
+#include <ChilliSource/Core/System/AppSystem.h>
+
+#include <unordered_map>
+#include <vector>
+
+namespace ChilliSource
+{
+    /// A system which evaluates the skeletal poses of all AnimatedModelComponents in the scene
+    /// as a single parallel stage, rather than evaluating each component serially during its
+    /// update.
+    ///
+    /// Animated model components register themselves with the system when added to the scene.
+    /// Each frame, after all components have been updated, the application calls EvaluatePoses()
+    /// which evaluates the pose of every component whose animation has changed. Components don't
+    /// share any data while evaluating their pose, so each one is processed as an independent
+    /// task. Anything which isn't thread-safe, such as animation events or updating the transforms
+    /// of attached entities, remains on the main thread.
+    ///
+    /// Components with pose sharing enabled which would produce the same pose are grouped into a
+    /// single shared pose. Only one component in each group is evaluated, and the resulting joint
+    /// data is used to build a single RenderSkinnedAnimation per mesh which the whole group
+    /// renders with.
+    ///
+    /// This is not thread-safe and should only be accessed from the main thread.
+    ///
+    class AnimatedModelSystem final : public AppSystem
+    {
+    public:
+        CS_DECLARE_NAMEDTYPE(AnimatedModelSystem);
+        
+        /// Allows querying of whether or not this system implements the interface described by the
+        /// given interface Id. Typically this is not called directly as the templated equivalent
+        /// IsA<Interface>() is preferred.
+        ///
+        /// @param interfaceId
+        ///     The Id of the interface.
+        ///
+        /// @return Whether or not the interface is implemented.
+        ///
+        bool IsA(InterfaceIDType interfaceId) const noexcept override;
+        
+        /// Registers the given component with the system, so its pose will be evaluated during
+        /// EvaluatePoses(). This is called by the component when it is added to the scene.
+        ///
+        /// @param animatedModelComponent
+        ///     The component to register. Must not already be registered.
+        ///
+        void Add(AnimatedModelComponent* animatedModelComponent) noexcept;
+        
+        /// Unregisters the given component from the system. This is called by the component when
+        /// it is removed from the scene.
+        ///
+        /// @param animatedModelComponent
+        ///     The component to unregister. Must be registered.
+        ///
+        void Remove(AnimatedModelComponent* animatedModelComponent) noexcept;
+        
+        /// Evaluates the pose of each registered component whose animation data is dirty. The
+        /// poses are evaluated in parallel, after which the transforms of any entities attached
+        /// to the evaluated skeletons are updated on the main thread.
+        ///
+        /// This is called by the application once all components have been updated and before
+        /// transforms are resolved for the render snapshot.
+        ///
+        void EvaluatePoses() noexcept;
+        
+        /// Gets the render skinned animation for a single mesh of the given shared pose. This is
+        /// created in the given render snapshot the first time it is requested each frame, and is
+        /// then used by every component which shares the pose. This is called by the component
+        /// during the render snapshot phase.
+        ///
+        /// @param sharedPoseIndex
+        ///     The index of the shared pose, as assigned during EvaluatePoses().
+        /// @param meshIndex
+        ///     The index of the mesh in the model.
+        /// @param renderSnapshot
+        ///     The render snapshot the render skinned animation should be added to.
+        ///
+        /// @return The render skinned animation. This will remain valid for the rest of the frame.
+        ///
+        const RenderSkinnedAnimation* GetSharedRenderSkinnedAnimation(u32 sharedPoseIndex, u32 meshIndex, RenderSnapshot& renderSnapshot) noexcept;
+        
+    private:
+        friend class Application;
+        
+        /// A factory method for creating new instances of the system. This must be called by
+        /// Application.
+        ///
+        /// @return The new instance of the system.
+        ///
+        static AnimatedModelSystemUPtr Create() noexcept;
+        
+        /// A pose which is shared by all components which would produce it. The pose is evaluated
+        /// by the first of these components, and the resulting joint data is copied so it is
+        /// unaffected by any later changes to that component.
+        ///
+        struct SharedPose final
+        {
+            AnimatedModelComponent* m_component = nullptr;
+            f32 m_playbackPosition = 0.0f;
+            s32 m_nextWithSameHash = -1;
+            u32 m_jointDataSize = 0;
+            std::vector<Vector4> m_jointData;
+            std::vector<const RenderSkinnedAnimation*> m_renderSkinnedAnimations;
+        };
+        
+        AnimatedModelSystem() = default;
+        
+        /// Adds the given component to the shared pose it would produce, creating a new shared
+        /// pose if there isn't one yet this frame.
+        ///
+        /// @param animatedModelComponent
+        ///     The component. Must be able to share its pose.
+        ///
+        void AddToSharedPose(AnimatedModelComponent* animatedModelComponent) noexcept;
+        
+        std::vector<AnimatedModelComponent*> m_components;
+        std::vector<AnimatedModelComponent*> m_dirtyComponents;
+        std::vector<SharedPose> m_sharedPoses;
+        u32 m_numSharedPoses = 0;
+        std::unordered_map<std::size_t, u32> m_sharedPoseLookup;
+    };
+}
+
+#endif
@@ -34,6 +34,7 @@
 #include <ChilliSource/Core/Math/Vector3.h>
 #include <ChilliSource/Core/Threading/TaskScheduler.h>
 #include <ChilliSource/Rendering/Model/SkinnedAnimation.h>
+#include <ChilliSource/Rendering/Model/SkinnedAnimationResourceOptions.h>
 
 namespace ChilliSource
 {
@@ -147,6 +148,8 @@ namespace ChilliSource
     
     CS_DEFINE_NAMEDTYPE(CSAnimProvider);
     
+    const IResourceOptionsBaseCSPtr CSAnimProvider::s_defaultOptions(std::make_shared<SkinnedAnimationResourceOptions>());
+    
     //-------------------------------------------------------------------------
     //-------------------------------------------------------------------------
     CSAnimProviderUPtr CSAnimProvider::Create()
@@ -171,13 +174,19 @@ namespace ChilliSource
     {
         return (in_extension == k_fileExtension);
     }
+    //----------------------------------------------------
+    //----------------------------------------------------
+    IResourceOptionsBaseCSPtr CSAnimProvider::GetDefaultOptions() const
+    {
+        return s_defaultOptions;
+    }
     //----------------------------------------------------------------------------
     //----------------------------------------------------------------------------
     void CSAnimProvider::CreateResourceFromFile(StorageLocation in_location, const std::string& in_filePath, const IResourceOptionsBaseCSPtr& in_options, const ResourceSPtr& out_resource)
     {
         SkinnedAnimationSPtr anim = std::static_pointer_cast<SkinnedAnimation>(out_resource);
         
-        ReadSkinnedAnimationFromFile(in_location, in_filePath, nullptr, anim);
+        ReadSkinnedAnimationFromFile(in_location, in_filePath, in_options, nullptr, anim);
     }
     //----------------------------------------------------------------------------
     //----------------------------------------------------------------------------
@@ -186,13 +195,16 @@ namespace ChilliSource
         SkinnedAnimationSPtr anim = std::static_pointer_cast<SkinnedAnimation>(out_resource);
         Application::Get()->GetTaskScheduler()->ScheduleTask(TaskType::k_file, [=](const TaskContext&) noexcept
         {
-            ReadSkinnedAnimationFromFile(in_location, in_filePath, in_delegate, anim);
+            ReadSkinnedAnimationFromFile(in_location, in_filePath, in_options, in_delegate, anim);
         });
     }
     //----------------------------------------------------------------------------
     //----------------------------------------------------------------------------
-    void CSAnimProvider::ReadSkinnedAnimationFromFile(StorageLocation in_location, const std::string& in_filePath, const ResourceProvider::AsyncLoadDelegate& in_delegate, const SkinnedAnimationSPtr& out_resource) const
+    void CSAnimProvider::ReadSkinnedAnimationFromFile(StorageLocation in_location, const std::string& in_filePath, const IResourceOptionsBaseCSPtr& in_options, const ResourceProvider::AsyncLoadDelegate& in_delegate, const SkinnedAnimationSPtr& out_resource) const
     {
+        CS_ASSERT(in_options != nullptr, "Options for skinned animation load cannot be null");
+        
+
         IBinaryInputStreamUPtr stream = Application::Get()->GetFileSystem()->CreateBinaryInputStream(in_location, in_filePath);
 
         u32 numFrames = 0;
@@ -213,6 +225,12 @@ namespace ChilliSource
         
         ReadAnimationData(stream, numFrames, numSkeletonNodes, out_resource);
         
+        auto options = static_cast<const SkinnedAnimationResourceOptions*>(in_options.get());
+        if (options->IsCompressionEnabled() == true)
+        {
+            out_resource->Compress(options->GetErrorBudget());
+        }
+        
         out_resource->SetLoadState(Resource::LoadState::k_loaded);
         
         if(in_delegate != nullptr)
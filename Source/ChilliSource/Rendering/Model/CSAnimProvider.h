@@ -73,6 +73,11 @@ namespace ChilliSource
         /// @return Whether the object can create a resource with the given extension
         //----------------------------------------------------------------------------
         bool CanCreateResourceWithFileExtension(const std::string& in_extension) const override;
+        //----------------------------------------------------
+        /// @return Default options for skinned animation
+        /// loading.
+        //----------------------------------------------------
+        IResourceOptionsBaseCSPtr GetDefaultOptions() const override;
 
     private:
         //----------------------------------------------------------------------------
@@ -108,10 +113,13 @@ namespace ChilliSource
         ///
         /// @param The storage location to load from
         /// @param File path
+        /// @param Options to customise the creation
         /// @param Completion delegate
         /// @param [Out] the output resource pointer
         //----------------------------------------------------------------------------
-        void ReadSkinnedAnimationFromFile(StorageLocation in_location, const std::string& in_filePath, const ResourceProvider::AsyncLoadDelegate& in_delegate, const SkinnedAnimationSPtr& out_resource) const;
+        void ReadSkinnedAnimationFromFile(StorageLocation in_location, const std::string& in_filePath, const IResourceOptionsBaseCSPtr& in_options, const ResourceProvider::AsyncLoadDelegate& in_delegate, const SkinnedAnimationSPtr& out_resource) const;
+        
+        static const IResourceOptionsBaseCSPtr s_defaultOptions;
     };
 }
 
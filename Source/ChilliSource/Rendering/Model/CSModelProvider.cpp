@@ -495,24 +495,25 @@ namespace ChilliSource
         ModelSPtr meshResource = std::static_pointer_cast<Model>(out_resource);
         
         //Load model as task
-        Application::Get()->GetTaskScheduler()->ScheduleTask(TaskType::k_file, [=](const TaskContext&) noexcept
+        Application::Get()->GetTaskScheduler()->ScheduleTask(TaskType::k_file, [=](const TaskContext& in_taskContext) noexcept
         {
-            LoadMeshDataTask(in_location, in_filePath, in_delegate, meshResource);
+            LoadMeshDataTask(in_location, in_filePath, in_delegate, meshResource, in_taskContext);
         });
     }
     //----------------------------------------------------------------------------
     //----------------------------------------------------------------------------
-    void CSModelProvider::LoadMeshDataTask(StorageLocation in_location, const std::string& in_filePath, const AsyncLoadDelegate& in_delegate, const ModelSPtr& out_resource)
+    void CSModelProvider::LoadMeshDataTask(StorageLocation in_location, const std::string& in_filePath, const AsyncLoadDelegate& in_delegate, const ModelSPtr& out_resource, const TaskContext& in_taskContext)
     {
         //read the mesh data into a MoStaticDeclaration
         ModelDescSPtr modelDesc(new ModelDesc());
-        if (false == ReadFile(in_location, in_filePath, *modelDesc))
+        if (false == ReadFile(in_location, in_filePath, *modelDesc) || in_taskContext.IsCancelled() == true)
         {
             out_resource->SetLoadState(Resource::LoadState::k_failed);
             Application::Get()->GetTaskScheduler()->ScheduleTask(TaskType::k_mainThread, [=](const TaskContext&) noexcept
             {
                 in_delegate(out_resource);
             });
+            return;
         }
         
         //start a main thread task for loading the data into a mesh
@@ -110,8 +110,9 @@ namespace ChilliSource
         /// @param File path
         /// @param Delegate to callback on completion either success or failure
         /// @param the output resource pointer
+        /// @param The context of the file task. The load fails if this is cancelled.
         //----------------------------------------------------------------------------
-        void LoadMeshDataTask(StorageLocation in_location, const std::string& in_filePath, const AsyncLoadDelegate& in_delegate, const ModelSPtr& out_resource);
+        void LoadMeshDataTask(StorageLocation in_location, const std::string& in_filePath, const AsyncLoadDelegate& in_delegate, const ModelSPtr& out_resource, const TaskContext& in_taskContext);
     };
 }
 
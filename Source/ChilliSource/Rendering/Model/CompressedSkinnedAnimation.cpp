@@ -0,0 +1,643 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2016 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#include <ChilliSource/Rendering/Model/CompressedSkinnedAnimation.h>
+
+#include <ChilliSource/Core/Math/MathUtils.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace ChilliSource
+{
+    namespace
+    {
+        constexpr u32 k_maxLowVector3Value = 0xff;
+        constexpr u32 k_maxHighVector3Value = 0xffff;
+        constexpr u32 k_maxLowOrientationValue = 0x3ff;
+        constexpr u32 k_maxHighOrientationValue = 0x7fff;
+        
+        /// The smallest three components of a unit quaternion are always within +/- 1 / sqrt(2).
+        ///
+        constexpr f32 k_smallestThreeRange = 0.70710678f;
+        
+        /// The indices of the three components which are stored for each possible largest
+        /// component. Looking these up avoids branching on the index of the largest component.
+        ///
+        const u32 k_smallestThreeIndices[4][3] = { { 1, 2, 3 }, { 0, 2, 3 }, { 0, 1, 3 }, { 0, 1, 2 } };
+        
+        /// Appends the bytes of the given value to the given buffer.
+        ///
+        /// @param value
+        ///     The value to write.
+        /// @param buffer
+        ///     [Out] The buffer to write to.
+        ///
+        template <typename TType> void WriteValue(TType value, std::vector<u8>& buffer) noexcept
+        {
+            auto offset = buffer.size();
+            buffer.resize(offset + sizeof(TType));
+            std::memcpy(buffer.data() + offset, &value, sizeof(TType));
+        }
+        
+        /// Reads a value from the given data. The data does not need to be aligned.
+        ///
+        /// @param data
+        ///     The data to read from.
+        ///
+        /// @return The value.
+        ///
+        template <typename TType> TType ReadValue(const u8* data) noexcept
+        {
+            TType value;
+            std::memcpy(&value, data, sizeof(TType));
+            return value;
+        }
+        
+        /// Quantises the given value to an integer in the range [0, maxValue].
+        ///
+        /// @param value
+        ///     The value to quantise.
+        /// @param min
+        ///     The minimum of the range of values.
+        /// @param step
+        ///     The size of each quantisation step.
+        /// @param maxValue
+        ///     The maximum quantised value.
+        ///
+        /// @return The quantised value.
+        ///
+        u32 Quantise(f32 value, f32 min, f32 step, u32 maxValue) noexcept
+        {
+            if (step <= 0.0f)
+            {
+                return 0;
+            }
+            
+            f32 quantised = std::round((value - min) / step);
+            return u32(std::min(std::max(quantised, 0.0f), f32(maxValue)));
+        }
+        
+        /// @param params
+        ///     The min and step of each component, in the order min x, y, z, step x, y, z.
+        /// @param x
+        ///     The quantised x component.
+        /// @param y
+        ///     The quantised y component.
+        /// @param z
+        ///     The quantised z component.
+        ///
+        /// @return The dequantised value.
+        ///
+        Vector3 DequantiseVector3(const f32* params, u32 x, u32 y, u32 z) noexcept
+        {
+            return Vector3(params[0] + f32(x) * params[3], params[1] + f32(y) * params[4], params[2] + f32(z) * params[5]);
+        }
+        
+        /// Encodes the given orientation using smallest three encoding. The largest component is
+        /// dropped and the remaining three are quantised. As q and -q describe the same rotation,
+        /// the quaternion is negated if required so the dropped component is always positive and
+        /// can be rebuilt from the others.
+        ///
+        /// @param orientation
+        ///     The orientation to encode.
+        /// @param maxValue
+        ///     The maximum quantised value for each component.
+        /// @param outLargestIndex
+        ///     [Out] The index of the dropped component.
+        /// @param outValues
+        ///     [Out] The three quantised components.
+        ///
+        void EncodeSmallestThree(const Quaternion& orientation, u32 maxValue, u32& outLargestIndex, u32* outValues) noexcept
+        {
+            auto normalised = Quaternion::Normalise(orientation);
+            const f32 components[4] = { normalised.x, normalised.y, normalised.z, normalised.w };
+            
+            outLargestIndex = 0;
+            for (u32 i = 1; i < 4; ++i)
+            {
+                if (std::abs(components[i]) > std::abs(components[outLargestIndex]))
+                {
+                    outLargestIndex = i;
+                }
+            }
+            
+            f32 sign = (components[outLargestIndex] < 0.0f) ? -1.0f : 1.0f;
+            f32 step = (2.0f * k_smallestThreeRange) / f32(maxValue);
+            
+            const u32* otherIndices = k_smallestThreeIndices[outLargestIndex];
+            for (u32 i = 0; i < 3; ++i)
+            {
+                outValues[i] = Quantise(sign * components[otherIndices[i]], -k_smallestThreeRange, step, maxValue);
+            }
+        }
+        
+        /// Decodes an orientation which was encoded using smallest three encoding.
+        ///
+        /// @param largestIndex
+        ///     The index of the dropped component.
+        /// @param a
+        ///     The first quantised component.
+        /// @param b
+        ///     The second quantised component.
+        /// @param c
+        ///     The third quantised component.
+        /// @param maxValue
+        ///     The maximum quantised value for each component.
+        ///
+        /// @return The decoded orientation.
+        ///
+        Quaternion DecodeSmallestThree(u32 largestIndex, u32 a, u32 b, u32 c, u32 maxValue) noexcept
+        {
+            f32 step = (2.0f * k_smallestThreeRange) / f32(maxValue);
+            f32 valueA = -k_smallestThreeRange + f32(a) * step;
+            f32 valueB = -k_smallestThreeRange + f32(b) * step;
+            f32 valueC = -k_smallestThreeRange + f32(c) * step;
+            
+            const u32* otherIndices = k_smallestThreeIndices[largestIndex];
+            f32 components[4];
+            components[otherIndices[0]] = valueA;
+            components[otherIndices[1]] = valueB;
+            components[otherIndices[2]] = valueC;
+            components[largestIndex] = std::sqrt(std::max(1.0f - (valueA * valueA + valueB * valueB + valueC * valueC), 0.0f));
+            
+            return Quaternion(components[0], components[1], components[2], components[3]);
+        }
+        
+        /// Packs a smallest three encoded orientation into 32 bits: 2 bits for the index of the
+        /// dropped component followed by 10 bits for each of the other components.
+        ///
+        u32 PackLowOrientation(u32 largestIndex, const u32* values) noexcept
+        {
+            return (largestIndex << 30) | (values[0] << 20) | (values[1] << 10) | values[2];
+        }
+        
+        /// Unpacks an orientation packed with PackLowOrientation().
+        ///
+        Quaternion UnpackLowOrientation(u32 packed) noexcept
+        {
+            return DecodeSmallestThree(packed >> 30, (packed >> 20) & k_maxLowOrientationValue, (packed >> 10) & k_maxLowOrientationValue, packed & k_maxLowOrientationValue, k_maxLowOrientationValue);
+        }
+        
+        /// Packs a smallest three encoded orientation into three 16 bit values, each containing
+        /// 15 bits for a component. The index of the dropped component is stored in the top bit
+        /// of the first two values.
+        ///
+        void PackHighOrientation(u32 largestIndex, const u32* values, u16* outPacked) noexcept
+        {
+            outPacked[0] = u16(values[0] | ((largestIndex & 1) << 15));
+            outPacked[1] = u16(values[1] | ((largestIndex >> 1) << 15));
+            outPacked[2] = u16(values[2]);
+        }
+        
+        /// Unpacks an orientation packed with PackHighOrientation().
+        ///
+        Quaternion UnpackHighOrientation(u16 packedA, u16 packedB, u16 packedC) noexcept
+        {
+            u32 largestIndex = u32(packedA >> 15) | (u32(packedB >> 15) << 1);
+            return DecodeSmallestThree(largestIndex, packedA & k_maxHighOrientationValue, packedB & k_maxHighOrientationValue, packedC, k_maxHighOrientationValue);
+        }
+        
+        /// Calculates the angle between two orientations. This is calculated from the distance
+        /// between the two quaternions in double precision, as using the dot product is not
+        /// accurate enough for very small angles.
+        ///
+        /// @param a
+        ///     The first orientation.
+        /// @param b
+        ///     The second orientation.
+        ///
+        /// @return The angle in radians.
+        ///
+        f64 CalcAngleBetween(const Quaternion& a, const Quaternion& b) noexcept
+        {
+            auto normalisedA = Quaternion::Normalise(a);
+            auto normalisedB = Quaternion::Normalise(b);
+            f64 sign = (Quaternion::Dot(normalisedA, normalisedB) < 0.0f) ? -1.0 : 1.0;
+            
+            f64 dx = f64(normalisedA.x) - sign * f64(normalisedB.x);
+            f64 dy = f64(normalisedA.y) - sign * f64(normalisedB.y);
+            f64 dz = f64(normalisedA.z) - sign * f64(normalisedB.z);
+            f64 dw = f64(normalisedA.w) - sign * f64(normalisedB.w);
+            f64 distance = std::sqrt(dx * dx + dy * dy + dz * dz + dw * dw);
+            
+            return 4.0 * std::asin(std::min(distance * 0.5, 1.0));
+        }
+        
+        /// @param a
+        ///     The first vector.
+        /// @param b
+        ///     The second vector.
+        ///
+        /// @return The largest difference between any component of the two vectors.
+        ///
+        f32 CalcMaxComponentDifference(const Vector3& a, const Vector3& b) noexcept
+        {
+            return std::max(std::max(std::abs(a.x - b.x), std::abs(a.y - b.y)), std::abs(a.z - b.z));
+        }
+        
+        /// Decodes and linearly interpolates each of the given translation or scale tracks.
+        ///
+        /// @param tracks
+        ///     The tracks, all of which must be in the format understood by the decoder.
+        /// @param numTracks
+        ///     The number of tracks.
+        /// @param params
+        ///     The parameters for all tracks.
+        /// @param frameDataA
+        ///     The sample data for the first frame.
+        /// @param frameDataB
+        ///     The sample data for the second frame.
+        /// @param interpFactor
+        ///     The interpolation factor between the two frames.
+        /// @param decoder
+        ///     A function which decodes a single value from the track params and sample data.
+        /// @param outValues
+        ///     [Out] The per node values that will be written to.
+        ///
+        template <typename TTrack, typename TDecoder> void LerpVector3Tracks(const TTrack* tracks, u32 numTracks, const f32* params, const u8* frameDataA, const u8* frameDataB, f32 interpFactor,
+                                                                            const TDecoder& decoder, Vector3* outValues) noexcept
+        {
+            for (u32 i = 0; i < numTracks; ++i)
+            {
+                const auto& track = tracks[i];
+                const f32* trackParams = params + track.m_paramsOffset;
+                outValues[track.m_nodeIndex] = MathUtils::Lerp(interpFactor, decoder(trackParams, frameDataA + track.m_sampleOffset), decoder(trackParams, frameDataB + track.m_sampleOffset));
+            }
+        }
+        
+        /// Decodes and spherically interpolates each of the given orientation tracks.
+        ///
+        /// @param tracks
+        ///     The tracks, all of which must be in the format understood by the decoder.
+        /// @param numTracks
+        ///     The number of tracks.
+        /// @param frameDataA
+        ///     The sample data for the first frame.
+        /// @param frameDataB
+        ///     The sample data for the second frame.
+        /// @param interpFactor
+        ///     The interpolation factor between the two frames.
+        /// @param decoder
+        ///     A function which decodes a single orientation from the sample data.
+        /// @param outValues
+        ///     [Out] The per node orientations that will be written to.
+        ///
+        template <typename TTrack, typename TDecoder> void SlerpOrientationTracks(const TTrack* tracks, u32 numTracks, const u8* frameDataA, const u8* frameDataB, f32 interpFactor,
+                                                                                 const TDecoder& decoder, Quaternion* outValues) noexcept
+        {
+            for (u32 i = 0; i < numTracks; ++i)
+            {
+                const auto& track = tracks[i];
+                outValues[track.m_nodeIndex] = Quaternion::Slerp(decoder(frameDataA + track.m_sampleOffset), decoder(frameDataB + track.m_sampleOffset), interpFactor);
+            }
+        }
+    }
+    
+    //------------------------------------------------------------------------------
+    CompressedSkinnedAnimation::CompressedSkinnedAnimation(const std::vector<SkinnedAnimation::FrameCUPtr>& frames, const SkinnedAnimation::ErrorBudget& errorBudget) noexcept
+    {
+        m_numFrames = u32(frames.size());
+        if (m_numFrames == 0)
+        {
+            return;
+        }
+        
+        m_numNodes = u32(frames[0]->m_nodeTranslations.size());
+        
+#ifdef CS_ENABLE_DEBUG
+        for (const auto& frame : frames)
+        {
+            CS_ASSERT(frame->m_nodeTranslations.size() == m_numNodes && frame->m_nodeOrientations.size() == m_numNodes && frame->m_nodeScales.size() == m_numNodes,
+                      "All frames must contain the same number of nodes.");
+        }
+#endif
+        
+        std::vector<std::vector<u8>> frameData(m_numFrames);
+        std::vector<Vector3> vector3Samples(m_numFrames);
+        std::vector<Quaternion> orientationSamples(m_numFrames);
+        std::vector<Track> trackGroups[k_numTrackTypes * k_numTrackFormats];
+        
+        for (u32 nodeIndex = 0; nodeIndex < m_numNodes; ++nodeIndex)
+        {
+            Track track;
+            track.m_nodeIndex = nodeIndex;
+            
+            for (u32 frameIndex = 0; frameIndex < m_numFrames; ++frameIndex)
+            {
+                vector3Samples[frameIndex] = frames[frameIndex]->m_nodeTranslations[nodeIndex];
+            }
+            auto format = EncodeVector3Track(vector3Samples, errorBudget.m_maxTranslationError, frameData, track);
+            trackGroups[GetTrackGroupIndex(TrackType::k_translation, format)].push_back(track);
+            
+            for (u32 frameIndex = 0; frameIndex < m_numFrames; ++frameIndex)
+            {
+                orientationSamples[frameIndex] = frames[frameIndex]->m_nodeOrientations[nodeIndex];
+            }
+            format = EncodeOrientationTrack(orientationSamples, errorBudget.m_maxOrientationError, frameData, track);
+            trackGroups[GetTrackGroupIndex(TrackType::k_orientation, format)].push_back(track);
+            
+            for (u32 frameIndex = 0; frameIndex < m_numFrames; ++frameIndex)
+            {
+                vector3Samples[frameIndex] = frames[frameIndex]->m_nodeScales[nodeIndex];
+            }
+            format = EncodeVector3Track(vector3Samples, errorBudget.m_maxScaleError, frameData, track);
+            trackGroups[GetTrackGroupIndex(TrackType::k_scale, format)].push_back(track);
+        }
+        
+        m_tracks.reserve(m_numNodes * k_numTrackTypes);
+        for (u32 groupIndex = 0; groupIndex < k_numTrackTypes * k_numTrackFormats; ++groupIndex)
+        {
+            m_trackGroupOffsets[groupIndex] = u32(m_tracks.size());
+            m_tracks.insert(m_tracks.end(), trackGroups[groupIndex].begin(), trackGroups[groupIndex].end());
+        }
+        m_trackGroupOffsets[k_numTrackTypes * k_numTrackFormats] = u32(m_tracks.size());
+        
+        m_frameDataSize = u32(frameData[0].size());
+        m_samples.reserve(m_numFrames * m_frameDataSize);
+        for (const auto& data : frameData)
+        {
+            CS_ASSERT(data.size() == m_frameDataSize, "All frames must contain the same amount of sample data.");
+            m_samples.insert(m_samples.end(), data.begin(), data.end());
+        }
+        
+        m_params.shrink_to_fit();
+    }
+    
+    //------------------------------------------------------------------------------
+    u32 CompressedSkinnedAnimation::GetDataSize() const noexcept
+    {
+        return u32(m_tracks.size() * sizeof(Track) + m_params.size() * sizeof(f32) + m_samples.size());
+    }
+    
+    //------------------------------------------------------------------------------
+    void CompressedSkinnedAnimation::Sample(u32 frameIndexA, u32 frameIndexB, f32 interpFactor, SkinnedAnimation::Frame& outFrame) const noexcept
+    {
+        CS_ASSERT(frameIndexA < m_numFrames && frameIndexB < m_numFrames, "Skinned animation frame out of bounds");
+        
+        outFrame.m_nodeTranslations.resize(m_numNodes);
+        outFrame.m_nodeOrientations.resize(m_numNodes);
+        outFrame.m_nodeScales.resize(m_numNodes);
+        
+        const u8* frameDataA = m_samples.data() + frameIndexA * m_frameDataSize;
+        const u8* frameDataB = m_samples.data() + frameIndexB * m_frameDataSize;
+        
+        SampleVector3Tracks(TrackType::k_translation, frameDataA, frameDataB, interpFactor, outFrame.m_nodeTranslations.data());
+        SampleOrientationTracks(frameDataA, frameDataB, interpFactor, outFrame.m_nodeOrientations.data());
+        SampleVector3Tracks(TrackType::k_scale, frameDataA, frameDataB, interpFactor, outFrame.m_nodeScales.data());
+    }
+    
+    //------------------------------------------------------------------------------
+    CompressedSkinnedAnimation::TrackFormat CompressedSkinnedAnimation::EncodeVector3Track(const std::vector<Vector3>& samples, f32 maxError, std::vector<std::vector<u8>>& frameData, Track& outTrack) noexcept
+    {
+        outTrack.m_sampleOffset = u32(frameData[0].size());
+        outTrack.m_paramsOffset = u32(m_params.size());
+        
+        Vector3 min = samples[0];
+        Vector3 max = samples[0];
+        for (const auto& sample : samples)
+        {
+            min = Vector3::Min(min, sample);
+            max = Vector3::Max(max, sample);
+        }
+        
+        //if the whole track is within the error budget of the middle of its range it can be stored as a constant.
+        Vector3 mid = 0.5f * (min + max);
+        f32 constantError = 0.0f;
+        for (const auto& sample : samples)
+        {
+            constantError = std::max(constantError, CalcMaxComponentDifference(mid, sample));
+        }
+        
+        if (constantError <= maxError)
+        {
+            m_params.insert(m_params.end(), { mid.x, mid.y, mid.z });
+            return TrackFormat::k_constant;
+        }
+        
+        //otherwise try quantising over the range of the track, using the fewest bits that are within the error budget.
+        const u32 k_maxValues[] = { k_maxLowVector3Value, k_maxHighVector3Value };
+        const TrackFormat k_formats[] = { TrackFormat::k_quantisedLow, TrackFormat::k_quantisedHigh };
+        for (u32 formatIndex = 0; formatIndex < 2; ++formatIndex)
+        {
+            u32 maxValue = k_maxValues[formatIndex];
+            Vector3 extent = max - min;
+            const f32 params[6] = { min.x, min.y, min.z, extent.x / f32(maxValue), extent.y / f32(maxValue), extent.z / f32(maxValue) };
+            
+            f32 quantisedError = 0.0f;
+            for (const auto& sample : samples)
+            {
+                auto decoded = DequantiseVector3(params, Quantise(sample.x, params[0], params[3], maxValue), Quantise(sample.y, params[1], params[4], maxValue), Quantise(sample.z, params[2], params[5], maxValue));
+                quantisedError = std::max(quantisedError, CalcMaxComponentDifference(decoded, sample));
+            }
+            
+            if (quantisedError <= maxError)
+            {
+                m_params.insert(m_params.end(), std::begin(params), std::end(params));
+                
+                for (u32 frameIndex = 0; frameIndex < samples.size(); ++frameIndex)
+                {
+                    const auto& sample = samples[frameIndex];
+                    u32 x = Quantise(sample.x, params[0], params[3], maxValue);
+                    u32 y = Quantise(sample.y, params[1], params[4], maxValue);
+                    u32 z = Quantise(sample.z, params[2], params[5], maxValue);
+                    
+                    if (k_formats[formatIndex] == TrackFormat::k_quantisedLow)
+                    {
+                        WriteValue(u8(x), frameData[frameIndex]);
+                        WriteValue(u8(y), frameData[frameIndex]);
+                        WriteValue(u8(z), frameData[frameIndex]);
+                    }
+                    else
+                    {
+                        WriteValue(u16(x), frameData[frameIndex]);
+                        WriteValue(u16(y), frameData[frameIndex]);
+                        WriteValue(u16(z), frameData[frameIndex]);
+                    }
+                }
+                return k_formats[formatIndex];
+            }
+        }
+        
+        //if neither are within budget then fall back on storing the track uncompressed.
+        for (u32 frameIndex = 0; frameIndex < samples.size(); ++frameIndex)
+        {
+            WriteValue(samples[frameIndex].x, frameData[frameIndex]);
+            WriteValue(samples[frameIndex].y, frameData[frameIndex]);
+            WriteValue(samples[frameIndex].z, frameData[frameIndex]);
+        }
+        
+        return TrackFormat::k_raw;
+    }
+    
+    //------------------------------------------------------------------------------
+    CompressedSkinnedAnimation::TrackFormat CompressedSkinnedAnimation::EncodeOrientationTrack(const std::vector<Quaternion>& samples, f32 maxError, std::vector<std::vector<u8>>& frameData, Track& outTrack) noexcept
+    {
+        outTrack.m_sampleOffset = u32(frameData[0].size());
+        outTrack.m_paramsOffset = u32(m_params.size());
+        
+        //if every orientation is within the error budget of the first it can be stored as a constant.
+        f64 constantError = 0.0;
+        for (const auto& sample : samples)
+        {
+            constantError = std::max(constantError, CalcAngleBetween(samples[0], sample));
+        }
+        
+        if (constantError <= f64(maxError))
+        {
+            m_params.insert(m_params.end(), { samples[0].x, samples[0].y, samples[0].z, samples[0].w });
+            return TrackFormat::k_constant;
+        }
+        
+        //otherwise try smallest three encoding, using the fewest bits that are within the error budget.
+        u32 values[3];
+        u32 largestIndex = 0;
+        
+        f64 lowError = 0.0;
+        for (const auto& sample : samples)
+        {
+            EncodeSmallestThree(sample, k_maxLowOrientationValue, largestIndex, values);
+            lowError = std::max(lowError, CalcAngleBetween(UnpackLowOrientation(PackLowOrientation(largestIndex, values)), sample));
+        }
+        
+        if (lowError <= f64(maxError))
+        {
+            for (u32 frameIndex = 0; frameIndex < samples.size(); ++frameIndex)
+            {
+                EncodeSmallestThree(samples[frameIndex], k_maxLowOrientationValue, largestIndex, values);
+                WriteValue(PackLowOrientation(largestIndex, values), frameData[frameIndex]);
+            }
+            return TrackFormat::k_quantisedLow;
+        }
+        
+        u16 packed[3];
+        f64 highError = 0.0;
+        for (const auto& sample : samples)
+        {
+            EncodeSmallestThree(sample, k_maxHighOrientationValue, largestIndex, values);
+            PackHighOrientation(largestIndex, values, packed);
+            highError = std::max(highError, CalcAngleBetween(UnpackHighOrientation(packed[0], packed[1], packed[2]), sample));
+        }
+        
+        if (highError <= f64(maxError))
+        {
+            for (u32 frameIndex = 0; frameIndex < samples.size(); ++frameIndex)
+            {
+                EncodeSmallestThree(samples[frameIndex], k_maxHighOrientationValue, largestIndex, values);
+                PackHighOrientation(largestIndex, values, packed);
+                WriteValue(packed[0], frameData[frameIndex]);
+                WriteValue(packed[1], frameData[frameIndex]);
+                WriteValue(packed[2], frameData[frameIndex]);
+            }
+            return TrackFormat::k_quantisedHigh;
+        }
+        
+        //if neither are within budget then fall back on storing the track uncompressed.
+        for (u32 frameIndex = 0; frameIndex < samples.size(); ++frameIndex)
+        {
+            WriteValue(samples[frameIndex].x, frameData[frameIndex]);
+            WriteValue(samples[frameIndex].y, frameData[frameIndex]);
+            WriteValue(samples[frameIndex].z, frameData[frameIndex]);
+            WriteValue(samples[frameIndex].w, frameData[frameIndex]);
+        }
+        
+        return TrackFormat::k_raw;
+    }
+    
+    //------------------------------------------------------------------------------
+    u32 CompressedSkinnedAnimation::GetTrackGroupIndex(TrackType trackType, TrackFormat trackFormat) noexcept
+    {
+        return u32(trackType) * k_numTrackFormats + u32(trackFormat);
+    }
+    
+    //------------------------------------------------------------------------------
+    void CompressedSkinnedAnimation::SampleVector3Tracks(TrackType trackType, const u8* frameDataA, const u8* frameDataB, f32 interpFactor, Vector3* outValues) const noexcept
+    {
+        CS_ASSERT(trackType != TrackType::k_orientation, "Cannot sample orientation tracks as vectors.");
+        
+        const f32* params = m_params.data();
+        
+        u32 groupIndex = GetTrackGroupIndex(trackType, TrackFormat::k_constant);
+        for (u32 i = m_trackGroupOffsets[groupIndex]; i < m_trackGroupOffsets[groupIndex + 1]; ++i)
+        {
+            const f32* trackParams = params + m_tracks[i].m_paramsOffset;
+            outValues[m_tracks[i].m_nodeIndex] = Vector3(trackParams[0], trackParams[1], trackParams[2]);
+        }
+        
+        groupIndex = GetTrackGroupIndex(trackType, TrackFormat::k_quantisedLow);
+        LerpVector3Tracks(m_tracks.data() + m_trackGroupOffsets[groupIndex], m_trackGroupOffsets[groupIndex + 1] - m_trackGroupOffsets[groupIndex], params, frameDataA, frameDataB, interpFactor,
+                          [](const f32* trackParams, const u8* sample) noexcept
+        {
+            return DequantiseVector3(trackParams, sample[0], sample[1], sample[2]);
+        }, outValues);
+        
+        groupIndex = GetTrackGroupIndex(trackType, TrackFormat::k_quantisedHigh);
+        LerpVector3Tracks(m_tracks.data() + m_trackGroupOffsets[groupIndex], m_trackGroupOffsets[groupIndex + 1] - m_trackGroupOffsets[groupIndex], params, frameDataA, frameDataB, interpFactor,
+                          [](const f32* trackParams, const u8* sample) noexcept
+        {
+            return DequantiseVector3(trackParams, ReadValue<u16>(sample), ReadValue<u16>(sample + 2), ReadValue<u16>(sample + 4));
+        }, outValues);
+        
+        groupIndex = GetTrackGroupIndex(trackType, TrackFormat::k_raw);
+        LerpVector3Tracks(m_tracks.data() + m_trackGroupOffsets[groupIndex], m_trackGroupOffsets[groupIndex + 1] - m_trackGroupOffsets[groupIndex], params, frameDataA, frameDataB, interpFactor,
+                          [](const f32*, const u8* sample) noexcept
+        {
+            return Vector3(ReadValue<f32>(sample), ReadValue<f32>(sample + 4), ReadValue<f32>(sample + 8));
+        }, outValues);
+    }
+    
+    //------------------------------------------------------------------------------
+    void CompressedSkinnedAnimation::SampleOrientationTracks(const u8* frameDataA, const u8* frameDataB, f32 interpFactor, Quaternion* outValues) const noexcept
+    {
+        u32 groupIndex = GetTrackGroupIndex(TrackType::k_orientation, TrackFormat::k_constant);
+        for (u32 i = m_trackGroupOffsets[groupIndex]; i < m_trackGroupOffsets[groupIndex + 1]; ++i)
+        {
+            const f32* trackParams = m_params.data() + m_tracks[i].m_paramsOffset;
+            outValues[m_tracks[i].m_nodeIndex] = Quaternion(trackParams[0], trackParams[1], trackParams[2], trackParams[3]);
+        }
+        
+        groupIndex = GetTrackGroupIndex(TrackType::k_orientation, TrackFormat::k_quantisedLow);
+        SlerpOrientationTracks(m_tracks.data() + m_trackGroupOffsets[groupIndex], m_trackGroupOffsets[groupIndex + 1] - m_trackGroupOffsets[groupIndex], frameDataA, frameDataB, interpFactor,
+                               [](const u8* sample) noexcept
+        {
+            return UnpackLowOrientation(ReadValue<u32>(sample));
+        }, outValues);
+        
+        groupIndex = GetTrackGroupIndex(TrackType::k_orientation, TrackFormat::k_quantisedHigh);
+        SlerpOrientationTracks(m_tracks.data() + m_trackGroupOffsets[groupIndex], m_trackGroupOffsets[groupIndex + 1] - m_trackGroupOffsets[groupIndex], frameDataA, frameDataB, interpFactor,
+                               [](const u8* sample) noexcept
+        {
+            return UnpackHighOrientation(ReadValue<u16>(sample), ReadValue<u16>(sample + 2), ReadValue<u16>(sample + 4));
+        }, outValues);
+        
+        groupIndex = GetTrackGroupIndex(TrackType::k_orientation, TrackFormat::k_raw);
+        SlerpOrientationTracks(m_tracks.data() + m_trackGroupOffsets[groupIndex], m_trackGroupOffsets[groupIndex + 1] - m_trackGroupOffsets[groupIndex], frameDataA, frameDataB, interpFactor,
+                               [](const u8* sample) noexcept
+        {
+            return Quaternion(ReadValue<f32>(sample), ReadValue<f32>(sample + 4), ReadValue<f32>(sample + 8), ReadValue<f32>(sample + 12));
+        }, outValues);
+    }
+}
@@ -0,0 +1,210 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2016 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#ifndef _CHILLISOURCE_RENDERING_MODEL_COMPRESSEDSKINNEDANIMATION_H_
+#define _CHILLISOURCE_RENDERING_MODEL_COMPRESSEDSKINNEDANIMATION_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Rendering/Model/SkinnedAnimation.h>
+
+#include <vector>
+
+namespace ChilliSource
+{
+    /// A compressed representation of the frames of a skinned animation.
+    ///
+    /// Each skeleton node has a translation, orientation and scale track, each of which is stored
+    /// in the smallest format that keeps it within the given error budget:
+    ///
+    ///  - Constant: Tracks which don't change over the course of the animation are stored once,
+    ///    rather than per frame. Typically this applies to most scale tracks and the translation
+    ///    tracks of all but the root nodes.
+    ///  - Quantised: Translations and scales are quantised to 8 or 16 bits per component over the
+    ///    range of values in the track. Orientations are stored using "smallest three" encoding,
+    ///    in which the largest component is dropped and rebuilt from the other three, in either
+    ///    32 or 48 bits.
+    ///  - Raw: Tracks which cannot be quantised within the error budget are stored uncompressed.
+    ///
+    /// Samples are stored per frame, so sampling the animation only needs to read the data for
+    /// the two frames either side of the playback position. Frames are never fully expanded; each
+    /// track is decoded and interpolated directly into the output.
+    ///
+    /// This is immutable and therefore thread-safe once constructed.
+    ///
+    class CompressedSkinnedAnimation final
+    {
+    public:
+        CS_DECLARE_NOCOPY(CompressedSkinnedAnimation);
+        
+        /// Compresses the given uncompressed frames. Every frame must contain the same number of
+        /// nodes.
+        ///
+        /// @param frames
+        ///     The uncompressed frames.
+        /// @param errorBudget
+        ///     The maximum error which may be introduced to each track.
+        ///
+        CompressedSkinnedAnimation(const std::vector<SkinnedAnimation::FrameCUPtr>& frames, const SkinnedAnimation::ErrorBudget& errorBudget) noexcept;
+        
+        /// @return The number of frames in the animation.
+        ///
+        u32 GetNumFrames() const noexcept { return m_numFrames; }
+        
+        /// @return The number of skeleton nodes in each frame.
+        ///
+        u32 GetNumNodes() const noexcept { return m_numNodes; }
+        
+        /// @return The size of the compressed data in bytes.
+        ///
+        u32 GetDataSize() const noexcept;
+        
+        /// Decodes the two given frames and interpolates between them. The output frame's buffers
+        /// are reused, so this doesn't allocate once they have grown to fit.
+        ///
+        /// @param frameIndexA
+        ///     The index of the first frame.
+        /// @param frameIndexB
+        ///     The index of the second frame.
+        /// @param interpFactor
+        ///     The interpolation factor between the two frames.
+        /// @param outFrame
+        ///     [Out] The frame the result is written to.
+        ///
+        void Sample(u32 frameIndexA, u32 frameIndexB, f32 interpFactor, SkinnedAnimation::Frame& outFrame) const noexcept;
+        
+    private:
+        /// The type of data stored in a track.
+        ///
+        enum class TrackType : u8
+        {
+            k_translation,
+            k_orientation,
+            k_scale
+        };
+        
+        /// The different formats a track can be stored in. The meaning of the quantised formats
+        /// depends on the type of track.
+        ///
+        enum class TrackFormat : u8
+        {
+            k_constant,
+            k_quantisedLow,
+            k_quantisedHigh,
+            k_raw
+        };
+        
+        static constexpr u32 k_numTrackTypes = 3;
+        static constexpr u32 k_numTrackFormats = 4;
+        
+        /// Describes where the data for a single track is stored. Tracks are grouped by type and
+        /// format, so each group can be decoded in a tight loop without branching on the format.
+        ///
+        struct Track
+        {
+            u32 m_nodeIndex;
+            u32 m_sampleOffset;
+            u32 m_paramsOffset;
+        };
+        
+        /// Chooses the smallest format for the given translation or scale track that keeps it
+        /// within the error budget, and encodes it.
+        ///
+        /// @param samples
+        ///     The value of the track in each frame.
+        /// @param maxError
+        ///     The maximum error per component.
+        /// @param frameData
+        ///     [Out] The sample data for each frame, which the encoded samples are appended to.
+        /// @param outTrack
+        ///     [Out] The track description, which will have its offsets set.
+        ///
+        /// @return The chosen format.
+        ///
+        TrackFormat EncodeVector3Track(const std::vector<Vector3>& samples, f32 maxError, std::vector<std::vector<u8>>& frameData, Track& outTrack) noexcept;
+        
+        /// Chooses the smallest format for the given orientation track that keeps it within the
+        /// error budget, and encodes it.
+        ///
+        /// @param samples
+        ///     The value of the track in each frame.
+        /// @param maxError
+        ///     The maximum angle in radians between an original and decoded orientation.
+        /// @param frameData
+        ///     [Out] The sample data for each frame, which the encoded samples are appended to.
+        /// @param outTrack
+        ///     [Out] The track description, which will have its offsets set.
+        ///
+        /// @return The chosen format.
+        ///
+        TrackFormat EncodeOrientationTrack(const std::vector<Quaternion>& samples, f32 maxError, std::vector<std::vector<u8>>& frameData, Track& outTrack) noexcept;
+        
+        /// @param trackType
+        ///     The track type.
+        /// @param trackFormat
+        ///     The track format.
+        ///
+        /// @return The index of the group containing tracks of the given type and format.
+        ///
+        static u32 GetTrackGroupIndex(TrackType trackType, TrackFormat trackFormat) noexcept;
+        
+        /// Decodes and interpolates all translation or scale tracks of the given type.
+        ///
+        /// @param trackType
+        ///     The type of tracks to sample. Must be translation or scale.
+        /// @param frameDataA
+        ///     The sample data for the first frame.
+        /// @param frameDataB
+        ///     The sample data for the second frame.
+        /// @param interpFactor
+        ///     The interpolation factor between the two frames.
+        /// @param outValues
+        ///     [Out] The per node values that will be written to.
+        ///
+        void SampleVector3Tracks(TrackType trackType, const u8* frameDataA, const u8* frameDataB, f32 interpFactor, Vector3* outValues) const noexcept;
+        
+        /// Decodes and interpolates all orientation tracks.
+        ///
+        /// @param frameDataA
+        ///     The sample data for the first frame.
+        /// @param frameDataB
+        ///     The sample data for the second frame.
+        /// @param interpFactor
+        ///     The interpolation factor between the two frames.
+        /// @param outValues
+        ///     [Out] The per node orientations that will be written to.
+        ///
+        void SampleOrientationTracks(const u8* frameDataA, const u8* frameDataB, f32 interpFactor, Quaternion* outValues) const noexcept;
+        
+        u32 m_numFrames = 0;
+        u32 m_numNodes = 0;
+        u32 m_frameDataSize = 0;
+        std::vector<Track> m_tracks;
+        u32 m_trackGroupOffsets[k_numTrackTypes * k_numTrackFormats + 1] = {};
+        std::vector<f32> m_params;
+        std::vector<u8> m_samples;
+    };
+}
+
+#endif
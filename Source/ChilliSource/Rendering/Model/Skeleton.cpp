@@ -49,6 +49,48 @@ namespace ChilliSource
         }
         
         madwJoints = in_desc.GetJointIndices();
+        
+        //build the child lists so that the nodes can be sorted breadth first from the roots in linear time.
+        const s32 numNodes = s32(mapNodes.size());
+        std::vector<s32> childOffsets(numNodes + 1, 0);
+        for (const auto& node : mapNodes)
+        {
+            if (node->mdwParentIndex >= 0 && node->mdwParentIndex < numNodes)
+            {
+                ++childOffsets[node->mdwParentIndex + 1];
+            }
+        }
+        
+        for (s32 i = 0; i < numNodes; ++i)
+        {
+            childOffsets[i + 1] += childOffsets[i];
+        }
+        
+        std::vector<s32> children(childOffsets[numNodes]);
+        std::vector<s32> childCounts(numNodes, 0);
+        for (s32 i = 0; i < numNodes; ++i)
+        {
+            s32 parentIndex = mapNodes[i]->mdwParentIndex;
+            if (parentIndex >= 0 && parentIndex < numNodes)
+            {
+                children[childOffsets[parentIndex] + childCounts[parentIndex]++] = i;
+            }
+        }
+        
+        madwParentSortedNodes.reserve(numNodes);
+        for (s32 i = 0; i < numNodes; ++i)
+        {
+            if (mapNodes[i]->mdwParentIndex == -1)
+            {
+                madwParentSortedNodes.push_back(i);
+            }
+        }
+        
+        for (u32 i = 0; i < madwParentSortedNodes.size(); ++i)
+        {
+            s32 nodeIndex = madwParentSortedNodes[i];
+            madwParentSortedNodes.insert(madwParentSortedNodes.end(), children.begin() + childOffsets[nodeIndex], children.begin() + childOffsets[nodeIndex + 1]);
+        }
     }
     //-------------------------------------------------------------------------
     /// Get Node By Name
@@ -121,4 +163,10 @@ namespace ChilliSource
     {
         return madwJoints;
     }
+    //-------------------------------------------------------------------------
+    //-------------------------------------------------------------------------
+    const std::vector<s32>& Skeleton::GetParentSortedNodeIndices() const
+    {
+        return madwParentSortedNodes;
+    }
 }
\ No newline at end of file
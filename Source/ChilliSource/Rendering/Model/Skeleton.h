@@ -120,11 +120,20 @@ namespace ChilliSource
         /// @return the array of joint indices
         //-------------------------------------------------------------------------
         const std::vector<s32>& GetJointIndices() const;
+        //-------------------------------------------------------------------------
+        /// Returns the indices of all nodes reachable from a root node, ordered
+        /// such that every node appears after its parent. This allows the world
+        /// transforms of the skeleton to be built in a single pass.
+        ///
+        /// @return the parent sorted array of node indices.
+        //-------------------------------------------------------------------------
+        const std::vector<s32>& GetParentSortedNodeIndices() const;
         
     private:
         
         std::vector<SkeletonNodeCUPtr> mapNodes;
         std::vector<s32> madwJoints;
+        std::vector<s32> madwParentSortedNodes;
     };
 }
 
@@ -28,6 +28,8 @@
 
 #include <ChilliSource/Rendering/Model/SkinnedAnimation.h>
 
+#include <ChilliSource/Rendering/Model/CompressedSkinnedAnimation.h>
+
 namespace ChilliSource
 {
     CS_DEFINE_NAMEDTYPE(SkinnedAnimation);
@@ -53,11 +55,24 @@ namespace ChilliSource
     //---------------------------------------------------------------------
     const SkinnedAnimation::Frame* SkinnedAnimation::GetFrameAtIndex(u32 in_index) const
     {
+        CS_ASSERT(m_compressedAnimation == nullptr, "Cannot get the frames of a compressed skinned animation.");
         CS_ASSERT(in_index < m_frames.size(), "Skinned animation frame out of bounds");
         return m_frames[in_index].get();
     }
     //---------------------------------------------------------------------
     //---------------------------------------------------------------------
+    bool SkinnedAnimation::IsCompressed() const
+    {
+        return (m_compressedAnimation != nullptr);
+    }
+    //---------------------------------------------------------------------
+    //---------------------------------------------------------------------
+    const CompressedSkinnedAnimation* SkinnedAnimation::GetCompressedAnimation() const
+    {
+        return m_compressedAnimation.get();
+    }
+    //---------------------------------------------------------------------
+    //---------------------------------------------------------------------
     f32 SkinnedAnimation::GetFrameTime() const
     {
         return m_frameTime;
@@ -66,12 +81,18 @@ namespace ChilliSource
     //---------------------------------------------------------------------
     u32 SkinnedAnimation::GetNumFrames() const
     {
+        if (m_compressedAnimation != nullptr)
+        {
+            return m_compressedAnimation->GetNumFrames();
+        }
+        
         return static_cast<u32>(m_frames.size());
     }
     //---------------------------------------------------------------------
     //---------------------------------------------------------------------
     void SkinnedAnimation::AddFrame(SkinnedAnimation::FrameCUPtr in_frame)
     {
+        CS_ASSERT(m_compressedAnimation == nullptr, "Cannot add frames to a compressed skinned animation.");
         m_frames.push_back(std::move(in_frame));
     }
     //---------------------------------------------------------------------
@@ -80,5 +101,21 @@ namespace ChilliSource
     {
         m_frameTime = in_timeBetweenFrames;
     }
+    //---------------------------------------------------------------------
+    //---------------------------------------------------------------------
+    void SkinnedAnimation::Compress(const ErrorBudget& in_errorBudget)
+    {
+        CS_ASSERT(m_compressedAnimation == nullptr, "Skinned animation has already been compressed.");
+        
+        m_compressedAnimation = CompressedSkinnedAnimationCUPtr(new CompressedSkinnedAnimation(m_frames, in_errorBudget));
+        
+        m_frames.clear();
+        m_frames.shrink_to_fit();
+    }
+    //---------------------------------------------------------------------
+    //---------------------------------------------------------------------
+    SkinnedAnimation::~SkinnedAnimation()
+    {
+    }
 }
 
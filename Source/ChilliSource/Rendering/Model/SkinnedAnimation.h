@@ -63,6 +63,19 @@ namespace ChilliSource
         using FrameCUPtr = std::unique_ptr<const Frame>;
         using FrameCSPtr = std::shared_ptr<const Frame>;
         
+        //---------------------------------------------------------------------
+        /// The maximum error that compressing the animation may introduce to
+        /// each track. Orientation error is the angle between the original and
+        /// compressed orientation in radians. Translation and scale error are
+        /// measured per component.
+        //---------------------------------------------------------------------
+        struct ErrorBudget
+        {
+            f32 m_maxTranslationError = 0.001f;
+            f32 m_maxOrientationError = 0.001f;
+            f32 m_maxScaleError = 0.001f;
+        };
+        
         CS_DECLARE_NAMEDTYPE(SkinnedAnimation);
         
         //---------------------------------------------------------------------
@@ -81,8 +94,17 @@ namespace ChilliSource
         //---------------------------------------------------------------------
         const SkinnedAnimation::Frame* GetFrameAtIndex(u32 in_index) const;
         //---------------------------------------------------------------------
-        /// @author Ian Copland
-        ///
+        /// @return Whether or not the animation has been compressed. The
+        /// frames of a compressed animation cannot be accessed directly and
+        /// instead must be sampled through the compressed animation.
+        //---------------------------------------------------------------------
+        bool IsCompressed() const;
+        //---------------------------------------------------------------------
+        /// @return The compressed animation, or null if the animation hasn't
+        /// been compressed.
+        //---------------------------------------------------------------------
+        const CompressedSkinnedAnimation* GetCompressedAnimation() const;
+        //---------------------------------------------------------------------
         /// @return the time between frames in seconds
         //---------------------------------------------------------------------
         f32 GetFrameTime() const;
@@ -110,6 +132,18 @@ namespace ChilliSource
         /// @param The time between frames in seconds
         //---------------------------------------------------------------------
         void SetFrameTime(f32 in_timeBetweenFrames);
+        //---------------------------------------------------------------------
+        /// Converts the frames of the animation into a compressed
+        /// representation. The original frames are released, so no more
+        /// frames can be added afterwards.
+        ///
+        /// @param The maximum error the compression may introduce.
+        //---------------------------------------------------------------------
+        void Compress(const ErrorBudget& in_errorBudget);
+        //---------------------------------------------------------------------
+        /// Destructor
+        //---------------------------------------------------------------------
+        ~SkinnedAnimation();
         
     private:
         
@@ -135,6 +169,7 @@ namespace ChilliSource
         
         f32 m_frameTime;
         std::vector<SkinnedAnimation::FrameCUPtr> m_frames;
+        CompressedSkinnedAnimationCUPtr m_compressedAnimation;
     };
 }
 
@@ -30,9 +30,13 @@
 #include <ChilliSource/Core/Math/Quaternion.h>
 #include <ChilliSource/Core/Math/Vector3.h>
 #include <ChilliSource/Core/Math/MathUtils.h>
+#include <ChilliSource/Rendering/Model/CompressedSkinnedAnimation.h>
 #include <ChilliSource/Rendering/Model/SkinnedAnimation.h>
 #include <ChilliSource/Rendering/Model/Skeleton.h>
 
+#include <algorithm>
+#include <functional>
+
 namespace ChilliSource
 {
     //-----------------------------------------------------------
@@ -41,10 +45,7 @@ namespace ChilliSource
     SkinnedAnimationGroup::SkinnedAnimationGroup(const Skeleton& inpSkeleton)
     : mpSkeleton(inpSkeleton), mbAnimationLengthDirty(true), mfAnimationLength(0.0f), mbPrepared(false)
     {
-        for (s32 i = 0; i < mpSkeleton.GetNumNodes(); ++i)
-        {
-            mCurrentAnimationMatrices.push_back(Matrix4());
-        }
+        mCurrentAnimationMatrices.resize(mpSkeleton.GetNumNodes());
     }
     //----------------------------------------------------------
     /// Attach Animation
@@ -103,38 +104,31 @@ namespace ChilliSource
                 }
             }
             
-            //get the animation frames
-            SkinnedAnimation::FrameCUPtr pFrame1;
-            if (pAnimItem1 != nullptr)
-                pFrame1 = CalculateAnimationFrame(pAnimItem1->pSkinnedAnimation, infPlaybackPosition);
-            
-            SkinnedAnimation::FrameCUPtr pFrame2;
-            if (pAnimItem2 != nullptr)
-                pFrame2 = CalculateAnimationFrame(pAnimItem2->pSkinnedAnimation, infPlaybackPosition);
-            
-            //check that we do indeed have two animations to blend. if not, just return the frame we do have.
-            if (pFrame1 != nullptr && pFrame2 != nullptr && pAnimItem1.get() != pAnimItem2.get())
+            //check that we do indeed have two animations to blend. if not, just use the frame we do have.
+            if (pAnimItem1 != nullptr && pAnimItem2 != nullptr && pAnimItem1.get() != pAnimItem2.get())
             {
+                CalculateAnimationFrame(pAnimItem1->pSkinnedAnimation, infPlaybackPosition, mCurrentAnimationData);
+                CalculateAnimationFrame(pAnimItem2->pSkinnedAnimation, infPlaybackPosition, mBlendAnimationData);
+                
                 //get the interpolation factor and then apply the requested blend to the two frames.
                 f32 fFactor = (infBlendlinePosition - pAnimItem1->fBlendlinePosition) / (pAnimItem2->fBlendlinePosition - pAnimItem1->fBlendlinePosition);
                 switch (ineBlendType)
                 {
                     case AnimationBlendType::k_linear:
-                        mCurrentAnimationData = LerpBetweenFrames(pFrame1.get(), pFrame2.get(), fFactor);
+                        LerpBetweenFrames(mCurrentAnimationData, mBlendAnimationData, fFactor, mCurrentAnimationData);
                         break;
                     default:
                         CS_LOG_ERROR("Invalid animation blend type given.");
-                        mCurrentAnimationData = std::move(pFrame1);
                         break;
                 }
             }
-            else if (pFrame1 != nullptr)
+            else if (pAnimItem1 != nullptr)
             {
-                mCurrentAnimationData = std::move(pFrame1);
+                CalculateAnimationFrame(pAnimItem1->pSkinnedAnimation, infPlaybackPosition, mCurrentAnimationData);
             }
-            else if (pFrame2 != nullptr)
+            else if (pAnimItem2 != nullptr)
             {
-                mCurrentAnimationData = std::move(pFrame2);
+                CalculateAnimationFrame(pAnimItem2->pSkinnedAnimation, infPlaybackPosition, mCurrentAnimationData);
             }
             else 
             {
@@ -146,7 +140,7 @@ namespace ChilliSource
         else if (mAnimations.size() > 0) 
         {
             const SkinnedAnimationCSPtr& pAnim = mAnimations[0]->pSkinnedAnimation;
-            mCurrentAnimationData = CalculateAnimationFrame(pAnim, infPlaybackPosition);
+            CalculateAnimationFrame(pAnim, infPlaybackPosition, mCurrentAnimationData);
             mbPrepared = true;
         }
         else
@@ -163,7 +157,7 @@ namespace ChilliSource
         switch (ineBlendType)
         {
             case AnimationBlendType::k_linear:
-                mCurrentAnimationData = LerpBetweenFrames(mCurrentAnimationData.get(), inpAnimationGroup->mCurrentAnimationData.get(), infBlendFactor);
+                LerpBetweenFrames(mCurrentAnimationData, inpAnimationGroup->mCurrentAnimationData, infBlendFactor, mCurrentAnimationData);
                 break;
             default:
                 CS_LOG_ERROR("Invalid animation blend type given.");
@@ -173,29 +167,31 @@ namespace ChilliSource
     //----------------------------------------------------------
     /// Build Matrices
     //----------------------------------------------------------
-    void SkinnedAnimationGroup::BuildMatrices(s32 indwCurrentParent, const Matrix4& inParentMatrix)
+    void SkinnedAnimationGroup::BuildMatrices()
     {
         const std::vector<SkeletonNodeCUPtr>& nodes = mpSkeleton.GetNodes();
-        u32 currIndex = 0;
-        for (auto it = nodes.begin(); it != nodes.end(); ++it)
+        const bool hasAnimationData = (mCurrentAnimationData.m_nodeTranslations.empty() == false);
+        
+        //parents are always visited before their children, so the parent matrix is always up to date.
+        for (s32 nodeIndex : mpSkeleton.GetParentSortedNodeIndices())
         {
-            if ((*it)->mdwParentIndex == indwCurrentParent)
+            //get the local translation and orientation
+            Matrix4 localMat;
+            if (hasAnimationData == true)
             {
-                //get the world translation and orientation
-                Matrix4 localMat;
-                if(mCurrentAnimationData->m_nodeTranslations.empty() == false)
-                {
-                    localMat = Matrix4::CreateTransform(mCurrentAnimationData->m_nodeTranslations[currIndex], mCurrentAnimationData->m_nodeScales[currIndex], mCurrentAnimationData->m_nodeOrientations[currIndex]);
-                }
-                
-                //convert to matrix and store
-                mCurrentAnimationMatrices[currIndex] =  localMat * inParentMatrix;
-                
-                //Apply to all children
-                BuildMatrices(currIndex, mCurrentAnimationMatrices[currIndex]);
+                localMat = Matrix4::CreateTransform(mCurrentAnimationData.m_nodeTranslations[nodeIndex], mCurrentAnimationData.m_nodeScales[nodeIndex], mCurrentAnimationData.m_nodeOrientations[nodeIndex]);
             }
             
-            currIndex++;
+            //convert to matrix and store
+            s32 parentIndex = nodes[nodeIndex]->mdwParentIndex;
+            if (parentIndex == -1)
+            {
+                mCurrentAnimationMatrices[nodeIndex] = localMat;
+            }
+            else
+            {
+                mCurrentAnimationMatrices[nodeIndex] = localMat * mCurrentAnimationMatrices[parentIndex];
+            }
         }
     }
     //----------------------------------------------------------
@@ -212,31 +208,44 @@ namespace ChilliSource
     //----------------------------------------------------------
     //----------------------------------------------------------
     RenderSkinnedAnimationAUPtr SkinnedAnimationGroup::BuildRenderSkinnedAnimation(IAllocator* in_allocator, const std::vector<Matrix4>& in_inverseBindPoseMatrices) const noexcept
+    {
+        auto jointDataSize = GetJointDataSize();
+        auto jointData = MakeUniqueArray<Vector4>(*in_allocator, jointDataSize);
+        
+        BuildJointData(in_inverseBindPoseMatrices, jointData.get());
+        
+        return MakeUnique<RenderSkinnedAnimation>(*in_allocator, std::move(jointData), jointDataSize);
+    }
+    //----------------------------------------------------------
+    //----------------------------------------------------------
+    void SkinnedAnimationGroup::BuildJointData(const std::vector<Matrix4>& in_inverseBindPoseMatrices, Vector4* out_jointData) const noexcept
     {
         const std::vector<s32>& joints = mpSkeleton.GetJointIndices();
         CS_ASSERT(joints.size() == in_inverseBindPoseMatrices.size(), "Cannot apply bind pose matrices to joint matrices, because they are not from the same skeleton.");
         
-        constexpr u32 k_numVectorsPerJoint = 3;
-        auto jointDataSize = joints.size() * k_numVectorsPerJoint;
-        auto jointData = MakeUniqueArray<Vector4>(*in_allocator, jointDataSize);
-        
         s32 count = 0;
         std::vector<s32>::const_iterator joint = joints.begin();
         for (auto ibp = in_inverseBindPoseMatrices.begin(); joint != joints.end() && ibp != in_inverseBindPoseMatrices.end();)
         {
             Matrix4 combinedMatrix = ((*ibp) * (mCurrentAnimationMatrices[*joint]));
             
-            jointData[count * 3 + 0] = Vector4(combinedMatrix.m[0], combinedMatrix.m[4], combinedMatrix.m[8], combinedMatrix.m[12]);
-            jointData[count * 3 + 1] = Vector4(combinedMatrix.m[1], combinedMatrix.m[5], combinedMatrix.m[9], combinedMatrix.m[13]);
-            jointData[count * 3 + 2] = Vector4(combinedMatrix.m[2], combinedMatrix.m[6], combinedMatrix.m[10], combinedMatrix.m[14]);
+            out_jointData[count * 3 + 0] = Vector4(combinedMatrix.m[0], combinedMatrix.m[4], combinedMatrix.m[8], combinedMatrix.m[12]);
+            out_jointData[count * 3 + 1] = Vector4(combinedMatrix.m[1], combinedMatrix.m[5], combinedMatrix.m[9], combinedMatrix.m[13]);
+            out_jointData[count * 3 + 2] = Vector4(combinedMatrix.m[2], combinedMatrix.m[6], combinedMatrix.m[10], combinedMatrix.m[14]);
             
             //incriment the iterators
             ++joint;
             ++ibp;
             count++;
         }
+    }
+    //----------------------------------------------------------
+    //----------------------------------------------------------
+    u32 SkinnedAnimationGroup::GetJointDataSize() const noexcept
+    {
+        constexpr u32 k_numVectorsPerJoint = 3;
         
-        return MakeUnique<RenderSkinnedAnimation>(*in_allocator, std::move(jointData), u32(jointDataSize));
+        return u32(mpSkeleton.GetJointIndices().size()) * k_numVectorsPerJoint;
     }
     //----------------------------------------------------------
     /// Get Animation Length
@@ -271,6 +280,40 @@ namespace ChilliSource
         }
     }
     //----------------------------------------------------------
+    /// Has Same Animations
+    //----------------------------------------------------------
+    bool SkinnedAnimationGroup::HasSameAnimations(const SkinnedAnimationGroup& in_other) const noexcept
+    {
+        if (mAnimations.size() != in_other.mAnimations.size())
+        {
+            return false;
+        }
+        
+        for (u32 i = 0; i < mAnimations.size(); ++i)
+        {
+            if (mAnimations[i]->pSkinnedAnimation != in_other.mAnimations[i]->pSkinnedAnimation || mAnimations[i]->fBlendlinePosition != in_other.mAnimations[i]->fBlendlinePosition)
+            {
+                return false;
+            }
+        }
+        
+        return true;
+    }
+    //----------------------------------------------------------
+    /// Hash Animations
+    //----------------------------------------------------------
+    std::size_t SkinnedAnimationGroup::HashAnimations() const noexcept
+    {
+        std::size_t hash = mAnimations.size();
+        for (const auto& animationItem : mAnimations)
+        {
+            hash = hash * 31 + std::hash<const SkinnedAnimation*>()(animationItem->pSkinnedAnimation.get());
+            hash = hash * 31 + std::hash<f32>()(animationItem->fBlendlinePosition);
+        }
+        
+        return hash;
+    }
+    //----------------------------------------------------------
     /// Calculate Animation Length
     //----------------------------------------------------------
     void SkinnedAnimationGroup::CalculateAnimationLength()
@@ -300,7 +343,7 @@ namespace ChilliSource
     //----------------------------------------------------------
     /// Calculate Animation Frame
     //----------------------------------------------------------
-    SkinnedAnimation::FrameCUPtr SkinnedAnimationGroup::CalculateAnimationFrame(const SkinnedAnimationCSPtr& inpAnimation, f32 infPlaybackPosition)
+    void SkinnedAnimationGroup::CalculateAnimationFrame(const SkinnedAnimationCSPtr& inpAnimation, f32 infPlaybackPosition, SkinnedAnimation::Frame& outFrame)
     {
         //report errors if the playback position provided does not make sense
         if (infPlaybackPosition < 0.0f)
@@ -334,78 +377,49 @@ namespace ChilliSource
             dwFrameBIndex = inpAnimation->GetNumFrames() - 1;
         }
         
+        //get the ratio of one frame to the next
+        f32 interpFactor = (infPlaybackPosition - (dwFrameAIndex * inpAnimation->GetFrameTime())) / inpAnimation->GetFrameTime();
+        
+        //compressed animations are decoded straight into the output rather than expanding the frames.
+        if (inpAnimation->IsCompressed() == true)
+        {
+            inpAnimation->GetCompressedAnimation()->Sample(dwFrameAIndex, dwFrameBIndex, interpFactor, outFrame);
+            return;
+        }
+        
         //get the frames
         const SkinnedAnimation::Frame* frameA = inpAnimation->GetFrameAtIndex(dwFrameAIndex);
         const SkinnedAnimation::Frame* frameB = inpAnimation->GetFrameAtIndex(dwFrameBIndex);
         
-        //get the ratio of one frame to the next
-        f32 interpFactor = (infPlaybackPosition - (dwFrameAIndex * inpAnimation->GetFrameTime())) / inpAnimation->GetFrameTime();
-        
         //blend between frames
-        return LerpBetweenFrames(frameA, frameB, interpFactor);
+        LerpBetweenFrames(*frameA, *frameB, interpFactor, outFrame);
     }
     //--------------------------------------------------------------
     /// Lerp Between Frames
     //--------------------------------------------------------------
-    SkinnedAnimation::FrameCUPtr SkinnedAnimationGroup::LerpBetweenFrames(const SkinnedAnimation::Frame* inFrameA, const SkinnedAnimation::Frame* inFrameB, f32 infInterpFactor)
+    void SkinnedAnimationGroup::LerpBetweenFrames(const SkinnedAnimation::Frame& inFrameA, const SkinnedAnimation::Frame& inFrameB, f32 infInterpFactor, SkinnedAnimation::Frame& outFrame)
     {
-        SkinnedAnimation::FrameUPtr outFrame(new SkinnedAnimation::Frame());
+        //the output buffers are only resized so they don't allocate once they have grown to fit. This is
+        //safe if the output is also an input, as only elements that aren't read are discarded.
+        const std::size_t numTranslations = std::min(inFrameA.m_nodeTranslations.size(), inFrameB.m_nodeTranslations.size());
+        outFrame.m_nodeTranslations.resize(numTranslations);
+        for (std::size_t i = 0; i < numTranslations; ++i)
+        {
+            outFrame.m_nodeTranslations[i] = MathUtils::Lerp(infInterpFactor, inFrameA.m_nodeTranslations[i], inFrameB.m_nodeTranslations[i]);
+        }
         
-        if(inFrameA != nullptr && inFrameB != nullptr)
+        const std::size_t numOrientations = std::min(inFrameA.m_nodeOrientations.size(), inFrameB.m_nodeOrientations.size());
+        outFrame.m_nodeOrientations.resize(numOrientations);
+        for (std::size_t i = 0; i < numOrientations; ++i)
         {
-            //iterate through each translation
-            outFrame->m_nodeTranslations.reserve(inFrameB->m_nodeTranslations.size());
-            std::vector<Vector3>::const_iterator transAIt = inFrameA->m_nodeTranslations.begin();
-            for (std::vector<Vector3>::const_iterator transBIt = inFrameB->m_nodeTranslations.begin();
-                 transAIt != inFrameA->m_nodeTranslations.end() && transBIt != inFrameB->m_nodeTranslations.end();)
-            {
-                //lerp
-                Vector3 newTrans = MathUtils::Lerp(infInterpFactor, *transAIt, *transBIt);
-                
-                //add to frame
-                outFrame->m_nodeTranslations.push_back(newTrans);
-                
-                //incriment the iterators
-                ++transAIt;
-                ++transBIt;
-            }
-            
-            //iterate through each orientation
-            outFrame->m_nodeOrientations.reserve(inFrameB->m_nodeOrientations.size());
-            std::vector<Quaternion>::const_iterator orientAIt = inFrameA->m_nodeOrientations.begin();
-            for (std::vector<Quaternion>::const_iterator orientBIt = inFrameB->m_nodeOrientations.begin();
-                 orientAIt != inFrameA->m_nodeOrientations.end() && orientBIt != inFrameB->m_nodeOrientations.end();)
-            {
-                //lerp
-                Quaternion newOrient = Quaternion::Slerp(*orientAIt, *orientBIt, infInterpFactor);
-                
-                //add to frame
-                outFrame->m_nodeOrientations.push_back(newOrient);
-                
-                //incriment the iterators
-                ++orientAIt;
-                ++orientBIt;
-            }
-            
-            //iterate through each scale
-            outFrame->m_nodeScales.reserve(inFrameB->m_nodeScales.size());
-            std::vector<Vector3>::const_iterator scaleAIt = inFrameA->m_nodeScales.begin();
-            for (std::vector<Vector3>::const_iterator scaleBIt = inFrameB->m_nodeScales.begin();
-                 scaleAIt != inFrameA->m_nodeScales.end() && scaleBIt != inFrameB->m_nodeScales.end();)
-            {
-                //lerp
-                Vector3 newScale = MathUtils::Lerp(infInterpFactor, *scaleAIt, *scaleBIt);
-                
-                //add to frame
-                outFrame->m_nodeScales.push_back(newScale);
-                
-                //incriment the iterators
-                ++scaleAIt;
-                ++scaleBIt;
-            }
+            outFrame.m_nodeOrientations[i] = Quaternion::Slerp(inFrameA.m_nodeOrientations[i], inFrameB.m_nodeOrientations[i], infInterpFactor);
         }
         
-        return SkinnedAnimation::FrameCUPtr(std::move(outFrame));
+        const std::size_t numScales = std::min(inFrameA.m_nodeScales.size(), inFrameB.m_nodeScales.size());
+        outFrame.m_nodeScales.resize(numScales);
+        for (std::size_t i = 0; i < numScales; ++i)
+        {
+            outFrame.m_nodeScales[i] = MathUtils::Lerp(infInterpFactor, inFrameA.m_nodeScales[i], inFrameB.m_nodeScales[i]);
+        }
     }
 }
-
@@ -109,12 +109,10 @@ namespace ChilliSource
         /// Build Matrices
         ///
         /// Builds the animation matrix data from the current
-        /// animation data.
-        ///
-        /// @param the current parent.
-        /// @param the parent matrix.
+        /// animation data. The matrices are built in a single pass
+        /// over the parent sorted nodes of the skeleton.
         //----------------------------------------------------------
-        void BuildMatrices(s32 indwCurrentParent = -1, const Matrix4& inParentMatrix = Matrix4());
+        void BuildMatrices();
         //----------------------------------------------------------
         /// Get Matrix At Index
         ///
@@ -144,6 +142,24 @@ namespace ChilliSource
         //----------------------------------------------------------
         RenderSkinnedAnimationAUPtr BuildRenderSkinnedAnimation(IAllocator* in_allocator, const std::vector<Matrix4>& in_inverseBindPoseMatrices) const noexcept;
         //----------------------------------------------------------
+        /// Generates the same joint data as
+        /// BuildRenderSkinnedAnimation(), but writes it into the
+        /// given buffer rather than allocating it. This allows
+        /// the joint data to be built ahead of the render snapshot.
+        ///
+        /// @param in_inverseBindPoseMatrices - The inverse bind
+        /// pose matrices that will be applied.
+        /// @param out_jointData - [Out] The buffer the joint data
+        /// will be written to. Must have room for GetJointDataSize()
+        /// elements.
+        //----------------------------------------------------------
+        void BuildJointData(const std::vector<Matrix4>& in_inverseBindPoseMatrices, Vector4* out_jointData) const noexcept;
+        //----------------------------------------------------------
+        /// @return The number of Vector4s that make up the joint
+        /// data for a single mesh.
+        //----------------------------------------------------------
+        u32 GetJointDataSize() const noexcept;
+        //----------------------------------------------------------
         /// Get Animation Length
         ///
         /// @return the length of the animation in seconds.
@@ -168,6 +184,21 @@ namespace ChilliSource
         /// @param OUT: The list of animations.
         //----------------------------------------------------------
         void GetAnimations(std::vector<SkinnedAnimationCSPtr>& outapSkinnedAnimationList);
+        //----------------------------------------------------------
+        /// @param in_other - The group to compare against.
+        ///
+        /// @return Whether or not the other group has the same
+        /// animations attached at the same blendline positions,
+        /// in the same order. Two such groups will produce the
+        /// same pose for a given playback position.
+        //----------------------------------------------------------
+        bool HasSameAnimations(const SkinnedAnimationGroup& in_other) const noexcept;
+        //----------------------------------------------------------
+        /// @return A hash of the attached animations and their
+        /// blendline positions. Groups for which HasSameAnimations()
+        /// is true will have the same hash.
+        //----------------------------------------------------------
+        std::size_t HashAnimations() const noexcept;
     private:
         //----------------------------------------------------------
         /// Animation Item
@@ -190,28 +221,32 @@ namespace ChilliSource
         //----------------------------------------------------------
         /// Calculate Animation Frame
         ///
-        /// Gets the frame data from a single animation.
+        /// Samples the frame data from a single animation into
+        /// the given frame. The frame's buffers are reused, so
+        /// this doesn't allocate once they have grown to fit.
         ///
-        /// @param The blend type.
         /// @param the animation.
         /// @param the playback position.
+        /// @param [Out] The frame the sample is written to.
         //----------------------------------------------------------
-        SkinnedAnimation::FrameCUPtr CalculateAnimationFrame(const SkinnedAnimationCSPtr& inpAnimation, f32 infPlaybackPosition);
+        void CalculateAnimationFrame(const SkinnedAnimationCSPtr& inpAnimation, f32 infPlaybackPosition, SkinnedAnimation::Frame& outFrame);
         //--------------------------------------------------------------
         /// Lerp Between Frames
         ///
-        /// Linearly interpolates between two animation frames.
+        /// Linearly interpolates between two animation frames. The
+        /// output frame may be the same as either input frame.
         ///
         /// @param frame 1
         /// @param frame 2
         /// @param the interpolation factor
-        /// @return output interpolated frame.
+        /// @param [Out] The interpolated frame.
         //--------------------------------------------------------------
-        SkinnedAnimation::FrameCUPtr LerpBetweenFrames(const SkinnedAnimation::Frame* inFrameA, const SkinnedAnimation::Frame* inFrameB, f32 infInterpFactor);
+        static void LerpBetweenFrames(const SkinnedAnimation::Frame& inFrameA, const SkinnedAnimation::Frame& inFrameB, f32 infInterpFactor, SkinnedAnimation::Frame& outFrame);
         
         const Skeleton& mpSkeleton;
         std::vector<AnimationItemPtr> mAnimations;
-        SkinnedAnimation::FrameCUPtr mCurrentAnimationData;
+        SkinnedAnimation::Frame mCurrentAnimationData;
+        SkinnedAnimation::Frame mBlendAnimationData;
         std::vector<Matrix4> mCurrentAnimationMatrices;
         bool mbAnimationLengthDirty;
         f32 mfAnimationLength;
@@ -0,0 +1,58 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2016 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#include <ChilliSource/Rendering/Model/SkinnedAnimationResourceOptions.h>
+
+#include <ChilliSource/Core/Cryptographic/HashCRC32.h>
+
+namespace ChilliSource
+{
+    //-------------------------------------------------------
+    //-------------------------------------------------------
+    SkinnedAnimationResourceOptions::SkinnedAnimationResourceOptions(bool in_compressed, const SkinnedAnimation::ErrorBudget& in_errorBudget)
+    : m_compressed(in_compressed), m_errorBudget(in_errorBudget)
+    {
+    }
+    //-------------------------------------------------------
+    //-------------------------------------------------------
+    u32 SkinnedAnimationResourceOptions::GenerateHash() const
+    {
+        //the options are hashed field by field to avoid including any padding.
+        const f32 hashData[] = { m_compressed ? 1.0f : 0.0f, m_errorBudget.m_maxTranslationError, m_errorBudget.m_maxOrientationError, m_errorBudget.m_maxScaleError };
+        return HashCRC32::GenerateHashCode((const s8*)hashData, sizeof(hashData));
+    }
+    //-------------------------------------------------------
+    //-------------------------------------------------------
+    bool SkinnedAnimationResourceOptions::IsCompressionEnabled() const
+    {
+        return m_compressed;
+    }
+    //-------------------------------------------------------
+    //-------------------------------------------------------
+    const SkinnedAnimation::ErrorBudget& SkinnedAnimationResourceOptions::GetErrorBudget() const
+    {
+        return m_errorBudget;
+    }
+}
@@ -0,0 +1,81 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2016 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#ifndef _CHILLISOURCE_RENDERING_MODEL_SKINNEDANIMATIONRESOURCEOPTIONS_H_
+#define _CHILLISOURCE_RENDERING_MODEL_SKINNEDANIMATIONRESOURCEOPTIONS_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Resource/IResourceOptions.h>
+#include <ChilliSource/Rendering/Model/SkinnedAnimation.h>
+
+namespace ChilliSource
+{
+    //-------------------------------------------------------
+    /// Custom options for loading a skinned animation.
+    //-------------------------------------------------------
+    class SkinnedAnimationResourceOptions final : public IResourceOptions<SkinnedAnimation>
+    {
+    public:
+        //-------------------------------------------------------
+        /// Constructor. Animations are loaded uncompressed by
+        /// default.
+        //-------------------------------------------------------
+        SkinnedAnimationResourceOptions() = default;
+        //-------------------------------------------------------
+        /// Constructor
+        ///
+        /// @param Whether or not the animation should be
+        /// compressed once loaded. This greatly reduces the
+        /// memory used by the animation at the cost of some
+        /// precision and a small increase in load time.
+        /// @param The maximum error that compression may
+        /// introduce.
+        //-------------------------------------------------------
+        SkinnedAnimationResourceOptions(bool in_compressed, const SkinnedAnimation::ErrorBudget& in_errorBudget = SkinnedAnimation::ErrorBudget());
+        //-------------------------------------------------------
+        /// Generate a unique hash based on the
+        /// currently set options
+        ///
+        /// @return Hash of the options contents
+        //-------------------------------------------------------
+        u32 GenerateHash() const override;
+        //-------------------------------------------------------
+        /// @return Whether the animation should be compressed.
+        //-------------------------------------------------------
+        bool IsCompressionEnabled() const;
+        //-------------------------------------------------------
+        /// @return The maximum error that compression may
+        /// introduce.
+        //-------------------------------------------------------
+        const SkinnedAnimation::ErrorBudget& GetErrorBudget() const;
+        
+    private:
+        
+        bool m_compressed = false;
+        SkinnedAnimation::ErrorBudget m_errorBudget;
+    };
+}
+
+#endif
@@ -33,6 +33,7 @@
 #include <ChilliSource/Core/Entity/Entity.h>
 #include <ChilliSource/Core/Math/Matrix4.h>
 #include <ChilliSource/Core/Math/Geometry/Shapes.h>
+#include <ChilliSource/Core/Scene/Scene.h>
 #include <ChilliSource/Rendering/Base/RenderSnapshot.h>
 #include <ChilliSource/Rendering/Material/Material.h>
 
@@ -84,7 +85,9 @@ namespace ChilliSource
     //------------------------------------------------------------------------------
     const AABB& StaticModelComponent::GetAABB() noexcept
     {
-        if(GetEntity() && !m_isAABBValid)
+        ResolveTransformChanges();
+        
+        if(GetEntity() && m_model && !m_isAABBValid)
         {
             m_isAABBValid = true;
             
@@ -166,6 +169,8 @@ namespace ChilliSource
     //------------------------------------------------------------------------------
     const OOBB& StaticModelComponent::GetOOBB() noexcept
     {
+        ResolveTransformChanges();
+        
         if(GetEntity() && !m_isOOBBValid)
         {
             m_isOOBBValid = true;
@@ -179,6 +184,8 @@ namespace ChilliSource
     //------------------------------------------------------------------------------
     const Sphere& StaticModelComponent::GetBoundingSphere() noexcept
     {
+        ResolveTransformChanges();
+        
         if(GetEntity() && !m_isBoundingSphereValid)
         {
             m_isBoundingSphereValid = true;
@@ -207,6 +214,7 @@ namespace ChilliSource
         
         m_oobb.SetSize(m_model->GetAABB().GetSize());
         m_oobb.SetOrigin(m_model->GetAABB().GetOrigin());
+        OnEntityTransformChanged();
         
         SetMaterial(GetMaterialForMesh(0));
     }
@@ -224,6 +232,7 @@ namespace ChilliSource
         
         m_oobb.SetSize(m_model->GetAABB().GetSize());
         m_oobb.SetOrigin(m_model->GetAABB().GetOrigin());
+        OnEntityTransformChanged();
         
         SetMaterial(material);
     }
@@ -246,6 +255,7 @@ namespace ChilliSource
         
         m_oobb.SetSize(m_model->GetAABB().GetSize());
         m_oobb.SetOrigin(m_model->GetAABB().GetOrigin());
+        OnEntityTransformChanged();
     }
     
     //------------------------------------------------------------------------------
@@ -330,6 +340,8 @@ namespace ChilliSource
         m_isAABBValid = false;
         m_isOOBBValid = false;
         m_isBoundingSphereValid = false;
+        
+        InvalidateVolume();
     }
     
     //------------------------------------------------------------------------------
@@ -338,6 +350,12 @@ namespace ChilliSource
         CS_ASSERT(m_model->GetLoadState() == Resource::LoadState::k_loaded, "Cannot use a model that hasn't been loaded yet.");
         CS_ASSERT(m_model->GetNumMeshes() == m_materials.size(), "Invalid number of materials.");
         
+        //objects outside of the camera view are only needed if they could cast a shadow into it.
+        if (!m_shadowCastingEnabled && !GetEntity()->GetScene()->IsVolumeInView(this))
+        {
+            return;
+        }
+        
         for (u32 index = 0; index < m_model->GetNumMeshes(); ++index)
         {
             CS_ASSERT(m_materials[index]->GetLoadState() == Resource::LoadState::k_loaded, "Cannot use a material that hasn't been loaded yet.");
@@ -193,8 +193,8 @@ namespace ChilliSource
         ///
         void OnAddedToScene() noexcept override;
         
-        /// Delegate called when the owning entities transform changes. This is used to dirty
-        /// the bounding volumes
+        /// Delegate called when the owning entities transform changes, or the model is changed.
+        /// This is used to dirty the bounding volumes
         ///
         void OnEntityTransformChanged() noexcept;
         
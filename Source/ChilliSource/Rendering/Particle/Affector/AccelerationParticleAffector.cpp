@@ -29,7 +29,8 @@
 #include <ChilliSource/Rendering/Particle/Affector/AccelerationParticleAffector.h>
 
 #include <ChilliSource/Core/Math/MathUtils.h>
-#include <ChilliSource/Rendering/Particle/Particle.h>
+#include <ChilliSource/Core/Math/SIMD.h>
+#include <ChilliSource/Rendering/Particle/ParticleBuffer.h>
 #include <ChilliSource/Rendering/Particle/ParticleEffect.h>
 #include <ChilliSource/Rendering/Particle/Affector/AccelerationParticleAffectorDef.h>
 
@@ -37,31 +38,43 @@ namespace ChilliSource
 {
     //----------------------------------------------------------------
     //----------------------------------------------------------------
-    AccelerationParticleAffector::AccelerationParticleAffector(const ParticleAffectorDef* in_affectorDef, dynamic_array<Particle>* in_particleArray)
-        : ParticleAffector(in_affectorDef, in_particleArray), m_particleAcceleration(in_particleArray->size())
+    AccelerationParticleAffector::AccelerationParticleAffector(const ParticleAffectorDef* in_affectorDef, ParticleBuffer* in_particleBuffer)
+        : ParticleAffector(in_affectorDef, in_particleBuffer), m_particleAccelerationX(in_particleBuffer->GetStreamLength()), m_particleAccelerationY(in_particleBuffer->GetStreamLength()),
+        m_particleAccelerationZ(in_particleBuffer->GetStreamLength())
     {
         //This can only be created by the AccelerationParticleAffectorDef so this is safe.
         m_accelerationAffectorDef = static_cast<const AccelerationParticleAffectorDef*>(in_affectorDef);
+
+        m_particleAccelerationX.fill(0.0f);
+        m_particleAccelerationY.fill(0.0f);
+        m_particleAccelerationZ.fill(0.0f);
     }
     //----------------------------------------------------------------
     //----------------------------------------------------------------
     void AccelerationParticleAffector::ActivateParticle(u32 in_index, f32 in_effectProgress)
     {
-        CS_ASSERT(in_index >= 0 && in_index < m_particleAcceleration.size(), "Index out of bounds!");
+        CS_ASSERT(in_index >= 0 && in_index < m_particleAccelerationX.size(), "Index out of bounds!");
 
-        m_particleAcceleration[in_index] = m_accelerationAffectorDef->GetAccelerationProperty()->GenerateValue(in_effectProgress);
+        Vector3 acceleration = m_accelerationAffectorDef->GetAccelerationProperty()->GenerateValue(in_effectProgress);
+        m_particleAccelerationX[in_index] = acceleration.x;
+        m_particleAccelerationY[in_index] = acceleration.y;
+        m_particleAccelerationZ[in_index] = acceleration.z;
     }
     //----------------------------------------------------------------
     //----------------------------------------------------------------
     void AccelerationParticleAffector::AffectParticles(f32 in_deltaTime, f32 in_effectProgress)
     {
-        dynamic_array<Particle>* particleArray = GetParticleArray();
-        for (u32 i = 0; i < particleArray->size(); ++i)
-        {
-            Particle& particle = particleArray->at(i);
-            Vector3& acceleration = m_particleAcceleration[i];
+        ParticleBuffer* particleBuffer = GetParticleBuffer();
+        f32* velocitiesX = particleBuffer->GetStream(ParticleBuffer::Stream::k_velocityX);
+        f32* velocitiesY = particleBuffer->GetStream(ParticleBuffer::Stream::k_velocityY);
+        f32* velocitiesZ = particleBuffer->GetStream(ParticleBuffer::Stream::k_velocityZ);
 
-            particle.m_velocity += acceleration * in_deltaTime;
+        const SIMD::Float4 deltaTime = SIMD::Splat(in_deltaTime);
+        for (u32 i = 0; i < particleBuffer->GetActiveRangeEnd(); i += SIMD::k_width)
+        {
+            SIMD::Store(velocitiesX + i, SIMD::MultiplyAdd(SIMD::Load(m_particleAccelerationX.data() + i), deltaTime, SIMD::Load(velocitiesX + i)));
+            SIMD::Store(velocitiesY + i, SIMD::MultiplyAdd(SIMD::Load(m_particleAccelerationY.data() + i), deltaTime, SIMD::Load(velocitiesY + i)));
+            SIMD::Store(velocitiesZ + i, SIMD::MultiplyAdd(SIMD::Load(m_particleAccelerationZ.data() + i), deltaTime, SIMD::Load(velocitiesZ + i)));
         }
     }
-}
\ No newline at end of file
+}
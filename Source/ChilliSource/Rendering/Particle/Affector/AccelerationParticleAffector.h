@@ -79,12 +79,14 @@ namespace ChilliSource
         /// @author Ian Copland
         ///
         /// @param The particle affector definition.
-        /// @param The particle array.
+        /// @param The particle buffer.
         //----------------------------------------------------------------
-        AccelerationParticleAffector(const ParticleAffectorDef* in_affectorDef, dynamic_array<Particle>* in_particleArray);
+        AccelerationParticleAffector(const ParticleAffectorDef* in_affectorDef, ParticleBuffer* in_particleBuffer);
 
         const AccelerationParticleAffectorDef* m_accelerationAffectorDef = nullptr;
-        dynamic_array<Vector3> m_particleAcceleration;
+        dynamic_array<f32> m_particleAccelerationX;
+        dynamic_array<f32> m_particleAccelerationY;
+        dynamic_array<f32> m_particleAccelerationZ;
     };
 }
 
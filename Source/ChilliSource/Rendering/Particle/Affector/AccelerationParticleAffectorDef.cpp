@@ -63,9 +63,9 @@ namespace ChilliSource
     }
     //----------------------------------------------------------------
     //----------------------------------------------------------------
-    ParticleAffectorUPtr AccelerationParticleAffectorDef::CreateInstance(dynamic_array<Particle>* in_particleArray) const
+    ParticleAffectorUPtr AccelerationParticleAffectorDef::CreateVectorisedInstance(ParticleBuffer* in_particleBuffer) const
     {
-        return ParticleAffectorUPtr(new AccelerationParticleAffector(this, in_particleArray));
+        return ParticleAffectorUPtr(new AccelerationParticleAffector(this, in_particleBuffer));
     }
     //----------------------------------------------------------------
     //----------------------------------------------------------------
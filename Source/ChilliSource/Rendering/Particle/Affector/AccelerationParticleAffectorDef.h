@@ -91,15 +91,14 @@ namespace ChilliSource
         //----------------------------------------------------------------
         bool IsA(InterfaceIDType in_interfaceId) const override;
         //----------------------------------------------------------------
-        /// Creates an instance of the particle affector described by this.
+        /// Creates an instance of the particle affector described by this
+        /// which operates directly on the particle buffer.
         ///
-        /// @author Ian Copland.
-        ///
-        /// @param The particle array.
+        /// @param The particle buffer.
         ///
         /// @return the instance.
         //----------------------------------------------------------------
-        ParticleAffectorUPtr CreateInstance(dynamic_array<Particle>* in_particleArray) const override;
+        ParticleAffectorUPtr CreateVectorisedInstance(ParticleBuffer* in_particleBuffer) const override;
         //----------------------------------------------------------------
         /// @author Ian Copland
         ///
@@ -29,7 +29,8 @@
 #include <ChilliSource/Rendering/Particle/Affector/AngularAccelerationParticleAffector.h>
 
 #include <ChilliSource/Core/Math/MathUtils.h>
-#include <ChilliSource/Rendering/Particle/Particle.h>
+#include <ChilliSource/Core/Math/SIMD.h>
+#include <ChilliSource/Rendering/Particle/ParticleBuffer.h>
 #include <ChilliSource/Rendering/Particle/ParticleEffect.h>
 #include <ChilliSource/Rendering/Particle/Affector/AngularAccelerationParticleAffectorDef.h>
 
@@ -37,11 +38,13 @@ namespace ChilliSource
 {
     //----------------------------------------------------------------
     //----------------------------------------------------------------
-    AngularAccelerationParticleAffector::AngularAccelerationParticleAffector(const ParticleAffectorDef* in_affectorDef, dynamic_array<Particle>* in_particleArray)
-        : ParticleAffector(in_affectorDef, in_particleArray), m_particleAngularAcceleration(in_particleArray->size())
+    AngularAccelerationParticleAffector::AngularAccelerationParticleAffector(const ParticleAffectorDef* in_affectorDef, ParticleBuffer* in_particleBuffer)
+        : ParticleAffector(in_affectorDef, in_particleBuffer), m_particleAngularAcceleration(in_particleBuffer->GetStreamLength())
     {
         //This can only be created by the AngularAccelerationParticleAffectorDef so this is safe.
         m_angularAccelerationAffectorDef = static_cast<const AngularAccelerationParticleAffectorDef*>(in_affectorDef);
+
+        m_particleAngularAcceleration.fill(0.0f);
     }
     //----------------------------------------------------------------
     //----------------------------------------------------------------
@@ -55,12 +58,13 @@ namespace ChilliSource
     //----------------------------------------------------------------
     void AngularAccelerationParticleAffector::AffectParticles(f32 in_deltaTime, f32 in_effectProgress)
     {
-        dynamic_array<Particle>* particleArray = GetParticleArray();
-        for (u32 i = 0; i < particleArray->size(); ++i)
+        ParticleBuffer* particleBuffer = GetParticleBuffer();
+        f32* angularVelocities = particleBuffer->GetStream(ParticleBuffer::Stream::k_angularVelocity);
+
+        const SIMD::Float4 deltaTime = SIMD::Splat(in_deltaTime);
+        for (u32 i = 0; i < particleBuffer->GetActiveRangeEnd(); i += SIMD::k_width)
         {
-            Particle& particle = particleArray->at(i);
-            f32 angularAcceleration = m_particleAngularAcceleration[i];
-            particle.m_angularVelocity += angularAcceleration * in_deltaTime;
+            SIMD::Store(angularVelocities + i, SIMD::MultiplyAdd(SIMD::Load(m_particleAngularAcceleration.data() + i), deltaTime, SIMD::Load(angularVelocities + i)));
         }
     }
-}
\ No newline at end of file
+}
@@ -79,9 +79,9 @@ namespace ChilliSource
         /// @author Ian Copland
         ///
         /// @param The particle affector definition.
-        /// @param The particle array.
+        /// @param The particle buffer.
         //----------------------------------------------------------------
-        AngularAccelerationParticleAffector(const ParticleAffectorDef* in_affectorDef, dynamic_array<Particle>* in_particleArray);
+        AngularAccelerationParticleAffector(const ParticleAffectorDef* in_affectorDef, ParticleBuffer* in_particleBuffer);
 
         const AngularAccelerationParticleAffectorDef* m_angularAccelerationAffectorDef = nullptr;
         dynamic_array<f32> m_particleAngularAcceleration;
@@ -63,9 +63,9 @@ namespace ChilliSource
     }
     //----------------------------------------------------------------
     //----------------------------------------------------------------
-    ParticleAffectorUPtr AngularAccelerationParticleAffectorDef::CreateInstance(dynamic_array<Particle>* in_particleArray) const
+    ParticleAffectorUPtr AngularAccelerationParticleAffectorDef::CreateVectorisedInstance(ParticleBuffer* in_particleBuffer) const
     {
-        return ParticleAffectorUPtr(new AngularAccelerationParticleAffector(this, in_particleArray));
+        return ParticleAffectorUPtr(new AngularAccelerationParticleAffector(this, in_particleBuffer));
     }
     //----------------------------------------------------------------
     //----------------------------------------------------------------
@@ -29,78 +29,89 @@
 #include <ChilliSource/Rendering/Particle/Affector/ColourOverLifetimeParticleAffector.h>
 
 #include <ChilliSource/Core/Math/MathUtils.h>
-#include <ChilliSource/Rendering/Particle/Particle.h>
+#include <ChilliSource/Core/Math/SIMD.h>
+#include <ChilliSource/Rendering/Particle/ParticleBuffer.h>
 #include <ChilliSource/Rendering/Particle/ParticleEffect.h>
 #include <ChilliSource/Rendering/Particle/Affector/ColourOverLifetimeParticleAffectorDef.h>
 
+#include <algorithm>
+
 namespace ChilliSource
 {
-    namespace
-    {
-        //----------------------------------------------------------------
-        /// @author Nicolas Tanda
-        ///
-        /// @param Value to clamp
-        ///
-        /// @return The value clamped between 0.0f and 1.0f
-        //----------------------------------------------------------------
-        f32 Clamp(f32 in_value)
-        {
-            return MathUtils::Clamp(in_value, 0.0f, 1.0f);
-        }
-    }
-    
     //----------------------------------------------------------------
     //----------------------------------------------------------------
-    ColourOverLifetimeParticleAffector::ColourOverLifetimeParticleAffector(const ParticleAffectorDef* in_affectorDef, dynamic_array<Particle>* in_particleArray)
-    :ParticleAffector(in_affectorDef, in_particleArray)
-    ,m_particleColourData(0)
+    ColourOverLifetimeParticleAffector::ColourOverLifetimeParticleAffector(const ParticleAffectorDef* in_affectorDef, ParticleBuffer* in_particleBuffer)
+    :ParticleAffector(in_affectorDef, in_particleBuffer)
+    ,m_particleKeyData(0)
+    ,m_particleLifeProgress(in_particleBuffer->GetStreamLength())
+    ,m_streamLength(in_particleBuffer->GetStreamLength())
     {
         m_colourOverLifetimeAffectorDef = static_cast<const ColourOverLifetimeParticleAffectorDef*>(in_affectorDef);
         m_intermediateParticles = static_cast<u32>(m_colourOverLifetimeAffectorDef->GetIntermediateColours().size());
-        m_particleColourData = std::move(dynamic_array<ColourData>(in_particleArray->size() * (2 + m_intermediateParticles)));
+        m_intermediateColours.reserve(m_intermediateParticles);
+
+        const u32 numKeys = 2 + m_intermediateParticles;
+        m_particleKeyData = dynamic_array<f32>(numKeys * u32(KeyStream::k_total) * m_streamLength);
+        m_particleKeyData.fill(0.0f);
+        m_particleLifeProgress.fill(0.0f);
+
+        //Particles which have never been activated are still processed, so give them distinct key times to avoid dividing by zero.
+        for (u32 keyIndex = 0; keyIndex < numKeys; ++keyIndex)
+        {
+            std::fill_n(GetKeyStream(keyIndex, KeyStream::k_time), m_streamLength, f32(keyIndex) / f32(numKeys - 1));
+        }
     }
     //----------------------------------------------------------------
     //----------------------------------------------------------------
     void ColourOverLifetimeParticleAffector::ActivateParticle(u32 in_index, f32 in_effectProgress)
     {
-        u32 colourDataIndex = in_index * (2 + m_intermediateParticles);
-        CS_ASSERT(colourDataIndex >= 0 && colourDataIndex < m_particleColourData.size(), "colourDataIndex out of bounds!");
+        CS_ASSERT(in_index >= 0 && in_index < m_streamLength, "index out of bounds!");
         
-        ColourData& colourDataInitial = m_particleColourData[colourDataIndex];
-        const Particle& particle = GetParticleArray()->at(in_index);
+        const ParticleBuffer* particleBuffer = GetParticleBuffer();
         
+        ColourData colourDataInitial;
         colourDataInitial.m_time = 0.0f;
-        colourDataInitial.m_colour = particle.m_colour;
-        ++colourDataIndex;
+        colourDataInitial.m_colour.r = particleBuffer->GetStream(ParticleBuffer::Stream::k_colourR)[in_index];
+        colourDataInitial.m_colour.g = particleBuffer->GetStream(ParticleBuffer::Stream::k_colourG)[in_index];
+        colourDataInitial.m_colour.b = particleBuffer->GetStream(ParticleBuffer::Stream::k_colourB)[in_index];
+        colourDataInitial.m_colour.a = particleBuffer->GetStream(ParticleBuffer::Stream::k_colourA)[in_index];
         
         // Get the intermediate colours
-        std::vector<ColourData> intermediateColours;
-        intermediateColours.reserve(m_intermediateParticles);
+        m_intermediateColours.clear();
         for(const auto& intermediateColour : m_colourOverLifetimeAffectorDef->GetIntermediateColours())
         {
-            intermediateColours.push_back(ColourData());
-            intermediateColours.back().m_colour = intermediateColour.m_colourProperty->GenerateValue(in_effectProgress);
-            intermediateColours.back().m_time = intermediateColour.m_timeProperty->GenerateValue(in_effectProgress);
+            m_intermediateColours.push_back(ColourData());
+            m_intermediateColours.back().m_colour = intermediateColour.m_colourProperty->GenerateValue(in_effectProgress);
+            m_intermediateColours.back().m_time = intermediateColour.m_timeProperty->GenerateValue(in_effectProgress);
         }
         
         // Sort by time
-        std::sort(intermediateColours.begin(), intermediateColours.end(), [](const ColourData& in_r, const ColourData& in_l)-> bool
+        std::sort(m_intermediateColours.begin(), m_intermediateColours.end(), [](const ColourData& in_r, const ColourData& in_l)-> bool
         {
             return in_r.m_time < in_l.m_time;
         });
         
-        // Add to the particles colour data
-        for(const auto& intermediateColour : intermediateColours)
-        {
-            ColourData& colourDataIntermediate = m_particleColourData[colourDataIndex];
-            colourDataIntermediate = intermediateColour;
-            ++colourDataIndex;
-        }
-        
-        ColourData& colourDataTarget = m_particleColourData[colourDataIndex];
+        ColourData colourDataTarget;
         colourDataTarget.m_time = 1.0f;
         colourDataTarget.m_colour = m_colourOverLifetimeAffectorDef->GetTargetColourProperty()->GenerateValue(in_effectProgress);
+        
+        // Add to the particles colour keys
+        auto setKey = [&](u32 in_keyIndex, const ColourData& in_colourData)
+        {
+            GetKeyStream(in_keyIndex, KeyStream::k_colourR)[in_index] = in_colourData.m_colour.r;
+            GetKeyStream(in_keyIndex, KeyStream::k_colourG)[in_index] = in_colourData.m_colour.g;
+            GetKeyStream(in_keyIndex, KeyStream::k_colourB)[in_index] = in_colourData.m_colour.b;
+            GetKeyStream(in_keyIndex, KeyStream::k_colourA)[in_index] = in_colourData.m_colour.a;
+            GetKeyStream(in_keyIndex, KeyStream::k_time)[in_index] = in_colourData.m_time;
+        };
+        
+        u32 keyIndex = 0;
+        setKey(keyIndex++, colourDataInitial);
+        for(const auto& intermediateColour : m_intermediateColours)
+        {
+            setKey(keyIndex++, intermediateColour);
+        }
+        setKey(keyIndex, colourDataTarget);
     }
     //----------------------------------------------------------------
     //----------------------------------------------------------------
@@ -108,30 +119,72 @@ namespace ChilliSource
     {
         const auto& interpolation = m_colourOverLifetimeAffectorDef->GetInterpolation();
         
-        dynamic_array<Particle>* particleArray = GetParticleArray();
-        for (u32 i = 0; i < particleArray->size(); ++i)
+        ParticleBuffer* particleBuffer = GetParticleBuffer();
+        const f32* energies = particleBuffer->GetStream(ParticleBuffer::Stream::k_energy);
+        const f32* lifetimes = particleBuffer->GetStream(ParticleBuffer::Stream::k_lifetime);
+        
+        // The interpolation curve is an arbitrary function so has to be evaluated for each live particle individually.
+        for (auto index : particleBuffer->GetActiveIndices())
+        {
+            f32 normalisedLifeProgress = 1.0f - (energies[index] / lifetimes[index]);
+            m_particleLifeProgress[index] = interpolation(normalisedLifeProgress);
+        }
+        
+        f32* coloursR = particleBuffer->GetStream(ParticleBuffer::Stream::k_colourR);
+        f32* coloursG = particleBuffer->GetStream(ParticleBuffer::Stream::k_colourG);
+        f32* coloursB = particleBuffer->GetStream(ParticleBuffer::Stream::k_colourB);
+        f32* coloursA = particleBuffer->GetStream(ParticleBuffer::Stream::k_colourA);
+        
+        const SIMD::Float4 zero = SIMD::Splat(0.0f);
+        const SIMD::Float4 one = SIMD::Splat(1.0f);
+        for (u32 i = 0; i < particleBuffer->GetActiveRangeEnd(); i += SIMD::k_width)
         {
-            Particle& particle = particleArray->at(i);
+            SIMD::Float4 progress = SIMD::Load(m_particleLifeProgress.data() + i);
             
-            if(particle.m_isActive == false)
-            {
-                continue;
-            }
+            SIMD::Float4 keyR = SIMD::Load(GetKeyStream(0, KeyStream::k_colourR) + i);
+            SIMD::Float4 keyG = SIMD::Load(GetKeyStream(0, KeyStream::k_colourG) + i);
+            SIMD::Float4 keyB = SIMD::Load(GetKeyStream(0, KeyStream::k_colourB) + i);
+            SIMD::Float4 keyA = SIMD::Load(GetKeyStream(0, KeyStream::k_colourA) + i);
+            SIMD::Float4 keyTime = SIMD::Load(GetKeyStream(0, KeyStream::k_time) + i);
             
-            u32 colourIndex = i * (2 + m_intermediateParticles);
-            ColourData& colourDataInitial = m_particleColourData[colourIndex];
-
-            f32 normalisedLifeProgress = 1.0f - (particle.m_energy / particle.m_lifetime);
-            f32 progress = interpolation(normalisedLifeProgress);
+            SIMD::Float4 colourR = keyR;
+            SIMD::Float4 colourG = keyG;
+            SIMD::Float4 colourB = keyB;
+            SIMD::Float4 colourA = keyA;
             
-            particle.m_colour = colourDataInitial.m_colour;
             for(u32 offset = 0; offset < m_intermediateParticles + 1; ++offset)
             {
-                ColourData& colourData = m_particleColourData[colourIndex + offset];
-                ColourData& colourDataNext = m_particleColourData[colourIndex + offset + 1];
-                f32 timeProgress = Clamp(Clamp(progress - colourData.m_time) / (colourDataNext.m_time - colourData.m_time));
-                particle.m_colour += (colourDataNext.m_colour - colourData.m_colour) * timeProgress;
+                SIMD::Float4 nextKeyR = SIMD::Load(GetKeyStream(offset + 1, KeyStream::k_colourR) + i);
+                SIMD::Float4 nextKeyG = SIMD::Load(GetKeyStream(offset + 1, KeyStream::k_colourG) + i);
+                SIMD::Float4 nextKeyB = SIMD::Load(GetKeyStream(offset + 1, KeyStream::k_colourB) + i);
+                SIMD::Float4 nextKeyA = SIMD::Load(GetKeyStream(offset + 1, KeyStream::k_colourA) + i);
+                SIMD::Float4 nextKeyTime = SIMD::Load(GetKeyStream(offset + 1, KeyStream::k_time) + i);
+                
+                SIMD::Float4 timeProgress = SIMD::Clamp(SIMD::Subtract(progress, keyTime), zero, one);
+                timeProgress = SIMD::Clamp(SIMD::Divide(timeProgress, SIMD::Subtract(nextKeyTime, keyTime)), zero, one);
+                
+                colourR = SIMD::MultiplyAdd(SIMD::Subtract(nextKeyR, keyR), timeProgress, colourR);
+                colourG = SIMD::MultiplyAdd(SIMD::Subtract(nextKeyG, keyG), timeProgress, colourG);
+                colourB = SIMD::MultiplyAdd(SIMD::Subtract(nextKeyB, keyB), timeProgress, colourB);
+                colourA = SIMD::MultiplyAdd(SIMD::Subtract(nextKeyA, keyA), timeProgress, colourA);
+                
+                keyR = nextKeyR;
+                keyG = nextKeyG;
+                keyB = nextKeyB;
+                keyA = nextKeyA;
+                keyTime = nextKeyTime;
             }
+            
+            SIMD::Store(coloursR + i, colourR);
+            SIMD::Store(coloursG + i, colourG);
+            SIMD::Store(coloursB + i, colourB);
+            SIMD::Store(coloursA + i, colourA);
         }
     }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    f32* ColourOverLifetimeParticleAffector::GetKeyStream(u32 in_keyIndex, KeyStream in_stream)
+    {
+        return m_particleKeyData.data() + (in_keyIndex * u32(KeyStream::k_total) + u32(in_stream)) * m_streamLength;
+    }
 }
@@ -34,6 +34,8 @@
 #include <ChilliSource/Core/Container/dynamic_array.h>
 #include <ChilliSource/Rendering/Particle/Affector/ParticleAffector.h>
 
+#include <vector>
+
 namespace ChilliSource
 {
     //---------------------------------------------------------------------
@@ -77,7 +79,7 @@ namespace ChilliSource
     private:
         friend class ColourOverLifetimeParticleAffectorDef;
         //----------------------------------------------------------------
-        /// A container for the colours of a single particle.
+        /// A container for a single colour key of a particle.
         ///
         /// @author Nicolas Tanda
         //----------------------------------------------------------------
@@ -87,20 +89,44 @@ namespace ChilliSource
             f32 m_time;
         };
         //----------------------------------------------------------------
+        /// The streams stored for each colour key. Each particle has the
+        /// initial colour, the intermediate colours and the target colour
+        /// as keys.
+        //----------------------------------------------------------------
+        enum class KeyStream
+        {
+            k_colourR,
+            k_colourG,
+            k_colourB,
+            k_colourA,
+            k_time,
+            k_total
+        };
+        //----------------------------------------------------------------
         /// Constructor.
         ///
         /// @author Ian Copland
         ///
         /// @param The particle affector definition.
-        /// @param The particle array.
+        /// @param The particle buffer.
+        //----------------------------------------------------------------
+        ColourOverLifetimeParticleAffector(const ParticleAffectorDef* in_affectorDef, ParticleBuffer* in_particleBuffer);
+        //----------------------------------------------------------------
+        /// @param The index of the colour key.
+        /// @param The stream.
+        ///
+        /// @return The start of the requested stream for the given key.
         //----------------------------------------------------------------
-        ColourOverLifetimeParticleAffector(const ParticleAffectorDef* in_affectorDef, dynamic_array<Particle>* in_particleArray);
+        f32* GetKeyStream(u32 in_keyIndex, KeyStream in_stream);
         
     private:
         const ColourOverLifetimeParticleAffectorDef* m_colourOverLifetimeAffectorDef = nullptr;
-        dynamic_array<ColourData> m_particleColourData;
+        dynamic_array<f32> m_particleKeyData;
+        dynamic_array<f32> m_particleLifeProgress;
+        std::vector<ColourData> m_intermediateColours;
         
         u32 m_intermediateParticles = 0;
+        u32 m_streamLength = 0;
     };
 }
 
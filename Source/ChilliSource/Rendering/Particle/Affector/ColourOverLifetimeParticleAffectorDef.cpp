@@ -109,9 +109,9 @@ namespace ChilliSource
     }
     //----------------------------------------------------------------
     //----------------------------------------------------------------
-    ParticleAffectorUPtr ColourOverLifetimeParticleAffectorDef::CreateInstance(dynamic_array<Particle>* in_particleArray) const
+    ParticleAffectorUPtr ColourOverLifetimeParticleAffectorDef::CreateVectorisedInstance(ParticleBuffer* in_particleBuffer) const
     {
-        return ParticleAffectorUPtr(new ColourOverLifetimeParticleAffector(this, in_particleArray));
+        return ParticleAffectorUPtr(new ColourOverLifetimeParticleAffector(this, in_particleBuffer));
     }
     //----------------------------------------------------------------
     //----------------------------------------------------------------
@@ -35,6 +35,20 @@ namespace ChilliSource
     ParticleAffector::ParticleAffector(const ParticleAffectorDef* in_affectorDef, dynamic_array<Particle>* in_particleArray)
         : m_affectorDef(in_affectorDef), m_particleArray(in_particleArray)
     {
+        CS_ASSERT(m_particleArray != nullptr, "Cannot create particle affector with null particle array.");
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    ParticleAffector::ParticleAffector(const ParticleAffectorDef* in_affectorDef, ParticleBuffer* in_particleBuffer)
+        : m_affectorDef(in_affectorDef), m_particleBuffer(in_particleBuffer)
+    {
+        CS_ASSERT(m_particleBuffer != nullptr, "Cannot create particle affector with null particle buffer.");
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    bool ParticleAffector::RequiresParticleArray() const
+    {
+        return (m_particleArray != nullptr);
     }
     //----------------------------------------------------------------
     //----------------------------------------------------------------
@@ -48,4 +62,10 @@ namespace ChilliSource
     {
         return m_particleArray;
     }
-}
\ No newline at end of file
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    ParticleBuffer* ParticleAffector::GetParticleBuffer() const
+    {
+        return m_particleBuffer;
+    }
+}
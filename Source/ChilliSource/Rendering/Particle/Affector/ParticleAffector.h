@@ -40,6 +40,12 @@ namespace ChilliSource
     ///
     /// Particle affectors will be updated as part of a background task and 
     /// should not be accessed from other threads.
+    ///
+    /// Affectors either operate directly on the structure-of-arrays 
+    /// particle buffer, which allows them to process particles using SIMD,
+    /// or on an array of Particle structures. The latter is slower, as the
+    /// particle state has to be copied to and from the array each update,
+    /// but is simpler to implement, so is suitable for custom affectors.
     //---------------------------------------------------------------------
     class ParticleAffector
     {
@@ -55,6 +61,19 @@ namespace ChilliSource
         //----------------------------------------------------------------
         ParticleAffector(const ParticleAffectorDef* in_affectorDef, dynamic_array<Particle>* in_particleArray);
         //----------------------------------------------------------------
+        /// Constructor. Creates an affector which operates directly on
+        /// the particle buffer.
+        ///
+        /// @param The particle affector definition.
+        /// @param The particle buffer.
+        //----------------------------------------------------------------
+        ParticleAffector(const ParticleAffectorDef* in_affectorDef, ParticleBuffer* in_particleBuffer);
+        //----------------------------------------------------------------
+        /// @return Whether or not this operates on an array of Particle
+        /// structures rather than directly on the particle buffer.
+        //----------------------------------------------------------------
+        bool RequiresParticleArray() const;
+        //----------------------------------------------------------------
         /// Activates the particle with the given index.
         ///
         /// This will be called on a background thread.
@@ -94,13 +113,20 @@ namespace ChilliSource
         //----------------------------------------------------------------
         /// @author Ian Copland
         ///
-        /// @return The particle array.
+        /// @return The particle array. This will be null if the affector
+        /// operates on the particle buffer.
         //----------------------------------------------------------------
         dynamic_array<Particle>* GetParticleArray() const;
+        //----------------------------------------------------------------
+        /// @return The particle buffer. This will be null if the affector
+        /// operates on a particle array.
+        //----------------------------------------------------------------
+        ParticleBuffer* GetParticleBuffer() const;
     private:
 
         const ParticleAffectorDef* m_affectorDef = nullptr;
         dynamic_array<Particle>* m_particleArray = nullptr;
+        ParticleBuffer* m_particleBuffer = nullptr;
     };
 }
 
@@ -28,11 +28,26 @@
 
 #include <ChilliSource/Rendering/Particle/Affector/ParticleAffectorDef.h>
 
+#include <ChilliSource/Rendering/Particle/Affector/ParticleAffector.h>
+
 namespace ChilliSource
 {
     CS_DEFINE_NAMEDTYPE(ParticleAffectorDef);
     //----------------------------------------------------------------
     //----------------------------------------------------------------
+    ParticleAffectorUPtr ParticleAffectorDef::CreateVectorisedInstance(ParticleBuffer* in_particleBuffer) const
+    {
+        return nullptr;
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    ParticleAffectorUPtr ParticleAffectorDef::CreateInstance(dynamic_array<Particle>* in_particleArray) const
+    {
+        CS_LOG_FATAL("Particle affector defs must implement either CreateVectorisedInstance() or CreateInstance().");
+        return nullptr;
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
     const ParticleEffect* ParticleAffectorDef::GetParticleEffect() const
     {
         return m_particleEffect;
@@ -71,7 +71,23 @@ namespace ChilliSource
         //----------------------------------------------------------------
         ParticleAffectorDef() = default;
         //----------------------------------------------------------------
-        /// Creates an instance of the particle affector described by this.
+        /// Creates an instance of the particle affector described by this
+        /// which operates directly on the structure-of-arrays particle
+        /// buffer. This is preferred over CreateInstance(), which will
+        /// only be called if this returns null. By default this returns 
+        /// null.
+        ///
+        /// @param The particle buffer.
+        ///
+        /// @return the instance, or null if not supported.
+        //----------------------------------------------------------------
+        virtual ParticleAffectorUPtr CreateVectorisedInstance(ParticleBuffer* in_particleBuffer) const;
+        //----------------------------------------------------------------
+        /// Creates an instance of the particle affector described by this
+        /// which operates on an array of Particle structures. The array is
+        /// kept in sync with the particle buffer while the affector is
+        /// applied. This must be implemented if CreateVectorisedInstance()
+        /// is not.
         ///
         /// @author Ian Copland.
         ///
@@ -79,7 +95,7 @@ namespace ChilliSource
         ///
         /// @return the instance.
         //----------------------------------------------------------------
-        virtual ParticleAffectorUPtr CreateInstance(dynamic_array<Particle>* in_particleArray) const = 0;
+        virtual ParticleAffectorUPtr CreateInstance(dynamic_array<Particle>* in_particleArray) const;
         //----------------------------------------------------------------
         /// @author Ian Copland
         ///
@@ -29,7 +29,8 @@
 #include <ChilliSource/Rendering/Particle/Affector/ScaleOverLifetimeParticleAffector.h>
 
 #include <ChilliSource/Core/Math/MathUtils.h>
-#include <ChilliSource/Rendering/Particle/Particle.h>
+#include <ChilliSource/Core/Math/SIMD.h>
+#include <ChilliSource/Rendering/Particle/ParticleBuffer.h>
 #include <ChilliSource/Rendering/Particle/ParticleEffect.h>
 #include <ChilliSource/Rendering/Particle/Affector/ScaleOverLifetimeParticleAffectorDef.h>
 
@@ -37,37 +38,50 @@ namespace ChilliSource
 {
     //----------------------------------------------------------------
     //----------------------------------------------------------------
-    ScaleOverLifetimeParticleAffector::ScaleOverLifetimeParticleAffector(const ParticleAffectorDef* in_affectorDef, dynamic_array<Particle>* in_particleArray)
-        : ParticleAffector(in_affectorDef, in_particleArray), m_particleScaleData(in_particleArray->size())
+    ScaleOverLifetimeParticleAffector::ScaleOverLifetimeParticleAffector(const ParticleAffectorDef* in_affectorDef, ParticleBuffer* in_particleBuffer)
+        : ParticleAffector(in_affectorDef, in_particleBuffer), m_particleInitialScaleX(in_particleBuffer->GetStreamLength()), m_particleInitialScaleY(in_particleBuffer->GetStreamLength()),
+        m_particleScaleDeltaX(in_particleBuffer->GetStreamLength()), m_particleScaleDeltaY(in_particleBuffer->GetStreamLength())
     {
         //This can only be created by the ScaleOverLifetimeParticleAffectorDef so this is safe.
         m_scaleOverLifetimeAffectorDef = static_cast<const ScaleOverLifetimeParticleAffectorDef*>(in_affectorDef);
+
+        m_particleInitialScaleX.fill(0.0f);
+        m_particleInitialScaleY.fill(0.0f);
+        m_particleScaleDeltaX.fill(0.0f);
+        m_particleScaleDeltaY.fill(0.0f);
     }
     //----------------------------------------------------------------
     //----------------------------------------------------------------
     void ScaleOverLifetimeParticleAffector::ActivateParticle(u32 in_index, f32 in_effectProgress)
     {
-        CS_ASSERT(in_index >= 0 && in_index < m_particleScaleData.size(), "Index out of bounds!");
+        CS_ASSERT(in_index >= 0 && in_index < m_particleInitialScaleX.size(), "Index out of bounds!");
 
-        ScaleData& scaleData = m_particleScaleData[in_index];
-        const Particle& particle = GetParticleArray()->at(in_index);
-        
-        scaleData.m_initialScale = particle.m_scale;
+        const ParticleBuffer* particleBuffer = GetParticleBuffer();
+        Vector2 initialScale(particleBuffer->GetStream(ParticleBuffer::Stream::k_scaleX)[in_index], particleBuffer->GetStream(ParticleBuffer::Stream::k_scaleY)[in_index]);
+        Vector2 targetScale = initialScale * m_scaleOverLifetimeAffectorDef->GetScaleProperty()->GenerateValue(in_effectProgress);
 
-        scaleData.m_targetScale = scaleData.m_initialScale * m_scaleOverLifetimeAffectorDef->GetScaleProperty()->GenerateValue(in_effectProgress);
+        //the difference is stored rather than the target scale so the update is a single multiply-add.
+        m_particleInitialScaleX[in_index] = initialScale.x;
+        m_particleInitialScaleY[in_index] = initialScale.y;
+        m_particleScaleDeltaX[in_index] = targetScale.x - initialScale.x;
+        m_particleScaleDeltaY[in_index] = targetScale.y - initialScale.y;
     }
     //----------------------------------------------------------------
     //----------------------------------------------------------------
     void ScaleOverLifetimeParticleAffector::AffectParticles(f32 in_deltaTime, f32 in_effectProgress)
     {
-        dynamic_array<Particle>* particleArray = GetParticleArray();
-        for (u32 i = 0; i < particleArray->size(); ++i)
-        {
-            Particle& particle = particleArray->at(i);
-            ScaleData& scaleData = m_particleScaleData[i];
+        ParticleBuffer* particleBuffer = GetParticleBuffer();
+        const f32* energies = particleBuffer->GetStream(ParticleBuffer::Stream::k_energy);
+        const f32* lifetimes = particleBuffer->GetStream(ParticleBuffer::Stream::k_lifetime);
+        f32* scalesX = particleBuffer->GetStream(ParticleBuffer::Stream::k_scaleX);
+        f32* scalesY = particleBuffer->GetStream(ParticleBuffer::Stream::k_scaleY);
 
-            f32 normalisedLifeProgress = 1.0f - (particle.m_energy / particle.m_lifetime);
-            particle.m_scale = scaleData.m_initialScale + (scaleData.m_targetScale - scaleData.m_initialScale) * normalisedLifeProgress;
+        const SIMD::Float4 one = SIMD::Splat(1.0f);
+        for (u32 i = 0; i < particleBuffer->GetActiveRangeEnd(); i += SIMD::k_width)
+        {
+            SIMD::Float4 normalisedLifeProgress = SIMD::Subtract(one, SIMD::Divide(SIMD::Load(energies + i), SIMD::Load(lifetimes + i)));
+            SIMD::Store(scalesX + i, SIMD::MultiplyAdd(SIMD::Load(m_particleScaleDeltaX.data() + i), normalisedLifeProgress, SIMD::Load(m_particleInitialScaleX.data() + i)));
+            SIMD::Store(scalesY + i, SIMD::MultiplyAdd(SIMD::Load(m_particleScaleDeltaY.data() + i), normalisedLifeProgress, SIMD::Load(m_particleInitialScaleY.data() + i)));
         }
     }
-}
\ No newline at end of file
+}
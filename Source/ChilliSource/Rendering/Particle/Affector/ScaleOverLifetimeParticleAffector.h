@@ -81,23 +81,15 @@ namespace ChilliSource
         /// @author Ian Copland
         ///
         /// @param The particle affector definition.
-        /// @param The particle array.
+        /// @param The particle buffer.
         //----------------------------------------------------------------
-        ScaleOverLifetimeParticleAffector(const ParticleAffectorDef* in_affectorDef, dynamic_array<Particle>* in_particleArray);
-        //----------------------------------------------------------------
-        /// A container for the initial scale and scale factor of a single 
-        /// particle.
-        ///
-        /// @author Ian Copland.
-        //----------------------------------------------------------------
-        struct ScaleData
-        {
-            Vector2 m_initialScale;
-            Vector2 m_targetScale;
-        };
+        ScaleOverLifetimeParticleAffector(const ParticleAffectorDef* in_affectorDef, ParticleBuffer* in_particleBuffer);
 
         const ScaleOverLifetimeParticleAffectorDef* m_scaleOverLifetimeAffectorDef = nullptr;
-        dynamic_array<ScaleData> m_particleScaleData;
+        dynamic_array<f32> m_particleInitialScaleX;
+        dynamic_array<f32> m_particleInitialScaleY;
+        dynamic_array<f32> m_particleScaleDeltaX;
+        dynamic_array<f32> m_particleScaleDeltaY;
     };
 }
 
@@ -63,9 +63,9 @@ namespace ChilliSource
     }
     //----------------------------------------------------------------
     //----------------------------------------------------------------
-    ParticleAffectorUPtr ScaleOverLifetimeParticleAffectorDef::CreateInstance(dynamic_array<Particle>* in_particleArray) const
+    ParticleAffectorUPtr ScaleOverLifetimeParticleAffectorDef::CreateVectorisedInstance(ParticleBuffer* in_particleBuffer) const
     {
-        return ParticleAffectorUPtr(new ScaleOverLifetimeParticleAffector(this, in_particleArray));
+        return ParticleAffectorUPtr(new ScaleOverLifetimeParticleAffector(this, in_particleBuffer));
     }
     //----------------------------------------------------------------
     //----------------------------------------------------------------
@@ -28,7 +28,9 @@
 
 #include <ChilliSource/Rendering/Particle/ConcurrentParticleData.h>
 
-#include <ChilliSource/Rendering/Particle/Particle.h>
+#include <ChilliSource/Rendering/Particle/ParticleBuffer.h>
+
+#include <algorithm>
 
 namespace ChilliSource
 {
@@ -104,33 +106,47 @@ namespace ChilliSource
     }
     //-----------------------------------------------------------------
     //-----------------------------------------------------------------
-    void ConcurrentParticleData::CommitParticleData(const dynamic_array<ChilliSource::Particle>* in_particles, const std::vector<u32>& in_newIndices, const AABB& in_aabb, const Sphere& in_boundingSphere)
+    void ConcurrentParticleData::CommitParticleData(const ParticleBuffer& in_particleBuffer, const std::vector<u32>& in_newIndices, const AABB& in_aabb, const Sphere& in_boundingSphere)
     {
         std::unique_lock<std::recursive_mutex> lock(m_mutex);
 
-        CS_ASSERT(in_particles->size() == m_particles.size(), "Particle data lists must be the same size.");
+        CS_ASSERT(in_particleBuffer.GetMaxParticles() == m_particles.size(), "Particle data lists must be the same size.");
+
+        //Only particles within the active range can be active, but any particles that were active in the
+        //previous commit also need to be updated.
+        const u32 activeRangeEnd = std::min(in_particleBuffer.GetActiveRangeEnd(), u32(m_particles.size()));
+        const u32 updateRangeEnd = std::max(activeRangeEnd, m_committedRangeEnd);
 
-        m_activeParticles = false;
-        for (u32 i = 0; i < m_particles.size(); ++i)
+        const f32* positionsX = in_particleBuffer.GetStream(ParticleBuffer::Stream::k_positionX);
+        const f32* positionsY = in_particleBuffer.GetStream(ParticleBuffer::Stream::k_positionY);
+        const f32* positionsZ = in_particleBuffer.GetStream(ParticleBuffer::Stream::k_positionZ);
+        const f32* scalesX = in_particleBuffer.GetStream(ParticleBuffer::Stream::k_scaleX);
+        const f32* scalesY = in_particleBuffer.GetStream(ParticleBuffer::Stream::k_scaleY);
+        const f32* rotations = in_particleBuffer.GetStream(ParticleBuffer::Stream::k_rotation);
+        const f32* coloursR = in_particleBuffer.GetStream(ParticleBuffer::Stream::k_colourR);
+        const f32* coloursG = in_particleBuffer.GetStream(ParticleBuffer::Stream::k_colourG);
+        const f32* coloursB = in_particleBuffer.GetStream(ParticleBuffer::Stream::k_colourB);
+        const f32* coloursA = in_particleBuffer.GetStream(ParticleBuffer::Stream::k_colourA);
+
+        for (u32 i = 0; i < updateRangeEnd; ++i)
         {
             Particle& concurrentParticle = m_particles[i];
-            const ChilliSource::Particle& particle = (*in_particles)[i];
-
-            concurrentParticle.m_isActive = particle.m_isActive;
-            concurrentParticle.m_position = particle.m_position;
-            concurrentParticle.m_rotation = particle.m_rotation;
-            concurrentParticle.m_scale = particle.m_scale;
-            concurrentParticle.m_colour = particle.m_colour;
 
+            concurrentParticle.m_isActive = in_particleBuffer.IsActive(i);
             if (concurrentParticle.m_isActive == true)
             {
-                m_activeParticles = true;
+                concurrentParticle.m_position = Vector3(positionsX[i], positionsY[i], positionsZ[i]);
+                concurrentParticle.m_rotation = rotations[i];
+                concurrentParticle.m_scale = Vector2(scalesX[i], scalesY[i]);
+                concurrentParticle.m_colour = Colour(coloursR[i], coloursG[i], coloursB[i], coloursA[i]);
             }
         }
 
+        m_activeParticles = (in_particleBuffer.GetNumActiveParticles() > 0);
+        m_committedRangeEnd = activeRangeEnd;
         m_newParticleIndices.insert(m_newParticleIndices.end(), in_newIndices.begin(), in_newIndices.end());
         m_aabb = in_aabb;
         m_boundingSphere = in_boundingSphere;
         m_updating = false;
     }
-}
\ No newline at end of file
+}
@@ -159,19 +159,19 @@ namespace ChilliSource
         ///
         /// @author Ian Copland
         ///
-        /// @param The list of particles.
+        /// @param The particle buffer.
         /// @param The new indices.
         /// @param The aabb.
-        /// @param The obb.
         /// @param The bounding sphere.
         //-----------------------------------------------------------------
-        void CommitParticleData(const dynamic_array<ChilliSource::Particle>* in_particles, const std::vector<u32>& in_newIndices, const AABB& in_aabb, const Sphere& in_boundingSphere);
+        void CommitParticleData(const ParticleBuffer& in_particleBuffer, const std::vector<u32>& in_newIndices, const AABB& in_aabb, const Sphere& in_boundingSphere);
     private:
 
         dynamic_array<ConcurrentParticleData::Particle> m_particles;
         std::vector<u32> m_newParticleIndices;
         AABB m_aabb;
         Sphere m_boundingSphere;
+        u32 m_committedRangeEnd = 0;
         bool m_updating = false;
         bool m_activeParticles = false;
         
@@ -36,23 +36,46 @@
 #include <ChilliSource/Rendering/Particle/Drawable/StaticBillboardParticleDrawableDef.h>
 
 #include <ChilliSource/Core/Base/Application.h>
+#include <ChilliSource/Core/Base/ByteColour.h>
 #include <ChilliSource/Core/Base/ColourUtils.h>
 #include <ChilliSource/Core/Entity/Entity.h>
 #include <ChilliSource/Core/Math/Matrix4.h>
 #include <ChilliSource/Core/Math/Quaternion.h>
 #include <ChilliSource/Core/Math/Vector3.h>
+#include <ChilliSource/Core/Math/Vector4.h>
+#include <ChilliSource/Core/Memory/UniquePtr.h>
 #include <ChilliSource/Rendering/Base/AlignmentAnchors.h>
 #include <ChilliSource/Rendering/Base/AspectRatioUtils.h>
 #include <ChilliSource/Rendering/Camera/CameraComponent.h>
 #include <ChilliSource/Rendering/Material/Material.h>
+#include <ChilliSource/Rendering/Model/IndexFormat.h>
+#include <ChilliSource/Rendering/Model/PolygonType.h>
+#include <ChilliSource/Rendering/Model/RenderDynamicMesh.h>
+#include <ChilliSource/Rendering/Model/VertexFormat.h>
 #include <ChilliSource/Rendering/Sprite/SpriteMeshBuilder.h>
 #include <ChilliSource/Rendering/Texture/Texture.h>
 #include <ChilliSource/Rendering/Texture/TextureAtlas.h>
 
+#include <algorithm>
+
 namespace ChilliSource
 {
     namespace
     {
+        constexpr u32 k_verticesPerBillboard = 4;
+        constexpr u32 k_indicesPerBillboard = 6;
+        constexpr u32 k_maxBillboardsPerBatch = 65536 / k_verticesPerBillboard;
+
+        //-----------------------------------------------------------------------------
+        /// A description of a billboard vertex. This matches the sprite vertex format.
+        //-----------------------------------------------------------------------------
+        struct BillboardVertex final
+        {
+            Vector4 m_position;
+            Vector2 m_uv;
+            ByteColour m_colour;
+        };
+
         //-----------------------------------------------------------------------------
         /// Returns the billboard size for the given size of image with the given 
         /// size policy
@@ -123,6 +146,12 @@ namespace ChilliSource
     //----------------------------------------------------------------
     void StaticBillboardParticleDrawable::DrawParticles(const dynamic_array<ConcurrentParticleData::Particle>& in_particleData, RenderSnapshot& in_renderSnapshot)
     {
+        if (m_billboardDrawableDef->GetDrawMode() == StaticBillboardParticleDrawableDef::DrawMode::k_batched)
+        {
+            DrawBatched(in_particleData, in_renderSnapshot);
+            return;
+        }
+
         switch (GetDrawableDef()->GetParticleEffect()->GetSimulationSpace())
         {
         case ParticleEffect::SimulationSpace::k_local:
@@ -250,4 +279,150 @@ namespace ChilliSource
             }
         }
     }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    void StaticBillboardParticleDrawable::DrawBatched(const dynamic_array<ConcurrentParticleData::Particle>& in_particleData, RenderSnapshot& in_renderSnapshot)
+    {
+        //particles simulated in local space are transformed by the owning entity, using a uniform scale from the
+        //average of its scale components for the same reason as in DrawLocalSpace().
+        Matrix4 simulationTransform = Matrix4::k_identity;
+        f32 particleScaleFactor = 1.0f;
+        if (GetDrawableDef()->GetParticleEffect()->GetSimulationSpace() == ParticleEffect::SimulationSpace::k_local)
+        {
+            simulationTransform = GetEntity()->GetTransform().GetWorldTransform();
+
+            auto entityScale = GetEntity()->GetTransform().GetWorldScale();
+            particleScaleFactor = (entityScale.x + entityScale.y + entityScale.z) / 3.0f;
+        }
+
+        m_batchedParticles.clear();
+        for (u32 i = 0; i < in_particleData.size(); ++i)
+        {
+            const auto& particle = in_particleData[i];
+
+            if (particle.m_isActive == true && particle.m_colour != Colour::k_transparent)
+            {
+                BatchedParticle batchedParticle;
+                batchedParticle.m_index = i;
+                batchedParticle.m_worldPosition = particle.m_position * simulationTransform;
+                batchedParticle.m_depth = 0.0f;
+                m_batchedParticles.push_back(batchedParticle);
+            }
+        }
+
+        if (m_batchedParticles.empty())
+        {
+            return;
+        }
+
+        auto renderCamera = in_renderSnapshot.GetRenderCamera();
+        auto inverseView = renderCamera.GetOrientation();
+
+        //transparent billboards within the batch are sorted back to front, as they can't be sorted against each other by the renderer.
+        if (m_billboardDrawableDef->GetMaterial()->IsTransparencyEnabled() == true)
+        {
+            auto cameraPosition = renderCamera.GetWorldMatrix().GetTranslation();
+            auto cameraDirection = Vector3::Rotate(Vector3::k_unitPositiveZ, inverseView);
+
+            for (auto& batchedParticle : m_batchedParticles)
+            {
+                batchedParticle.m_depth = Vector3::DotProduct(batchedParticle.m_worldPosition - cameraPosition, cameraDirection);
+            }
+
+            std::sort(m_batchedParticles.begin(), m_batchedParticles.end(), [](const BatchedParticle& in_a, const BatchedParticle& in_b)
+            {
+                return in_a.m_depth > in_b.m_depth;
+            });
+        }
+
+        //a single batch is limited by the range of 16-bit indices, and by the largest single allocation the frame allocator can provide for the vertex data.
+        auto maxAllocationSize = in_renderSnapshot.GetFrameAllocator()->GetMaxAllocationSize();
+        u32 maxBillboardsPerBatch = std::min(k_maxBillboardsPerBatch, u32(maxAllocationSize / (k_verticesPerBillboard * sizeof(BillboardVertex))));
+        CS_ASSERT(maxBillboardsPerBatch > 0, "Frame allocator cannot fit a single billboard.");
+
+        for (u32 batchStart = 0; batchStart < m_batchedParticles.size(); batchStart += maxBillboardsPerBatch)
+        {
+            u32 numBatchedParticles = std::min(u32(m_batchedParticles.size()) - batchStart, maxBillboardsPerBatch);
+            DrawBatch(in_particleData, m_batchedParticles.data() + batchStart, numBatchedParticles, particleScaleFactor, inverseView, in_renderSnapshot);
+        }
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    void StaticBillboardParticleDrawable::DrawBatch(const dynamic_array<ConcurrentParticleData::Particle>& in_particleData, const BatchedParticle* in_batchedParticles, u32 in_numBatchedParticles, f32 in_particleScaleFactor,
+                                                    const Quaternion& in_inverseView, RenderSnapshot& in_renderSnapshot) const
+    {
+        auto allocator = in_renderSnapshot.GetFrameAllocator();
+
+        const u32 numVertices = in_numBatchedParticles * k_verticesPerBillboard;
+        const u32 numIndices = in_numBatchedParticles * k_indicesPerBillboard;
+        const u32 vertexDataSize = numVertices * sizeof(BillboardVertex);
+        const u32 indexDataSize = numIndices * sizeof(u16);
+
+        auto vertexData = MakeUniqueArray<u8>(*allocator, vertexDataSize);
+        auto indexData = MakeUniqueArray<u8>(*allocator, indexDataSize);
+        auto vertices = reinterpret_cast<BillboardVertex*>(vertexData.get());
+        auto indices = reinterpret_cast<u16*>(indexData.get());
+
+        Vector3 minBounds = in_batchedParticles[0].m_worldPosition;
+        Vector3 maxBounds = in_batchedParticles[0].m_worldPosition;
+        f32 maxBillboardRadius = 0.0f;
+
+        for (u32 i = 0; i < in_numBatchedParticles; ++i)
+        {
+            const auto& batchedParticle = in_batchedParticles[i];
+            const auto& particle = in_particleData[batchedParticle.m_index];
+            const auto& billboardData = m_billboards->at(m_particleBillboardIndices[batchedParticle.m_index]);
+
+            //rotate locally in the XY plane before rotating to face the camera, then build the billboard axes from the result.
+            auto worldOrientation = Quaternion(Vector3::k_unitPositiveZ, particle.m_rotation) * in_inverseView;
+            auto worldScale = particle.m_scale * in_particleScaleFactor;
+            auto right = Vector3::Rotate(Vector3::k_unitPositiveX, worldOrientation) * worldScale.x;
+            auto up = Vector3::Rotate(Vector3::k_unitPositiveY, worldOrientation) * worldScale.y;
+
+            Vector2 halfSize = 0.5f * billboardData.m_localSize;
+            auto centre = batchedParticle.m_worldPosition + right * billboardData.m_localCentre.x + up * billboardData.m_localCentre.y;
+            auto halfRight = right * halfSize.x;
+            auto halfUp = up * halfSize.y;
+
+            auto billboardVertices = vertices + i * k_verticesPerBillboard;
+            billboardVertices[0].m_position = Vector4(centre - halfRight + halfUp, 1.0f);
+            billboardVertices[1].m_position = Vector4(centre - halfRight - halfUp, 1.0f);
+            billboardVertices[2].m_position = Vector4(centre + halfRight + halfUp, 1.0f);
+            billboardVertices[3].m_position = Vector4(centre + halfRight - halfUp, 1.0f);
+
+            const auto& uvs = billboardData.m_uvs;
+            billboardVertices[0].m_uv = Vector2(uvs.m_u, uvs.m_v);
+            billboardVertices[1].m_uv = Vector2(uvs.m_u, uvs.m_v + uvs.m_t);
+            billboardVertices[2].m_uv = Vector2(uvs.m_u + uvs.m_s, uvs.m_v);
+            billboardVertices[3].m_uv = Vector2(uvs.m_u + uvs.m_s, uvs.m_v + uvs.m_t);
+
+            auto byteColour = ColourUtils::ColourToByteColour(particle.m_colour);
+            for (u32 j = 0; j < k_verticesPerBillboard; ++j)
+            {
+                billboardVertices[j].m_colour = byteColour;
+            }
+
+            auto firstVertex = u16(i * k_verticesPerBillboard);
+            auto billboardIndices = indices + i * k_indicesPerBillboard;
+            billboardIndices[0] = firstVertex;
+            billboardIndices[1] = firstVertex + 1;
+            billboardIndices[2] = firstVertex + 2;
+            billboardIndices[3] = firstVertex + 1;
+            billboardIndices[4] = firstVertex + 3;
+            billboardIndices[5] = firstVertex + 2;
+
+            minBounds = Vector3::Min(minBounds, batchedParticle.m_worldPosition);
+            maxBounds = Vector3::Max(maxBounds, batchedParticle.m_worldPosition);
+            maxBillboardRadius = std::max(maxBillboardRadius, (centre - batchedParticle.m_worldPosition).Length() + (halfRight + halfUp).Length());
+        }
+
+        Sphere boundingSphere(0.5f * (minBounds + maxBounds), 0.5f * (maxBounds - minBounds).Length() + maxBillboardRadius);
+
+        auto renderDynamicMesh = MakeUnique<RenderDynamicMesh>(*allocator, PolygonType::k_triangle, VertexFormat::k_sprite, IndexFormat::k_short, numVertices, numIndices, boundingSphere,
+                                                               std::move(vertexData), vertexDataSize, std::move(indexData), indexDataSize);
+
+        auto renderMaterialGroup = m_billboardDrawableDef->GetMaterial()->GetRenderMaterialGroup();
+        in_renderSnapshot.AddRenderObject(RenderObject(renderMaterialGroup, renderDynamicMesh.get(), Matrix4::k_identity, boundingSphere, false, RenderLayer::k_standard));
+        in_renderSnapshot.AddRenderDynamicMesh(std::move(renderDynamicMesh));
+    }
 }
@@ -32,9 +32,12 @@
 #include <ChilliSource/ChilliSource.h>
 #include <ChilliSource/Core/Container/dynamic_array.h>
 #include <ChilliSource/Core/Math/Vector2.h>
+#include <ChilliSource/Core/Math/Vector3.h>
 #include <ChilliSource/Rendering/Particle/Drawable/ParticleDrawable.h>
 #include <ChilliSource/Rendering/Texture/TextureAtlas.h>
 
+#include <vector>
+
 namespace ChilliSource
 {
     //-----------------------------------------------------------------------
@@ -59,6 +62,16 @@ namespace ChilliSource
             Vector2 m_localSize;
         };
         //----------------------------------------------------------------
+        /// A container for information on a single particle which will
+        /// be drawn as part of a batch.
+        //----------------------------------------------------------------
+        struct BatchedParticle
+        {
+            u32 m_index;
+            Vector3 m_worldPosition;
+            f32 m_depth;
+        };
+        //----------------------------------------------------------------
         /// Constructor.
         ///
         /// @author Ian Copland
@@ -125,11 +138,38 @@ namespace ChilliSource
         /// will be added to.
         //----------------------------------------------------------------
         void DrawWorldSpace(const dynamic_array<ConcurrentParticleData::Particle>& in_particleData, RenderSnapshot& in_renderSnapshot) const;
+        //----------------------------------------------------------------
+        /// Draws the particles by building the billboards for all active
+        /// particles into camera facing meshes in the frame allocator,
+        /// adding a single render object for each mesh rather than for
+        /// each particle. If the material uses transparency the billboards
+        /// are sorted back to front.
+        ///
+        /// @param The particle draw data.
+        /// @param in_renderSnapshot - The render snapshot that particles
+        /// will be added to.
+        //----------------------------------------------------------------
+        void DrawBatched(const dynamic_array<ConcurrentParticleData::Particle>& in_particleData, RenderSnapshot& in_renderSnapshot);
+        //----------------------------------------------------------------
+        /// Builds a single camera facing mesh containing the billboards
+        /// for the given batched particles and adds it to the snapshot.
+        ///
+        /// @param The particle draw data.
+        /// @param The batched particles to build billboards for.
+        /// @param The number of batched particles.
+        /// @param The scale factor applied to each particle.
+        /// @param The orientation which billboards should face.
+        /// @param in_renderSnapshot - The render snapshot that the mesh
+        /// will be added to.
+        //----------------------------------------------------------------
+        void DrawBatch(const dynamic_array<ConcurrentParticleData::Particle>& in_particleData, const BatchedParticle* in_batchedParticles, u32 in_numBatchedParticles, f32 in_particleScaleFactor,
+                       const Quaternion& in_inverseView, RenderSnapshot& in_renderSnapshot) const;
 
         const StaticBillboardParticleDrawableDef* m_billboardDrawableDef;
         std::unique_ptr <dynamic_array<BillboardData>> m_billboards;
         dynamic_array<u32> m_particleBillboardIndices;
         u32 m_nextBillboardIndex = 0;
+        std::vector<BatchedParticle> m_batchedParticles;
     };
 }
 
@@ -78,6 +78,12 @@ namespace ChilliSource
     /// “UseHeightMaintainingAspect”, “UsePreferredSize”,
     /// “UseWidthMaintainingAspect”
     ///
+    /// "DrawMode": A string describing how the particles are submitted
+    /// for rendering. Possible values are "Individual", where each
+    /// particle is a separate render object, or "Batched", where all
+    /// billboards in the effect are built into a single camera facing
+    /// mesh. Defaults to "Individual".
+    ///
     /// @author Ian Copland
     //-----------------------------------------------------------------------
     class StaticBillboardParticleDrawableDef final : public ParticleDrawableDef
@@ -97,6 +103,20 @@ namespace ChilliSource
             k_cycle
         };
         //----------------------------------------------------------------
+        /// An enum describing the different ways in which particles can
+        /// be submitted for rendering. Individual will add a render object
+        /// for each particle, while batched will build the billboards for
+        /// every particle into a single camera facing mesh in the frame
+        /// allocator and add a single render object for the effect. If
+        /// the material uses transparency, batched billboards are sorted
+        /// back to front within the mesh.
+        //----------------------------------------------------------------
+        enum class DrawMode
+        {
+            k_individual,
+            k_batched
+        };
+        //----------------------------------------------------------------
         /// Constructor for creating a billboard particle drawable
         /// definition which uses just a material.
         ///
@@ -107,8 +127,9 @@ namespace ChilliSource
         /// @param The size policy describing how the particle is rendered
         /// when the rendered image has a different aspect ratio to the 
         /// given size.
+        /// @param [Optional] The draw mode. Defaults to individual.
         //----------------------------------------------------------------
-        StaticBillboardParticleDrawableDef(const MaterialCSPtr& in_material, const Vector2& in_particleSize, SizePolicy in_sizePolicy);
+        StaticBillboardParticleDrawableDef(const MaterialCSPtr& in_material, const Vector2& in_particleSize, SizePolicy in_sizePolicy, DrawMode in_drawMode = DrawMode::k_individual);
         //----------------------------------------------------------------
         /// Constructor for creating a billboard particle drawable definition
         /// which uses a texture atlas and multiple atlas Ids.
@@ -123,8 +144,10 @@ namespace ChilliSource
         /// @param The size policy describing how the particle is rendered 
         /// when the rendered image has a different aspect ratio to the 
         /// given size.
+        /// @param [Optional] The draw mode. Defaults to individual.
         //----------------------------------------------------------------
-        StaticBillboardParticleDrawableDef(const MaterialCSPtr& in_material, const TextureAtlasCSPtr& in_textureAtlas, const std::string& in_atlasId, const Vector2& in_particleSize, SizePolicy in_sizePolicy);
+        StaticBillboardParticleDrawableDef(const MaterialCSPtr& in_material, const TextureAtlasCSPtr& in_textureAtlas, const std::string& in_atlasId, const Vector2& in_particleSize, SizePolicy in_sizePolicy,
+                                           DrawMode in_drawMode = DrawMode::k_individual);
         //----------------------------------------------------------------
         /// Constructor for creating a billboard particle drawable 
         /// definition which uses a texture atlas and multiple atlas Ids.
@@ -141,8 +164,10 @@ namespace ChilliSource
         /// @param The size policy describing how the particle is rendered
         /// when the rendered image has a different aspect ratio to the 
         /// given size.
+        /// @param [Optional] The draw mode. Defaults to individual.
         //----------------------------------------------------------------
-        StaticBillboardParticleDrawableDef(const MaterialCSPtr& in_material, const TextureAtlasCSPtr& in_textureAtlas, const std::vector<std::string>& in_atlasIds, ImageSelectionType in_imageSelectionType, const Vector2& in_particleSize, SizePolicy in_sizePolicy);
+        StaticBillboardParticleDrawableDef(const MaterialCSPtr& in_material, const TextureAtlasCSPtr& in_textureAtlas, const std::vector<std::string>& in_atlasIds, ImageSelectionType in_imageSelectionType, const Vector2& in_particleSize, SizePolicy in_sizePolicy,
+                                           DrawMode in_drawMode = DrawMode::k_individual);
         //----------------------------------------------------------------
         /// Constructor. Loads the params for the drawable def from the 
         /// given json params. If the async delegate is not null, then
@@ -221,6 +246,11 @@ namespace ChilliSource
         /// ratio.
         //----------------------------------------------------------------
         SizePolicy GetSizePolicy() const;
+        //----------------------------------------------------------------
+        /// @return The method that will be used to submit the particles
+        /// for rendering.
+        //----------------------------------------------------------------
+        DrawMode GetDrawMode() const;
     private:
         //----------------------------------------------------------------
         /// Loads the billboard resources on the main thread.
@@ -247,6 +277,7 @@ namespace ChilliSource
         ImageSelectionType m_imageSelectionType = ImageSelectionType::k_cycle;
         Vector2 m_particleSize = Vector2::k_one;
         SizePolicy m_sizePolicy = SizePolicy::k_none;
+        DrawMode m_drawMode = DrawMode::k_individual;
     };
 }
 
@@ -52,8 +52,8 @@ namespace ChilliSource
 
     //----------------------------------------------------------------
     //----------------------------------------------------------------
-    CircleParticleEmitter::CircleParticleEmitter(const ParticleEmitterDef* in_particleEmitter, dynamic_array<Particle>* in_particleArray)
-        : ParticleEmitter(in_particleEmitter, in_particleArray)
+    CircleParticleEmitter::CircleParticleEmitter(const ParticleEmitterDef* in_particleEmitter, ParticleBuffer* in_particleBuffer)
+        : ParticleEmitter(in_particleEmitter, in_particleBuffer)
     {
         //Only the circle emitter def can create this, so this is safe.
         m_circleParticleEmitterDef = static_cast<const CircleParticleEmitterDef*>(in_particleEmitter);
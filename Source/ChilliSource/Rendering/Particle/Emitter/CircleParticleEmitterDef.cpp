@@ -145,9 +145,9 @@ namespace ChilliSource
     }
     //----------------------------------------------------------------
     //----------------------------------------------------------------
-    ParticleEmitterUPtr CircleParticleEmitterDef::CreateInstance(dynamic_array<Particle>* in_particleArray) const
+    ParticleEmitterUPtr CircleParticleEmitterDef::CreateVectorisedInstance(ParticleBuffer* in_particleBuffer) const
     {
-        return ParticleEmitterUPtr(new CircleParticleEmitter(this, in_particleArray));
+        return ParticleEmitterUPtr(new CircleParticleEmitter(this, in_particleBuffer));
     }
     //----------------------------------------------------------------
     //----------------------------------------------------------------
@@ -112,8 +112,8 @@ namespace ChilliSource
 
     //----------------------------------------------------------------
     //----------------------------------------------------------------
-    Cone2DParticleEmitter::Cone2DParticleEmitter(const ParticleEmitterDef* in_particleEmitter, dynamic_array<Particle>* in_particleArray)
-        : ParticleEmitter(in_particleEmitter, in_particleArray)
+    Cone2DParticleEmitter::Cone2DParticleEmitter(const ParticleEmitterDef* in_particleEmitter, ParticleBuffer* in_particleBuffer)
+        : ParticleEmitter(in_particleEmitter, in_particleBuffer)
     {
         //Only the sphere emitter def can create this, so this is safe.
         m_coneParticleEmitterDef = static_cast<const Cone2DParticleEmitterDef*>(in_particleEmitter);
@@ -67,9 +67,9 @@ namespace ChilliSource
         /// @author Ian Copland
         ///
         /// @param The particle emitter definition.
-        /// @param The particle array.
+        /// @param The particle buffer.
         //----------------------------------------------------------------
-        Cone2DParticleEmitter(const ParticleEmitterDef* in_particleEmitter, dynamic_array<Particle>* in_particleArray);
+        Cone2DParticleEmitter(const ParticleEmitterDef* in_particleEmitter, ParticleBuffer* in_particleBuffer);
 
         const Cone2DParticleEmitterDef* m_coneParticleEmitterDef = nullptr;
     };
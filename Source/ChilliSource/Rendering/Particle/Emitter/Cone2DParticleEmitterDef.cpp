@@ -157,9 +157,9 @@ namespace ChilliSource
     }
     //----------------------------------------------------------------
     //----------------------------------------------------------------
-    ParticleEmitterUPtr Cone2DParticleEmitterDef::CreateInstance(dynamic_array<Particle>* in_particleArray) const
+    ParticleEmitterUPtr Cone2DParticleEmitterDef::CreateVectorisedInstance(ParticleBuffer* in_particleBuffer) const
     {
-        return ParticleEmitterUPtr(new Cone2DParticleEmitter(this, in_particleArray));
+        return ParticleEmitterUPtr(new Cone2DParticleEmitter(this, in_particleBuffer));
     }
     //----------------------------------------------------------------
     //----------------------------------------------------------------
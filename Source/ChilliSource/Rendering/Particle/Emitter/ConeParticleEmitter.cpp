@@ -124,8 +124,8 @@ namespace ChilliSource
 
     //----------------------------------------------------------------
     //----------------------------------------------------------------
-    ConeParticleEmitter::ConeParticleEmitter(const ParticleEmitterDef* in_particleEmitter, dynamic_array<Particle>* in_particleArray)
-        : ParticleEmitter(in_particleEmitter, in_particleArray)
+    ConeParticleEmitter::ConeParticleEmitter(const ParticleEmitterDef* in_particleEmitter, ParticleBuffer* in_particleBuffer)
+        : ParticleEmitter(in_particleEmitter, in_particleBuffer)
     {
         //Only the sphere emitter def can create this, so this is safe.
         m_coneParticleEmitterDef = static_cast<const ConeParticleEmitterDef*>(in_particleEmitter);
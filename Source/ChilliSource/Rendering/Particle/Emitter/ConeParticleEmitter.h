@@ -67,9 +67,9 @@ namespace ChilliSource
         /// @author Ian Copland
         ///
         /// @param The particle emitter definition.
-        /// @param The particle array.
+        /// @param The particle buffer.
         //----------------------------------------------------------------
-        ConeParticleEmitter(const ParticleEmitterDef* in_particleEmitter, dynamic_array<Particle>* in_particleArray);
+        ConeParticleEmitter(const ParticleEmitterDef* in_particleEmitter, ParticleBuffer* in_particleBuffer);
 
         const ConeParticleEmitterDef* m_coneParticleEmitterDef = nullptr;
     };
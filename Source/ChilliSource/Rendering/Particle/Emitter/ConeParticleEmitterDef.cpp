@@ -157,9 +157,9 @@ namespace ChilliSource
     }
     //----------------------------------------------------------------
     //----------------------------------------------------------------
-    ParticleEmitterUPtr ConeParticleEmitterDef::CreateInstance(dynamic_array<Particle>* in_particleArray) const
+    ParticleEmitterUPtr ConeParticleEmitterDef::CreateVectorisedInstance(ParticleBuffer* in_particleBuffer) const
     {
-        return ParticleEmitterUPtr(new ConeParticleEmitter(this, in_particleArray));
+        return ParticleEmitterUPtr(new ConeParticleEmitter(this, in_particleBuffer));
     }
     //----------------------------------------------------------------
     //----------------------------------------------------------------
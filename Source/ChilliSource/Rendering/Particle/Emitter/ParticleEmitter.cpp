@@ -33,6 +33,7 @@
 #include <ChilliSource/Core/Entity/Transform.h>
 #include <ChilliSource/Core/Math/Random.h>
 #include <ChilliSource/Rendering/Particle/Particle.h>
+#include <ChilliSource/Rendering/Particle/ParticleBuffer.h>
 #include <ChilliSource/Rendering/Particle/ParticleEffect.h>
 #include <ChilliSource/Rendering/Particle/Emitter/ParticleEmitterDef.h>
 
@@ -50,6 +51,20 @@ namespace ChilliSource
     }
     //----------------------------------------------
     //----------------------------------------------
+    ParticleEmitter::ParticleEmitter(const ParticleEmitterDef* in_emitterDef, ParticleBuffer* in_particleBuffer)
+        : m_emitterDef(in_emitterDef), m_particleBuffer(in_particleBuffer)
+    {
+        CS_ASSERT(m_emitterDef != nullptr, "Cannot create particle emitter with null emitter def.");
+        CS_ASSERT(m_particleBuffer != nullptr, "Cannot create particle emitter with null particle buffer.");
+    }
+    //----------------------------------------------
+    //----------------------------------------------
+    bool ParticleEmitter::RequiresParticleArray() const
+    {
+        return (m_particleArray != nullptr);
+    }
+    //----------------------------------------------
+    //----------------------------------------------
     std::vector<u32> ParticleEmitter::TryEmit(f32 in_playbackTime, const Vector3& in_emitterPosition, const Vector3& in_emitterScale, const Quaternion& in_emitterOrientation, bool in_interpolateEmission)
     {
         CS_ASSERT(in_playbackTime >= 0.0f, "Playback time cannot be below zero.");
@@ -176,16 +191,27 @@ namespace ChilliSource
     {
         const ParticleEffect* particleEffect = m_emitterDef->GetParticleEffect();
 
-        u32 particleIndex = m_nextParticleIndex++;
-        Particle& particle = m_particleArray->at(particleIndex);
-        if (m_nextParticleIndex >= particleEffect->GetMaxParticles())
+        u32 particleIndex = 0;
+        bool isFree = false;
+        if (m_particleBuffer != nullptr)
         {
-            m_nextParticleIndex = 0;
+            isFree = m_particleBuffer->TryActivateParticle(particleIndex);
         }
+        else
+        {
+            particleIndex = m_nextParticleIndex++;
+            if (m_nextParticleIndex >= particleEffect->GetMaxParticles())
+            {
+                m_nextParticleIndex = 0;
+            }
 
-        if (particle.m_isActive == false)
+            isFree = (m_particleArray->at(particleIndex).m_isActive == false);
+        }
+
+        if (isFree == true)
         {
             inout_emittedParticles.push_back(particleIndex);
+            Particle particle;
 
             //Get the emission position and direction.
             Vector3 localPosition;
@@ -237,6 +263,15 @@ namespace ChilliSource
             particle.m_rotation = localRotation;
             particle.m_angularVelocity = particleEffect->GetInitialAngularVelocityProperty()->GenerateValue(in_normalisedEmissionTime);
             particle.m_isActive = true;
+
+            if (m_particleBuffer != nullptr)
+            {
+                m_particleBuffer->SetParticle(particleIndex, particle);
+            }
+            else
+            {
+                (*m_particleArray)[particleIndex] = particle;
+            }
         }
     }
 }
\ No newline at end of file
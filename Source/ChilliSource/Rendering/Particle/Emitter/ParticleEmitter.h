@@ -62,6 +62,19 @@ namespace ChilliSource
         //----------------------------------------------------------------
         ParticleEmitter(const ParticleEmitterDef* in_particleEmitter, dynamic_array<Particle>* in_particleArray);
         //----------------------------------------------------------------
+        /// Constructor. Creates an emitter which emits directly into the
+        /// particle buffer.
+        ///
+        /// @param The particle emitter definition.
+        /// @param The particle buffer.
+        //----------------------------------------------------------------
+        ParticleEmitter(const ParticleEmitterDef* in_particleEmitter, ParticleBuffer* in_particleBuffer);
+        //----------------------------------------------------------------
+        /// @return Whether or not this emits into an array of Particle
+        /// structures rather than directly into the particle buffer.
+        //----------------------------------------------------------------
+        bool RequiresParticleArray() const;
+        //----------------------------------------------------------------
         /// Tries to emit new particles if required. This will be called 
         /// as part of a background task.
         ///
@@ -126,8 +139,8 @@ namespace ChilliSource
         //----------------------------------------------------------------
         std::vector<u32> TryEmitBurst(f32 in_playbackTime, const Vector3& in_emitterPosition, const Vector3& in_emitterScale, const Quaternion& in_emitterOrientation);
         //----------------------------------------------------------------
-        /// Emits a new particle if the next particle in the list is free
-        /// to be emitted. 
+        /// Emits a new particle if there is a free particle in the buffer,
+        /// or if the next particle in the array is free, to be emitted. 
         ///
         /// @author Ian Copland
         /// 
@@ -147,6 +160,7 @@ namespace ChilliSource
 
         const ParticleEmitterDef* m_emitterDef = nullptr;
         dynamic_array<Particle>* m_particleArray = nullptr;
+        ParticleBuffer* m_particleBuffer = nullptr;
 
         Vector3 m_emissionPosition;
         Vector3 m_emissionScale;
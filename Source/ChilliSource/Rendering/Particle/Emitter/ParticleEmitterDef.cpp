@@ -29,6 +29,7 @@
 #include <ChilliSource/Rendering/Particle/Emitter/ParticleEmitterDef.h>
 
 #include <ChilliSource/Core/Container/ParamDictionary.h>
+#include <ChilliSource/Rendering/Particle/Emitter/ParticleEmitter.h>
 #include <ChilliSource/Rendering/Particle/Property/ParticlePropertyFactory.h>
 
 namespace ChilliSource
@@ -126,6 +127,19 @@ namespace ChilliSource
     }
     //----------------------------------------------------------------
     //----------------------------------------------------------------
+    ParticleEmitterUPtr ParticleEmitterDef::CreateVectorisedInstance(ParticleBuffer* in_particleBuffer) const
+    {
+        return nullptr;
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    ParticleEmitterUPtr ParticleEmitterDef::CreateInstance(dynamic_array<Particle>* in_particleArray) const
+    {
+        CS_LOG_FATAL("Particle emitter defs must implement either CreateVectorisedInstance() or CreateInstance().");
+        return nullptr;
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
     const ParticleEffect* ParticleEmitterDef::GetParticleEffect() const
     {
         return m_particleEffect;
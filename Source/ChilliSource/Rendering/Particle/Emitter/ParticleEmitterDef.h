@@ -125,16 +125,30 @@ namespace ChilliSource
         //----------------------------------------------------------------
         ParticleEmitterDef(const Json::Value& in_paramsJson);
         //----------------------------------------------------------------
-        /// Creates an instance of the particle emitter described by this.
+        /// Creates an instance of the particle emitter described by this
+        /// which emits directly into the structure-of-arrays particle
+        /// buffer. This is preferred over CreateInstance(), which will
+        /// only be called if this returns null. By default this returns
+        /// null.
+        ///
+        /// @param The particle buffer.
+        ///
+        /// @return the instance, or null if not supported.
+        //----------------------------------------------------------------
+        virtual ParticleEmitterUPtr CreateVectorisedInstance(ParticleBuffer* in_particleBuffer) const;
+        //----------------------------------------------------------------
+        /// Creates an instance of the particle emitter described by this
+        /// which emits into an array of Particle structures. New particles
+        /// are copied into the particle buffer after each emission. This
+        /// must be implemented if CreateVectorisedInstance() is not.
         ///
         /// @author Ian Copland.
         ///
-        /// @param The particle effect.
         /// @param The particle array.
         ///
         /// @return the instance.
         //----------------------------------------------------------------
-        virtual ParticleEmitterUPtr CreateInstance(dynamic_array<Particle>* in_particleArray) const = 0;
+        virtual ParticleEmitterUPtr CreateInstance(dynamic_array<Particle>* in_particleArray) const;
         //----------------------------------------------------------------
         /// @author Ian Copland
         ///
@@ -36,8 +36,8 @@ namespace ChilliSource
 {
     //----------------------------------------------------------------
     //----------------------------------------------------------------
-    PointParticleEmitter::PointParticleEmitter(const ParticleEmitterDef* in_particleEmitter, dynamic_array<Particle>* in_particleArray)
-        : ParticleEmitter(in_particleEmitter, in_particleArray)
+    PointParticleEmitter::PointParticleEmitter(const ParticleEmitterDef* in_particleEmitter, ParticleBuffer* in_particleBuffer)
+        : ParticleEmitter(in_particleEmitter, in_particleBuffer)
     {
     }
     //----------------------------------------------------------------
@@ -66,9 +66,9 @@ namespace ChilliSource
         /// @author Ian Copland
         ///
         /// @param The particle emitter definition.
-        /// @param The particle array.
+        /// @param The particle buffer.
         //----------------------------------------------------------------
-        PointParticleEmitter(const ParticleEmitterDef* in_particleEmitter, dynamic_array<Particle>* in_particleArray);
+        PointParticleEmitter(const ParticleEmitterDef* in_particleEmitter, ParticleBuffer* in_particleBuffer);
     };
 }
 
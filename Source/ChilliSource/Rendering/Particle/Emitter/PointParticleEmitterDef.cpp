@@ -59,8 +59,8 @@ namespace ChilliSource
     }
     //----------------------------------------------------------------
     //----------------------------------------------------------------
-    ParticleEmitterUPtr PointParticleEmitterDef::CreateInstance(dynamic_array<Particle>* in_particleArray) const
+    ParticleEmitterUPtr PointParticleEmitterDef::CreateVectorisedInstance(ParticleBuffer* in_particleBuffer) const
     {
-        return ParticleEmitterUPtr(new PointParticleEmitter(this, in_particleArray));
+        return ParticleEmitterUPtr(new PointParticleEmitter(this, in_particleBuffer));
     }
 }
\ No newline at end of file
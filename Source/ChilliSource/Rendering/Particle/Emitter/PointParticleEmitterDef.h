@@ -101,11 +101,11 @@ namespace ChilliSource
         ///
         /// @author Ian Copland.
         ///
-        /// @param The particle array.
+        /// @param The particle buffer.
         ///
         /// @return the instance.
         //----------------------------------------------------------------
-        ParticleEmitterUPtr CreateInstance(dynamic_array<Particle>* in_particleArray) const override;
+        ParticleEmitterUPtr CreateVectorisedInstance(ParticleBuffer* in_particleBuffer) const override;
     };
 }
 
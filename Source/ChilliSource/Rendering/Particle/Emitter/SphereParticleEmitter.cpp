@@ -52,8 +52,8 @@ namespace ChilliSource
 
     //----------------------------------------------------------------
     //----------------------------------------------------------------
-    SphereParticleEmitter::SphereParticleEmitter(const ParticleEmitterDef* in_particleEmitter, dynamic_array<Particle>* in_particleArray)
-        : ParticleEmitter(in_particleEmitter, in_particleArray)
+    SphereParticleEmitter::SphereParticleEmitter(const ParticleEmitterDef* in_particleEmitter, ParticleBuffer* in_particleBuffer)
+        : ParticleEmitter(in_particleEmitter, in_particleBuffer)
     {
         //Only the sphere emitter def can create this, so this is safe.
         m_sphereParticleEmitterDef = static_cast<const SphereParticleEmitterDef*>(in_particleEmitter);
@@ -67,9 +67,9 @@ namespace ChilliSource
         /// @author Ian Copland
         ///
         /// @param The particle emitter definition.
-        /// @param The particle array.
+        /// @param The particle buffer.
         //----------------------------------------------------------------
-        SphereParticleEmitter(const ParticleEmitterDef* in_particleEmitter, dynamic_array<Particle>* in_particleArray);
+        SphereParticleEmitter(const ParticleEmitterDef* in_particleEmitter, ParticleBuffer* in_particleBuffer);
 
         const SphereParticleEmitterDef* m_sphereParticleEmitterDef = nullptr;
     };
@@ -145,9 +145,9 @@ namespace ChilliSource
     }
     //----------------------------------------------------------------
     //----------------------------------------------------------------
-    ParticleEmitterUPtr SphereParticleEmitterDef::CreateInstance(dynamic_array<Particle>* in_particleArray) const
+    ParticleEmitterUPtr SphereParticleEmitterDef::CreateVectorisedInstance(ParticleBuffer* in_particleBuffer) const
     {
-        return ParticleEmitterUPtr(new SphereParticleEmitter(this, in_particleArray));
+        return ParticleEmitterUPtr(new SphereParticleEmitter(this, in_particleBuffer));
     }
     //----------------------------------------------------------------
     //----------------------------------------------------------------
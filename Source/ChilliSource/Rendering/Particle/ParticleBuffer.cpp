@@ -0,0 +1,306 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2016 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#include <ChilliSource/Rendering/Particle/ParticleBuffer.h>
+
+#include <ChilliSource/Core/Math/SIMD.h>
+
+#include <algorithm>
+
+namespace ChilliSource
+{
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    ParticleBuffer::ParticleBuffer(u32 in_maxParticles)
+        : m_maxParticles(in_maxParticles), m_streamLength(SIMD::RoundUp(in_maxParticles)), m_streams(SIMD::RoundUp(in_maxParticles) * u32(Stream::k_total)),
+        m_activeFlags(SIMD::RoundUp(in_maxParticles))
+    {
+        m_streams.fill(0.0f);
+        m_activeFlags.fill(false);
+        m_activeIndices.reserve(m_maxParticles);
+
+        //inactive particles are still processed by the kernels, so give them a non-zero lifetime to avoid dividing by zero.
+        std::fill_n(GetStream(Stream::k_lifetime), m_streamLength, 1.0f);
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    u32 ParticleBuffer::GetMaxParticles() const
+    {
+        return m_maxParticles;
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    u32 ParticleBuffer::GetStreamLength() const
+    {
+        return m_streamLength;
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    u32 ParticleBuffer::GetActiveRangeEnd() const
+    {
+        return m_activeRangeEnd;
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    u32 ParticleBuffer::GetNumActiveParticles() const
+    {
+        return u32(m_activeIndices.size());
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    const std::vector<u32>& ParticleBuffer::GetActiveIndices() const
+    {
+        return m_activeIndices;
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    bool ParticleBuffer::IsActive(u32 in_index) const
+    {
+        return m_activeFlags[in_index];
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    f32* ParticleBuffer::GetStream(Stream in_stream)
+    {
+        CS_ASSERT(in_stream != Stream::k_total, "Invalid particle stream.");
+
+        return m_streams.data() + u32(in_stream) * m_streamLength;
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    const f32* ParticleBuffer::GetStream(Stream in_stream) const
+    {
+        CS_ASSERT(in_stream != Stream::k_total, "Invalid particle stream.");
+
+        return m_streams.data() + u32(in_stream) * m_streamLength;
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    bool ParticleBuffer::TryActivateParticle(u32& out_index)
+    {
+        while (m_firstFreeIndex < m_maxParticles && m_activeFlags[m_firstFreeIndex] == true)
+        {
+            ++m_firstFreeIndex;
+        }
+
+        if (m_firstFreeIndex >= m_maxParticles)
+        {
+            return false;
+        }
+
+        out_index = m_firstFreeIndex++;
+        m_activeFlags[out_index] = true;
+        m_activeIndices.push_back(out_index);
+        m_activeRangeEnd = std::max(m_activeRangeEnd, SIMD::RoundUp(out_index + 1));
+
+        return true;
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    void ParticleBuffer::ActivateParticle(u32 in_index, const Particle& in_particle)
+    {
+        CS_ASSERT(in_index < m_maxParticles, "Particle index out of bounds.");
+        CS_ASSERT(m_activeFlags[in_index] == false, "Particle is already active.");
+
+        m_activeFlags[in_index] = true;
+        m_activeIndices.push_back(in_index);
+        m_activeRangeEnd = std::max(m_activeRangeEnd, SIMD::RoundUp(in_index + 1));
+
+        SetParticle(in_index, in_particle);
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    void ParticleBuffer::DeactivateAllParticles()
+    {
+        for (auto index : m_activeIndices)
+        {
+            m_activeFlags[index] = false;
+        }
+
+        std::fill_n(GetStream(Stream::k_energy), m_streamLength, 0.0f);
+
+        m_activeIndices.clear();
+        m_activeRangeEnd = 0;
+        m_firstFreeIndex = 0;
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    Particle ParticleBuffer::GetParticle(u32 in_index) const
+    {
+        CS_ASSERT(in_index < m_maxParticles, "Particle index out of bounds.");
+
+        Particle particle;
+        particle.m_isActive = m_activeFlags[in_index];
+        particle.m_lifetime = GetStream(Stream::k_lifetime)[in_index];
+        particle.m_energy = GetStream(Stream::k_energy)[in_index];
+        particle.m_position.x = GetStream(Stream::k_positionX)[in_index];
+        particle.m_position.y = GetStream(Stream::k_positionY)[in_index];
+        particle.m_position.z = GetStream(Stream::k_positionZ)[in_index];
+        particle.m_scale.x = GetStream(Stream::k_scaleX)[in_index];
+        particle.m_scale.y = GetStream(Stream::k_scaleY)[in_index];
+        particle.m_rotation = GetStream(Stream::k_rotation)[in_index];
+        particle.m_colour.r = GetStream(Stream::k_colourR)[in_index];
+        particle.m_colour.g = GetStream(Stream::k_colourG)[in_index];
+        particle.m_colour.b = GetStream(Stream::k_colourB)[in_index];
+        particle.m_colour.a = GetStream(Stream::k_colourA)[in_index];
+        particle.m_velocity.x = GetStream(Stream::k_velocityX)[in_index];
+        particle.m_velocity.y = GetStream(Stream::k_velocityY)[in_index];
+        particle.m_velocity.z = GetStream(Stream::k_velocityZ)[in_index];
+        particle.m_angularVelocity = GetStream(Stream::k_angularVelocity)[in_index];
+        return particle;
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    void ParticleBuffer::SetParticle(u32 in_index, const Particle& in_particle)
+    {
+        CS_ASSERT(in_index < m_maxParticles, "Particle index out of bounds.");
+
+        GetStream(Stream::k_lifetime)[in_index] = in_particle.m_lifetime;
+        GetStream(Stream::k_energy)[in_index] = in_particle.m_energy;
+        GetStream(Stream::k_positionX)[in_index] = in_particle.m_position.x;
+        GetStream(Stream::k_positionY)[in_index] = in_particle.m_position.y;
+        GetStream(Stream::k_positionZ)[in_index] = in_particle.m_position.z;
+        GetStream(Stream::k_scaleX)[in_index] = in_particle.m_scale.x;
+        GetStream(Stream::k_scaleY)[in_index] = in_particle.m_scale.y;
+        GetStream(Stream::k_rotation)[in_index] = in_particle.m_rotation;
+        GetStream(Stream::k_colourR)[in_index] = in_particle.m_colour.r;
+        GetStream(Stream::k_colourG)[in_index] = in_particle.m_colour.g;
+        GetStream(Stream::k_colourB)[in_index] = in_particle.m_colour.b;
+        GetStream(Stream::k_colourA)[in_index] = in_particle.m_colour.a;
+        GetStream(Stream::k_velocityX)[in_index] = in_particle.m_velocity.x;
+        GetStream(Stream::k_velocityY)[in_index] = in_particle.m_velocity.y;
+        GetStream(Stream::k_velocityZ)[in_index] = in_particle.m_velocity.z;
+        GetStream(Stream::k_angularVelocity)[in_index] = in_particle.m_angularVelocity;
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    void ParticleBuffer::CopyToArray(dynamic_array<Particle>* out_particleArray) const
+    {
+        CS_ASSERT(out_particleArray->size() == m_maxParticles, "Particle array must be the same size as the particle buffer.");
+
+        for (u32 i = 0; i < m_maxParticles; ++i)
+        {
+            (*out_particleArray)[i] = GetParticle(i);
+        }
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    void ParticleBuffer::CopyFromArray(const dynamic_array<Particle>& in_particleArray)
+    {
+        CS_ASSERT(in_particleArray.size() == m_maxParticles, "Particle array must be the same size as the particle buffer.");
+
+        bool anyDeactivated = false;
+        for (auto index : m_activeIndices)
+        {
+            const auto& particle = in_particleArray[index];
+            if (particle.m_isActive == true)
+            {
+                SetParticle(index, particle);
+            }
+            else
+            {
+                m_activeFlags[index] = false;
+                GetStream(Stream::k_energy)[index] = 0.0f;
+                anyDeactivated = true;
+            }
+        }
+
+        if (anyDeactivated == true)
+        {
+            CompactActiveIndices();
+        }
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    void ParticleBuffer::Integrate(f32 in_deltaTime)
+    {
+        f32* energies = GetStream(Stream::k_energy);
+        f32* positionsX = GetStream(Stream::k_positionX);
+        f32* positionsY = GetStream(Stream::k_positionY);
+        f32* positionsZ = GetStream(Stream::k_positionZ);
+        f32* rotations = GetStream(Stream::k_rotation);
+        const f32* velocitiesX = GetStream(Stream::k_velocityX);
+        const f32* velocitiesY = GetStream(Stream::k_velocityY);
+        const f32* velocitiesZ = GetStream(Stream::k_velocityZ);
+        const f32* angularVelocities = GetStream(Stream::k_angularVelocity);
+
+        const SIMD::Float4 deltaTime = SIMD::Splat(in_deltaTime);
+        const SIMD::Float4 zero = SIMD::Splat(0.0f);
+
+        //Particles only move if they are still alive after this update. Inactive particles have zero energy so are never moved.
+        for (u32 i = 0; i < m_activeRangeEnd; i += SIMD::k_width)
+        {
+            SIMD::Float4 energy = SIMD::Subtract(SIMD::Load(energies + i), deltaTime);
+            SIMD::Float4 isAlive = SIMD::GreaterThan(energy, zero);
+            SIMD::Store(energies + i, SIMD::Select(isAlive, energy, zero));
+
+            SIMD::Float4 positionX = SIMD::Load(positionsX + i);
+            SIMD::Float4 positionY = SIMD::Load(positionsY + i);
+            SIMD::Float4 positionZ = SIMD::Load(positionsZ + i);
+            SIMD::Float4 rotation = SIMD::Load(rotations + i);
+            SIMD::Store(positionsX + i, SIMD::Select(isAlive, SIMD::MultiplyAdd(SIMD::Load(velocitiesX + i), deltaTime, positionX), positionX));
+            SIMD::Store(positionsY + i, SIMD::Select(isAlive, SIMD::MultiplyAdd(SIMD::Load(velocitiesY + i), deltaTime, positionY), positionY));
+            SIMD::Store(positionsZ + i, SIMD::Select(isAlive, SIMD::MultiplyAdd(SIMD::Load(velocitiesZ + i), deltaTime, positionZ), positionZ));
+            SIMD::Store(rotations + i, SIMD::Select(isAlive, SIMD::MultiplyAdd(SIMD::Load(angularVelocities + i), deltaTime, rotation), rotation));
+        }
+
+        bool anyDeactivated = false;
+        for (auto index : m_activeIndices)
+        {
+            if (energies[index] <= 0.0f)
+            {
+                m_activeFlags[index] = false;
+                anyDeactivated = true;
+            }
+        }
+
+        if (anyDeactivated == true)
+        {
+            CompactActiveIndices();
+        }
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    void ParticleBuffer::CompactActiveIndices()
+    {
+        u32 highestIndex = 0;
+        u32 numActive = 0;
+        for (auto index : m_activeIndices)
+        {
+            if (m_activeFlags[index] == true)
+            {
+                m_activeIndices[numActive++] = index;
+                highestIndex = std::max(highestIndex, index + 1);
+            }
+            else
+            {
+                m_firstFreeIndex = std::min(m_firstFreeIndex, index);
+            }
+        }
+
+        m_activeIndices.resize(numActive);
+        m_activeRangeEnd = SIMD::RoundUp(highestIndex);
+    }
+}
@@ -0,0 +1,220 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2016 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#ifndef _CHILLISOURCE_RENDERING_PARTICLE_PARTICLEBUFFER_H_
+#define _CHILLISOURCE_RENDERING_PARTICLE_PARTICLEBUFFER_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Container/dynamic_array.h>
+#include <ChilliSource/Rendering/Particle/Particle.h>
+
+#include <vector>
+
+namespace ChilliSource
+{
+    //-----------------------------------------------------------------------
+    /// The particle state for a single particle effect instance, stored as
+    /// a structure-of-arrays. Each property of a particle is stored in its
+    /// own contiguous stream of floats, allowing the built in update and
+    /// affector kernels to process a number of particles at a time using
+    /// SIMD instructions.
+    ///
+    /// Particles keep the same index for their whole life, so per-particle
+    /// data in affectors and drawables can be stored by index. New
+    /// particles are always given the lowest free index, which keeps the
+    /// live particles packed towards the start of the streams. The kernels
+    /// only need to process the "active range": the streams up to and
+    /// including the highest active index, rounded up to the SIMD width.
+    /// A compacted list of the active indices is also kept for loops which
+    /// only need to visit live particles.
+    ///
+    /// Particles in the active range which aren't active are still
+    /// processed by the kernels, but their state is never read: it is
+    /// fully re-initialised when the particle is next activated.
+    ///
+    /// This is not thread-safe. It is owned by the particle update
+    /// background task while an update is in progress.
+    //-----------------------------------------------------------------------
+    class ParticleBuffer final
+    {
+    public:
+        CS_DECLARE_NOCOPY(ParticleBuffer);
+        //----------------------------------------------------------------
+        /// An enum describing each of the streams of particle properties.
+        //----------------------------------------------------------------
+        enum class Stream
+        {
+            k_lifetime,
+            k_energy,
+            k_positionX,
+            k_positionY,
+            k_positionZ,
+            k_scaleX,
+            k_scaleY,
+            k_rotation,
+            k_colourR,
+            k_colourG,
+            k_colourB,
+            k_colourA,
+            k_velocityX,
+            k_velocityY,
+            k_velocityZ,
+            k_angularVelocity,
+            k_total
+        };
+        //----------------------------------------------------------------
+        /// Constructor. All particles start inactive.
+        ///
+        /// @param The maximum number of particles.
+        //----------------------------------------------------------------
+        ParticleBuffer(u32 in_maxParticles);
+        //----------------------------------------------------------------
+        /// @return The maximum number of particles.
+        //----------------------------------------------------------------
+        u32 GetMaxParticles() const;
+        //----------------------------------------------------------------
+        /// @return The length of each stream. This is the maximum number
+        /// of particles rounded up to the SIMD width, and should be used
+        /// to size any per-particle streams stored outside of the buffer.
+        //----------------------------------------------------------------
+        u32 GetStreamLength() const;
+        //----------------------------------------------------------------
+        /// @return One past the highest active particle index, rounded up
+        /// to the SIMD width. This will never exceed the stream length.
+        //----------------------------------------------------------------
+        u32 GetActiveRangeEnd() const;
+        //----------------------------------------------------------------
+        /// @return The number of active particles.
+        //----------------------------------------------------------------
+        u32 GetNumActiveParticles() const;
+        //----------------------------------------------------------------
+        /// @return The indices of all active particles. These are not in
+        /// any particular order.
+        //----------------------------------------------------------------
+        const std::vector<u32>& GetActiveIndices() const;
+        //----------------------------------------------------------------
+        /// @param The particle index.
+        ///
+        /// @return Whether or not the particle is active.
+        //----------------------------------------------------------------
+        bool IsActive(u32 in_index) const;
+        //----------------------------------------------------------------
+        /// @param The stream.
+        ///
+        /// @return The start of the requested stream.
+        //----------------------------------------------------------------
+        f32* GetStream(Stream in_stream);
+        //----------------------------------------------------------------
+        /// @param The stream.
+        ///
+        /// @return The start of the requested stream.
+        //----------------------------------------------------------------
+        const f32* GetStream(Stream in_stream) const;
+        //----------------------------------------------------------------
+        /// Activates the particle with the lowest free index. The
+        /// properties of the particle should be set immediately after
+        /// using SetParticle().
+        ///
+        /// @param [Out] The index of the activated particle.
+        ///
+        /// @return Whether or not a particle could be activated. This will
+        /// be false if all particles are already active.
+        //----------------------------------------------------------------
+        bool TryActivateParticle(u32& out_index);
+        //----------------------------------------------------------------
+        /// Activates the particle with the given index, which must not
+        /// already be active, and sets its properties. This is used to
+        /// add particles emitted into a particle array by custom, scalar,
+        /// emitters.
+        ///
+        /// @param The particle index.
+        /// @param The particle properties.
+        //----------------------------------------------------------------
+        void ActivateParticle(u32 in_index, const Particle& in_particle);
+        //----------------------------------------------------------------
+        /// Deactivates all particles.
+        //----------------------------------------------------------------
+        void DeactivateAllParticles();
+        //----------------------------------------------------------------
+        /// @param The particle index.
+        ///
+        /// @return The properties of the particle with the given index.
+        //----------------------------------------------------------------
+        Particle GetParticle(u32 in_index) const;
+        //----------------------------------------------------------------
+        /// Sets the properties of the particle with the given index. This
+        /// doesn't change whether or not the particle is active.
+        ///
+        /// @param The particle index.
+        /// @param The particle properties.
+        //----------------------------------------------------------------
+        void SetParticle(u32 in_index, const Particle& in_particle);
+        //----------------------------------------------------------------
+        /// Copies the state of every particle into the given array of
+        /// structures. This is used to provide custom, scalar, affectors
+        /// with the particle array they operate on.
+        ///
+        /// @param [Out] The particle array. This must be the same size as
+        /// the maximum number of particles.
+        //----------------------------------------------------------------
+        void CopyToArray(dynamic_array<Particle>* out_particleArray) const;
+        //----------------------------------------------------------------
+        /// Copies the state of each active particle back from the given
+        /// array of structures. Active particles which have been flagged
+        /// as inactive in the array are deactivated. Particles cannot be
+        /// activated in this way.
+        ///
+        /// @param The particle array. This must be the same size as the
+        /// maximum number of particles.
+        //----------------------------------------------------------------
+        void CopyFromArray(const dynamic_array<Particle>& in_particleArray);
+        //----------------------------------------------------------------
+        /// Reduces the energy of all active particles and integrates their
+        /// position and rotation. Any particles which run out of energy
+        /// are deactivated.
+        ///
+        /// @param The delta time.
+        //----------------------------------------------------------------
+        void Integrate(f32 in_deltaTime);
+
+    private:
+        //----------------------------------------------------------------
+        /// Removes any particles which are no longer active from the
+        /// list of active indices, then updates the active range and the
+        /// search start for free particles.
+        //----------------------------------------------------------------
+        void CompactActiveIndices();
+
+        u32 m_maxParticles = 0;
+        u32 m_streamLength = 0;
+        u32 m_activeRangeEnd = 0;
+        u32 m_firstFreeIndex = 0;
+        dynamic_array<f32> m_streams;
+        dynamic_array<bool> m_activeFlags;
+        std::vector<u32> m_activeIndices;
+    };
+}
+
+#endif
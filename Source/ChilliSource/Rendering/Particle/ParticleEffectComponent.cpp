@@ -37,6 +37,7 @@
 #include <ChilliSource/Rendering/Camera/PerspectiveCameraComponent.h>
 #include <ChilliSource/Rendering/Particle/ConcurrentParticleData.h>
 #include <ChilliSource/Rendering/Particle/Particle.h>
+#include <ChilliSource/Rendering/Particle/ParticleBuffer.h>
 #include <ChilliSource/Rendering/Particle/ParticleEffect.h>
 #include <ChilliSource/Rendering/Particle/Affector/ParticleAffector.h>
 #include <ChilliSource/Rendering/Particle/Affector/ParticleAffectorDef.h>
@@ -45,6 +46,7 @@
 #include <ChilliSource/Rendering/Particle/Emitter/ParticleEmitter.h>
 #include <ChilliSource/Rendering/Particle/Emitter/ParticleEmitterDef.h>
 
+#include <algorithm>
 #include <limits>
 #include <tuple>
 
@@ -63,6 +65,7 @@ namespace ChilliSource
             ParticleEffectCSPtr m_particleEffect;
             ParticleEmitterSPtr m_particleEmitter;
             std::vector<ParticleAffectorSPtr> m_particleAffectors;
+            ParticleBufferSPtr m_particleBuffer;
             std::shared_ptr<dynamic_array<Particle>> m_particleArray;
             ConcurrentParticleDataSPtr m_concurrentParticleData;
             f32 m_playbackTime = 0.0f;
@@ -97,39 +100,30 @@ namespace ChilliSource
         /// @author Ian Copland
         ///
         /// @param The particle effect.
-        /// @param The array of particles.
+        /// @param The particle buffer.
         /// 
         /// @return a pair containing the AABB and the Bounding Sphere.
         //----------------------------------------------------------------
-        std::pair<AABB, Sphere> CalculateBoundingShapes(const ParticleEffect* in_particleEffect, const dynamic_array<Particle>* in_particleArray)
+        std::pair<AABB, Sphere> CalculateBoundingShapes(const ParticleEffect* in_particleEffect, const ParticleBuffer* in_particleBuffer)
         {
             Vector3 min = Vector3(std::numeric_limits<f32>::max(), std::numeric_limits<f32>::max(), std::numeric_limits<f32>::max());
             Vector3 max = Vector3(-std::numeric_limits<f32>::max(), -std::numeric_limits<f32>::max(), -std::numeric_limits<f32>::max());
 
-            bool anyActive = false;
-            for (const auto& particle : *in_particleArray)
+            const f32* positionsX = in_particleBuffer->GetStream(ParticleBuffer::Stream::k_positionX);
+            const f32* positionsY = in_particleBuffer->GetStream(ParticleBuffer::Stream::k_positionY);
+            const f32* positionsZ = in_particleBuffer->GetStream(ParticleBuffer::Stream::k_positionZ);
+            for (auto index : in_particleBuffer->GetActiveIndices())
             {
-                if (particle.m_isActive == true)
-                {
-                    anyActive = true;
-
-                    if (particle.m_position.x < min.x)
-                        min.x = particle.m_position.x;
-                    if (particle.m_position.y < min.y)
-                        min.y = particle.m_position.y;
-                    if (particle.m_position.z < min.z)
-                        min.z = particle.m_position.z;
-
-                    if (particle.m_position.x > max.x)
-                        max.x = particle.m_position.x;
-                    if (particle.m_position.y > max.y)
-                        max.y = particle.m_position.y;
-                    if (particle.m_position.z > max.z)
-                        max.z = particle.m_position.z;
-                }
+                min.x = std::min(min.x, positionsX[index]);
+                min.y = std::min(min.y, positionsY[index]);
+                min.z = std::min(min.z, positionsZ[index]);
+
+                max.x = std::max(max.x, positionsX[index]);
+                max.y = std::max(max.y, positionsY[index]);
+                max.z = std::max(max.z, positionsZ[index]);
             }
 
-            if (anyActive == false)
+            if (in_particleBuffer->GetNumActiveParticles() == 0)
             {
                 min = Vector3::k_zero;
                 max = Vector3::k_zero;
@@ -154,42 +148,80 @@ namespace ChilliSource
         void ParticleUpdateTask(const ParticleUpdateDesc& in_desc)
         {
             CS_ASSERT(in_desc.m_particleEffect != nullptr, "Cannot update particles with null particle effect.");
-            CS_ASSERT(in_desc.m_particleArray != nullptr, "Cannot update particles with null particle array.");
+            CS_ASSERT(in_desc.m_particleBuffer != nullptr, "Cannot update particles with null particle buffer.");
             CS_ASSERT(in_desc.m_concurrentParticleData != nullptr, "Cannot update particles with null concurrent particle data.");
 
+            ParticleBuffer* particleBuffer = in_desc.m_particleBuffer.get();
+            dynamic_array<Particle>* particleArray = in_desc.m_particleArray.get();
+
             //update the particles
-            for (auto& particle : *in_desc.m_particleArray)
+            particleBuffer->Integrate(in_desc.m_deltaTime);
+
+            //calculate the normalised playback progress.
+            const f32 effectProgress = in_desc.m_playbackTime / in_desc.m_particleEffect->GetDuration();
+            
+            //apply affectors. Affectors which operate on the particle array rather than the buffer need the
+            //particle state to be copied across, so this only happens when switching between the two types.
+            bool isArrayCurrent = false;
+            bool isBufferCurrent = true;
+            for (auto& affector : in_desc.m_particleAffectors)
             {
-                if (particle.m_isActive == true)
+                if (affector->RequiresParticleArray() == true)
                 {
-                    particle.m_energy -= in_desc.m_deltaTime;
-                    if (particle.m_energy > 0.0f)
+                    CS_ASSERT(particleArray != nullptr, "Cannot update array based particle affector with null particle array.");
+
+                    if (isArrayCurrent == false)
                     {
-                        particle.m_position += particle.m_velocity * in_desc.m_deltaTime;
-                        particle.m_rotation += particle.m_angularVelocity * in_desc.m_deltaTime;
+                        particleBuffer->CopyToArray(particleArray);
+                        isArrayCurrent = true;
                     }
-                    else
+
+                    affector->AffectParticles(in_desc.m_deltaTime, effectProgress);
+                    isBufferCurrent = false;
+                }
+                else
+                {
+                    if (isBufferCurrent == false)
                     {
-                        particle.m_energy = 0.0f;
-                        particle.m_isActive = false;
+                        particleBuffer->CopyFromArray(*particleArray);
+                        isBufferCurrent = true;
                     }
+
+                    affector->AffectParticles(in_desc.m_deltaTime, effectProgress);
+                    isArrayCurrent = false;
                 }
             }
 
-            //calculate the normalised playback progress.
-            const f32 effectProgress = in_desc.m_playbackTime / in_desc.m_particleEffect->GetDuration();
-            
-            //apply affectors
-            for (auto& affector : in_desc.m_particleAffectors)
+            if (isBufferCurrent == false)
             {
-                affector->AffectParticles(in_desc.m_deltaTime, effectProgress);
+                particleBuffer->CopyFromArray(*particleArray);
             }
 
-            //try to emit
+            //try to emit. Emitters which emit into the particle array need it to be up to date so they can find free
+            //particles, and the new particles are then copied across to the buffer.
             std::vector<u32> newIndices;
             if (in_desc.m_particleEmitter != nullptr)
             {
-                newIndices = in_desc.m_particleEmitter->TryEmit(in_desc.m_playbackTime, in_desc.m_entityPosition, in_desc.m_entityScale, in_desc.m_entityOrientation, in_desc.m_interpolateEmission);
+                if (in_desc.m_particleEmitter->RequiresParticleArray() == true)
+                {
+                    CS_ASSERT(particleArray != nullptr, "Cannot update array based particle emitter with null particle array.");
+
+                    if (isArrayCurrent == false)
+                    {
+                        particleBuffer->CopyToArray(particleArray);
+                    }
+
+                    newIndices = in_desc.m_particleEmitter->TryEmit(in_desc.m_playbackTime, in_desc.m_entityPosition, in_desc.m_entityScale, in_desc.m_entityOrientation, in_desc.m_interpolateEmission);
+
+                    for (u32 newIndex : newIndices)
+                    {
+                        particleBuffer->ActivateParticle(newIndex, (*particleArray)[newIndex]);
+                    }
+                }
+                else
+                {
+                    newIndices = in_desc.m_particleEmitter->TryEmit(in_desc.m_playbackTime, in_desc.m_entityPosition, in_desc.m_entityScale, in_desc.m_entityOrientation, in_desc.m_interpolateEmission);
+                }
             }
 
             //Initialise any new particles in each affector.
@@ -197,12 +229,21 @@ namespace ChilliSource
             {
                 for (auto& affector : in_desc.m_particleAffectors)
                 {
-                    affector->ActivateParticle(newIndex, effectProgress);
+                    if (affector->RequiresParticleArray() == true)
+                    {
+                        (*particleArray)[newIndex] = particleBuffer->GetParticle(newIndex);
+                        affector->ActivateParticle(newIndex, effectProgress);
+                        particleBuffer->SetParticle(newIndex, (*particleArray)[newIndex]);
+                    }
+                    else
+                    {
+                        affector->ActivateParticle(newIndex, effectProgress);
+                    }
                 }
             }
 
-            auto boundingShapes = CalculateBoundingShapes(in_desc.m_particleEffect.get(), in_desc.m_particleArray.get());
-            in_desc.m_concurrentParticleData->CommitParticleData(in_desc.m_particleArray.get(), newIndices, boundingShapes.first, boundingShapes.second);
+            auto boundingShapes = CalculateBoundingShapes(in_desc.m_particleEffect.get(), particleBuffer);
+            in_desc.m_concurrentParticleData->CommitParticleData(*particleBuffer, newIndices, boundingShapes.first, boundingShapes.second);
         }
     }
     CS_DEFINE_NAMEDTYPE(ParticleEffectComponent);
@@ -325,6 +366,7 @@ namespace ChilliSource
         m_localAABB = AABB();
         m_localBoundingSphere = Sphere();
         m_invalidateBoundingShapeCache = true;
+        InvalidateVolume();
     }
     //-------------------------------------------------------
     //-------------------------------------------------------
@@ -377,19 +419,35 @@ namespace ChilliSource
         {
             ValidateParticleEffect(m_particleEffect);
 
-            m_particleArray = std::make_shared<dynamic_array<Particle>>(m_particleEffect->GetMaxParticles());
+            m_particleBuffer = std::make_shared<ParticleBuffer>(m_particleEffect->GetMaxParticles());
             m_concurrentParticleData = std::make_shared<ConcurrentParticleData>(m_particleEffect->GetMaxParticles());
 
             m_drawable = m_particleEffect->GetDrawableDef()->CreateInstance(GetEntity(), m_concurrentParticleData.get());
             CS_ASSERT(m_drawable != nullptr, "Failed to create particle drawable.");
 
-            m_emitter = m_particleEffect->GetEmitterDef()->CreateInstance(m_particleArray.get());
+            m_emitter = m_particleEffect->GetEmitterDef()->CreateVectorisedInstance(m_particleBuffer.get());
+            if (m_emitter == nullptr)
+            {
+                //the particle array is only needed if the emitter or any affectors don't support the particle buffer.
+                m_particleArray = std::make_shared<dynamic_array<Particle>>(m_particleEffect->GetMaxParticles());
+                m_emitter = m_particleEffect->GetEmitterDef()->CreateInstance(m_particleArray.get());
+            }
             CS_ASSERT(m_emitter != nullptr, "Failed to create particle emitter.");
 
             const std::vector<const ParticleAffectorDef*> affectorDefs = m_particleEffect->GetAffectorDefs();
             for (const auto& affectorDef : affectorDefs)
             {
-                ParticleAffectorSPtr affector = affectorDef->CreateInstance(m_particleArray.get());
+                ParticleAffectorSPtr affector = affectorDef->CreateVectorisedInstance(m_particleBuffer.get());
+                if (affector == nullptr)
+                {
+                    //the particle array is only needed if there are affectors which don't support the particle buffer.
+                    if (m_particleArray == nullptr)
+                    {
+                        m_particleArray = std::make_shared<dynamic_array<Particle>>(m_particleEffect->GetMaxParticles());
+                    }
+
+                    affector = affectorDef->CreateInstance(m_particleArray.get());
+                }
                 CS_ASSERT(affector != nullptr, "Failed to create particle emitter.");
 
                 m_affectors.push_back(affector);
@@ -401,12 +459,14 @@ namespace ChilliSource
             m_localAABB = AABB();
             m_localBoundingSphere = Sphere();
             m_invalidateBoundingShapeCache = true;
+            InvalidateVolume();
         }
     }
     //-------------------------------------------------------
     //-------------------------------------------------------
     void ParticleEffectComponent::CleanupParticleEffect()
     {
+        m_particleBuffer.reset();
         m_particleArray.reset();
         m_concurrentParticleData.reset();
         m_drawable.reset();
@@ -422,6 +482,7 @@ namespace ChilliSource
         m_localAABB = m_concurrentParticleData->GetAABB();
         m_localBoundingSphere = m_concurrentParticleData->GetBoundingSphere();
         m_invalidateBoundingShapeCache = true;
+        InvalidateVolume();
     }
     //----------------------------------------------------------------
     //----------------------------------------------------------------
@@ -429,6 +490,8 @@ namespace ChilliSource
     {
         CS_ASSERT(GetEntity() != nullptr, "Cannot get world bounding shapes without being attached to an entity.");
 
+        ResolveTransformChanges();
+
         if (m_invalidateBoundingShapeCache == true)
         {
             if (m_particleEffect != nullptr && m_particleEffect->GetSimulationSpace() == ParticleEffect::SimulationSpace::k_world)
@@ -535,11 +598,8 @@ namespace ChilliSource
         if (m_concurrentParticleData->StartUpdate() == true)
         {
             //intialise the particles by disabling them all.
-            for (auto& particle : *m_particleArray)
-            {
-                particle.m_isActive = false;
-            }
-            m_concurrentParticleData->CommitParticleData(m_particleArray.get(), std::vector<u32>(), AABB(), Sphere());
+            m_particleBuffer->DeactivateAllParticles();
+            m_concurrentParticleData->CommitParticleData(*m_particleBuffer, std::vector<u32>(), AABB(), Sphere());
 
             m_playbackState = PlaybackState::k_playing;
             UpdatePlayingState(in_deltaTime);
@@ -580,6 +640,7 @@ namespace ChilliSource
             desc.m_particleEffect = m_particleEffect;
             desc.m_particleEmitter = m_emitter;
             desc.m_particleAffectors = m_affectors;
+            desc.m_particleBuffer = m_particleBuffer;
             desc.m_particleArray = m_particleArray;
             desc.m_concurrentParticleData = m_concurrentParticleData;
             desc.m_playbackTime = m_playbackTimer;
@@ -616,6 +677,7 @@ namespace ChilliSource
                 desc.m_particleEffect = m_particleEffect;
                 desc.m_particleEmitter = nullptr;
                 desc.m_particleAffectors = m_affectors;
+                desc.m_particleBuffer = m_particleBuffer;
                 desc.m_particleArray = m_particleArray;
                 desc.m_concurrentParticleData = m_concurrentParticleData;
                 desc.m_playbackTime = m_playbackTimer;
@@ -650,6 +712,7 @@ namespace ChilliSource
     void ParticleEffectComponent::OnEntityTransformChanged()
     {
         m_invalidateBoundingShapeCache = true;
+        InvalidateVolume();
     }
     //-------------------------------------------------------
     //-------------------------------------------------------
@@ -388,6 +388,7 @@ namespace ChilliSource
         ParticleDrawableUPtr m_drawable;
         ParticleEmitterSPtr m_emitter;
         std::vector<ParticleAffectorSPtr> m_affectors;
+        ParticleBufferSPtr m_particleBuffer;
         std::shared_ptr<dynamic_array<Particle>> m_particleArray;
         ConcurrentParticleDataSPtr m_concurrentParticleData;
 
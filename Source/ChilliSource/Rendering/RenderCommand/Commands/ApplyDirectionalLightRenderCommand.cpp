@@ -27,10 +27,12 @@
 namespace ChilliSource
 {
     //------------------------------------------------------------------------------
-    ApplyDirectionalLightRenderCommand::ApplyDirectionalLightRenderCommand(const Colour& colour, const Vector3& direction, const Matrix4& lightViewProjection, f32 shadowTolerance,
-                                                                           const RenderTexture* shadowMapRenderTexture) noexcept
-        : RenderCommand(Type::k_applyDirectionalLight), m_colour(colour), m_direction(direction), m_lightViewProjection(lightViewProjection), m_shadowTolerance(shadowTolerance),
-          m_shadowMapRenderTexture(shadowMapRenderTexture)
+    ApplyDirectionalLightRenderCommand::ApplyDirectionalLightRenderCommand(const Colour& colour, const Vector3& direction, const std::array<Matrix4, DirectionalRenderLight::k_maxShadowCascades>& lightViewProjections,
+                                                                           f32 shadowTolerance, const std::array<const RenderTexture*, DirectionalRenderLight::k_maxShadowCascades>& shadowMapRenderTextures,
+                                                                           u32 numShadowMaps) noexcept
+        : RenderCommand(Type::k_applyDirectionalLight), m_colour(colour), m_direction(direction), m_lightViewProjections(lightViewProjections), m_shadowTolerance(shadowTolerance),
+          m_shadowMapRenderTextures(shadowMapRenderTextures), m_numShadowMaps(numShadowMaps)
     {
+        CS_ASSERT(m_numShadowMaps <= DirectionalRenderLight::k_maxShadowCascades, "Too many shadow maps.");
     }
 }
@@ -29,8 +29,11 @@
 #include <ChilliSource/Core/Base/Colour.h>
 #include <ChilliSource/Core/Math/Matrix4.h>
 #include <ChilliSource/Core/Math/Vector3.h>
+#include <ChilliSource/Rendering/Lighting/DirectionalRenderLight.h>
 #include <ChilliSource/Rendering/RenderCommand/RenderCommand.h>
 
+#include <array>
+
 namespace ChilliSource
 {
     /// A render command for applying the described directional light to the current context
@@ -51,19 +54,22 @@ namespace ChilliSource
         ///
         const Vector3& GetDirection() const noexcept { return m_direction; }
         
-        /// @return The view projection matrix of the light which is used as the camera when rendering
-        ///     the shadow map.
+        /// @return The view projection matrix of the light for each shadow cascade, which is used as
+        ///     the camera when rendering the shadow map.
         ///
-        const Matrix4& GetLightViewProjection() const noexcept { return m_lightViewProjection; }
+        const std::array<Matrix4, DirectionalRenderLight::k_maxShadowCascades>& GetLightViewProjections() const noexcept { return m_lightViewProjections; }
         
         /// @return The tolerence used to judge if an object is in shadow.
         ///
         f32 GetShadowTolerance() const noexcept { return m_shadowTolerance; }
         
-        /// @return The render texture which should be used for the shadow map. Will be null if there is
-        ///     no shadow map.
+        /// @return The render texture which should be used for the shadow map of each cascade.
+        ///
+        const std::array<const RenderTexture*, DirectionalRenderLight::k_maxShadowCascades>& GetShadowMapRenderTextures() const noexcept { return m_shadowMapRenderTextures; }
+        
+        /// @return The number of shadow maps. Will be zero if there is no shadow map.
         ///
-        const RenderTexture* GetShadowMapRenderTexture() const noexcept { return m_shadowMapRenderTexture; }
+        u32 GetNumShadowMaps() const noexcept { return m_numShadowMaps; }
         
     private:
         friend class RenderCommandList;
@@ -74,22 +80,25 @@ namespace ChilliSource
         ///     The colour of the light.
         /// @param direction
         ///     The direction of the light.
-        /// @param lightViewProjection
-        ///     The view projection matrix of the light which is used as the camera when rendering
-        ///     the shadow map.
+        /// @param lightViewProjections
+        ///     The view projection matrix of the light for each shadow cascade, which is used as the
+        ///     camera when rendering the shadow map.
         /// @param shadowTolerance
         ///     The tolerence used to judge if an object is in shadow.
-        /// @param shadowMapRenderTexture
-        ///     The render texture which should be used for the shadow map. Can be null if there is no
-        ///     shadow map.
+        /// @param shadowMapRenderTextures
+        ///     The render texture which should be used for the shadow map of each cascade.
+        /// @param numShadowMaps
+        ///     The number of shadow maps. Can be zero if there is no shadow map.
         ///
-        ApplyDirectionalLightRenderCommand(const Colour& colour, const Vector3& direction, const Matrix4& lightViewProjection, f32 shadowTolerance, const RenderTexture* shadowMapRenderTexture) noexcept;
+        ApplyDirectionalLightRenderCommand(const Colour& colour, const Vector3& direction, const std::array<Matrix4, DirectionalRenderLight::k_maxShadowCascades>& lightViewProjections, f32 shadowTolerance,
+                                           const std::array<const RenderTexture*, DirectionalRenderLight::k_maxShadowCascades>& shadowMapRenderTextures, u32 numShadowMaps) noexcept;
         
         Colour m_colour;
         Vector3 m_direction;
-        Matrix4 m_lightViewProjection;
+        std::array<Matrix4, DirectionalRenderLight::k_maxShadowCascades> m_lightViewProjections;
         f32 m_shadowTolerance;
-        const RenderTexture* m_shadowMapRenderTexture;
+        std::array<const RenderTexture*, DirectionalRenderLight::k_maxShadowCascades> m_shadowMapRenderTextures;
+        u32 m_numShadowMaps;
     };
 }
 
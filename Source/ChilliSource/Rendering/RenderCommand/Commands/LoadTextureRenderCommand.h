@@ -34,6 +34,10 @@ namespace ChilliSource
     /// A render command for loading the texture data pertaining to a single render texture into
     /// render memory.
     ///
+    /// If the render texture has precomputed mip levels the data may contain only the smaller
+    /// levels, starting at the given first mip level. The larger levels are then added using
+    /// StreamTextureRenderCommands.
+    ///
     /// This must be instantiated via a RenderCommandList.
     ///
     /// This is immutable and therefore thread-safe.
@@ -60,6 +64,11 @@ namespace ChilliSource
         ///
         u32 GetTextureDataSize() const noexcept { return m_textureDataSize; }
         
+        /// @return The first mip level contained in the texture data. The data contains this
+        /// level and all smaller levels, largest first.
+        ///
+        u32 GetFirstMipLevel() const noexcept { return m_firstMipLevel; }
+        
     private:
         friend class RenderCommandList;
         
@@ -71,12 +80,15 @@ namespace ChilliSource
         ///     The data describing the texture.
         /// @param textureDataSize
         ///     The size of the texture data in bytes.
+        /// @param firstMipLevel
+        ///     The first mip level contained in the texture data.
         ///
-        LoadTextureRenderCommand(RenderTexture* renderTexture, std::unique_ptr<const u8[]> textureData, u32 textureDataSize) noexcept;
+        LoadTextureRenderCommand(RenderTexture* renderTexture, std::unique_ptr<const u8[]> textureData, u32 textureDataSize, u32 firstMipLevel) noexcept;
         
         RenderTexture* m_renderTexture;
         std::unique_ptr<const u8[]> m_textureData;
         u32 m_textureDataSize;
+        u32 m_firstMipLevel;
     };
 }
 
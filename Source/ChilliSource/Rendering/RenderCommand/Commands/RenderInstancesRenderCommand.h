@@ -0,0 +1,78 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2016 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#ifndef _CHILLISOURCE_RENDERING_RENDERCOMMAND_COMMANDS_RENDERINSTANCESRENDERCOMMAND_H_
+#define _CHILLISOURCE_RENDERING_RENDERCOMMAND_COMMANDS_RENDERINSTANCESRENDERCOMMAND_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Math/Matrix4.h>
+#include <ChilliSource/Rendering/RenderCommand/RenderCommand.h>
+
+namespace ChilliSource
+{
+    /// A render command for rendering multiple instances of the mesh currently described by
+    /// the context state, each with its own world transform. If hardware instancing is
+    /// supported this will be rendered using a single instanced draw call.
+    ///
+    /// The instance world matrices are stored in the render command list directly after the
+    /// command, so they share its lifetime.
+    ///
+    /// This must be instantiated via a RenderCommandList.
+    ///
+    /// This is immutable and therefore thread-safe.
+    ///
+    class RenderInstancesRenderCommand final : public RenderCommand
+    {
+    public:
+        /// The maximum number of instances which can be rendered by a single command.
+        ///
+        static constexpr u32 k_maxInstances = 256;
+        
+        /// @return The world matrices of each instance.
+        ///
+        const Matrix4* GetWorldMatrices() const noexcept { return m_worldMatrices; };
+        
+        /// @return The number of instances.
+        ///
+        u32 GetNumInstances() const noexcept { return m_numInstances; };
+        
+    private:
+        friend class RenderCommandList;
+        
+        /// Creates a new command with the given world matrix buffer.
+        ///
+        /// @param worldMatrices
+        ///     The world matrices of each instance. This must live for as long as the command.
+        /// @param numInstances
+        ///     The number of instances.
+        ///
+        RenderInstancesRenderCommand(const Matrix4* worldMatrices, u32 numInstances) noexcept;
+        
+        const Matrix4* m_worldMatrices;
+        u32 m_numInstances;
+    };
+}
+
+#endif
@@ -0,0 +1,109 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2016 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CHILLISOURCE_RENDERING_RENDERCOMMAND_COMMANDS_STREAMTEXTURERENDERCOMMAND_H_
+#define _CHILLISOURCE_RENDERING_RENDERCOMMAND_COMMANDS_STREAMTEXTURERENDERCOMMAND_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Rendering/RenderCommand/RenderCommand.h>
+#include <ChilliSource/Rendering/Texture/RenderTexture.h>
+
+namespace ChilliSource
+{
+    /// A render command for streaming part of a precomputed mip level into render memory for a
+    /// render texture which has already been loaded with only its smaller levels.
+    ///
+    /// A streamed texture is refined by building a new mip chain, starting at the given first
+    /// mip level, a band of rows at a time. The new chain replaces the loaded one once all of
+    /// its levels have been streamed.
+    ///
+    /// This must be instantiated via a RenderCommandList.
+    ///
+    /// This is immutable and therefore thread-safe.
+    ///
+    class StreamTextureRenderCommand final : public RenderCommand
+    {
+    public:
+        /// @return The render texture that should be streamed to.
+        ///
+        RenderTexture* GetRenderTexture() const noexcept { return m_renderTexture; };
+        
+        /// @return The row data for the mip level.
+        ///
+        const u8* GetTextureData() const noexcept { return m_textureData.get(); }
+        
+        /// Moves the texture data out of this class. Use with caution as this command
+        /// will be in a broken state after this is used.
+        ///
+        /// @return The row data for the mip level.
+        ///
+        std::unique_ptr<const u8[]> ClaimTextureData() noexcept;
+        
+        /// @return The size of the texture data in bytes. This is always a whole number of
+        /// rows.
+        ///
+        u32 GetTextureDataSize() const noexcept { return m_textureDataSize; }
+        
+        /// @return The first mip level of the chain which is being built.
+        ///
+        u32 GetFirstMipLevel() const noexcept { return m_firstMipLevel; }
+        
+        /// @return The mip level the texture data belongs to.
+        ///
+        u32 GetMipLevel() const noexcept { return m_mipLevel; }
+        
+        /// @return The first row of the mip level contained in the texture data.
+        ///
+        u32 GetFirstRow() const noexcept { return m_firstRow; }
+        
+    private:
+        friend class RenderCommandList;
+        
+        /// Constructs a new instance with the given render texture and row data.
+        ///
+        /// @param renderTexture
+        ///     The render texture that should be streamed to.
+        /// @param textureData
+        ///     The row data for the mip level.
+        /// @param textureDataSize
+        ///     The size of the texture data in bytes.
+        /// @param firstMipLevel
+        ///     The first mip level of the chain which is being built.
+        /// @param mipLevel
+        ///     The mip level the texture data belongs to.
+        /// @param firstRow
+        ///     The first row of the mip level contained in the texture data.
+        ///
+        StreamTextureRenderCommand(RenderTexture* renderTexture, std::unique_ptr<const u8[]> textureData, u32 textureDataSize, u32 firstMipLevel, u32 mipLevel, u32 firstRow) noexcept;
+        
+        RenderTexture* m_renderTexture;
+        std::unique_ptr<const u8[]> m_textureData;
+        u32 m_textureDataSize;
+        u32 m_firstMipLevel;
+        u32 m_mipLevel;
+        u32 m_firstRow;
+    };
+}
+
+#endif
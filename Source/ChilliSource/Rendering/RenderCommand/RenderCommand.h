@@ -35,7 +35,9 @@ namespace ChilliSource
     /// a type, which can be used to safely cast down to the concrete type, without the need for
     /// virtual calls or RTTI.
     ///
-    /// Render commands should be instantiated within a RenderCommandList.
+    /// Render commands should be instantiated within a RenderCommandList, which stores them
+    /// contiguously in a tagged command stream. As such render commands are never deleted
+    /// through a pointer to the base class, and have no virtual destructor.
     ///
     /// A render command should be immutable and therefore thread safe.
     ///
@@ -47,6 +49,7 @@ namespace ChilliSource
         enum class Type
         {
             k_loadTexture,
+            k_streamTexture,
             k_loadShader,
             k_loadMaterialGroup,
             k_loadMesh,
@@ -66,6 +69,7 @@ namespace ChilliSource
             k_applyMeshBatch,
             k_applySkinnedAnimation,
             k_renderInstance,
+            k_renderInstances,
             k_end,
             k_unloadTargetGroup,
             k_unloadMesh,
@@ -78,8 +82,6 @@ namespace ChilliSource
         ///
         Type GetType() const noexcept { return m_type; }
         
-        virtual ~RenderCommand() noexcept {}
-        
     protected:
         /// Constructs the RenderCommand with the given type.
         ///
@@ -88,8 +90,13 @@ namespace ChilliSource
         ///
         RenderCommand(Type type) noexcept;
         
+        ~RenderCommand() noexcept = default;
+        
     private:
+        friend class RenderCommandList;
+        
         Type m_type;
+        u32 m_streamStride = 0;
     };
 }
 
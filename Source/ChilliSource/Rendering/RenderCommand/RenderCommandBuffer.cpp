@@ -27,20 +27,24 @@
 namespace ChilliSource
 {
     //------------------------------------------------------------------------------
-    RenderCommandBuffer::RenderCommandBuffer(u32 numSlots, RenderFrameData renderFrameData) noexcept
+    RenderCommandBuffer::RenderCommandBuffer(RenderFrameData renderFrameData) noexcept
         : m_renderFrameData(std::move(renderFrameData))
     {
-        m_renderCommandLists.reserve(numSlots);
-        for (u32 i = 0; i < numSlots; ++i)
-        {
-            m_renderCommandLists.push_back(RenderCommandListUPtr(new RenderCommandList()));
-        }
+    }
+    
+    //------------------------------------------------------------------------------
+    RenderCommandListUPtr RenderCommandBuffer::CreateRenderCommandList() noexcept
+    {
+        return RenderCommandListUPtr(new RenderCommandList(m_renderFrameData.GetFrameAllocator(), &m_frameAllocatorMutex));
+    }
+    
+    //------------------------------------------------------------------------------
+    void RenderCommandBuffer::AddRenderCommandList(RenderCommandListUPtr renderCommandList) noexcept
+    {
+        CS_ASSERT(renderCommandList, "Cannot add a null render command list.");
         
-        m_queue.reserve(numSlots);
-        for (const auto& renderCommandList : m_renderCommandLists)
-        {
-            m_queue.push_back(renderCommandList.get());
-        }
+        m_queue.push_back(renderCommandList.get());
+        m_renderCommandLists.push_back(std::move(renderCommandList));
     }
     
     //------------------------------------------------------------------------------
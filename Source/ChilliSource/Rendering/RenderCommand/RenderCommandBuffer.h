@@ -31,36 +31,47 @@
 #include <ChilliSource/Rendering/Model/RenderSkinnedAnimation.h>
 #include <ChilliSource/Rendering/RenderCommand/RenderCommandList.h>
 
+#include <mutex>
 #include <vector>
 
 namespace ChilliSource
 {
-    /// Provides the ability to create a buffer of Render Command Lists. By creating and ordering
-    /// all of the Render Command Lists up front, the Render Command Lists can be safely
-    /// populated on separate threads without locking.
+    /// Provides the ability to create a buffer of Render Command Lists. Lists created by the
+    /// buffer share its frame allocator, so they can be safely populated on separate threads,
+    /// then added to the buffer in the order they should be processed once complete.
     ///
     /// This also holds frame data required by commands to ensure that the data exists for as long
-    /// as the commands require them.
+    /// as the commands require them. The commands themselves are allocated from the frame
+    /// allocator.
     ///
-    /// This is not thread-safe but can be safely used accross threads as long as each thread
-    /// only accessed one queue slot.
+    /// Creating lists is thread-safe, but adding them to the buffer is not and should only be
+    /// done from one thread at a time.
     ///
     class RenderCommandBuffer final
     {
     public:
         CS_DECLARE_NOCOPY(RenderCommandBuffer);
         
-        RenderCommandBuffer(RenderCommandBuffer&&) = default;
-        RenderCommandBuffer& operator=(RenderCommandBuffer&&) = default;
-        
-        /// Creates a new render command buffer with the requested number of slots.
+        /// Creates a new empty render command buffer.
         ///
-        /// @param numSlots
-        ///     The number of slots in the queue.
         /// @param renderFrameData
         ///     The render frame data that must persist to the end of the frame. Must be moved.
         ///
-        RenderCommandBuffer(u32 numSlots, RenderFrameData renderFrameData) noexcept;
+        RenderCommandBuffer(RenderFrameData renderFrameData) noexcept;
+        
+        /// Creates a new empty render command list which allocates from the frame allocator of
+        /// this buffer. This is thread-safe.
+        ///
+        /// @return The new render command list. This must be added to this buffer once populated.
+        ///
+        RenderCommandListUPtr CreateRenderCommandList() noexcept;
+        
+        /// Adds the given render command list to the end of the queue.
+        ///
+        /// @param renderCommandList
+        ///     The render command list. Must be moved.
+        ///
+        void AddRenderCommandList(RenderCommandListUPtr renderCommandList) noexcept;
         
         /// @return The allocator from which all frame allocations should occur.
         ///
@@ -85,6 +96,7 @@ namespace ChilliSource
         std::vector<RenderDynamicMeshAUPtr> m_renderDynamicMeshes;
         std::vector<RenderSkinnedAnimationAUPtr> m_renderSkinnedAnimations;
         std::vector<const RenderCommandList*> m_queue;
+        std::mutex m_frameAllocatorMutex;
         std::vector<RenderCommandListUPtr> m_renderCommandLists; //TODO: This should be changed to a pool.
         const RenderFrameData m_renderFrameData;
     };
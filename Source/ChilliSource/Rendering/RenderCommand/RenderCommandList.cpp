@@ -24,6 +24,7 @@
 
 #include <ChilliSource/Rendering/RenderCommand/RenderCommandList.h>
 
+#include <ChilliSource/Core/Memory/IAllocator.h>
 #include <ChilliSource/Rendering/RenderCommand/Commands/ApplyAmbientLightRenderCommand.h>
 #include <ChilliSource/Rendering/RenderCommand/Commands/ApplyCameraRenderCommand.h>
 #include <ChilliSource/Rendering/RenderCommand/Commands/ApplyDirectionalLightRenderCommand.h>
@@ -42,254 +43,479 @@
 #include <ChilliSource/Rendering/RenderCommand/Commands/LoadTargetGroupRenderCommand.h>
 #include <ChilliSource/Rendering/RenderCommand/Commands/LoadTextureRenderCommand.h>
 #include <ChilliSource/Rendering/RenderCommand/Commands/RenderInstanceRenderCommand.h>
+#include <ChilliSource/Rendering/RenderCommand/Commands/RenderInstancesRenderCommand.h>
 #include <ChilliSource/Rendering/RenderCommand/Commands/RestoreMeshRenderCommand.h>
 #include <ChilliSource/Rendering/RenderCommand/Commands/RestoreRenderTargetGroupCommand.h>
 #include <ChilliSource/Rendering/RenderCommand/Commands/RestoreTextureRenderCommand.h>
+#include <ChilliSource/Rendering/RenderCommand/Commands/StreamTextureRenderCommand.h>
 #include <ChilliSource/Rendering/RenderCommand/Commands/UnloadMaterialGroupRenderCommand.h>
 #include <ChilliSource/Rendering/RenderCommand/Commands/UnloadMeshRenderCommand.h>
 #include <ChilliSource/Rendering/RenderCommand/Commands/UnloadShaderRenderCommand.h>
 #include <ChilliSource/Rendering/RenderCommand/Commands/UnloadTargetGroupRenderCommand.h>
 #include <ChilliSource/Rendering/RenderCommand/Commands/UnloadTextureRenderCommand.h>
 
+#include <algorithm>
+#include <cstdint>
+
 namespace ChilliSource
 {
+    namespace
+    {
+        constexpr u32 k_commandAlignment = sizeof(std::intptr_t);
+        constexpr u32 k_minBlockSize = 512;
+        constexpr u32 k_maxBlockSize = 16 * 1024;
+        
+        /// Calls the destructor of the given command, without deallocating its memory.
+        ///
+        /// @param renderCommand
+        ///     The command to destroy.
+        ///
+        template <typename TRenderCommand> void DestroyCommand(RenderCommand* renderCommand) noexcept
+        {
+            static_cast<TRenderCommand*>(renderCommand)->~TRenderCommand();
+        }
+        
+        /// Calls the destructor of the given command, based on its type, without deallocating
+        /// its memory.
+        ///
+        /// @param renderCommand
+        ///     The command to destroy.
+        ///
+        void DestroyCommand(RenderCommand* renderCommand) noexcept
+        {
+            switch (renderCommand->GetType())
+            {
+                case RenderCommand::Type::k_loadTexture:
+                    DestroyCommand<LoadTextureRenderCommand>(renderCommand);
+                    break;
+                case RenderCommand::Type::k_streamTexture:
+                    DestroyCommand<StreamTextureRenderCommand>(renderCommand);
+                    break;
+                case RenderCommand::Type::k_loadShader:
+                    DestroyCommand<LoadShaderRenderCommand>(renderCommand);
+                    break;
+                case RenderCommand::Type::k_loadMaterialGroup:
+                    DestroyCommand<LoadMaterialGroupRenderCommand>(renderCommand);
+                    break;
+                case RenderCommand::Type::k_loadMesh:
+                    DestroyCommand<LoadMeshRenderCommand>(renderCommand);
+                    break;
+                case RenderCommand::Type::k_restoreTexture:
+                    DestroyCommand<RestoreTextureRenderCommand>(renderCommand);
+                    break;
+                case RenderCommand::Type::k_restoreMesh:
+                    DestroyCommand<RestoreMeshRenderCommand>(renderCommand);
+                    break;
+                case RenderCommand::Type::k_restoreRenderTargetGroup:
+                    DestroyCommand<RestoreRenderTargetGroupCommand>(renderCommand);
+                    break;
+                case RenderCommand::Type::k_loadTargetGroup:
+                    DestroyCommand<LoadTargetGroupRenderCommand>(renderCommand);
+                    break;
+                case RenderCommand::Type::k_begin:
+                    DestroyCommand<BeginRenderCommand>(renderCommand);
+                    break;
+                case RenderCommand::Type::k_beginWithTargetGroup:
+                    DestroyCommand<BeginWithTargetGroupRenderCommand>(renderCommand);
+                    break;
+                case RenderCommand::Type::k_applyCamera:
+                    DestroyCommand<ApplyCameraRenderCommand>(renderCommand);
+                    break;
+                case RenderCommand::Type::k_applyAmbientLight:
+                    DestroyCommand<ApplyAmbientLightRenderCommand>(renderCommand);
+                    break;
+                case RenderCommand::Type::k_applyDirectionalLight:
+                    DestroyCommand<ApplyDirectionalLightRenderCommand>(renderCommand);
+                    break;
+                case RenderCommand::Type::k_applyPointLight:
+                    DestroyCommand<ApplyPointLightRenderCommand>(renderCommand);
+                    break;
+                case RenderCommand::Type::k_applyMaterial:
+                    DestroyCommand<ApplyMaterialRenderCommand>(renderCommand);
+                    break;
+                case RenderCommand::Type::k_applyMesh:
+                    DestroyCommand<ApplyMeshRenderCommand>(renderCommand);
+                    break;
+                case RenderCommand::Type::k_applyDynamicMesh:
+                    DestroyCommand<ApplyDynamicMeshRenderCommand>(renderCommand);
+                    break;
+                case RenderCommand::Type::k_applyMeshBatch:
+                    DestroyCommand<ApplyMeshBatchRenderCommand>(renderCommand);
+                    break;
+                case RenderCommand::Type::k_applySkinnedAnimation:
+                    DestroyCommand<ApplySkinnedAnimationRenderCommand>(renderCommand);
+                    break;
+                case RenderCommand::Type::k_renderInstance:
+                    DestroyCommand<RenderInstanceRenderCommand>(renderCommand);
+                    break;
+                case RenderCommand::Type::k_renderInstances:
+                    DestroyCommand<RenderInstancesRenderCommand>(renderCommand);
+                    break;
+                case RenderCommand::Type::k_end:
+                    DestroyCommand<EndRenderCommand>(renderCommand);
+                    break;
+                case RenderCommand::Type::k_unloadTargetGroup:
+                    DestroyCommand<UnloadTargetGroupRenderCommand>(renderCommand);
+                    break;
+                case RenderCommand::Type::k_unloadMesh:
+                    DestroyCommand<UnloadMeshRenderCommand>(renderCommand);
+                    break;
+                case RenderCommand::Type::k_unloadMaterialGroup:
+                    DestroyCommand<UnloadMaterialGroupRenderCommand>(renderCommand);
+                    break;
+                case RenderCommand::Type::k_unloadShader:
+                    DestroyCommand<UnloadShaderRenderCommand>(renderCommand);
+                    break;
+                case RenderCommand::Type::k_unloadTexture:
+                    DestroyCommand<UnloadTextureRenderCommand>(renderCommand);
+                    break;
+                default:
+                    CS_LOG_FATAL("Invalid render command type.");
+                    break;
+            }
+        }
+    }
+    
     //------------------------------------------------------------------------------
-    void RenderCommandList::AddLoadShaderCommand(RenderShader* renderShader, const std::string& vertexShader, const std::string& fragmentShader) noexcept
+    RenderCommandList::RenderCommandList(IAllocator* allocator, std::mutex* allocatorMutex) noexcept
+        : m_allocator(allocator), m_allocatorMutex(allocatorMutex)
+    {
+        CS_ASSERT(m_allocator, "Render command list must have an allocator.");
+    }
+    
+    //------------------------------------------------------------------------------
+    RenderCommandList::RenderCommandList(RenderCommandList&& toMove) noexcept
+        : m_allocator(toMove.m_allocator), m_allocatorMutex(toMove.m_allocatorMutex), m_firstBlock(toMove.m_firstBlock), m_lastBlock(toMove.m_lastBlock), m_numCommands(toMove.m_numCommands)
     {
-        RenderCommandUPtr renderCommand(new LoadShaderRenderCommand(renderShader, vertexShader, fragmentShader));
+        toMove.m_firstBlock = nullptr;
+        toMove.m_lastBlock = nullptr;
+        toMove.m_numCommands = 0;
+    }
+    
+    //------------------------------------------------------------------------------
+    RenderCommandList& RenderCommandList::operator=(RenderCommandList&& toMove) noexcept
+    {
+        if (this != &toMove)
+        {
+            Clear();
+            
+            m_allocator = toMove.m_allocator;
+            m_allocatorMutex = toMove.m_allocatorMutex;
+            m_firstBlock = toMove.m_firstBlock;
+            m_lastBlock = toMove.m_lastBlock;
+            m_numCommands = toMove.m_numCommands;
+            
+            toMove.m_firstBlock = nullptr;
+            toMove.m_lastBlock = nullptr;
+            toMove.m_numCommands = 0;
+        }
         
-        m_orderedCommands.push_back(renderCommand.get());
-        m_renderCommands.push_back(std::move(renderCommand));
+        return *this;
     }
     
     //------------------------------------------------------------------------------
-    void RenderCommandList::AddLoadTextureCommand(RenderTexture* renderTexture, std::unique_ptr<const u8[]> textureData, u32 textureDataSize) noexcept
+    template <typename TRenderCommand, typename... TArgs> void RenderCommandList::AddCommand(TArgs&&... args) noexcept
     {
-        RenderCommandUPtr renderCommand(new LoadTextureRenderCommand(renderTexture, std::move(textureData), textureDataSize));
+        static_assert(alignof(TRenderCommand) <= k_commandAlignment, "Render command alignment is too large for the command stream.");
+        
+        constexpr u32 k_stride = u32((sizeof(TRenderCommand) + k_commandAlignment - 1) & ~(k_commandAlignment - 1));
         
-        m_orderedCommands.push_back(renderCommand.get());
-        m_renderCommands.push_back(std::move(renderCommand));
+        auto renderCommand = new (Reserve(k_stride)) TRenderCommand(std::forward<TArgs>(args)...);
+        renderCommand->m_streamStride = k_stride;
+        
+        ++m_numCommands;
+    }
+    
+    //------------------------------------------------------------------------------
+    void RenderCommandList::AddLoadShaderCommand(RenderShader* renderShader, const std::string& vertexShader, const std::string& fragmentShader) noexcept
+    {
+        AddCommand<LoadShaderRenderCommand>(renderShader, vertexShader, fragmentShader);
+    }
+    
+    //------------------------------------------------------------------------------
+    void RenderCommandList::AddLoadTextureCommand(RenderTexture* renderTexture, std::unique_ptr<const u8[]> textureData, u32 textureDataSize, u32 firstMipLevel) noexcept
+    {
+        AddCommand<LoadTextureRenderCommand>(renderTexture, std::move(textureData), textureDataSize, firstMipLevel);
+    }
+    
+    //------------------------------------------------------------------------------
+    void RenderCommandList::AddStreamTextureCommand(RenderTexture* renderTexture, std::unique_ptr<const u8[]> textureData, u32 textureDataSize, u32 firstMipLevel, u32 mipLevel, u32 firstRow) noexcept
+    {
+        AddCommand<StreamTextureRenderCommand>(renderTexture, std::move(textureData), textureDataSize, firstMipLevel, mipLevel, firstRow);
     }
     
     //------------------------------------------------------------------------------
     void RenderCommandList::AddLoadMaterialGroupCommand(RenderMaterialGroup* renderMaterialGroup) noexcept
     {
-        RenderCommandUPtr renderCommand(new LoadMaterialGroupRenderCommand(renderMaterialGroup));
-        
-        m_orderedCommands.push_back(renderCommand.get());
-        m_renderCommands.push_back(std::move(renderCommand));
+        AddCommand<LoadMaterialGroupRenderCommand>(renderMaterialGroup);
     }
     
     //------------------------------------------------------------------------------
     void RenderCommandList::AddLoadMeshCommand(RenderMesh* renderMesh, std::unique_ptr<const u8[]> vertexData, u32 vertexDataSize, std::unique_ptr<const u8[]> indexData, u32 indexDataSize) noexcept
     {
-        RenderCommandUPtr renderCommand(new LoadMeshRenderCommand(renderMesh, std::move(vertexData), vertexDataSize, std::move(indexData), indexDataSize));
-        
-        m_orderedCommands.push_back(renderCommand.get());
-        m_renderCommands.push_back(std::move(renderCommand));
+        AddCommand<LoadMeshRenderCommand>(renderMesh, std::move(vertexData), vertexDataSize, std::move(indexData), indexDataSize);
     }
     
     //------------------------------------------------------------------------------
     void RenderCommandList::AddRestoreTextureCommand(const RenderTexture* renderTexture) noexcept
     {
-        RenderCommandUPtr renderCommand(new RestoreTextureRenderCommand(renderTexture));
-        
-        m_orderedCommands.push_back(renderCommand.get());
-        m_renderCommands.push_back(std::move(renderCommand));
+        AddCommand<RestoreTextureRenderCommand>(renderTexture);
     }
     
     //------------------------------------------------------------------------------
     void RenderCommandList::AddRestoreMeshCommand(const RenderMesh* renderMesh) noexcept
     {
-        RenderCommandUPtr renderCommand(new RestoreMeshRenderCommand(renderMesh));
-
-        m_orderedCommands.push_back(renderCommand.get());
-        m_renderCommands.push_back(std::move(renderCommand));
+        AddCommand<RestoreMeshRenderCommand>(renderMesh);
     }
     
     //------------------------------------------------------------------------------
     void RenderCommandList::AddRestoreRenderTargetGroupCommand(const RenderTargetGroup* renderTargetGroup) noexcept
     {
-        RenderCommandUPtr renderCommand(new RestoreRenderTargetGroupCommand(renderTargetGroup));
-        
-        m_orderedCommands.push_back(renderCommand.get());
-        m_renderCommands.push_back(std::move(renderCommand));
+        AddCommand<RestoreRenderTargetGroupCommand>(renderTargetGroup);
     }
     
     //------------------------------------------------------------------------------
     void RenderCommandList::AddLoadTargetGroupCommand(RenderTargetGroup* renderTargetGroup) noexcept
     {
-        RenderCommandUPtr renderCommand(new LoadTargetGroupRenderCommand(renderTargetGroup));
-
-        m_orderedCommands.push_back(renderCommand.get());
-        m_renderCommands.push_back(std::move(renderCommand));
+        AddCommand<LoadTargetGroupRenderCommand>(renderTargetGroup);
     }
     //------------------------------------------------------------------------------
     void RenderCommandList::AddBeginCommand(const Integer2& resolution, const Colour& clearColour) noexcept
     {
-        RenderCommandUPtr renderCommand(new BeginRenderCommand(resolution, clearColour));
-        
-        m_orderedCommands.push_back(renderCommand.get());
-        m_renderCommands.push_back(std::move(renderCommand));
+        AddCommand<BeginRenderCommand>(resolution, clearColour);
     }
     
     //------------------------------------------------------------------------------
     void RenderCommandList::AddBeginWithTargetGroupCommand(const RenderTargetGroup* renderTargetGroup, const Colour& clearColour) noexcept
     {
-        RenderCommandUPtr renderCommand(new BeginWithTargetGroupRenderCommand(renderTargetGroup, clearColour));
-        
-        m_orderedCommands.push_back(renderCommand.get());
-        m_renderCommands.push_back(std::move(renderCommand));
+        AddCommand<BeginWithTargetGroupRenderCommand>(renderTargetGroup, clearColour);
     }
     
     //------------------------------------------------------------------------------
     void RenderCommandList::AddApplyCameraCommand(const Vector3& position, const Matrix4& viewProjectionMatrix) noexcept
     {
-        RenderCommandUPtr renderCommand(new ApplyCameraRenderCommand(position, viewProjectionMatrix));
-        
-        m_orderedCommands.push_back(renderCommand.get());
-        m_renderCommands.push_back(std::move(renderCommand));
+        AddCommand<ApplyCameraRenderCommand>(position, viewProjectionMatrix);
     }
     
     //------------------------------------------------------------------------------
     void RenderCommandList::AddApplyAmbientLightCommand(const Colour& colour) noexcept
     {
-        RenderCommandUPtr renderCommand(new ApplyAmbientLightRenderCommand(colour));
-        
-        m_orderedCommands.push_back(renderCommand.get());
-        m_renderCommands.push_back(std::move(renderCommand));
+        AddCommand<ApplyAmbientLightRenderCommand>(colour);
     }
     
     //------------------------------------------------------------------------------
-    void RenderCommandList::AddApplyDirectionalLightCommand(const Colour& colour, const Vector3& direction, const Matrix4& lightViewProjection, f32 shadowTolerance, const RenderTexture* shadowMapRenderTexture) noexcept
+    void RenderCommandList::AddApplyDirectionalLightCommand(const Colour& colour, const Vector3& direction, const std::array<Matrix4, DirectionalRenderLight::k_maxShadowCascades>& lightViewProjections, f32 shadowTolerance,
+                                                            const std::array<const RenderTexture*, DirectionalRenderLight::k_maxShadowCascades>& shadowMapRenderTextures, u32 numShadowMaps) noexcept
     {
-        RenderCommandUPtr renderCommand(new ApplyDirectionalLightRenderCommand(colour, direction, lightViewProjection, shadowTolerance, shadowMapRenderTexture));
-        
-        m_orderedCommands.push_back(renderCommand.get());
-        m_renderCommands.push_back(std::move(renderCommand));
+        AddCommand<ApplyDirectionalLightRenderCommand>(colour, direction, lightViewProjections, shadowTolerance, shadowMapRenderTextures, numShadowMaps);
     }
     
     //------------------------------------------------------------------------------
     void RenderCommandList::AddApplyPointLightCommand(const Colour& colour, const Vector3& position, const Vector3& attenuation) noexcept
     {
-        RenderCommandUPtr renderCommand(new ApplyPointLightRenderCommand(colour, position, attenuation));
-        
-        m_orderedCommands.push_back(renderCommand.get());
-        m_renderCommands.push_back(std::move(renderCommand));
+        AddCommand<ApplyPointLightRenderCommand>(colour, position, attenuation);
     }
     
     //------------------------------------------------------------------------------
     void RenderCommandList::AddApplyMaterialCommand(const RenderMaterial* renderMaterial) noexcept
     {
-        RenderCommandUPtr renderCommand(new ApplyMaterialRenderCommand(renderMaterial));
-        
-        m_orderedCommands.push_back(renderCommand.get());
-        m_renderCommands.push_back(std::move(renderCommand));
+        AddCommand<ApplyMaterialRenderCommand>(renderMaterial);
     }
     
     //------------------------------------------------------------------------------
     void RenderCommandList::AddApplyMeshCommand(const RenderMesh* renderMesh) noexcept
     {
-        RenderCommandUPtr renderCommand(new ApplyMeshRenderCommand(renderMesh));
-        
-        m_orderedCommands.push_back(renderCommand.get());
-        m_renderCommands.push_back(std::move(renderCommand));
+        AddCommand<ApplyMeshRenderCommand>(renderMesh);
     }
     
     //------------------------------------------------------------------------------
     void RenderCommandList::AddApplyDynamicMeshCommand(const RenderDynamicMesh* renderDynamicMesh) noexcept
     {
-        RenderCommandUPtr renderCommand(new ApplyDynamicMeshRenderCommand(renderDynamicMesh));
-        
-        m_orderedCommands.push_back(renderCommand.get());
-        m_renderCommands.push_back(std::move(renderCommand));
+        AddCommand<ApplyDynamicMeshRenderCommand>(renderDynamicMesh);
     }
     
     //------------------------------------------------------------------------------
     void RenderCommandList::AddApplyMeshBatchCommand(RenderMeshBatchUPtr renderMeshBatch) noexcept
     {
-        RenderCommandUPtr renderCommand(new ApplyMeshBatchRenderCommand(std::move(renderMeshBatch)));
-        
-        m_orderedCommands.push_back(renderCommand.get());
-        m_renderCommands.push_back(std::move(renderCommand));
+        AddCommand<ApplyMeshBatchRenderCommand>(std::move(renderMeshBatch));
     }
     
     //------------------------------------------------------------------------------
     void RenderCommandList::AddApplySkinnedAnimationCommand(const RenderSkinnedAnimation* renderSkinnedAnimation) noexcept
     {
-        RenderCommandUPtr renderCommand(new ApplySkinnedAnimationRenderCommand(renderSkinnedAnimation));
-        
-        m_orderedCommands.push_back(renderCommand.get());
-        m_renderCommands.push_back(std::move(renderCommand));
+        AddCommand<ApplySkinnedAnimationRenderCommand>(renderSkinnedAnimation);
     }
     
     //------------------------------------------------------------------------------
     void RenderCommandList::AddRenderInstanceCommand(const Matrix4& worldMatrix) noexcept
     {
-        RenderCommandUPtr renderCommand(new RenderInstanceRenderCommand(worldMatrix));
+        AddCommand<RenderInstanceRenderCommand>(worldMatrix);
+    }
+    
+    //------------------------------------------------------------------------------
+    void RenderCommandList::AddRenderInstancesCommand(const Matrix4* worldMatrices, u32 numInstances) noexcept
+    {
+        static_assert(alignof(Matrix4) <= k_commandAlignment, "Matrix alignment is too large for the command stream.");
+        static_assert(sizeof(Matrix4) % k_commandAlignment == 0, "Matrix size must preserve command alignment.");
         
-        m_orderedCommands.push_back(renderCommand.get());
-        m_renderCommands.push_back(std::move(renderCommand));
+        constexpr u32 k_commandSize = u32((sizeof(RenderInstancesRenderCommand) + k_commandAlignment - 1) & ~(k_commandAlignment - 1));
+        
+        CS_ASSERT(numInstances > 0 && numInstances <= RenderInstancesRenderCommand::k_maxInstances, "Invalid number of instances.");
+        
+        // The instance buffer is stored in the stream directly after the command so it is
+        // released along with the rest of the list.
+        u32 stride = k_commandSize + numInstances * u32(sizeof(Matrix4));
+        auto memory = reinterpret_cast<u8*>(Reserve(stride));
+        
+        auto instanceBuffer = reinterpret_cast<Matrix4*>(memory + k_commandSize);
+        std::copy(worldMatrices, worldMatrices + numInstances, instanceBuffer);
+        
+        auto renderCommand = new (memory) RenderInstancesRenderCommand(instanceBuffer, numInstances);
+        renderCommand->m_streamStride = stride;
+        
+        ++m_numCommands;
     }
     
     //------------------------------------------------------------------------------
     void RenderCommandList::AddEndCommand() noexcept
     {
-        RenderCommandUPtr renderCommand(new EndRenderCommand());
-        
-        m_orderedCommands.push_back(renderCommand.get());
-        m_renderCommands.push_back(std::move(renderCommand));
+        AddCommand<EndRenderCommand>();
     }
     
     //------------------------------------------------------------------------------
     void RenderCommandList::AddUnloadTargetGroupCommand(RenderTargetGroupUPtr renderTargetGroup) noexcept
     {
-        RenderCommandUPtr renderCommand(new UnloadTargetGroupRenderCommand(std::move(renderTargetGroup)));
-        
-        m_orderedCommands.push_back(renderCommand.get());
-        m_renderCommands.push_back(std::move(renderCommand));
+        AddCommand<UnloadTargetGroupRenderCommand>(std::move(renderTargetGroup));
     }
 
     //------------------------------------------------------------------------------
     void RenderCommandList::AddUnloadMeshCommand(RenderMeshUPtr renderMesh) noexcept
     {
-        RenderCommandUPtr renderCommand(new UnloadMeshRenderCommand(std::move(renderMesh)));
-        
-        m_orderedCommands.push_back(renderCommand.get());
-        m_renderCommands.push_back(std::move(renderCommand));
+        AddCommand<UnloadMeshRenderCommand>(std::move(renderMesh));
     }
     
     //------------------------------------------------------------------------------
     void RenderCommandList::AddUnloadMaterialGroupCommand(RenderMaterialGroupUPtr renderMaterialGroup) noexcept
     {
-        RenderCommandUPtr renderCommand(new UnloadMaterialGroupRenderCommand(std::move(renderMaterialGroup)));
-        
-        m_orderedCommands.push_back(renderCommand.get());
-        m_renderCommands.push_back(std::move(renderCommand));
+        AddCommand<UnloadMaterialGroupRenderCommand>(std::move(renderMaterialGroup));
     }
     
     //------------------------------------------------------------------------------
     void RenderCommandList::AddUnloadTextureCommand(RenderTextureUPtr renderTexture) noexcept
     {
-        RenderCommandUPtr renderCommand(new UnloadTextureRenderCommand(std::move(renderTexture)));
-        
-        m_orderedCommands.push_back(renderCommand.get());
-        m_renderCommands.push_back(std::move(renderCommand));
+        AddCommand<UnloadTextureRenderCommand>(std::move(renderTexture));
     }
     
     //------------------------------------------------------------------------------
     void RenderCommandList::AddUnloadShaderCommand(RenderShaderUPtr renderShader) noexcept
     {
-        RenderCommandUPtr renderCommand(new UnloadShaderRenderCommand(std::move(renderShader)));
+        AddCommand<UnloadShaderRenderCommand>(std::move(renderShader));
+    }
+    //------------------------------------------------------------------------------
+    RenderCommandList::Iterator RenderCommandList::begin() noexcept
+    {
+        if (!m_firstBlock)
+        {
+            return end();
+        }
+        
+        return Iterator(m_firstBlock->GetStart(), m_firstBlock->GetStart() + m_firstBlock->m_size, m_firstBlock->m_next);
+    }
+    
+    //------------------------------------------------------------------------------
+    RenderCommandList::ConstIterator RenderCommandList::begin() const noexcept
+    {
+        if (!m_firstBlock)
+        {
+            return end();
+        }
+        
+        return ConstIterator(m_firstBlock->GetStart(), m_firstBlock->GetStart() + m_firstBlock->m_size, m_firstBlock->m_next);
+    }
+    
+    //------------------------------------------------------------------------------
+    void* RenderCommandList::Reserve(u32 size) noexcept
+    {
+        static_assert(sizeof(Block) % k_commandAlignment == 0, "Block header must preserve command alignment.");
+        
+        if (!m_lastBlock || m_lastBlock->m_capacity - m_lastBlock->m_size < size)
+        {
+            u32 capacity = m_lastBlock ? std::min(m_lastBlock->m_capacity * 2, k_maxBlockSize) : k_minBlockSize;
+            capacity = std::max(capacity, size);
+            
+            void* memory = nullptr;
+            if (m_allocatorMutex)
+            {
+                std::unique_lock<std::mutex> lock(*m_allocatorMutex);
+                memory = m_allocator->Allocate(sizeof(Block) + capacity);
+            }
+            else
+            {
+                memory = m_allocator->Allocate(sizeof(Block) + capacity);
+            }
+            
+            auto block = reinterpret_cast<Block*>(memory);
+            block->m_next = nullptr;
+            block->m_capacity = capacity;
+            block->m_size = 0;
+            
+            if (m_lastBlock)
+            {
+                m_lastBlock->m_next = block;
+            }
+            else
+            {
+                m_firstBlock = block;
+            }
+            
+            m_lastBlock = block;
+        }
+        
+        void* output = m_lastBlock->GetStart() + m_lastBlock->m_size;
+        m_lastBlock->m_size += size;
         
-        m_orderedCommands.push_back(renderCommand.get());
-        m_renderCommands.push_back(std::move(renderCommand));
+        return output;
     }
+    
     //------------------------------------------------------------------------------
-    RenderCommand* RenderCommandList::GetCommand(u32 index) noexcept
+    void RenderCommandList::Clear() noexcept
     {
-        CS_ASSERT(index < GetNumCommands(), "Index out of bounds.");
+        auto block = m_firstBlock;
+        while (block)
+        {
+            auto next = block->m_next;
+            
+            auto position = block->GetStart();
+            auto blockEnd = position + block->m_size;
+            while (position < blockEnd)
+            {
+                auto renderCommand = reinterpret_cast<RenderCommand*>(position);
+                position += renderCommand->m_streamStride;
+                
+                DestroyCommand(renderCommand);
+            }
+            
+            if (m_allocatorMutex)
+            {
+                std::unique_lock<std::mutex> lock(*m_allocatorMutex);
+                m_allocator->Deallocate(block);
+            }
+            else
+            {
+                m_allocator->Deallocate(block);
+            }
+            
+            block = next;
+        }
         
-        return m_renderCommands[index].get();
+        m_firstBlock = nullptr;
+        m_lastBlock = nullptr;
+        m_numCommands = 0;
+    }
+    
+    //------------------------------------------------------------------------------
+    RenderCommandList::~RenderCommandList() noexcept
+    {
+        Clear();
     }
 }
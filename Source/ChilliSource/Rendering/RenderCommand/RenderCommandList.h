@@ -26,26 +26,66 @@
 #define _CHILLISOURCE_RENDERING_RENDERCOMMAND_RENDERCOMMANDLIST_H_
 
 #include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Rendering/Lighting/DirectionalRenderLight.h>
 #include <ChilliSource/Rendering/RenderCommand/RenderCommand.h>
 
-#include <vector>
+#include <array>
+#include <mutex>
 
 namespace ChilliSource
 {
     /// Provides the ability to create an ordered list of render commands. Commands are
-    /// created contiguously in memory to improve cache locality and reduce fragmentation.
+    /// stored as a linear, tagged command stream: each command is constructed in place
+    /// directly after the previous one, in blocks allocated from the frame allocator.
+    /// The type of each command acts as its tag, allowing the stream to be walked
+    /// sequentially without virtual calls or per-command heap allocations.
     ///
     /// This is not thread-safe and therefore should only be accessed from one thread
-    /// at a time.
+    /// at a time. Multiple lists may share a frame allocator across threads if they
+    /// are given the same allocator mutex.
     ///
     class RenderCommandList final
     {
+        struct Block;
+        
     public:
         CS_DECLARE_NOCOPY(RenderCommandList);
         
-        RenderCommandList() = default;
-        RenderCommandList(RenderCommandList&&) = default;
-        RenderCommandList& operator=(RenderCommandList&&) = default;
+        /// A forward iterator over the commands in the list.
+        ///
+        template <typename TRenderCommand> class IteratorBase final
+        {
+        public:
+            IteratorBase(u8* position, u8* blockEnd, const Block* nextBlock) noexcept;
+            
+            TRenderCommand* operator*() const noexcept { return reinterpret_cast<TRenderCommand*>(m_position); }
+            IteratorBase& operator++() noexcept;
+            bool operator==(const IteratorBase& other) const noexcept { return m_position == other.m_position; }
+            bool operator!=(const IteratorBase& other) const noexcept { return m_position != other.m_position; }
+            
+        private:
+            u8* m_position;
+            u8* m_blockEnd;
+            const Block* m_nextBlock;
+        };
+        
+        using Iterator = IteratorBase<RenderCommand>;
+        using ConstIterator = IteratorBase<const RenderCommand>;
+        
+        /// Creates a new empty render command list.
+        ///
+        /// @param allocator
+        ///     The allocator from which the command stream should be allocated. This should
+        ///     typically be the frame allocator, and must outlive the list.
+        /// @param allocatorMutex
+        ///     (Optional) A mutex which is locked whenever the allocator is accessed. This
+        ///     should be provided if the allocator is shared with lists populated on other
+        ///     threads.
+        ///
+        RenderCommandList(IAllocator* allocator, std::mutex* allocatorMutex = nullptr) noexcept;
+        
+        RenderCommandList(RenderCommandList&& toMove) noexcept;
+        RenderCommandList& operator=(RenderCommandList&& toMove) noexcept;
         
         /// Creates and adds a new load shader command to the render command list.
         ///
@@ -66,8 +106,27 @@ namespace ChilliSource
         ///     The data describing the texture.
         /// @param textureDataSize
         ///     The size of the texture data in bytes.
+        /// @param firstMipLevel
+        ///     The first mip level contained in the texture data.
         ///
-        void AddLoadTextureCommand(RenderTexture* renderTexture, std::unique_ptr<const u8[]> textureData, u32 textureDataSize) noexcept;
+        void AddLoadTextureCommand(RenderTexture* renderTexture, std::unique_ptr<const u8[]> textureData, u32 textureDataSize, u32 firstMipLevel) noexcept;
+        
+        /// Creates and adds a new stream texture command to the render command list.
+        ///
+        /// @param renderTexture
+        ///     The render texture that should be streamed to.
+        /// @param textureData
+        ///     The row data for the mip level.
+        /// @param textureDataSize
+        ///     The size of the texture data in bytes.
+        /// @param firstMipLevel
+        ///     The first mip level of the chain which is being built.
+        /// @param mipLevel
+        ///     The mip level the texture data belongs to.
+        /// @param firstRow
+        ///     The first row of the mip level contained in the texture data.
+        ///
+        void AddStreamTextureCommand(RenderTexture* renderTexture, std::unique_ptr<const u8[]> textureData, u32 textureDataSize, u32 firstMipLevel, u32 mipLevel, u32 firstRow) noexcept;
         
         /// Creates and adds a new load material group command to the render command list.
         ///
@@ -160,16 +219,18 @@ namespace ChilliSource
         ///     The colour of the light.
         /// @param direction
         ///     The direction of the light.
-        /// @param lightViewProjection
-        ///     The view projection matrix of the light which is used as the camera when rendering
-        ///     the shadow map.
+        /// @param lightViewProjections
+        ///     The view projection matrix of the light for each shadow cascade, which is used as the
+        ///     camera when rendering the shadow map.
         /// @param shadowTolerance
         ///     The tolerence used to judge if an object is in shadow.
-        /// @param shadowMapRenderTexture
-        ///     The render texture which should be used for the shadow map. Can be null if there is no
-        ///     shadow map.
+        /// @param shadowMapRenderTextures
+        ///     The render texture which should be used for the shadow map of each cascade.
+        /// @param numShadowMaps
+        ///     The number of shadow maps. Can be zero if there is no shadow map.
         ///
-        void AddApplyDirectionalLightCommand(const Colour& colour, const Vector3& direction, const Matrix4& lightViewProjection, f32 shadowTolerance, const RenderTexture* shadowMapRenderTexture) noexcept;
+        void AddApplyDirectionalLightCommand(const Colour& colour, const Vector3& direction, const std::array<Matrix4, DirectionalRenderLight::k_maxShadowCascades>& lightViewProjections, f32 shadowTolerance,
+                                             const std::array<const RenderTexture*, DirectionalRenderLight::k_maxShadowCascades>& shadowMapRenderTextures, u32 numShadowMaps) noexcept;
         
         /// Creates and adds a new apply point light command to the render command list.
         ///
@@ -225,6 +286,17 @@ namespace ChilliSource
         ///
         void AddRenderInstanceCommand(const Matrix4& worldMatrix) noexcept;
         
+        /// Creates and adds a new render instances command to the render command list. The
+        /// world matrices are copied into the command stream.
+        ///
+        /// @param worldMatrices
+        ///     The world matrices of each instance.
+        /// @param numInstances
+        ///     The number of instances. Must be no greater than
+        ///     RenderInstancesRenderCommand::k_maxInstances.
+        ///
+        void AddRenderInstancesCommand(const Matrix4* worldMatrices, u32 numInstances) noexcept;
+        
         /// Creates and adds a new end command to the render command list.
         ///
         void AddEndCommand() noexcept;
@@ -266,20 +338,97 @@ namespace ChilliSource
 
         /// @return The number of render commands in the list.
         ///
-        u32 GetNumCommands() const noexcept { return u32(m_renderCommands.size()); }
+        u32 GetNumCommands() const noexcept { return m_numCommands; }
+        
+        /// @return An iterator pointing to the first command in the list.
+        ///
+        Iterator begin() noexcept;
         
-        /// @return The ordered list of render commands.
+        /// @return An iterator pointing past the last command in the list.
         ///
-        const std::vector<const RenderCommand*>& GetOrderedList() const noexcept { return m_orderedCommands; };
+        Iterator end() noexcept { return Iterator(nullptr, nullptr, nullptr); }
         
-        /// @return The RenderCommand at the given index
+        /// @return A const iterator pointing to the first command in the list.
         ///
-        RenderCommand* GetCommand(u32 index) noexcept;
+        ConstIterator begin() const noexcept;
+        
+        /// @return A const iterator pointing past the last command in the list.
+        ///
+        ConstIterator end() const noexcept { return ConstIterator(nullptr, nullptr, nullptr); }
+        
+        ~RenderCommandList() noexcept;
         
     private:
-        std::vector<const RenderCommand*> m_orderedCommands;
-        std::vector<RenderCommandUPtr> m_renderCommands; //TODO: This should be changed to a series of pools of individial render command types.
+        /// The header of a block in the command stream. The commands in the block directly
+        /// follow the header.
+        ///
+        struct Block
+        {
+            Block* m_next;
+            u32 m_capacity;
+            u32 m_size;
+            
+            /// @return The start of the commands in the block.
+            ///
+            u8* GetStart() const noexcept { return reinterpret_cast<u8*>(const_cast<Block*>(this)) + sizeof(Block); }
+        };
+        
+        /// Constructs a new command of the given type at the end of the command stream.
+        ///
+        /// @param args
+        ///     The arguments to the constructor of the command.
+        ///
+        template <typename TRenderCommand, typename... TArgs> void AddCommand(TArgs&&... args) noexcept;
+        
+        /// Reserves space for a command of the given size at the end of the stream, allocating
+        /// a new block if required.
+        ///
+        /// @param size
+        ///     The size of the command, which must already be aligned.
+        ///
+        /// @return The memory for the new command.
+        ///
+        void* Reserve(u32 size) noexcept;
+        
+        /// Destroys all commands in the list and returns the blocks to the allocator.
+        ///
+        void Clear() noexcept;
+        
+        IAllocator* m_allocator;
+        std::mutex* m_allocatorMutex;
+        Block* m_firstBlock = nullptr;
+        Block* m_lastBlock = nullptr;
+        u32 m_numCommands = 0;
     };
+    
+    //------------------------------------------------------------------------------
+    template <typename TRenderCommand> RenderCommandList::IteratorBase<TRenderCommand>::IteratorBase(u8* position, u8* blockEnd, const Block* nextBlock) noexcept
+        : m_position(position), m_blockEnd(blockEnd), m_nextBlock(nextBlock)
+    {
+    }
+    
+    //------------------------------------------------------------------------------
+    template <typename TRenderCommand> RenderCommandList::IteratorBase<TRenderCommand>& RenderCommandList::IteratorBase<TRenderCommand>::operator++() noexcept
+    {
+        m_position += reinterpret_cast<const RenderCommand*>(m_position)->m_streamStride;
+        
+        if (m_position >= m_blockEnd)
+        {
+            if (m_nextBlock)
+            {
+                m_position = m_nextBlock->GetStart();
+                m_blockEnd = m_position + m_nextBlock->m_size;
+                m_nextBlock = m_nextBlock->m_next;
+            }
+            else
+            {
+                m_position = nullptr;
+                m_blockEnd = nullptr;
+            }
+        }
+        
+        return *this;
+    }
 }
 
 #endif
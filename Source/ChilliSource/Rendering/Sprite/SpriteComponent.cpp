@@ -170,6 +170,8 @@ namespace ChilliSource
     //----------------------------------------------------
     const AABB& SpriteComponent::GetAABB()
     {
+        ResolveTransformChanges();
+        
         if(IsTextureSizeCacheValid() == false)
         {
             OnTransformChanged();
@@ -195,6 +197,8 @@ namespace ChilliSource
     //----------------------------------------------------
     const OOBB& SpriteComponent::GetOOBB()
     {
+        ResolveTransformChanges();
+        
         if(IsTextureSizeCacheValid() == false)
         {
             OnTransformChanged();
@@ -221,6 +225,8 @@ namespace ChilliSource
     //----------------------------------------------------
     const Sphere& SpriteComponent::GetBoundingSphere()
     {
+        ResolveTransformChanges();
+        
         if(IsTextureSizeCacheValid() == false)
         {
             OnTransformChanged();
@@ -292,6 +298,9 @@ namespace ChilliSource
     void SpriteComponent::SetMaterial(const MaterialCSPtr& in_material)
     {
         mpMaterial = in_material;
+        
+        //the size of the sprite may depend on the material's texture
+        InvalidateVolume();
     }
     //-----------------------------------------------------------
     //-----------------------------------------------------------
@@ -395,6 +404,8 @@ namespace ChilliSource
         m_isBSValid = false;
         m_isAABBValid = false;
         m_isOOBBValid = false;
+        
+        InvalidateVolume();
     }
     //-----------------------------------------------------------
     //-----------------------------------------------------------
@@ -24,12 +24,76 @@
 
 #include <ChilliSource/Rendering/Texture/RenderTexture.h>
 
+#include <algorithm>
+
 namespace ChilliSource
 {
+    namespace
+    {
+        /// @param imageFormat
+        ///     The image format.
+        ///
+        /// @return The number of bytes per pixel for the given uncompressed image format.
+        ///
+        u32 GetBytesPerPixel(ImageFormat imageFormat) noexcept
+        {
+            switch (imageFormat)
+            {
+                case ImageFormat::k_Lum8:
+                    return 1;
+                case ImageFormat::k_RGBA4444:
+                case ImageFormat::k_RGB565:
+                case ImageFormat::k_LumA88:
+                case ImageFormat::k_Depth16:
+                    return 2;
+                case ImageFormat::k_RGB888:
+                    return 3;
+                case ImageFormat::k_RGBA8888:
+                case ImageFormat::k_Depth32:
+                    return 4;
+                default:
+                    CS_LOG_FATAL("Invalid image format.");
+                    return 0;
+            }
+        }
+    }
+    
     //------------------------------------------------------------------------------
     RenderTexture::RenderTexture(const Integer2& dimensions, ImageFormat imageFormat, ImageCompression imageCompression, TextureFilterMode filterMode, TextureWrapMode wrapModeS,  TextureWrapMode wrapModeT,
-                                 bool isMipmapped, bool shouldBackupData) noexcept
-        : m_dimensions(dimensions), m_imageFormat(imageFormat), m_imageCompression(imageCompression), m_filterMode(filterMode), m_wrapModeS(wrapModeS), m_wrapModeT(wrapModeT), m_isMipmapped(isMipmapped), m_shouldBackupData(shouldBackupData)
+                                 bool isMipmapped, u32 numMipLevels, bool shouldBackupData) noexcept
+        : m_dimensions(dimensions), m_imageFormat(imageFormat), m_imageCompression(imageCompression), m_filterMode(filterMode), m_wrapModeS(wrapModeS), m_wrapModeT(wrapModeT), m_isMipmapped(isMipmapped),
+          m_numMipLevels(numMipLevels), m_shouldBackupData(shouldBackupData)
+    {
+        CS_ASSERT(m_numMipLevels > 0, "A render texture must have at least one mip level.");
+        CS_ASSERT(m_numMipLevels == 1 || m_imageCompression == ImageCompression::k_none, "Precomputed mip levels are only supported for uncompressed textures.");
+    }
+    
+    //------------------------------------------------------------------------------
+    Integer2 RenderTexture::GetMipLevelDimensions(u32 mipLevel) const noexcept
+    {
+        CS_ASSERT(mipLevel < m_numMipLevels, "Mip level out of bounds.");
+        
+        return Integer2(std::max(m_dimensions.x >> mipLevel, 1), std::max(m_dimensions.y >> mipLevel, 1));
+    }
+    
+    //------------------------------------------------------------------------------
+    u32 RenderTexture::GetMipLevelDataSize(u32 mipLevel) const noexcept
+    {
+        CS_ASSERT(m_imageCompression == ImageCompression::k_none, "Mip level data size can only be calculated for uncompressed textures.");
+        
+        auto mipLevelDimensions = GetMipLevelDimensions(mipLevel);
+        return u32(mipLevelDimensions.x) * u32(mipLevelDimensions.y) * GetBytesPerPixel(m_imageFormat);
+    }
+    
+    //------------------------------------------------------------------------------
+    u32 RenderTexture::GetMipLevelDataOffset(u32 mipLevel) const noexcept
     {
+        u32 offset = 0;
+        for (u32 i = 0; i < mipLevel; ++i)
+        {
+            offset += GetMipLevelDataSize(i);
+        }
+        
+        return offset;
     }
 }
@@ -76,6 +76,39 @@ namespace ChilliSource
         ///
         bool IsMipmapped() const noexcept { return m_isMipmapped; }
         
+        /// @return The number of precomputed mip levels in the texture data, including the top
+        /// level. If this is 1 and the texture is mipmapped, mipmaps are generated on upload.
+        ///
+        u32 GetNumMipLevels() const noexcept { return m_numMipLevels; }
+        
+        /// @param mipLevel
+        ///     The index of the mip level, where 0 is the top level.
+        ///
+        /// @return The dimensions of the given mip level.
+        ///
+        Integer2 GetMipLevelDimensions(u32 mipLevel) const noexcept;
+        
+        /// Calculates the size of the tightly packed data for the given mip level. This is
+        /// only valid for uncompressed textures.
+        ///
+        /// @param mipLevel
+        ///     The index of the mip level, where 0 is the top level.
+        ///
+        /// @return The size of the data for the given mip level, in bytes.
+        ///
+        u32 GetMipLevelDataSize(u32 mipLevel) const noexcept;
+        
+        /// Calculates the offset of the given mip level within texture data containing the
+        /// full chain of precomputed mip levels, stored largest first. This is only valid for
+        /// uncompressed textures.
+        ///
+        /// @param mipLevel
+        ///     The index of the mip level, where 0 is the top level.
+        ///
+        /// @return The offset of the data for the given mip level, in bytes.
+        ///
+        u32 GetMipLevelDataOffset(u32 mipLevel) const noexcept;
+        
         /// @return If the mesh should backup its data.
         ///
         bool ShouldBackupData() const noexcept { return m_shouldBackupData; }
@@ -111,11 +144,14 @@ namespace ChilliSource
         /// @param wrapModeT
         ///     The t-coordinate wrap mode.
         /// @param isMipmapped
-        ///     Whether or not mipmaps are generated for the texture.
+        ///     Whether or not the texture is mipmapped.
+        /// @param numMipLevels
+        ///     The number of precomputed mip levels in the texture data, including the top level.
         /// @param shouldBackupData
         ///     If the mesh data should be backed up in main memory for restoring it later.
         ///
-        RenderTexture(const Integer2& dimensions, ImageFormat imageFormat, ImageCompression imageCompression, TextureFilterMode filterMode, TextureWrapMode wrapModeS, TextureWrapMode wrapModeT, bool isMipmapped, bool shouldBackupData) noexcept;
+        RenderTexture(const Integer2& dimensions, ImageFormat imageFormat, ImageCompression imageCompression, TextureFilterMode filterMode, TextureWrapMode wrapModeS, TextureWrapMode wrapModeT, bool isMipmapped,
+                      u32 numMipLevels, bool shouldBackupData) noexcept;
         
         Integer2 m_dimensions;
         ImageFormat m_imageFormat;
@@ -124,6 +160,7 @@ namespace ChilliSource
         TextureWrapMode m_wrapModeS;
         TextureWrapMode m_wrapModeT;
         bool m_isMipmapped;
+        u32 m_numMipLevels;
         bool m_shouldBackupData = true;
         void* m_extraData = nullptr;
     };
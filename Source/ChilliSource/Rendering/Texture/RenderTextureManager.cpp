@@ -26,8 +26,100 @@
 
 #include <ChilliSource/Rendering/Base/RenderSnapshot.h>
 
+#include <algorithm>
+#include <cstring>
+
 namespace ChilliSource
 {
+    namespace
+    {
+        constexpr s32 k_maxInitialStreamingMipLevelSize = 64;
+        constexpr u32 k_streamingBudgetPerSnapshot = 4 * 1024 * 1024;
+        
+        /// Calculates the first mip level that should be loaded for a streamed texture. This
+        /// is the largest level that is no larger than the maximum initial streaming size.
+        ///
+        /// @param renderTexture
+        ///     The streamed render texture.
+        ///
+        /// @return The first mip level to load.
+        ///
+        u32 CalcInitialStreamingMipLevel(const RenderTexture* renderTexture) noexcept
+        {
+            u32 mipLevel = 0;
+            while (mipLevel + 1 < renderTexture->GetNumMipLevels())
+            {
+                auto dimensions = renderTexture->GetMipLevelDimensions(mipLevel);
+                if (dimensions.x <= k_maxInitialStreamingMipLevelSize && dimensions.y <= k_maxInitialStreamingMipLevelSize)
+                {
+                    break;
+                }
+                
+                ++mipLevel;
+            }
+            
+            return mipLevel;
+        }
+        
+        /// Copies the data for the given mip level and all smaller levels out of texture data
+        /// containing the full precomputed mip chain.
+        ///
+        /// @param renderTexture
+        ///     The render texture the data is for.
+        /// @param textureData
+        ///     The texture data containing the full mip chain.
+        /// @param textureDataSize
+        ///     The size of the texture data.
+        /// @param firstMipLevel
+        ///     The first mip level to copy.
+        /// @param [Out] outDataSize
+        ///     The size of the copied data.
+        ///
+        /// @return The copied data.
+        ///
+        std::unique_ptr<const u8[]> CopyMipLevels(const RenderTexture* renderTexture, const u8* textureData, u32 textureDataSize, u32 firstMipLevel, u32& outDataSize) noexcept
+        {
+            auto offset = renderTexture->GetMipLevelDataOffset(firstMipLevel);
+            CS_ASSERT(offset < textureDataSize, "Texture data does not contain the requested mip level.");
+            
+            outDataSize = textureDataSize - offset;
+            
+            u8* data = new u8[outDataSize];
+            std::memcpy(data, textureData + offset, outDataSize);
+            return std::unique_ptr<const u8[]>(data);
+        }
+        
+        /// Copies a band of rows for a single mip level out of texture data containing the full
+        /// precomputed mip chain.
+        ///
+        /// @param renderTexture
+        ///     The render texture the data is for.
+        /// @param textureData
+        ///     The texture data containing the full mip chain.
+        /// @param mipLevel
+        ///     The mip level to copy from.
+        /// @param firstRow
+        ///     The first row to copy.
+        /// @param numRows
+        ///     The number of rows to copy.
+        /// @param [Out] outDataSize
+        ///     The size of the copied data.
+        ///
+        /// @return The copied data.
+        ///
+        std::unique_ptr<const u8[]> CopyMipLevelRows(const RenderTexture* renderTexture, const u8* textureData, u32 mipLevel, u32 firstRow, u32 numRows, u32& outDataSize) noexcept
+        {
+            auto rowSize = renderTexture->GetMipLevelDataSize(mipLevel) / u32(renderTexture->GetMipLevelDimensions(mipLevel).y);
+            auto offset = renderTexture->GetMipLevelDataOffset(mipLevel) + firstRow * rowSize;
+            
+            outDataSize = numRows * rowSize;
+            
+            u8* data = new u8[outDataSize];
+            std::memcpy(data, textureData + offset, outDataSize);
+            return std::unique_ptr<const u8[]>(data);
+        }
+    }
+    
     CS_DEFINE_NAMEDTYPE(RenderTextureManager);
 
     //------------------------------------------------------------------------------
@@ -44,20 +136,45 @@ namespace ChilliSource
         
     //------------------------------------------------------------------------------
     const RenderTexture* RenderTextureManager::CreateRenderTexture(std::unique_ptr<const u8[]> textureData, u32 textureDataSize, const Integer2& dimensions, ImageFormat imageFormat, ImageCompression imageCompression,
-                                             TextureFilterMode filterMode, TextureWrapMode wrapModeS, TextureWrapMode wrapModeT, bool isMipmapped, bool shouldBackupData) noexcept
+                                             TextureFilterMode filterMode, TextureWrapMode wrapModeS, TextureWrapMode wrapModeT, bool isMipmapped, u32 numMipLevels, bool isStreamed, bool shouldBackupData) noexcept
     {
-        RenderTextureUPtr renderTexture(new RenderTexture(dimensions, imageFormat, imageCompression, filterMode, wrapModeS, wrapModeT, isMipmapped, shouldBackupData));
+        RenderTextureUPtr renderTexture(new RenderTexture(dimensions, imageFormat, imageCompression, filterMode, wrapModeS, wrapModeT, isMipmapped, numMipLevels, shouldBackupData));
         auto rawRenderTexture = renderTexture.get();
         
         PendingLoadCommand loadCommand;
-        loadCommand.m_textureData = std::move(textureData);
-        loadCommand.m_textureDataSize = textureDataSize;
         loadCommand.m_renderTexture = rawRenderTexture;
         
+        StreamingTexture streamingTexture;
+        if (isStreamed && textureData && numMipLevels > 1)
+        {
+            loadCommand.m_firstMipLevel = CalcInitialStreamingMipLevel(rawRenderTexture);
+        }
+        
+        if (loadCommand.m_firstMipLevel > 0)
+        {
+            loadCommand.m_textureData = CopyMipLevels(rawRenderTexture, textureData.get(), textureDataSize, loadCommand.m_firstMipLevel, loadCommand.m_textureDataSize);
+            
+            streamingTexture.m_textureData = std::move(textureData);
+            streamingTexture.m_textureDataSize = textureDataSize;
+            streamingTexture.m_firstMipLevel = loadCommand.m_firstMipLevel - 1;
+            streamingTexture.m_mipLevel = numMipLevels - 1;
+            streamingTexture.m_renderTexture = rawRenderTexture;
+        }
+        else
+        {
+            loadCommand.m_textureData = std::move(textureData);
+            loadCommand.m_textureDataSize = textureDataSize;
+        }
+        
         std::unique_lock<std::mutex> lock(m_mutex);
         m_renderTextures.push_back(std::move(renderTexture));
         m_pendingLoadCommands.push_back(std::move(loadCommand));
         
+        if (streamingTexture.m_renderTexture)
+        {
+            m_streamingTextures.push_back(std::move(streamingTexture));
+        }
+        
         return rawRenderTexture;
     }
     
@@ -66,6 +183,15 @@ namespace ChilliSource
     {
         std::unique_lock<std::mutex> lock(m_mutex);
         
+        for (auto it = m_streamingTextures.begin(); it != m_streamingTextures.end(); ++it)
+        {
+            if (it->m_renderTexture == renderTexture)
+            {
+                m_streamingTextures.erase(it);
+                break;
+            }
+        }
+        
         for (auto it = m_renderTextures.begin(); it != m_renderTextures.end(); ++it)
         {
             if (it->get() == renderTexture)
@@ -91,10 +217,73 @@ namespace ChilliSource
         
         for (auto& loadCommand : m_pendingLoadCommands)
         {
-            preRenderCommandList->AddLoadTextureCommand(loadCommand.m_renderTexture, std::move(loadCommand.m_textureData), loadCommand.m_textureDataSize);
+            preRenderCommandList->AddLoadTextureCommand(loadCommand.m_renderTexture, std::move(loadCommand.m_textureData), loadCommand.m_textureDataSize, loadCommand.m_firstMipLevel);
         }
         m_pendingLoadCommands.clear();
         
+        //Streaming textures are refined in the order they were created, a band of rows at a
+        //time, until the budget is used up. Each chain is streamed smallest level first and is
+        //only displayed once complete. Refinement starts the snapshot after the initial load.
+        u32 streamedDataSize = 0;
+        for (auto& streamingTexture : m_streamingTextures)
+        {
+            if (streamingTexture.m_isInitialLoadPending)
+            {
+                streamingTexture.m_isInitialLoadPending = false;
+                continue;
+            }
+            
+            auto renderTexture = streamingTexture.m_renderTexture;
+            while (streamingTexture.m_textureData)
+            {
+                auto numRows = u32(renderTexture->GetMipLevelDimensions(streamingTexture.m_mipLevel).y);
+                auto rowSize = renderTexture->GetMipLevelDataSize(streamingTexture.m_mipLevel) / numRows;
+                auto numRowsInBudget = (k_streamingBudgetPerSnapshot - streamedDataSize) / rowSize;
+                if (numRowsInBudget == 0)
+                {
+                    break;
+                }
+                
+                auto firstRow = streamingTexture.m_nextRow;
+                auto numStreamedRows = std::min(numRows - firstRow, numRowsInBudget);
+                
+                u32 textureDataSize = 0;
+                auto textureData = CopyMipLevelRows(renderTexture, streamingTexture.m_textureData.get(), streamingTexture.m_mipLevel, firstRow, numStreamedRows, textureDataSize);
+                preRenderCommandList->AddStreamTextureCommand(renderTexture, std::move(textureData), textureDataSize, streamingTexture.m_firstMipLevel, streamingTexture.m_mipLevel, firstRow);
+                streamedDataSize += textureDataSize;
+                
+                streamingTexture.m_nextRow += numStreamedRows;
+                if (streamingTexture.m_nextRow == numRows)
+                {
+                    streamingTexture.m_nextRow = 0;
+                    
+                    if (streamingTexture.m_mipLevel > streamingTexture.m_firstMipLevel)
+                    {
+                        --streamingTexture.m_mipLevel;
+                    }
+                    else if (streamingTexture.m_firstMipLevel > 0)
+                    {
+                        --streamingTexture.m_firstMipLevel;
+                        streamingTexture.m_mipLevel = renderTexture->GetNumMipLevels() - 1;
+                    }
+                    else
+                    {
+                        streamingTexture.m_textureData.reset();
+                    }
+                }
+            }
+            
+            if (streamingTexture.m_textureData)
+            {
+                break;
+            }
+        }
+        
+        m_streamingTextures.erase(std::remove_if(m_streamingTextures.begin(), m_streamingTextures.end(), [](const StreamingTexture& streamingTexture)
+        {
+            return !streamingTexture.m_textureData;
+        }), m_streamingTextures.end());
+        
         for (auto& unloadCommand : m_pendingUnloadCommands)
         {
             postRenderCommandList->AddUnloadTextureCommand(std::move(unloadCommand));
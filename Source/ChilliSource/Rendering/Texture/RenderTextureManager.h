@@ -39,6 +39,12 @@ namespace ChilliSource
     /// snapshot phase, ensuring that related textured data is processed before the RenderTexture
     /// is used.
     ///
+    /// Streamed textures with precomputed mip levels are loaded in a number of steps. The first
+    /// load command contains only the smallest mip levels. Each refinement then builds a chain
+    /// one level larger, which is streamed in bands of rows over later render snapshots and
+    /// replaces the loaded chain once complete. The amount of data streamed per snapshot is
+    /// limited to spread the upload cost over frames.
+    ///
     /// On deletion an UnloadTextureRenderCommand is queued and given ownership of the
     /// RenderTexture. The render texture is then deleted once the command has been processed.
     ///
@@ -82,14 +88,20 @@ namespace ChilliSource
         /// @param wrapModeT
         ///     The t-coordinate wrap mode.
         /// @param isMipmapped
-        ///     Whether or not mipmaps are generated for the texture.
+        ///     Whether or not the texture is mipmapped.
+        /// @param numMipLevels
+        ///     The number of precomputed mip levels in the texture data, including the top level.
+        ///     If this is 1 and the texture is mipmapped, mipmaps are generated on upload.
+        /// @param isStreamed
+        ///     Whether or not the precomputed mip levels should be streamed in over a number of
+        ///     render snapshots, smallest first. This has no effect if there is only one mip level.
         /// @param shouldBackupData
         ///     If the texture data should be backed up in main memory for restoring it later.
         ///
         /// @return The new render texture instance.
         ///
         const RenderTexture* CreateRenderTexture(std::unique_ptr<const u8[]> textureData, u32 textureDataSize, const Integer2& dimensions, ImageFormat imageFormat, ImageCompression imageCompression,
-                                           TextureFilterMode filterMode, TextureWrapMode wrapModeS, TextureWrapMode wrapModeT, bool isMipmapped, bool shouldBackupData) noexcept;
+                                           TextureFilterMode filterMode, TextureWrapMode wrapModeS, TextureWrapMode wrapModeT, bool isMipmapped, u32 numMipLevels, bool isStreamed, bool shouldBackupData) noexcept;
         
         /// Removes the render texture from the manager and queues an UnloadTextureRenderCommand for
         /// the next Render Snapshot stage in the render pipeline. The render command is given
@@ -107,12 +119,30 @@ namespace ChilliSource
         friend class Application;
         
         /// A container for information relating to pending texture load commands, such as the
-        /// texture data, data size and the related RenderTexture.
+        /// texture data, data size, first mip level contained in the data and the related
+        /// RenderTexture.
         ///
         struct PendingLoadCommand final
         {
             std::unique_ptr<const u8[]> m_textureData;
             u32 m_textureDataSize = 0;
+            u32 m_firstMipLevel = 0;
+            RenderTexture* m_renderTexture = nullptr;
+        };
+        
+        /// A container for information relating to a texture which is being streamed, such as
+        /// the full texture data, the first mip level of the chain which is being built, the
+        /// mip level and row which should be streamed next and whether the initial load is
+        /// still to be added to a render snapshot.
+        ///
+        struct StreamingTexture final
+        {
+            std::unique_ptr<const u8[]> m_textureData;
+            u32 m_textureDataSize = 0;
+            u32 m_firstMipLevel = 0;
+            u32 m_mipLevel = 0;
+            u32 m_nextRow = 0;
+            bool m_isInitialLoadPending = true;
             RenderTexture* m_renderTexture = nullptr;
         };
         
@@ -126,7 +156,8 @@ namespace ChilliSource
         RenderTextureManager() = default;
         
         /// Called during the Render Snapshot stage of the render pipeline. All pending load and
-        /// unload commands are added to the render snapshot.
+        /// unload commands are added to the render snapshot, along with as many rows of the
+        /// streaming textures as the per-snapshot streaming budget allows.
         ///
         /// @param renderSnapshot
         ///     The render shapshot for storing snapshotted data.
@@ -136,6 +167,7 @@ namespace ChilliSource
         std::mutex m_mutex;
         std::vector<RenderTextureUPtr> m_renderTextures; //TODO: This should be changed to an object pool.
         std::vector<PendingLoadCommand> m_pendingLoadCommands;
+        std::vector<StreamingTexture> m_streamingTextures;
         std::vector<RenderTextureUPtr> m_pendingUnloadCommands;
     };
 }
@@ -56,7 +56,8 @@ namespace ChilliSource
         m_restoreTextureDataEnabled = textureDesc.IsRestoreTextureDataEnabled();
         
         m_renderTexture = renderTextureManager->CreateRenderTexture(std::move(textureData), textureDataSize, textureDesc.GetDimensions(), textureDesc.GetImageFormat(), textureDesc.GetImageCompression(),
-                                                                    textureDesc.GetFilterMode(), textureDesc.GetWrapModeS(), textureDesc.GetWrapModeT(), textureDesc.IsMipmappingEnabled(), m_restoreTextureDataEnabled);
+                                                                    textureDesc.GetFilterMode(), textureDesc.GetWrapModeS(), textureDesc.GetWrapModeT(), textureDesc.IsMipmappingEnabled(), textureDesc.GetNumMipLevels(),
+                                                                    textureDesc.IsStreamingEnabled(), m_restoreTextureDataEnabled);
     }
 
     //------------------------------------------------------------------------------
@@ -45,6 +45,15 @@ namespace ChilliSource
     {
     }
 
+    //------------------------------------------------------------------------------
+    void TextureDesc::SetNumMipLevels(u32 numMipLevels) noexcept
+    {
+        CS_ASSERT(numMipLevels > 0, "A texture must have at least one mip level.");
+        CS_ASSERT(numMipLevels == 1 || m_imageCompression == ImageCompression::k_none, "Precomputed mip levels are only supported for uncompressed textures.");
+        
+        m_numMipLevels = numMipLevels;
+    }
+
     //------------------------------------------------------------------------------
     void TextureDesc::SetTextureDataRestoreEnabled(bool restoreTextureDataEnabled) noexcept
     {
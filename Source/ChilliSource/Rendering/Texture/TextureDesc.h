@@ -83,6 +83,26 @@ namespace ChilliSource
         ///
         void SetMipmappingEnabled(bool mipmappingEnabled) noexcept { m_mipmappingEnabled = mipmappingEnabled; };
         
+        /// Sets the number of precomputed mip levels contained in the texture data, including the
+        /// top level. The levels are stored largest first and tightly packed. If this is greater
+        /// than 1 mipmaps are no longer generated on upload. This is only supported for
+        /// uncompressed textures.
+        ///
+        /// @param numMipLevels
+        ///     The number of precomputed mip levels.
+        ///
+        void SetNumMipLevels(u32 numMipLevels) noexcept;
+        
+        /// Sets whether or not the texture should be streamed. A streamed texture with precomputed
+        /// mip levels uploads its smallest levels first and fills in the larger levels over later
+        /// frames, allowing it to be displayed sooner and spreading the cost of the upload. This
+        /// has no effect on textures without precomputed mip levels.
+        ///
+        /// @param streamingEnabled
+        ///     Whether or not the texture should be streamed.
+        ///
+        void SetStreamingEnabled(bool streamingEnabled) noexcept { m_streamingEnabled = streamingEnabled; };
+        
         /// Sets whether or not the texture data should be restored after a context loss. This involves
         /// maintaining a copy of the texture data in memory which is costly so this should be disabled
         /// for any textures that can easily be recreated, i.e any texture that is rendered into every
@@ -126,6 +146,15 @@ namespace ChilliSource
         ///
         bool IsMipmappingEnabled() const noexcept { return m_mipmappingEnabled; }
         
+        /// @return The number of precomputed mip levels contained in the texture data, including
+        /// the top level.
+        ///
+        u32 GetNumMipLevels() const noexcept { return m_numMipLevels; }
+        
+        /// @return Whether or not the texture should be streamed.
+        ///
+        bool IsStreamingEnabled() const noexcept { return m_streamingEnabled; }
+        
         /// @return Whether or not texture data should be restored on context loss.
         ///
         bool IsRestoreTextureDataEnabled() const noexcept { return m_restoreTextureDataEnabled; }
@@ -138,6 +167,8 @@ namespace ChilliSource
         TextureWrapMode m_wrapModeS = TextureWrapMode::k_clamp;
         TextureWrapMode m_wrapModeT = TextureWrapMode::k_clamp;
         bool m_mipmappingEnabled = false;
+        u32 m_numMipLevels = 1;
+        bool m_streamingEnabled = false;
         bool m_restoreTextureDataEnabled = true;
     };
 }
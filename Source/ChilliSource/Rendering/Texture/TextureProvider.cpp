@@ -35,8 +35,56 @@
 #include <ChilliSource/Rendering/Texture/TextureDesc.h>
 #include <ChilliSource/Rendering/Texture/TextureResourceOptions.h>
 
+#include <algorithm>
+
 namespace ChilliSource
 {
+    namespace
+    {
+        //-------------------------------------------------------
+        /// Builds the given texture from the given image using
+        /// the given options. If the image has precomputed mip
+        /// levels they are used when mip-maps are enabled and
+        /// otherwise only the top level is used.
+        ///
+        /// @param The image to build from
+        /// @param The image data, moved out of the image
+        /// @param The texture options
+        /// @param [Out] The texture
+        //-------------------------------------------------------
+        void BuildTexture(const ImageSPtr& in_image, Texture::DataUPtr in_data, const TextureResourceOptions* in_options, Texture* out_texture)
+        {
+            TextureDesc desc(Integer2(in_image->GetWidth(), in_image->GetHeight()), in_image->GetFormat(), in_image->GetCompression());
+            desc.SetFilterMode(in_options->GetFilterMode());
+            desc.SetWrapModeS(in_options->GetWrapModeS());
+            desc.SetWrapModeT(in_options->GetWrapModeT());
+            desc.SetMipmappingEnabled(in_options->IsMipMapsEnabled());
+            desc.SetTextureDataRestoreEnabled(false);
+            
+            u32 dataSize = in_image->GetDataSize();
+            if(in_image->GetNumMipLevels() > 1)
+            {
+                if(in_options->IsMipMapsEnabled())
+                {
+                    desc.SetNumMipLevels(in_image->GetNumMipLevels());
+                    desc.SetStreamingEnabled(in_options->IsStreamingEnabled());
+                }
+                else
+                {
+                    //The top level is stored first, so the rest of the chain can be ignored.
+                    u32 numPixels = 0;
+                    for(u32 i = 0; i < in_image->GetNumMipLevels(); ++i)
+                    {
+                        numPixels += std::max(in_image->GetWidth() >> i, 1u) * std::max(in_image->GetHeight() >> i, 1u);
+                    }
+                    dataSize = (dataSize / numPixels) * in_image->GetWidth() * in_image->GetHeight();
+                }
+            }
+            
+            out_texture->Build(std::move(in_data), dataSize, desc);
+        }
+    }
+    
     CS_DEFINE_NAMEDTYPE(TextureProvider);
     
     const IResourceOptionsBaseCSPtr TextureProvider::s_defaultOptions(std::make_shared<TextureResourceOptions>());
@@ -97,20 +145,20 @@ namespace ChilliSource
     //----------------------------------------------------------------------------
     void TextureProvider::CreateResourceFromFile(StorageLocation in_location, const std::string& in_filePath, const IResourceOptionsBaseCSPtr& in_options, const ResourceSPtr& out_resource)
     {
-        LoadTexture(in_location, in_filePath, in_options, nullptr, out_resource);
+        LoadTexture(in_location, in_filePath, in_options, nullptr, out_resource, nullptr);
     }
     //----------------------------------------------------------------------------
     //----------------------------------------------------------------------------
     void TextureProvider::CreateResourceFromFileAsync(StorageLocation in_location, const std::string& in_filePath, const IResourceOptionsBaseCSPtr& in_options, const ResourceProvider::AsyncLoadDelegate& in_delegate, const ResourceSPtr& out_resource)
     {
-        Application::Get()->GetTaskScheduler()->ScheduleTask(TaskType::k_file, [=](const TaskContext&) noexcept
+        Application::Get()->GetTaskScheduler()->ScheduleTask(TaskType::k_file, [=](const TaskContext& in_taskContext) noexcept
         {
-            LoadTexture(in_location, in_filePath, in_options, in_delegate, out_resource);
+            LoadTexture(in_location, in_filePath, in_options, in_delegate, out_resource, &in_taskContext);
         });
     }
     //----------------------------------------------------------------------------
     //----------------------------------------------------------------------------
-    void TextureProvider::LoadTexture(StorageLocation in_location, const std::string& in_filePath, const IResourceOptionsBaseCSPtr& in_options, const ResourceProvider::AsyncLoadDelegate& in_delegate, const ResourceSPtr& out_resource)
+    void TextureProvider::LoadTexture(StorageLocation in_location, const std::string& in_filePath, const IResourceOptionsBaseCSPtr& in_options, const ResourceProvider::AsyncLoadDelegate& in_delegate, const ResourceSPtr& out_resource, const TaskContext* in_taskContext)
     {
         CS_ASSERT(in_options != nullptr, "Options for texture load cannot be null");
         
@@ -146,7 +194,7 @@ namespace ChilliSource
         imageProvider->CreateResourceFromFile(in_location, in_filePath, nullptr, imageResource);
         ImageSPtr image(std::static_pointer_cast<Image>(imageResource));
         
-        if(image->GetLoadState() == Resource::LoadState::k_failed)
+        if(image->GetLoadState() == Resource::LoadState::k_failed || (in_taskContext != nullptr && in_taskContext->IsCancelled() == true))
         {
             CS_LOG_ERROR("Failed to load image " + in_filePath);
             out_resource->SetLoadState(Resource::LoadState::k_failed);
@@ -165,14 +213,7 @@ namespace ChilliSource
             auto texture = static_cast<Texture*>(out_resource.get());
             auto options = static_cast<const TextureResourceOptions*>(in_options.get());
             
-            TextureDesc desc(Integer2(image->GetWidth(), image->GetHeight()), image->GetFormat(), image->GetCompression());
-            desc.SetFilterMode(options->GetFilterMode());
-            desc.SetWrapModeS(options->GetWrapModeS());
-            desc.SetWrapModeT(options->GetWrapModeT());
-            desc.SetMipmappingEnabled(options->IsMipMapsEnabled());
-            desc.SetTextureDataRestoreEnabled(false);
-
-            texture->Build(Texture::DataUPtr(image->MoveData()), image->GetDataSize(), desc);
+            BuildTexture(image, Texture::DataUPtr(image->MoveData()), options, texture);
             texture->SetLoadState(Resource::LoadState::k_loaded);
         }
         else
@@ -182,14 +223,7 @@ namespace ChilliSource
                 auto texture = static_cast<Texture*>(out_resource.get());
                 auto options = static_cast<const TextureResourceOptions*>(in_options.get());
 
-                TextureDesc desc(Integer2(image->GetWidth(), image->GetHeight()), image->GetFormat(), image->GetCompression());
-                desc.SetFilterMode(options->GetFilterMode());
-                desc.SetWrapModeS(options->GetWrapModeS());
-                desc.SetWrapModeT(options->GetWrapModeT());
-                desc.SetMipmappingEnabled(options->IsMipMapsEnabled());
-                desc.SetTextureDataRestoreEnabled(false);
-
-                texture->Build(Texture::DataUPtr(image->MoveData()), image->GetDataSize(), desc);
+                BuildTexture(image, Texture::DataUPtr(image->MoveData()), options, texture);
                 texture->SetLoadState(Resource::LoadState::k_loaded);
                 in_delegate(out_resource);
             });
@@ -135,8 +135,10 @@ namespace ChilliSource
         /// @param Options to customise the creation
         /// @param Completion delegate
         /// @param [Out] Resource object
+        /// @param The context of the file task the texture is loaded in. The load fails
+        /// if this is cancelled. May be null if loading synchronously.
         //----------------------------------------------------------------------------
-        void LoadTexture(StorageLocation in_location, const std::string& in_filePath, const IResourceOptionsBaseCSPtr& in_options, const ResourceProvider::AsyncLoadDelegate& in_delegate, const ResourceSPtr& out_resource);
+        void LoadTexture(StorageLocation in_location, const std::string& in_filePath, const IResourceOptionsBaseCSPtr& in_options, const ResourceProvider::AsyncLoadDelegate& in_delegate, const ResourceSPtr& out_resource, const TaskContext* in_taskContext);
         
     private:
         
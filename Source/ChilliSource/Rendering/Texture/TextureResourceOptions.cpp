@@ -34,12 +34,13 @@ namespace ChilliSource
 {
     //-------------------------------------------------------
     //-------------------------------------------------------
-    TextureResourceOptions::TextureResourceOptions(bool in_mipmaps, TextureFilterMode in_filter, TextureWrapMode in_wrapS, TextureWrapMode in_wrapT)
+    TextureResourceOptions::TextureResourceOptions(bool in_mipmaps, TextureFilterMode in_filter, TextureWrapMode in_wrapS, TextureWrapMode in_wrapT, bool in_streaming)
     {
         m_options.m_hasMipMaps = in_mipmaps;
         m_options.m_filterMode = in_filter;
         m_options.m_wrapModeS = in_wrapS;
         m_options.m_wrapModeT = in_wrapT;
+        m_options.m_isStreamingEnabled = in_streaming;
     }
     //-------------------------------------------------------
     //-------------------------------------------------------
@@ -71,5 +72,10 @@ namespace ChilliSource
     {
         return m_options.m_filterMode;
     }
+    //-------------------------------------------------------
+    //-------------------------------------------------------
+    bool TextureResourceOptions::IsStreamingEnabled() const
+    {
+        return m_options.m_isStreamingEnabled;
+    }
 }
-
@@ -70,8 +70,14 @@ namespace ChilliSource
         /// are loaded from file as they are always restored from
         /// disk. This will only work for RGBA8888, RGB888, RGBA4444
         /// and RGB565 textures.
+        /// @param Whether or not the texture should be streamed.
+        /// Streamed textures loaded from images with precomputed
+        /// mip levels upload the smallest levels first and fill
+        /// in the larger levels over later frames. This has no
+        /// effect if mip-maps are disabled or the image has no
+        /// precomputed mip levels.
         //-------------------------------------------------------
-        TextureResourceOptions(bool in_mipmaps, TextureFilterMode in_filter, TextureWrapMode in_wrapS, TextureWrapMode in_wrapT);
+        TextureResourceOptions(bool in_mipmaps, TextureFilterMode in_filter, TextureWrapMode in_wrapS, TextureWrapMode in_wrapT, bool in_streaming = false);
         //-------------------------------------------------------
         /// Generate a unique hash based on the
         /// currently set options
@@ -106,6 +112,10 @@ namespace ChilliSource
         /// @return Filter mode to create texture with
         //-------------------------------------------------------
         TextureFilterMode GetFilterMode() const;
+        //-------------------------------------------------------
+        /// @return Whether the texture should be streamed
+        //-------------------------------------------------------
+        bool IsStreamingEnabled() const;
         
     private:
         
@@ -121,6 +131,7 @@ namespace ChilliSource
             TextureWrapMode m_wrapModeT = TextureWrapMode::k_clamp;
             TextureFilterMode m_filterMode = TextureFilterMode::k_bilinear;
             bool m_hasMipMaps = false;
+            bool m_isStreamingEnabled = false;
         };
         
         Options m_options;
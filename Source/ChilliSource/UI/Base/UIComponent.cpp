@@ -35,6 +35,7 @@
 #include <ChilliSource/Core/Math/Vector4.h>
 #include <ChilliSource/Core/String/StringUtils.h>
 #include <ChilliSource/UI/Base/PropertyTypes.h>
+#include <ChilliSource/UI/Base/Widget.h>
 
 namespace ChilliSource
 {
@@ -97,6 +98,15 @@ namespace ChilliSource
     }
     //----------------------------------------------------------------
     //----------------------------------------------------------------
+    void UIComponent::InvalidateRenderCache()
+    {
+        if (m_widget != nullptr)
+        {
+            m_widget->InvalidateRenderCache();
+        }
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
     void UIComponent::SetWidget(Widget* in_widget)
     {
         CS_ASSERT(m_propertyRegistrationComplete == true, "Cannot add component to a widget before property registration is complete.");
@@ -171,6 +171,13 @@ namespace ChilliSource
         //----------------------------------------------------------------
         void ApplyRegisteredProperties(const PropertyMap& in_properties);
         //----------------------------------------------------------------
+        /// Invalidates the render cache of the owning widget hierarchy.
+        /// This should be called whenever something changes which
+        /// affects how the component draws. It is safe to call this
+        /// before the component has been added to a widget.
+        //----------------------------------------------------------------
+        void InvalidateRenderCache();
+        //----------------------------------------------------------------
         /// A method which is called when all components owned by the parent
         /// widget have been created and added. Inheriting classes should use
         /// this for any required initialisation.
@@ -36,12 +36,15 @@
 #include <ChilliSource/Input/Pointer/PointerSystem.h>
 #include <ChilliSource/Rendering/Base/AlignmentAnchors.h>
 #include <ChilliSource/Rendering/Base/AspectRatioUtils.h>
+#include <ChilliSource/Rendering/Base/CanvasRenderCache.h>
 #include <ChilliSource/Rendering/Base/CanvasRenderer.h>
 #include <ChilliSource/UI/Base/PropertyTypes.h>
 #include <ChilliSource/UI/Drawable/UIDrawable.h>
 #include <ChilliSource/UI/Drawable/DrawableUIComponent.h>
 #include <ChilliSource/UI/Layout/LayoutUIComponent.h>
 
+#include <cmath>
+
 namespace ChilliSource
 {
     namespace
@@ -59,6 +62,7 @@ namespace ChilliSource
         const char k_properyNameParentalAnchor[] = "parentalanchor";
         const char k_properyNameVisible[] = "visible";
         const char k_properyNameClipChildren[] = "clipchildren";
+        const char k_properyNameRenderCacheEnabled[] = "rendercacheenabled";
         const char k_properyNameInputEnabled[] = "inputenabled";
         const char k_properyNameInputConsumeEnabled[] = "inputconsumeenabled";
         const char k_properyNameSizePolicy[] = "sizepolicy";
@@ -78,38 +82,12 @@ namespace ChilliSource
             {PropertyTypes::AlignmentAnchor(), k_properyNameParentalAnchor},
             {PropertyTypes::Bool(), k_properyNameVisible},
             {PropertyTypes::Bool(), k_properyNameClipChildren},
+            {PropertyTypes::Bool(), k_properyNameRenderCacheEnabled},
             {PropertyTypes::Bool(), k_properyNameInputEnabled},
             {PropertyTypes::Bool(), k_properyNameInputConsumeEnabled},
             {PropertyTypes::SizePolicy(), k_properyNameSizePolicy},
         };
         
-        //----------------------------------------------------------------------------------------
-        /// Perform a rough check to see if the widget is offscreen
-        ///
-        /// @author S Downie
-        ///
-        /// @param Absolute position
-        /// @param Absolute size
-        /// @param Canvas size
-        ///
-        /// @return Whether the widget is considered offscreen and should be culled
-        //----------------------------------------------------------------------------------------
-        bool ShouldCull(const Vector2& in_absPos, const Vector2& in_absSize, const Vector2& in_canvasSize)
-        {
-            Vector2 halfSize(in_absSize * 0.5f);
-            //Treat it like a square so that we do not need to take rotation into account
-            halfSize.x = std::max(halfSize.x, halfSize.y);
-            halfSize.y = std::max(halfSize.y, halfSize.y);
-            
-            Vector2 bottomLeft = GetAnchorPoint(AlignmentAnchor::k_bottomLeft, halfSize);
-            bottomLeft += in_absPos;
-            
-            Vector2 topRight = GetAnchorPoint(AlignmentAnchor::k_topRight, halfSize);
-            topRight += in_absPos;
-            
-            return (topRight.y < 0 || bottomLeft.y > in_canvasSize.y || topRight.x < 0 || bottomLeft.x > in_canvasSize.x);
-        }
-        
         namespace SizePolicyFuncs
         {
             //----------------------------------------------------------
@@ -263,6 +241,7 @@ namespace ChilliSource
         m_baseProperties.emplace(k_properyNameParentalAnchor, PropertyTypes::AlignmentAnchor()->CreateProperty(MakeDelegate(this, &Widget::GetParentalAnchor), MakeDelegate(this, &Widget::SetParentalAnchor)));
         m_baseProperties.emplace(k_properyNameVisible, PropertyTypes::Bool()->CreateProperty(MakeDelegate(this, &Widget::IsVisible), MakeDelegate(this, &Widget::SetVisible)));
         m_baseProperties.emplace(k_properyNameClipChildren, PropertyTypes::Bool()->CreateProperty(MakeDelegate(this, &Widget::IsClippingEnabled), MakeDelegate(this, &Widget::SetClippingEnabled)));
+        m_baseProperties.emplace(k_properyNameRenderCacheEnabled, PropertyTypes::Bool()->CreateProperty(MakeDelegate(this, &Widget::IsRenderCacheEnabled), MakeDelegate(this, &Widget::SetRenderCacheEnabled)));
         m_baseProperties.emplace(k_properyNameInputEnabled, PropertyTypes::Bool()->CreateProperty(MakeDelegate(this, &Widget::IsInputEnabled), MakeDelegate(this, &Widget::SetInputEnabled)));
         m_baseProperties.emplace(k_properyNameInputConsumeEnabled, PropertyTypes::Bool()->CreateProperty(MakeDelegate(this, &Widget::IsInputConsumeEnabled), MakeDelegate(this, &Widget::SetInputConsumeEnabled)));
         m_baseProperties.emplace(k_properyNameSizePolicy, PropertyTypes::SizePolicy()->CreateProperty(MakeDelegate(this, &Widget::GetSizePolicy), MakeDelegate(this, &Widget::SetSizePolicy)));
@@ -636,6 +615,9 @@ namespace ChilliSource
     void Widget::SetColour(const Colour& in_colour)
     {
         m_localColour = Colour::Clamp(in_colour);
+        
+        InvalidateRenderCache();
+        InvalidateDescendantRenderCaches();
     }
     //----------------------------------------------------------------------------------------
     //----------------------------------------------------------------------------------------
@@ -648,6 +630,9 @@ namespace ChilliSource
     void Widget::SetVisible(bool in_visible)
     {
         m_isVisible = in_visible;
+        
+        InvalidateRenderCache();
+        InvalidateHierarchyBounds();
     }
     //----------------------------------------------------------------------------------------
     //----------------------------------------------------------------------------------------
@@ -660,6 +645,10 @@ namespace ChilliSource
     void Widget::SetClippingEnabled(bool in_enabled)
     {
         m_isSubviewClippingEnabled = in_enabled;
+        
+        InvalidateRenderCache();
+        InvalidateDescendantRenderCaches();
+        InvalidateHierarchyBounds();
     }
     //----------------------------------------------------------------------------------------
     //----------------------------------------------------------------------------------------
@@ -669,6 +658,33 @@ namespace ChilliSource
     }
     //----------------------------------------------------------------------------------------
     //----------------------------------------------------------------------------------------
+    void Widget::SetRenderCacheEnabled(bool in_enabled)
+    {
+        m_isRenderCacheEnabled = in_enabled;
+        m_isRenderCacheValid = false;
+        
+        if (m_isRenderCacheEnabled == false)
+        {
+            m_renderCache.reset();
+        }
+    }
+    //----------------------------------------------------------------------------------------
+    //----------------------------------------------------------------------------------------
+    bool Widget::IsRenderCacheEnabled() const
+    {
+        return m_isRenderCacheEnabled;
+    }
+    //----------------------------------------------------------------------------------------
+    //----------------------------------------------------------------------------------------
+    void Widget::InvalidateRenderCache()
+    {
+        for (auto widget = this; widget != nullptr; widget = widget->m_parent)
+        {
+            widget->m_isRenderCacheValid = false;
+        }
+    }
+    //----------------------------------------------------------------------------------------
+    //----------------------------------------------------------------------------------------
     void Widget::SetInputEnabled(bool in_input)
     {
         bool wasEnabled = m_isInputEnabled;
@@ -720,6 +736,9 @@ namespace ChilliSource
         {
             in_widget->SetCanvas(m_canvas);
         }
+        
+        InvalidateRenderCache();
+        InvalidateHierarchyBounds();
     }
     //----------------------------------------------------------------------------------------
     //----------------------------------------------------------------------------------------
@@ -738,6 +757,9 @@ namespace ChilliSource
                 
                 (*it)->m_parent = nullptr;
                 m_children.erase(it);
+                
+                InvalidateRenderCache();
+                InvalidateHierarchyBounds();
                 return;
             }
         }
@@ -920,6 +942,8 @@ namespace ChilliSource
     {
         CS_ASSERT(m_parent != nullptr, "Widget has no parent to rearrange from");
         
+        m_parent->InvalidateRenderCache();
+        
         s32 length = static_cast<s32>(m_parent->m_children.size()) - 1;
         for(s32 i=0; i<length; ++i)
         {
@@ -935,6 +959,8 @@ namespace ChilliSource
     {
         CS_ASSERT(m_parent != nullptr, "Widget has no parent to rearrange from");
         
+        m_parent->InvalidateRenderCache();
+        
         s32 length = static_cast<s32>(m_parent->m_children.size()) - 1;
         for(s32 i=0; i<length; ++i)
         {
@@ -951,6 +977,8 @@ namespace ChilliSource
     {
         CS_ASSERT(m_parent != nullptr, "Widget has no parent to rearrange from");
         
+        m_parent->InvalidateRenderCache();
+        
         auto length = m_parent->m_children.size();
         for(std::size_t i = 1; i < length; ++i)
         {
@@ -967,6 +995,8 @@ namespace ChilliSource
     {
         CS_ASSERT(m_parent != nullptr, "Widget has no parent to rearrange from");
         
+        m_parent->InvalidateRenderCache();
+        
         auto length = m_parent->m_children.size();
         for(std::size_t i = 1; i < length; ++i)
         {
@@ -1393,6 +1423,7 @@ namespace ChilliSource
     {
         m_isParentTransformCacheValid = false;
         m_isParentSizeCacheValid = false;
+        m_isRenderCacheValid = false;
         
         ForceLayout();
     }
@@ -1478,9 +1509,46 @@ namespace ChilliSource
             return;
         }
         
+        //skip the entire hierarchy if none of it can be seen.
+        Vector2 hierarchyBottomLeft, hierarchyTopRight;
+        GetHierarchyBounds(hierarchyBottomLeft, hierarchyTopRight);
+        if (in_renderer->IsWithinClipBounds(hierarchyBottomLeft, hierarchyTopRight - hierarchyBottomLeft) == false)
+        {
+            return;
+        }
+        
+        //nested caches are recorded as part of the outer-most cache.
+        if (m_isRenderCacheEnabled == false || in_renderer->IsRecordingRenderCache() == true)
+        {
+            DrawHierarchy(in_renderer);
+            return;
+        }
+        
+        if (m_isRenderCacheValid == false)
+        {
+            if (m_renderCache == nullptr)
+            {
+                m_renderCache = CanvasRenderCacheUPtr(new CanvasRenderCache());
+            }
+            
+            in_renderer->BeginRenderCache(m_renderCache.get());
+            DrawHierarchy(in_renderer);
+            in_renderer->EndRenderCache();
+            
+            m_isRenderCacheValid = true;
+        }
+        
+        in_renderer->DrawRenderCache(*m_renderCache);
+    }
+    //----------------------------------------------------------------------------------------
+    //----------------------------------------------------------------------------------------
+    void Widget::DrawHierarchy(CanvasRenderer* in_renderer)
+    {
         Vector2 finalSize(GetFinalSize());
         
-        if (ShouldCull(GetFinalPositionOfCentre(), finalSize, m_screen->GetResolution()) == false)
+        Vector2 bottomLeft, topRight;
+        GetFinalBounds(bottomLeft, topRight);
+        if (in_renderer->IsWithinClipBounds(bottomLeft, topRight - bottomLeft) == true)
         {
             for (auto& component : m_components)
             {
@@ -1517,6 +1585,85 @@ namespace ChilliSource
     }
     //----------------------------------------------------------------------------------------
     //----------------------------------------------------------------------------------------
+    void Widget::GetFinalBounds(Vector2& out_bottomLeft, Vector2& out_topRight) const
+    {
+        Matrix3 finalTransform = GetFinalTransform();
+        Vector2 halfSize = 0.5f * GetFinalSize();
+        
+        //the final transform contains no scale, so this is the exact axis aligned bounds of the rotated widget.
+        Vector2 halfExtents(std::abs(finalTransform.m[0]) * halfSize.x + std::abs(finalTransform.m[3]) * halfSize.y, std::abs(finalTransform.m[1]) * halfSize.x + std::abs(finalTransform.m[4]) * halfSize.y);
+        Vector2 centre(finalTransform.m[6], finalTransform.m[7]);
+        
+        out_bottomLeft = centre - halfExtents;
+        out_topRight = centre + halfExtents;
+    }
+    //----------------------------------------------------------------------------------------
+    //----------------------------------------------------------------------------------------
+    void Widget::GetHierarchyBounds(Vector2& out_bottomLeft, Vector2& out_topRight) const
+    {
+        if (m_isHierarchyBoundsCacheValid == false)
+        {
+            GetFinalBounds(m_cachedHierarchyBottomLeft, m_cachedHierarchyTopRight);
+            
+            //children of a clipping widget cannot be drawn outside of it.
+            if (m_isSubviewClippingEnabled == false)
+            {
+                Vector2 childBottomLeft, childTopRight;
+                
+                for(const auto& child : m_internalChildren)
+                {
+                    if (child->IsVisible() == true)
+                    {
+                        child->GetHierarchyBounds(childBottomLeft, childTopRight);
+                        m_cachedHierarchyBottomLeft = Vector2::Min(m_cachedHierarchyBottomLeft, childBottomLeft);
+                        m_cachedHierarchyTopRight = Vector2::Max(m_cachedHierarchyTopRight, childTopRight);
+                    }
+                }
+                
+                for(const auto& child : m_children)
+                {
+                    if (child->IsVisible() == true)
+                    {
+                        child->GetHierarchyBounds(childBottomLeft, childTopRight);
+                        m_cachedHierarchyBottomLeft = Vector2::Min(m_cachedHierarchyBottomLeft, childBottomLeft);
+                        m_cachedHierarchyTopRight = Vector2::Max(m_cachedHierarchyTopRight, childTopRight);
+                    }
+                }
+            }
+            
+            m_isHierarchyBoundsCacheValid = true;
+        }
+        
+        out_bottomLeft = m_cachedHierarchyBottomLeft;
+        out_topRight = m_cachedHierarchyTopRight;
+    }
+    //----------------------------------------------------------------------------------------
+    //----------------------------------------------------------------------------------------
+    void Widget::InvalidateHierarchyBounds()
+    {
+        for (auto widget = this; widget != nullptr; widget = widget->m_parent)
+        {
+            widget->m_isHierarchyBoundsCacheValid = false;
+        }
+    }
+    //----------------------------------------------------------------------------------------
+    //----------------------------------------------------------------------------------------
+    void Widget::InvalidateDescendantRenderCaches()
+    {
+        for(auto& child : m_internalChildren)
+        {
+            child->m_isRenderCacheValid = false;
+            child->InvalidateDescendantRenderCaches();
+        }
+        
+        for(auto& child : m_children)
+        {
+            child->m_isRenderCacheValid = false;
+            child->InvalidateDescendantRenderCaches();
+        }
+    }
+    //----------------------------------------------------------------------------------------
+    //----------------------------------------------------------------------------------------
     void Widget::OnBackground()
     {
         m_children.lock();
@@ -1574,6 +1721,8 @@ namespace ChilliSource
     {
         m_isLocalTransformCacheValid = false;
         m_isLocalSizeCacheValid = false;
+        InvalidateRenderCache();
+        InvalidateHierarchyBounds();
         
         if(m_canvas != nullptr)
         {
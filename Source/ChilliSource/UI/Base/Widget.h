@@ -476,6 +476,33 @@ namespace ChilliSource
         //----------------------------------------------------------------------------------------
         bool IsClippingEnabled() const;
         //----------------------------------------------------------------------------------------
+        /// Sets whether the widget hierarchy from here down is rendered in retained mode. When
+        /// enabled, the hierarchy is recorded into a cache of pre-transformed sprite batches the
+        /// first time it is drawn, and the cached batches are re-submitted in subsequent frames
+        /// until something in the hierarchy changes. This is well suited to large, mostly static
+        /// hierarchies such as menus containing a lot of text.
+        ///
+        /// The cache is invalidated automatically whenever the layout, colour, visibility or
+        /// children of a widget in the hierarchy change, or a built-in component changes how it
+        /// draws. Nested widgets with the render cache enabled are recorded as part of the
+        /// outer-most cache.
+        ///
+        /// @param Whether or not the render cache is enabled.
+        //----------------------------------------------------------------------------------------
+        void SetRenderCacheEnabled(bool in_enabled);
+        //----------------------------------------------------------------------------------------
+        /// @return Whether or not the widget hierarchy from here down is rendered in retained
+        /// mode.
+        //----------------------------------------------------------------------------------------
+        bool IsRenderCacheEnabled() const;
+        //----------------------------------------------------------------------------------------
+        /// Invalidates the render cache of this widget and of all of its ancestors, ensuring the
+        /// hierarchy is re-recorded the next time it is drawn. This is called automatically by
+        /// the widget and the built-in components; custom components should call it whenever
+        /// something changes which affects how they draw.
+        //----------------------------------------------------------------------------------------
+        void InvalidateRenderCache();
+        //----------------------------------------------------------------------------------------
         /// @author S Downie
         ///
         /// @param Whether the widget should accept and respond to user input
@@ -1151,6 +1178,41 @@ namespace ChilliSource
         //----------------------------------------------------------------------------------------
         void OnDraw(CanvasRenderer* in_renderer);
         //----------------------------------------------------------------------------------------
+        /// Tells any components or child widgets to draw, ignoring the render cache of this
+        /// widget.
+        ///
+        /// @param Canvas renderer
+        //----------------------------------------------------------------------------------------
+        void DrawHierarchy(CanvasRenderer* in_renderer);
+        //----------------------------------------------------------------------------------------
+        /// Invalidates the render cache of all widgets below this one in the hierarchy. This is
+        /// used when a change to this widget affects how its descendants draw, such as a change
+        /// in colour.
+        //----------------------------------------------------------------------------------------
+        void InvalidateDescendantRenderCaches();
+        //----------------------------------------------------------------------------------------
+        /// Calculates the screen space axis aligned bounds of this widget, taking into account
+        /// rotation.
+        ///
+        /// @param [Out] The bottom left of the bounds.
+        /// @param [Out] The top right of the bounds.
+        //----------------------------------------------------------------------------------------
+        void GetFinalBounds(Vector2& out_bottomLeft, Vector2& out_topRight) const;
+        //----------------------------------------------------------------------------------------
+        /// Calculates the screen space axis aligned bounds of this widget and all of its visible
+        /// descendants. Descendants of a widget which clips its children are not included as
+        /// they cannot be drawn outside of it. The result is cached until the layout, visibility
+        /// or children of a widget in the hierarchy changes.
+        ///
+        /// @param [Out] The bottom left of the bounds.
+        /// @param [Out] The top right of the bounds.
+        //----------------------------------------------------------------------------------------
+        void GetHierarchyBounds(Vector2& out_bottomLeft, Vector2& out_topRight) const;
+        //----------------------------------------------------------------------------------------
+        /// Invalidates the cached hierarchy bounds of this widget and all of its ancestors.
+        //----------------------------------------------------------------------------------------
+        void InvalidateHierarchyBounds();
+        //----------------------------------------------------------------------------------------
         /// Backgrounds the widget, its components and its children. This is called when the widget
         /// is removed from the canvas and every time the state that owns the canvas is backgrounded
         /// while the widget is attached.
@@ -1244,6 +1306,8 @@ namespace ChilliSource
         mutable Matrix3 m_cachedFinalTransform;
         mutable Vector2 m_cachedFinalPosition;
         mutable Vector2 m_cachedFinalSize;
+        mutable Vector2 m_cachedHierarchyBottomLeft;
+        mutable Vector2 m_cachedHierarchyTopRight;
         
         SizePolicy m_sizePolicy = SizePolicy::k_none;
         SizePolicyDelegate m_sizePolicyDelegate;
@@ -1257,6 +1321,8 @@ namespace ChilliSource
 
         LayoutUIComponent* m_layoutComponent = nullptr;
         
+        CanvasRenderCacheUPtr m_renderCache;
+        
         Widget* m_parent = nullptr;
         const Widget* m_canvas = nullptr;
         
@@ -1268,11 +1334,14 @@ namespace ChilliSource
         bool m_isSubviewClippingEnabled = false;
         bool m_isInputEnabled = true;
         bool m_isInputConsumeEnabled = false;
+        bool m_isRenderCacheEnabled = false;
+        bool m_isRenderCacheValid = false;
         
         mutable bool m_isParentTransformCacheValid = false;
         mutable bool m_isLocalTransformCacheValid = false;
         mutable bool m_isLocalSizeCacheValid = false;
         mutable bool m_isParentSizeCacheValid = false;
+        mutable bool m_isHierarchyBoundsCacheValid = false;
 
         Screen* m_screen = nullptr;
         PointerSystem* m_pointerSystem = nullptr;
@@ -70,6 +70,9 @@ namespace ChilliSource
     //-------------------------------------------------------------------
     UIDrawable* DrawableUIComponent::GetDrawable()
     {
+        //the drawable may be changed through the returned pointer, so the render cache can no longer be trusted.
+        InvalidateRenderCache();
+        
         return m_drawable.get();
     }
     //-------------------------------------------------------------------
@@ -89,6 +92,8 @@ namespace ChilliSource
         {
             m_drawable = m_drawableDef->CreateDrawable();
         }
+        
+        InvalidateRenderCache();
     }
     //-------------------------------------------------------------------
     //-------------------------------------------------------------------
@@ -84,7 +84,9 @@ namespace ChilliSource
         ///
         /// @return The drawable object that performs the rendering. This
         /// can be used to directly change properties such as the UVs and
-        /// colour of the rendered image.
+        /// colour of the rendered image. As the drawable may be changed,
+        /// this invalidates the render cache of the owning widget; the
+        /// const version should be used for read-only access.
         //-------------------------------------------------------------------
         UIDrawable* GetDrawable();
         //-------------------------------------------------------------------
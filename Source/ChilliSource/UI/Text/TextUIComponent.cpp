@@ -222,6 +222,7 @@ namespace ChilliSource
         m_font = in_font;
         
         m_invalidateCache = true;
+        InvalidateRenderCache();
     }
     //------------------------------------------------------------------------------
     //------------------------------------------------------------------------------
@@ -247,6 +248,7 @@ namespace ChilliSource
         }
         
         m_invalidateCache = true;
+        InvalidateRenderCache();
     }
     //------------------------------------------------------------------------------
     //------------------------------------------------------------------------------
@@ -265,6 +267,7 @@ namespace ChilliSource
         }
         
         m_invalidateCache = true;
+        InvalidateRenderCache();
     }
     //------------------------------------------------------------------------------
     //------------------------------------------------------------------------------
@@ -275,6 +278,7 @@ namespace ChilliSource
         ReplaceVariables(m_localisedText->GetText(in_localisedTextId), in_params, in_imageData);
         
         m_invalidateCache = true;
+        InvalidateRenderCache();
     }
     //------------------------------------------------------------------------------
     //------------------------------------------------------------------------------
@@ -284,6 +288,7 @@ namespace ChilliSource
         m_text = in_text;
         
         m_invalidateCache = true;
+        InvalidateRenderCache();
     }
     //------------------------------------------------------------------------------
     //------------------------------------------------------------------------------
@@ -292,12 +297,15 @@ namespace ChilliSource
         ReplaceVariables(in_text, {}, in_imageData);
         
         m_invalidateCache = true;
+        InvalidateRenderCache();
     }
     //------------------------------------------------------------------------------
     //------------------------------------------------------------------------------
     void TextUIComponent::SetTextColour(const Colour& in_textColour)
     {
         m_textColour = in_textColour;
+        
+        InvalidateRenderCache();
     }
     //------------------------------------------------------------------------------
     //------------------------------------------------------------------------------
@@ -306,6 +314,7 @@ namespace ChilliSource
         m_textProperties.m_horizontalJustification = in_horizontalJustification;
         
         m_invalidateCache = true;
+        InvalidateRenderCache();
     }
     //------------------------------------------------------------------------------
     //------------------------------------------------------------------------------
@@ -314,6 +323,7 @@ namespace ChilliSource
         m_textProperties.m_verticalJustification = in_verticalJustification;
         
         m_invalidateCache = true;
+        InvalidateRenderCache();
     }
     //------------------------------------------------------------------------------
     //------------------------------------------------------------------------------
@@ -322,6 +332,7 @@ namespace ChilliSource
         m_textProperties.m_absCharSpacingOffset = in_offset;
         
         m_invalidateCache = true;
+        InvalidateRenderCache();
     }
     //------------------------------------------------------------------------------
     //------------------------------------------------------------------------------
@@ -330,6 +341,7 @@ namespace ChilliSource
         m_textProperties.m_absLineSpacingOffset = in_offset;
         
         m_invalidateCache = true;
+        InvalidateRenderCache();
     }
     //------------------------------------------------------------------------------
     //------------------------------------------------------------------------------
@@ -338,6 +350,7 @@ namespace ChilliSource
         m_textProperties.m_lineSpacingScale = in_scale;
         
         m_invalidateCache = true;
+        InvalidateRenderCache();
     }
     //------------------------------------------------------------------------------
     //------------------------------------------------------------------------------
@@ -348,6 +361,7 @@ namespace ChilliSource
         m_textProperties.m_maxNumLines = in_numLines;
         
         m_invalidateCache = true;
+        InvalidateRenderCache();
     }
     //------------------------------------------------------------------------------
     //------------------------------------------------------------------------------
@@ -356,6 +370,7 @@ namespace ChilliSource
         m_textProperties.m_textScale = in_scale;
         
         m_invalidateCache = true;
+        InvalidateRenderCache();
     }
     //------------------------------------------------------------------------------
     //------------------------------------------------------------------------------
@@ -364,6 +379,7 @@ namespace ChilliSource
         m_textProperties.m_minTextScale = in_scale;
         
         m_invalidateCache = true;
+        InvalidateRenderCache();
     }
     //------------------------------------------------------------------------------
     //------------------------------------------------------------------------------
@@ -372,6 +388,7 @@ namespace ChilliSource
         m_textProperties.m_shouldAutoScale = in_enable;
         
         m_invalidateCache = true;
+        InvalidateRenderCache();
     }
     //------------------------------------------------------------------------------
     //------------------------------------------------------------------------------
@@ -504,10 +521,20 @@ namespace ChilliSource
             f32 textScale = 1.0f;
             m_cachedText = in_renderer->BuildText(m_text, m_font, in_absSize, m_textProperties, textScale);
             m_cachedIcons = BuildIcons(m_font, m_cachedText, m_iconIndices, textScale);
+            m_isTextMeshValid = false;
+        }
+        
+        // Draw text. The text is built into a single mesh which is retained until the text or its colour changes.
+        Colour textColour = m_textColour * GetWidget()->GetFinalColour();
+        if (m_isTextMeshValid == false || m_textMeshColour != textColour)
+        {
+            m_isTextMeshValid = true;
+            m_textMeshColour = textColour;
+            
+            in_renderer->BuildTextMesh(m_cachedText.m_characters, textColour, m_font->GetTexture(), &m_textMesh);
         }
         
-        // Draw text
-        in_renderer->DrawText(m_cachedText.m_characters, in_transform, m_textColour * GetWidget()->GetFinalColour(), m_font->GetTexture());
+        in_renderer->DrawText(m_textMesh, in_transform);
         
         // Draw images
         for(const auto& iconData : m_cachedIcons)
@@ -33,6 +33,7 @@
 #include <ChilliSource/Core/Base/Colour.h>
 #include <ChilliSource/Core/Container/Property/PropertyMap.h>
 #include <ChilliSource/Core/String/StringMarkupParser.h>
+#include <ChilliSource/Rendering/Base/CanvasRenderCache.h>
 #include <ChilliSource/Rendering/Base/CanvasRenderer.h>
 #include <ChilliSource/Rendering/Base/HorizontalTextJustification.h>
 #include <ChilliSource/Rendering/Base/VerticalTextJustification.h>
@@ -498,6 +499,10 @@ namespace ChilliSource
         CanvasRenderer::BuiltText m_cachedText;
         std::vector<TextIconCachedData> m_cachedIcons;
         
+        bool m_isTextMeshValid = false;
+        Colour m_textMeshColour;
+        CanvasRenderCache m_textMesh;
+        
         StringMarkupParser m_markupParser;
     };
 }